@@ -129,6 +129,7 @@ private:
   Frozen_Visc_Disc,         /*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
   Frozen_Limiter_Disc,      /*!< \brief Flag for disc. adjoint problem with/without frozen limiter. */
   Inconsistent_Disc,        /*!< \brief Use an inconsistent (primal/dual) discrete adjoint formulation. */
+  DiscAdj_Residual_Krylov,  /*!< \brief Record only the residual and solve the disc. adjoint with a Krylov method. */
   Sens_Remove_Sharp,        /*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
   Hold_GridFixed,           /*!< \brief Flag hold fixed some part of the mesh during the deformation. */
   Axisymmetric,             /*!< \brief Flag for axisymmetric calculations */
@@ -406,6 +407,7 @@ private:
   su2double PhysicalTime;           /*!< \brief Physical time at the current iteration in the solver for unsteady problems. */
 
   unsigned short nLevels_TimeAccurateLTS;   /*!< \brief Number of time levels for time accurate local time stepping. */
+  unsigned short nLevels_Multirate;         /*!< \brief Number of time levels of the multirate explicit integration (FVM). */
   unsigned short nTimeDOFsADER_DG;          /*!< \brief Number of time DOFs used in the predictor step of ADER-DG. */
   su2double *TimeDOFsADER_DG;               /*!< \brief The location of the ADER-DG time DOFs on the interval [-1,1]. */
   unsigned short nTimeIntegrationADER_DG;   /*!< \brief Number of time integration points ADER-DG. */
@@ -419,6 +421,11 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  bool NewtonKrylovAdapt;      /*!< \brief Use the adaptive controller of the Newton-Krylov method. */
+  bool ActiveSet;              /*!< \brief Only compute the fluxes of the points that are not converged. */
+  su2double ActiveSet_Threshold; /*!< \brief Orders of magnitude below the RMS residual for a point to be frozen. */
+  unsigned long ActiveSet_Freq;  /*!< \brief Frequency of the full sweeps that update the active set. */
+  array<su2double,6> NK_AdaptParam{{0.9, 2.0, 0.5, 1.0, 2.0, 20.0}}; /*!< \brief Parameters of the adaptive NK controller. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -450,6 +457,9 @@ private:
   string *TagFFDBox;                  /*!< \brief Tag of the FFD box. */
   unsigned short GeometryMode;        /*!< \brief Gemoetry mode (analysis or gradient computation). */
   unsigned short MGCycle;             /*!< \brief Kind of multigrid cycle. */
+  unsigned short Kind_MG_Coarse_Smoother; /*!< \brief Smoother of the implicit system on the coarse levels. */
+  unsigned short MG_Coarse_Smoother_Iter; /*!< \brief Number of sweeps of the coarse level smoother. */
+  unsigned long MG_Agglomeration_BlockSize; /*!< \brief Size of the blocks of points agglomerated concurrently (0 for serial). */
   unsigned short FinestMesh;          /*!< \brief Finest mesh for the full multigrid approach. */
   unsigned short nFFD_Fix_IDir,
   nFFD_Fix_JDir, nFFD_Fix_KDir;       /*!< \brief Number of planes fixed in the FFD. */
@@ -540,9 +550,14 @@ private:
   MUSCL_AdjFlow,           /*!< \brief MUSCL scheme for the adj flow equations.*/
   MUSCL_AdjTurb,           /*!< \brief MUSCL scheme for the adj turbulence equations.*/
   Use_Accurate_Jacobians;  /*!< \brief Use numerically computed Jacobians for AUSM+up(2) and SLAU(2). */
+  bool Fused_Gradient_Limiter;  /*!< \brief Compute the reconstruction gradients and limiters of the flow in one pass. */
+  bool MUSCL_Single_Precision;  /*!< \brief Store the limited reconstruction gradients of the flow in single precision. */
   bool EulerPersson;       /*!< \brief Boolean to determine whether this is an Euler simulation with Persson shock capturing. */
   bool FSI_Problem = false,/*!< \brief Boolean to determine whether the simulation is FSI or not. */
   Multizone_Problem;       /*!< \brief Boolean to determine whether we are solving a multizone problem. */
+  bool Concurrent_Zones;   /*!< \brief Iterate the zones concurrently on disjoint groups of ranks. */
+  unsigned short nZone_Rank_Weights; /*!< \brief Number of zone weights for the distribution of ranks. */
+  su2double *Zone_Rank_Weights;      /*!< \brief Relative cost of each zone for the distribution of ranks. */
   unsigned short nID_DV;   /*!< \brief ID for the region of FEM when computed using direct differentiation. */
 
   bool AD_Mode;             /*!< \brief Algorithmic Differentiation support. */
@@ -754,11 +769,14 @@ private:
   SurfCoeff_FileName,            /*!< \brief Output file with the flow variables on the surface. */
   SurfAdjCoeff_FileName,         /*!< \brief Output file with the adjoint variables on the surface. */
   SurfSens_FileName,             /*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
-  VolSens_FileName;              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
+  VolSens_FileName,              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
+  Profiling_FileName;            /*!< \brief Output file for the profiling summary and trace. */
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
+  Wrt_Profiling,             /*!< \brief Profile the solver and write the timings at the end of a calculation.  */
+  Wrt_Profiling_Trace,       /*!< \brief Write the profiled events in Chrome trace format.  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
   Plot_Section_Forces;       /*!< \brief Write sectional forces for specified markers. */
@@ -972,6 +990,8 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  bool Geometry_Cache;              /*!< \brief Store/load preprocessing results in/from a geometry cache file. */
+  string Geometry_Cache_FileName;   /*!< \brief Base name of the geometry cache file. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1129,9 +1149,18 @@ private:
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
   monoatomic;                               /*!< \brief Flag for monoatomic mixture. */
+  unsigned short Kind_ChemistryIntegration, /*!< \brief Time integration of the chemical and vibrational sources. */
+  nChemistry_MaxSubsteps;                   /*!< \brief Maximum number of substeps of the split chemistry integration. */
   string GasModel,                          /*!< \brief Gas Model. */
   *Wall_Catalytic;                          /*!< \brief Pointer to catalytic walls. */
 
+  /* look-up table fluid model options */
+  unsigned short Kind_LUT_BaseModel;        /*!< \brief Fluid model used to generate the look-up table. */
+  string LUT_FileName;                      /*!< \brief CSV file with the look-up table (NONE to generate it). */
+  array<su2double,2> LUT_DensityRange{{0.1, 100.0}};      /*!< \brief Density range of the generated table. */
+  array<su2double,2> LUT_TemperatureRange{{200.0, 600.0}}; /*!< \brief Temperature range of the generated table. */
+  array<unsigned short,2> LUT_Size{{200, 200}};           /*!< \brief Number of density and energy points of the generated table. */
+
   /*!
    * \brief Set the default values of config options not set in the config file using another config object.
    * \param config - Config object to use the default values from.
@@ -1344,6 +1373,15 @@ public:
    */
   static unsigned short GetnDim(string val_mesh_filename, unsigned short val_format);
 
+  /*!
+   * \brief Gets the number of elements of a zone in the mesh file (read from the header only).
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[in] val_format - Format of the file with the grid information.
+   * \param[in] val_iZone - Index of the zone.
+   * \return Number of elements of the zone, 0 if it cannot be determined.
+   */
+  static unsigned long GetnElem(string val_mesh_filename, unsigned short val_format, unsigned short val_iZone);
+
   /*!
    * \brief Initializes pointers to null
    */
@@ -2763,6 +2801,12 @@ public:
    */
   void SetnLevels_TimeAccurateLTS(unsigned short val_nLevels) { nLevels_TimeAccurateLTS = val_nLevels;}
 
+  /*!
+   * \brief Get the number of time levels of the multirate explicit time integration of the FVM flow solvers.
+   * \return Number of time levels, 1 if the multirate integration is not used.
+   */
+  unsigned short GetnLevels_Multirate(void) const { return nLevels_Multirate; }
+
   /*!
    * \brief Get the number time DOFs for ADER-DG.
    * \return Number of time DOFs used in ADER-DG.
@@ -3033,6 +3077,24 @@ public:
    */
   bool GetWrt_AD_Statistics(void) const { return Wrt_AD_Statistics; }
 
+  /*!
+   * \brief Get information about profiling the solver.
+   * \return <code>TRUE</code> means that the profiling summary will be written at the end of a calculation.
+   */
+  bool GetWrt_Profiling(void) const { return Wrt_Profiling; }
+
+  /*!
+   * \brief Get information about writing the profiled events in Chrome trace format.
+   * \return <code>TRUE</code> means that the trace will be written at the end of a calculation.
+   */
+  bool GetWrt_Profiling_Trace(void) const { return Wrt_Profiling_Trace; }
+
+  /*!
+   * \brief Get the name of the file for the profiling summary and trace.
+   * \return Name of the file (without extension).
+   */
+  string GetProfiling_FileName(void) const { return Profiling_FileName; }
+
   /*!
    * \brief Get information about writing the mesh quality metrics to the visualization files.
    * \return <code>TRUE</code> means that the mesh quality metrics will be written to the visualization files.
@@ -3468,6 +3530,23 @@ public:
     return MG_CorrecSmooth[val_mesh];
   }
 
+  /*!
+   * \brief Get the smoother of the implicit system on the coarse multigrid levels.
+   * \return NONE if the coarse levels use the linear solver of the fine level.
+   */
+  unsigned short GetKind_MG_Coarse_Smoother(void) const { return Kind_MG_Coarse_Smoother; }
+
+  /*!
+   * \brief Get the number of sweeps of the coarse level smoother.
+   */
+  unsigned short GetMG_Coarse_Smoother_Iter(void) const { return MG_Coarse_Smoother_Iter; }
+
+  /*!
+   * \brief Get the size of the blocks of points that are agglomerated concurrently.
+   * \return 0 if the whole domain is agglomerated serially.
+   */
+  unsigned long GetMG_Agglomeration_BlockSize(void) const { return MG_Agglomeration_BlockSize; }
+
   /*!
    * \brief plane of the FFD (I axis) that should be fixed.
    * \param[in] val_index - Index of the arrray with all the planes in the I direction that should be fixed.
@@ -3681,6 +3760,31 @@ public:
    */
   su2double GetAcentric_Factor(void) const { return Acentric_Factor; }
 
+  /*!
+   * \brief Get the fluid model used to generate the look-up table of LUT_GAS.
+   */
+  unsigned short GetKind_LUT_BaseModel(void) const { return Kind_LUT_BaseModel; }
+
+  /*!
+   * \brief Get the name of the CSV file with the look-up table of LUT_GAS ("NONE" to generate it).
+   */
+  const string& GetLUT_FileName(void) const { return LUT_FileName; }
+
+  /*!
+   * \brief Get the density range (min, max) of the generated look-up table.
+   */
+  const array<su2double,2>& GetLUT_DensityRange(void) const { return LUT_DensityRange; }
+
+  /*!
+   * \brief Get the temperature range (min, max) of the generated look-up table.
+   */
+  const array<su2double,2>& GetLUT_TemperatureRange(void) const { return LUT_TemperatureRange; }
+
+  /*!
+   * \brief Get the number of density and energy points of the generated look-up table.
+   */
+  const array<unsigned short,2>& GetLUT_Size(void) const { return LUT_Size; }
+
   /*!
    * \brief Get the value of the viscosity model.
    * \return Viscosity model.
@@ -3902,6 +4006,16 @@ public:
    */
   unsigned short GetKind_Linear_Solver_Prec(void) const { return Kind_Linear_Solver_Prec; }
 
+  /*!
+   * \brief Get the kind of preconditioner for the implicit solver of a multigrid level of the flow.
+   * \param[in] val_mesh - Index of the grid.
+   * \return The fine level preconditioner, or that of the coarse level smoother.
+   */
+  unsigned short GetKind_Linear_Solver_Prec(unsigned short val_mesh) const {
+    if ((val_mesh == MESH_0) || (Kind_MG_Coarse_Smoother == MG_SMOOTHER_NONE)) return Kind_Linear_Solver_Prec;
+    return (Kind_MG_Coarse_Smoother == MG_SMOOTHER_LINELET)? LINELET : JACOBI;
+  }
+
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -3998,6 +4112,31 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get whether to use the adaptive controller of the Newton-Krylov method.
+   */
+  bool GetNewtonKrylovAdapt(void) const { return NewtonKrylovAdapt; }
+
+  /*!
+   * \brief Get the parameters of the adaptive Newton-Krylov controller.
+   */
+  array<su2double,6> GetNewtonKrylovAdaptParam(void) const { return NK_AdaptParam; }
+
+  /*!
+   * \brief Get whether to only compute the fluxes of the points that are not converged (active set).
+   */
+  bool GetActiveSet(void) const { return ActiveSet; }
+
+  /*!
+   * \brief Get the threshold to freeze points, orders of magnitude below the RMS residual.
+   */
+  su2double GetActiveSet_Threshold(void) const { return ActiveSet_Threshold; }
+
+  /*!
+   * \brief Get the frequency of the full sweeps, which update the active set.
+   */
+  unsigned long GetActiveSet_Frequency(void) const { return ActiveSet_Freq; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -4034,6 +4173,13 @@ public:
    */
   unsigned short GetKind_DiscAdj_Linear_Prec(void) const { return Kind_DiscAdj_Linear_Prec; }
 
+  /*!
+   * \brief Check if the discrete adjoint is computed by recording only the residual, R(U,X), and
+   *        solving the adjoint system with a Krylov method (instead of the fixed-point iteration).
+   * \return <code>TRUE</code> if the residual-based adjoint mode is used.
+   */
+  bool GetDiscAdj_Residual_Krylov(void) const { return DiscAdj_Residual_Krylov; }
+
   /*!
    * \brief Get the kind of preconditioner for the implicit solver.
    * \return Numerical preconditioner for implicit formulation (solving the linear system).
@@ -4224,6 +4370,16 @@ public:
    */
   bool GetMUSCL_Flow(void) const { return MUSCL_Flow; }
 
+  /*!
+   * \brief Get if the reconstruction gradients and limiters of the flow are computed in one pass.
+   */
+  bool GetFused_Gradient_Limiter(void) const { return Fused_Gradient_Limiter; }
+
+  /*!
+   * \brief Get if the limited reconstruction gradients of the flow are stored in single precision.
+   */
+  bool GetMUSCL_Single_Precision(void) const { return MUSCL_Single_Precision; }
+
   /*!
    * \brief Get if the upwind scheme used MUSCL or not.
    * \note This is the information that the code will use, the method will
@@ -5116,6 +5272,16 @@ public:
    */
   bool GetVTTransferResidualLimiting(void) const { return vt_transfer_res_limit; }
 
+  /*!
+   * \brief Get the kind of time integration of the chemical and vibrational sources.
+   */
+  unsigned short GetKind_ChemistryIntegration(void) const { return Kind_ChemistryIntegration; }
+
+  /*!
+   * \brief Get the maximum number of substeps of the split (point implicit) chemistry integration.
+   */
+  unsigned short GetChemistry_MaxSubsteps(void) const { return nChemistry_MaxSubsteps; }
+
   /*!
    * \brief Indicates if mixture is monoatomic.
    */
@@ -8581,6 +8747,22 @@ public:
    */
   bool GetMultizone_Problem(void) const { return Multizone_Problem; }
 
+  /*!
+   * \brief Check if the zones are iterated concurrently, each by its own group of ranks.
+   */
+  bool GetConcurrent_Zones(void) const { return Concurrent_Zones; }
+
+  /*!
+   * \brief Get the number of user defined zone weights for the distribution of ranks.
+   */
+  unsigned short GetnZone_Rank_Weights(void) const { return nZone_Rank_Weights; }
+
+  /*!
+   * \brief Get the relative cost of a zone, used to distribute the ranks over the zones.
+   * \param[in] val_iZone - Index of the zone.
+   */
+  su2double GetZone_Rank_Weight(unsigned short val_iZone) const { return Zone_Rank_Weights[val_iZone]; }
+
   /*!
    * \brief Get the ID for the FEA region that we want to compute the gradient for using direct differentiation
    * \return ID
@@ -9258,6 +9440,16 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Check if the geometry cache (partitioning, periodic matching, and wall distance) is used.
+   */
+  bool GetGeometry_Cache() const { return Geometry_Cache; }
+
+  /*!
+   * \brief Get the base name of the geometry cache file.
+   */
+  const string& GetGeometry_Cache_FileName() const { return Geometry_Cache_FileName; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -62,6 +62,7 @@ extern "C" {
 #include "../fem/geometry_structure_fem_part.hpp"
 #include "../toolboxes/graph_toolbox.hpp"
 #include "../adt/CADTElemClass.hpp"
+#include "primal_grid/CPrimalGridStore.hpp"
 
 using namespace std;
 
@@ -181,9 +182,23 @@ protected:
 
   CCompressedSparsePatternUL
   edgeColoring,                          /*!< \brief Edge coloring structure for thread-based parallelization. */
-  elemColoring;                          /*!< \brief Element coloring structure for thread-based parallelization. */
+  elemColoring,                          /*!< \brief Element coloring structure for thread-based parallelization. */
+  dualGridColoring;                      /*!< \brief Element coloring used to build the dual grid (see GetDualGridColoring). */
   unsigned long edgeColorGroupSize{1};   /*!< \brief Size of the edge groups within each color. */
   unsigned long elemColorGroupSize{1};   /*!< \brief Size of the element groups within each color. */
+  unsigned long dualGridColorGroupSize{1}; /*!< \brief Size of the element groups of the dual grid coloring. */
+
+  CPrimalGridStore elemStore;            /*!< \brief Flat (element-major) storage of the nodes of the volume elements. */
+
+  /*--- Geometric part of the least-squares gradients, shared by all the solvers. ---*/
+
+  su2activematrix lsqMatrices[2];        /*!< \brief Upper triangle of S = inv(R)*inv(R)^T of each point, unweighted and weighted. */
+  bool lsqMatricesValid[2] = {false, false}; /*!< \brief The matrices were computed for the current coordinates. */
+
+  /*!
+   * \brief Sparse pattern of the elements (outer indices) and their nodes (inner indices), to color them.
+   */
+  CCompressedSparsePatternUL GetElementPattern() const;
 
 public:
   /*--- Main geometric elements of the grid. ---*/
@@ -1594,6 +1609,13 @@ public:
    */
   void SetElemVolume();
 
+  /*!
+   * \brief Get the flat (element-major) connectivity of the volume elements.
+   * \note The store is built with the elements (see CPhysicalGeometry::LoadVolumeElements and
+   *       CPhysicalGeometry::LoadLinearlyPartitionedVolumeElements) and owns their nodes.
+   */
+  inline const CPrimalGridStore& GetElemStore() const { return elemStore; }
+
   /*!
    * \brief Set the multigrid index for the current geometry object.
    * \param[in] val_iMesh - Multigrid index for current geometry object.
@@ -1667,12 +1689,61 @@ public:
    */
   void SetNaturalElementColoring();
 
+  /*!
+   * \brief Get the element coloring used to accumulate the dual grid (volumes and normals).
+   * \note Unlike GetElementColoring, this coloring does not depend on the number of threads (or on
+   *       the choices of the solvers), the order in which the elements are summed, and so the dual grid,
+   *       is the same for any number of threads. If the greedy coloring fails, a single color with a
+   *       single group is used, i.e. the elements are processed sequentially.
+   * \return Reference to the coloring.
+   */
+  const CCompressedSparsePatternUL& GetDualGridColoring();
+
+  /*!
+   * \brief Get the group size used in the dual grid coloring.
+   * \return Group size.
+   */
+  inline unsigned long GetDualGridColorGroupSize(void) const { return dualGridColorGroupSize; }
+
   /*!
    * \brief Get the group size used in element coloring.
    * \return Group size.
    */
   inline unsigned long GetElementColorGroupSize(void) const { return elemColorGroupSize; }
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  static constexpr bool SHARED_LEAST_SQUARES = false; /*!< \brief Record the dependency on the coordinates (R matrix of each solver). */
+#else
+  static constexpr bool SHARED_LEAST_SQUARES = true;  /*!< \brief The solvers use the least-squares matrices of the geometry. */
+#endif
+
+  /*!
+   * \brief Get the matrices S = inv(R)*inv(R)^T of the least-squares gradients, stored as the
+   *        upper triangle of each point (nDim*(nDim+1)/2 entries, row-major).
+   * \note They are computed by computeGradientsLeastSquares on first use, for the domain points,
+   *       and invalidated when the dual grid is updated (grid movement).
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   * \return Reference to the matrices.
+   */
+  inline su2activematrix& GetLeastSquaresMatrices(bool weighted) { return lsqMatrices[weighted]; }
+
+  /*!
+   * \brief Check if the least-squares matrices are up to date.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   */
+  inline bool GetLeastSquaresMatricesValid(bool weighted) const { return lsqMatricesValid[weighted]; }
+
+  /*!
+   * \brief Mark the least-squares matrices as up to date.
+   * \param[in] weighted - Inverse-distance weighted or unweighted least-squares.
+   */
+  inline void SetLeastSquaresMatricesValid(bool weighted) { lsqMatricesValid[weighted] = true; }
+
+  /*!
+   * \brief Mark the least-squares matrices as outdated (the coordinates changed).
+   */
+  inline void InvalidateLeastSquaresMatrices() { lsqMatricesValid[0] = lsqMatricesValid[1] = false; }
+
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
@@ -1693,6 +1764,12 @@ public:
    */
   virtual void SetWallDistance(su2double val) {}
 
+  /*!
+   * \brief Check if the solver of a zone uses the wall distance (i.e. if ComputeWallDistance computes it).
+   * \param[in] config - Definition of the zone.
+   */
+  static bool WallDistanceNeeded(const CConfig *config);
+
   /*!
    * \brief Compute the distances to the closest vertex on viscous walls over the entire domain
    * \param[in] config_container - Definition of the particular problem.
@@ -0,0 +1,183 @@
+/*!
+ * \file CGeometryCache.hpp
+ * \brief Cache file of geometry preprocessing results (partitioning, periodic matching, and wall distance).
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+class CConfig;
+class CGeometry;
+
+/*!
+ * \class CGeometryCache
+ * \brief Binary file with the results of expensive geometry preprocessing steps (graph partitioning,
+ *        matching of the periodic points, and wall distance), to reuse them in consecutive runs on the
+ *        same mesh (e.g. optimizations or parametric sweeps).
+ * \note The file is only used if its key matches the key of the current run, which is a hash of the
+ *       mesh (coordinates and connectivity), of the number of ranks, of the kind of solver, and of the
+ *       options that affect the cached data. The data is stored by global point index and accessed with
+ *       MPI-IO, each rank only reads or writes its own points. All methods are collective.
+ * \note The other preprocessing stages are not cached. The dual grid and the multigrid agglomeration
+ *       are linear in the number of points (and threaded), while the partitioning, the periodic matching
+ *       (all pairs of vertices), and the wall distance search are not. The dual grid would also be the
+ *       largest part of the file (edges, normals, volumes), reading it is not much faster than computing
+ *       it. The ADT of the viscous walls is only used for the wall distance, which is cached. The halo and
+ *       periodic communication patterns are rebuilt from the cached partitioning and periodic donors.
+ *       The startup breakdown printed by CStageTimer shows the time of each stage on a given case.
+ * \author agent
+ */
+class CGeometryCache {
+private:
+  /*--- Layout of the header, values are stored as 64-bit unsigned integers. ---*/
+  enum HeaderEntry {MAGIC, VERSION, KEY, NRANK, NPOINT, HAS_WALL_DISTANCE, HAS_PERIODIC, HEADER_SIZE};
+  enum : unsigned long {MAGIC_NUMBER = 0x5355324745434845ul, FORMAT_VERSION = 2};
+
+  /*--- Periodic donor of a vertex: global index of the vertex point, then the donor point, global index,
+   *    vertex, marker, and rank, as set by CGeometry::MatchPeriodic. ---*/
+  enum : unsigned long {PERIODIC_RECORD_SIZE = 6};
+
+  std::string fileName;               /*!< \brief Name of the cache file. */
+  unsigned long key = 0;              /*!< \brief Key of the current run. */
+  unsigned long nPointGlobal = 0;     /*!< \brief Global number of points of the mesh. */
+  bool valid = false;                 /*!< \brief The file exists and was created for the current key. */
+  bool hasWallDistance = false;       /*!< \brief The file contains the wall distance. */
+  bool hasPeriodic = false;           /*!< \brief The file contains the periodic donors. */
+
+  /*!
+   * \brief Offset (bytes) of the partitioning section.
+   */
+  inline unsigned long PartitionOffset() const { return HEADER_SIZE*sizeof(unsigned long); }
+
+  /*!
+   * \brief Offset (bytes) of the wall distance section (aligned to 8 bytes).
+   */
+  inline unsigned long WallDistanceOffset() const {
+    return PartitionOffset() + ((nPointGlobal*sizeof(int) + 7) / 8) * 8;
+  }
+
+  /*!
+   * \brief Offset (bytes) of the roughness (of the nearest wall) section.
+   */
+  inline unsigned long RoughnessOffset() const { return WallDistanceOffset() + nPointGlobal*sizeof(double); }
+
+  /*!
+   * \brief Offset (bytes) of the periodic section, the number of records of each rank followed by the records.
+   */
+  inline unsigned long PeriodicOffset() const { return RoughnessOffset() + nPointGlobal*sizeof(double); }
+
+  /*!
+   * \brief Write the header (master rank) with the sections that are complete.
+   * \param[in] create - Create (or truncate) the file before writing.
+   * \return False if the file cannot be opened.
+   */
+  bool WriteHeader(bool create) const;
+
+  /*!
+   * \brief Read or write the header (master rank) and broadcast it.
+   * \param[in,out] header - Header entries.
+   * \param[in] write - Write the header instead of reading it.
+   * \param[in] create - Create (or truncate) the file before writing.
+   * \return False if the file cannot be opened.
+   */
+  bool AccessHeader(unsigned long* header, bool write, bool create) const;
+
+  /*!
+   * \brief Read or write values at given positions of a section of the file.
+   * \param[in] offset - Offset (bytes) of the section.
+   * \param[in] index - Positions (global point indices) of the values, in ascending order.
+   * \param[in,out] data - Values, each of size "bytes".
+   * \param[in] bytes - Size of each value (4 or 8 bytes).
+   * \param[in] write - Write the values instead of reading them.
+   */
+  void AccessSection(unsigned long offset, const std::vector<unsigned long>& index,
+                     void* data, unsigned long bytes, bool write) const;
+
+  /*!
+   * \brief Read or write a contiguous block of 64-bit integers (different for each rank).
+   * \param[in] offset - Offset (bytes) of the block of this rank.
+   * \param[in] count - Number of values.
+   * \param[in,out] data - Values.
+   * \param[in] write - Write the values instead of reading them.
+   */
+  void AccessBlock(unsigned long offset, unsigned long count, unsigned long* data, bool write) const;
+
+public:
+  /*!
+   * \brief Compute the key of the run and check if the cache file matches it.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Linearly partitioned geometry as read from the mesh file (before coloring).
+   */
+  CGeometryCache(const CConfig* config, const CGeometry* geometry);
+
+  /*!
+   * \brief Set the colors (ranks) of the points of the linearly partitioned geometry from the cache.
+   * \param[in] geometry - Linearly partitioned geometry.
+   * \return False if the cache does not contain valid data.
+   */
+  bool LoadPartition(CGeometry* geometry) const;
+
+  /*!
+   * \brief Create the cache file and store the colors of the points of the linearly partitioned geometry.
+   * \param[in] geometry - Linearly partitioned geometry (after coloring).
+   */
+  void SavePartition(const CGeometry* geometry);
+
+  /*!
+   * \brief Set the wall distance (and roughness of the nearest wall) of all points (domain and halo) from the cache.
+   * \param[in] geometry - Partitioned geometry.
+   * \return False if the cache does not contain valid data.
+   */
+  bool LoadWallDistance(CGeometry* geometry) const;
+
+  /*!
+   * \brief Store the wall distance (and roughness of the nearest wall) of the domain points.
+   * \param[in] geometry - Partitioned geometry with the wall distance.
+   */
+  void SaveWallDistance(const CGeometry* geometry);
+
+  /*!
+   * \brief Set the periodic donors of the vertices of the periodic markers from the cache.
+   * \note Only for the fine grid, the coarse grids match their periodic points from the fine grid.
+   * \param[in] geometry - Partitioned geometry with the vertices of the markers.
+   * \param[in] config - Definition of the particular problem.
+   * \return False if the cache does not contain valid data (for all ranks).
+   */
+  bool LoadPeriodic(CGeometry* geometry, const CConfig* config) const;
+
+  /*!
+   * \brief Store the periodic donors of the owned vertices of the periodic markers.
+   * \param[in] geometry - Partitioned geometry after CGeometry::MatchPeriodic.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SavePeriodic(const CGeometry* geometry, const CConfig* config);
+
+  /*!
+   * \brief Get the name of the cache file.
+   */
+  inline const std::string& GetFileName() const { return fileName; }
+};
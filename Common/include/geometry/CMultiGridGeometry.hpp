@@ -36,6 +36,57 @@
  * \author F. Palacios
  */
 class CMultiGridGeometry final : public CGeometry {
+private:
+  /*!
+   * \brief Agglomerate the domain points that were not agglomerated on the boundaries, with a single
+   *        priority queue over the whole domain (serial, default).
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in,out] Index_CoarseCV - Number of coarse points.
+   */
+  void AgglomerateDomain(CGeometry *fine_grid, CConfig *config, unsigned long& Index_CoarseCV);
+
+  /*!
+   * \brief Split the domain points that were not agglomerated on the boundaries into blocks of (at most)
+   *        blockSize points. The blocks are grown breadth-first to make them compact, a new
+   *        block starts from the front of the previous one.
+   * \note The blocks only depend on the fine grid, not on the number of threads.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] blockSize - Maximum number of points per block (MG_AGGLOMERATION_BLOCK_SIZE).
+   * \param[out] blocks - Points of each block.
+   * \param[out] blockOf - Block of each fine point (number of blocks if none).
+   * \param[out] localIndex - Position of each fine point in its block.
+   */
+  static void SetAgglomerationBlocks(const CGeometry *fine_grid, unsigned long blockSize,
+                                     vector<vector<unsigned long> >& blocks,
+                                     vector<unsigned long>& blockOf, vector<unsigned long>& localIndex);
+
+  /*!
+   * \brief Agglomerate the points of a block, the seeds and their children are taken from the block only.
+   * \note Blocks can be agglomerated concurrently. The fine points get the index of their agglomerate
+   *       within the block as parent, it is offset when the agglomerates of all blocks are numbered.
+   * \param[in] iBlock - Index of the block.
+   * \param[in] blocks - Points of each block.
+   * \param[in] blockOf - Block of each fine point.
+   * \param[in] localIndex - Position of each fine point in its block.
+   * \param[in] priority - Initial priority of the points (number of agglomerated neighbors).
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] agglomerates - Children of each agglomerate.
+   * \param[out] indirect - Indirect agglomeration flag of each agglomerate.
+   */
+  void AgglomerateBlock(unsigned long iBlock, const vector<vector<unsigned long> >& blocks,
+                        const vector<unsigned long>& blockOf, const vector<unsigned long>& localIndex,
+                        const vector<short>& priority, CGeometry *fine_grid, CConfig *config,
+                        vector<vector<unsigned long> >& agglomerates, vector<char>& indirect);
+
+  /*!
+   * \brief Set the points surrounding each coarse point from the parents of the neighbors of its children.
+   * \note The coarse points are processed concurrently, the result does not depend on the number of threads.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] nCoarsePoint - Number of coarse points for which the neighbors are set.
+   */
+  void SetCoarsePoints(CGeometry *fine_grid, unsigned long nCoarsePoint);
 
 public:
   /*--- This is to suppress Woverloaded-virtual, omitting it has no negative impact. ---*/
@@ -53,6 +104,19 @@ public:
    */
   CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh);
 
+  /*!
+   * \brief Compute quality metrics of the agglomeration over all ranks (collective).
+   * \note The aspect ratio of a coarse control volume is the area of its faces relative to that of
+   *       a cube (square in 2D) of the same volume, it is computed from the fine grid dual mesh.
+   * \param[in] fine_grid - Geometrical definition of the fine grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] maxChildren - Maximum number of children of a coarse control volume.
+   * \param[out] avgAspectRatio - Average aspect ratio of the coarse control volumes.
+   * \param[out] maxAspectRatio - Maximum aspect ratio of the coarse control volumes.
+   */
+  void ComputeAgglomerationQuality(CGeometry *fine_grid, const CConfig *config, unsigned long &maxChildren,
+                                   passivedouble &avgAspectRatio, passivedouble &maxAspectRatio) const;
+
   /*!
    * \brief Determine if a CVPoint van be agglomerated, if it have the same marker point as the seed.
    * \param[in] CVPoint - Control volume to be agglomerated.
@@ -178,6 +178,12 @@ public:
    */
   void SetElems(const vector<vector<long> >& elemsMatrix);
 
+  /*!
+   * \brief Set the elements that are connected to each point.
+   * \param[in] elems - Elements connected to each point in compressed format (CSR).
+   */
+  inline void SetElems(CCompressedSparsePatternL&& elems) { Elem = std::move(elems); }
+
   /*!
    * \brief Reset the elements of a control volume.
    */
@@ -45,6 +45,7 @@
 class CPrimalGrid {
 protected:
   unsigned long *Nodes;         /*!< \brief Vector to store the global nodes of an element. */
+  bool NodesInStore = false;    /*!< \brief Whether Nodes points to the storage of a CPrimalGridStore (not owned). */
   unsigned long GlobalIndex;    /*!< \brief The global index of an element. */
   long *Neighbor_Elements;      /*!< \brief Vector to store the elements surronding an element. */
   short *PeriodIndexNeighbors;  /*!< \brief Vector to store the periodic index of a neighbor.
@@ -340,6 +341,13 @@ public:
    */
   inline virtual void SetNode(unsigned short val_node, unsigned long val_point) { }
 
+  /*!
+   * \brief Move the nodes of the element to storage owned by a CPrimalGridStore, the element
+   *        then reads and writes (SetNode, Change_Orientation) the nodes in that storage.
+   * \param[in] storage - Location for the nodes, with room for GetnNodes() entries.
+   */
+  void SetNodesStorage(unsigned long* storage);
+
   /*!
    * \brief A pure virtual member.
    * \param[in] val_face - Local index of the face.
@@ -0,0 +1,180 @@
+/*!
+ * \file CPrimalGridStore.hpp
+ * \brief Flat (structure of arrays) storage of the connectivity of primal grid elements.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <vector>
+#include <cassert>
+
+class CPrimalGrid;
+
+/*!
+ * \class CPrimalGridStore
+ * \brief Element-major flat storage of a set of primal grid elements (volume or boundary), the nodes
+ *        of all elements in CSR format, one type tag (VTK nomenclature) per element, the global index
+ *        of each element and the list of elements of each type.
+ * \note The face topology is stored once per element type. Elements are accessed via light-weight
+ *       views with the same interface as CPrimalGrid for the connectivity (GetnNodes, GetNode, etc.)
+ *       to loop over elements without pointer chasing or virtual calls.
+ * \note The store owns the nodes, Build moves the nodes of the CPrimalGrid objects into it and the
+ *       objects then refer to that storage. Changes of the nodes made through the objects (e.g. point
+ *       renumbering or orientation fixes) are therefore seen by the store without rebuilding it. The
+ *       store must outlive the objects, and the type and global index of an element must not change.
+ * \author agent
+ */
+class CPrimalGridStore {
+public:
+  enum : unsigned short {
+    MAX_VTK_TYPE = 15,   /*!< \brief Supported VTK types are smaller than this. */
+    MAX_FACES = 6,       /*!< \brief Max number of faces of an element (hexahedron). */
+    MAX_NODES_FACE = 4   /*!< \brief Max number of nodes of a face (quadrilateral). */
+  };
+
+  /*!
+   * \brief Topology of a type of element, i.e. the number of nodes and the local nodes of each face.
+   */
+  struct CTopology {
+    unsigned short nNodes = 0;
+    unsigned short nFaces = 0;
+    unsigned short nNodesFace[MAX_FACES] = {0};
+    unsigned short faces[MAX_FACES][MAX_NODES_FACE] = {{0}};
+  };
+
+  /*!
+   * \brief View of one element of the store.
+   */
+  class CElementView {
+  private:
+    const unsigned long* nodes;
+    const CTopology* topology;
+    unsigned short vtkType;
+
+  public:
+    CElementView(const unsigned long* nodes_, const CTopology* topology_, unsigned short vtkType_) :
+      nodes(nodes_), topology(topology_), vtkType(vtkType_) {}
+
+    inline unsigned short GetVTK_Type() const { return vtkType; }
+    inline unsigned short GetnNodes() const { return topology->nNodes; }
+    inline unsigned long GetNode(unsigned short iNode) const { return nodes[iNode]; }
+    inline const unsigned long* GetNodes() const { return nodes; }
+    inline unsigned short GetnFaces() const { return topology->nFaces; }
+    inline unsigned short GetnNodesFace(unsigned short iFace) const { return topology->nNodesFace[iFace]; }
+    inline unsigned short GetFaces(unsigned short iFace, unsigned short iNode) const {
+      return topology->faces[iFace][iNode];
+    }
+  };
+
+private:
+  std::vector<unsigned char> vtkType;             /*!< \brief Type of each element. */
+  std::vector<unsigned long> nodeStart;           /*!< \brief Start of the nodes of each element (CSR). */
+  std::vector<unsigned long> nodes;               /*!< \brief Nodes of all elements. */
+  std::vector<unsigned long> globalIndex;         /*!< \brief Global index of each element. */
+  std::vector<unsigned long> elemOfType[MAX_VTK_TYPE]; /*!< \brief Elements of each type, in ascending order. */
+  CTopology topology[MAX_VTK_TYPE];               /*!< \brief Topology of each type. */
+
+public:
+  CPrimalGridStore() = default;
+  CPrimalGridStore(CPrimalGridStore&&) = default;
+  CPrimalGridStore& operator= (CPrimalGridStore&&) = default;
+
+  /*!
+   * \brief The elements refer to the storage of this object, copies would be stale.
+   */
+  CPrimalGridStore(const CPrimalGridStore&) = delete;
+  CPrimalGridStore& operator= (const CPrimalGridStore&) = delete;
+
+  /*!
+   * \brief Build the store from an array of elements and move the nodes of the elements to it.
+   * \param[in] elem - Array of elements (not owned).
+   * \param[in] nElem - Number of elements.
+   */
+  void Build(CPrimalGrid* const* elem, unsigned long nElem);
+
+  /*!
+   * \brief Get the number of elements.
+   */
+  inline unsigned long GetnElem() const { return vtkType.size(); }
+
+  /*!
+   * \brief Get the type (VTK nomenclature) of an element.
+   */
+  inline unsigned short GetVTK_Type(unsigned long iElem) const { return vtkType[iElem]; }
+
+  /*!
+   * \brief Get the number of nodes of an element.
+   */
+  inline unsigned short GetnNodes(unsigned long iElem) const {
+    return nodeStart[iElem+1] - nodeStart[iElem];
+  }
+
+  /*!
+   * \brief Get a node of an element.
+   */
+  inline unsigned long GetNode(unsigned long iElem, unsigned short iNode) const {
+    return nodes[nodeStart[iElem] + iNode];
+  }
+
+  /*!
+   * \brief Get the nodes of an element (contiguous).
+   */
+  inline const unsigned long* GetNodes(unsigned long iElem) const { return &nodes[nodeStart[iElem]]; }
+
+  /*!
+   * \brief Get the global index of an element.
+   */
+  inline unsigned long GetGlobalIndex(unsigned long iElem) const { return globalIndex[iElem]; }
+
+  /*!
+   * \brief Get the list of elements of a given type.
+   * \param[in] type - Type of element (VTK nomenclature).
+   */
+  inline const std::vector<unsigned long>& GetElemOfType(unsigned short type) const {
+    assert(type < MAX_VTK_TYPE);
+    return elemOfType[type];
+  }
+
+  /*!
+   * \brief Get the topology of a type of element (valid if at least one element of the type exists).
+   * \param[in] type - Type of element (VTK nomenclature).
+   */
+  inline const CTopology& GetTopology(unsigned short type) const {
+    assert(type < MAX_VTK_TYPE);
+    return topology[type];
+  }
+
+  /*!
+   * \brief Get a view of an element.
+   */
+  inline CElementView operator[] (unsigned long iElem) const {
+    return CElementView(GetNodes(iElem), &topology[vtkType[iElem]], vtkType[iElem]);
+  }
+
+  /*!
+   * \brief Approximate memory used by the store in bytes.
+   */
+  unsigned long GetMemoryUsage() const;
+};
@@ -41,10 +41,43 @@ using namespace std;
 class CBSplineBlending : public CFreeFormBlending{
 
 private:
-  vector<su2double>          U;  /*!< \brief The knot vector for uniform BSplines on the interval [0,1]. */
-  vector<vector<su2double> > N;  /*!< \brief The temporary matrix holding the j+p basis functions up to order p. */
+  vector<su2double> U;  /*!< \brief The knot vector for uniform BSplines on the interval [0,1]. */
+  vector<su2double> N;  /*!< \brief The temporary matrix (Order x Order, row-major) holding the j+p basis functions up to order p. */
   unsigned short KnotSize;       /*!< \brief The size of the knot vector. */
 
+  /*!
+   * \brief Compute the i+p basis functions up to order p into the work matrix Nw (val_t must be in the support of i).
+   * \param[in] val_i - index of the basis function.
+   * \param[in] val_t - Point at which we want to evaluate the i-th basis.
+   * \param[out] Nw - Work matrix of size Order x Order (row-major).
+   */
+  void FillWork(short val_i, su2double val_t, su2double* Nw) const;
+
+  /*!
+   * \brief Evaluate the i-th basis function using the work matrix Nw to store the i+p basis functions.
+   * \param[in] val_i - index of the basis function.
+   * \param[in] val_t - Point at which we want to evaluate the i-th basis.
+   * \param[in,out] Nw - Work matrix of size Order x Order (row-major).
+   */
+  su2double EvalBasis(short val_i, su2double val_t, su2double* Nw) const;
+
+  /*!
+   * \brief Derivative of the i-th basis function from a work matrix filled by FillWork.
+   * \param[in] val_i - index of the basis function.
+   * \param[in] val_order_der - Order of the derivative (0, 1, or 2).
+   * \param[in] Nw - Work matrix of size Order x Order (row-major).
+   */
+  su2double DerivativeFromWork(short val_i, short val_order_der, const su2double* Nw) const;
+
+  /*!
+   * \brief Evaluate the derivative of the i-th basis function using the work matrix Nw.
+   * \param[in] val_i - index of the basis function.
+   * \param[in] val_t - Point at which we want to evaluate the derivative of the i-th basis.
+   * \param[in] val_order_der - Order of the derivative.
+   * \param[in,out] Nw - Work matrix of size Order x Order (row-major).
+   */
+  su2double EvalDerivative(short val_i, su2double val_t, short val_order_der, su2double* Nw) const;
+
 public:
 
   /*!
@@ -79,4 +112,15 @@ public:
    */
   void SetOrder(short val_order, short n_controlpoints) override;
 
+  /*!
+   * \brief Evaluate all basis functions and their first and second derivatives (thread-safe).
+   * \param[in] val_t - Point at which we want to evaluate the basis.
+   * \param[in] n_basis - Number of basis functions.
+   * \param[out] basis - Values of the basis functions.
+   * \param[out] der1 - First derivatives of the basis functions (not computed if nullptr).
+   * \param[out] der2 - Second derivatives of the basis functions (not computed if nullptr).
+   */
+  void GetBasisTable(su2double val_t, unsigned short n_basis, su2double* basis,
+                     su2double* der1, su2double* der2) const override;
+
 };
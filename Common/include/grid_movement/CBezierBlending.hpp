@@ -43,6 +43,7 @@ class CBezierBlending : public CFreeFormBlending{
 private:
 
   vector<su2double> binomial; /*!< \brief Temporary vector for the Bernstein evaluation. */
+  vector<su2double> binomRow[3]; /*!< \brief Rows n, n-1, and n-2 of the Pascal triangle (n = Degree), for GetBasisTable. */
 
   /*!
    * \brief Returns the value of the i-th Bernstein polynomial of order n.
@@ -70,6 +71,20 @@ private:
    */
   su2double Binomial(unsigned short n, unsigned short m);
 
+  /*!
+   * \brief Returns the value of the i-th Bernstein polynomial of order n from tabulated powers, thread-safe.
+   * \param[in] val_n - Order of the Bernstein polynomial.
+   * \param[in] val_i - index of the basis function.
+   * \param[in] binom - Binomial coefficients n over 0,1,...,n.
+   * \param[in] tPow - Powers t^0,...,t^n.
+   * \param[in] sPow - Powers (1-t)^0,...,(1-t)^n.
+   */
+  static inline su2double EvalBernstein(short val_n, short val_i, const su2double* binom,
+                                        const su2double* tPow, const su2double* sPow) {
+    if ((val_i < 0) || (val_i > val_n)) return 0.0;
+    return binom[val_i] * tPow[val_i] * sPow[val_n - val_i];
+  }
+
 public:
 
   /*!
@@ -106,4 +121,15 @@ public:
    */
   void SetOrder(short val_order, short n_controlpoints) override;
 
+  /*!
+   * \brief Evaluate all basis functions and their first and second derivatives (thread-safe).
+   * \param[in] val_t - Point at which we want to evaluate the basis.
+   * \param[in] n_basis - Number of basis functions.
+   * \param[out] basis - Values of the basis functions.
+   * \param[out] der1 - First derivatives of the basis functions (not computed if nullptr).
+   * \param[out] der2 - Second derivatives of the basis functions (not computed if nullptr).
+   */
+  void GetBasisTable(su2double val_t, unsigned short n_basis, su2double* basis,
+                     su2double* der1, su2double* der2) const override;
+
 };
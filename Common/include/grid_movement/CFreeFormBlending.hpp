@@ -43,6 +43,8 @@ protected:
   Degree,               /*!< \brief Degree (Order - 1) of the polynomial basis. */
   nControl;             /*!< \brief Number of control points. */
 
+  enum : unsigned short {MAX_STACK_ORDER = 16}; /*!< \brief Up to this order GetBasisTable uses stack work arrays. */
+
 public:
 
   /*!
@@ -70,6 +72,18 @@ public:
    */
   inline virtual su2double GetDerivative(short val_i, su2double val_t, short val_order){return 0.0;}
 
+  /*!
+   * \brief Evaluate all basis functions and their first and second derivatives at one point.
+   * \note Unlike GetBasis and GetDerivative this does not modify any member and is therefore thread-safe.
+   * \param[in] val_t - Point at which we want to evaluate the basis.
+   * \param[in] n_basis - Number of basis functions (i.e. control points in this direction).
+   * \param[out] basis - Values of the basis functions.
+   * \param[out] der1 - First derivatives of the basis functions (not computed if nullptr).
+   * \param[out] der2 - Second derivatives of the basis functions (not computed if nullptr).
+   */
+  virtual void GetBasisTable(su2double val_t, unsigned short n_basis, su2double* basis,
+                             su2double* der1, su2double* der2) const = 0;
+
   /*!
    * \brief A pure virtual member.
    * \param[in] val_order - The new order of the function.
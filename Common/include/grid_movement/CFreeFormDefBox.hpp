@@ -53,9 +53,6 @@ public:
   nDegree, nDegree_Copy;        /*!< \brief Degree of the FFDBox in the k direction. (nOrder - 1)*/
   su2double *ParamCoord, *ParamCoord_,  /*!< \brief Parametric coordinates of a point. */
   *cart_coord, *cart_coord_;      /*!< \brief Cartesian coordinates of a point. */
-  su2double ObjFunc;      /*!< \brief Objective function of the point inversion process. */
-  su2double *Gradient;      /*!< \brief Gradient of the point inversion process. */
-  su2double **Hessian;          /*!< \brief Hessian of the point inversion process. */
   su2double MaxCoord[3];    /*!< \brief Maximum coordinates of the FFDBox. */
   su2double MinCoord[3];    /*!< \brief Minimum coordinates of the FFDBox. */
   string Tag;         /*!< \brief Tag to identify the FFDBox. */
@@ -172,7 +169,7 @@ public:
    * \brief Add to the vector of cartesian coordinates a new coordinate.
    * \param[in] val_coord - New coordinate inside the FFD box.
    */
-  inline void Set_CartesianCoord(su2double *val_coord) { CartesianCoord[0].push_back(val_coord[0]);
+  inline void Set_CartesianCoord(const su2double *val_coord) { CartesianCoord[0].push_back(val_coord[0]);
                                                                       CartesianCoord[1].push_back(val_coord[1]);
                                                                       CartesianCoord[2].push_back(val_coord[2]); }
 
@@ -191,7 +188,7 @@ public:
    * \brief Add to the vector of parametric coordinates a new coordinate.
    * \param[in] val_coord - New coordinate inside the FFD box.
    */
-  inline void Set_ParametricCoord(su2double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
+  inline void Set_ParametricCoord(const su2double *val_coord) { ParametricCoord[0].push_back(val_coord[0]);
                                                                        ParametricCoord[1].push_back(val_coord[1]);
                                                                        ParametricCoord[2].push_back(val_coord[2]); }
 
@@ -547,6 +544,59 @@ public:
    */
   su2double *GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, const su2double *guess, CConfig *config);
 
+  /*!
+   * \brief Copy the control points to a contiguous array ([i][j][k][iDim]) for the thread-safe evaluation routines.
+   * \param[out] cp - Coordinates of the control points.
+   */
+  void GetControlPointsFlat(vector<su2double>& cp) const;
+
+  /*!
+   * \brief Evaluate the cartesian coordinates of a point and their first and second derivatives w.r.t. the
+   *        parametric coordinates. The tensor-product sums are factorized (one direction at a time) which
+   *        reduces the cost from O(l*m*n) blending evaluations to O(l+m+n). This method is thread-safe.
+   * \param[in] cp - Control points (see GetControlPointsFlat).
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[out] xyz - Cartesian coordinates of the point.
+   * \param[out] dxyz - First derivatives, dxyz[iDim][iParam] (not computed if nullptr).
+   * \param[out] d2xyz - Second derivatives, d2xyz[iDim][iParam][jParam] (requires dxyz).
+   * \param[in,out] work - Scratch space, sized automatically, reuse it across calls.
+   */
+  void EvalCartesianCoord(const su2double *cp, const su2double *uvw, su2double *xyz, su2double (*dxyz)[3],
+                          su2double (*d2xyz)[3][3], vector<su2double>& work) const;
+
+  /*!
+   * \brief Newton method for the point inversion (thread-safe version of GetParametricCoord_Iterative).
+   * \param[in] cp - Control points (see GetControlPointsFlat).
+   * \param[in] xyz - Cartesians coordinates of the target point.
+   * \param[in] guess - Initial guess for doing the parametric coordinates search.
+   * \param[out] uvw - Parametric coordinates of the point.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] seed - Seed for the random restarts (to keep the results reproducible).
+   * \param[in,out] work - Scratch space for EvalCartesianCoord.
+   * \param[out] MinNormError - Minimum norm of the Newton update.
+   * \return True if the method converged.
+   */
+  bool GetParametricCoord_Newton(const su2double *cp, const su2double *xyz, const su2double *guess, su2double *uvw,
+                                 const CConfig *config, unsigned long seed, vector<su2double>& work,
+                                 su2double& MinNormError) const;
+
+  /*!
+   * \brief Point inversion for a batch of points. Independent points (no chained guess) are distributed over
+   *        threads in chunks of fixed size, chained points are inverted in order, in both cases the results
+   *        do not depend on the number of threads.
+   * \param[in] nPoint - Number of points.
+   * \param[in] nDim - Number of dimensions of the problem (for the error computation).
+   * \param[in] xyz - Cartesian coordinates of the points (3 per point).
+   * \param[in,out] uvw - Initial guess and parametric coordinates of the points (3 per point).
+   * \param[out] diff - Distance between xyz and the cartesian coordinates recomputed from uvw.
+   * \param[in] chain_guess - If true, the initial guess of a point is the solution of the previous point clamped to
+   *            [tol, 1-tol] (if it was inside the box), within chunks of 64 points each starting from uvw of its
+   *            first point, otherwise the guess is given by uvw.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void GetParametricCoord_Batch(unsigned long nPoint, unsigned short nDim, const su2double *xyz, su2double *uvw,
+                                su2double *diff, bool chain_guess, const CConfig *config) const;
+
   /*!
    * \brief Compute the cross product.
    * \param[in] v1 - First input vector.
@@ -627,25 +677,6 @@ public:
    */
   void SetDeformationZone(CGeometry *geometry, CConfig *config, unsigned short iFFDBox) const;
 
-  /*!
-   * \brief The routine computes the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2  evaluated at (u, v, w).
-   * \param[in] val_coord - Parametric coordiates of the target point.
-   * \param[in] xyz - Cartesians coordinates of the point.
-   * \param[in] analytical - Compute the analytical gradient.
-   * \return Value of the analytical gradient.
-   */
-  su2double *GetFFDGradient(su2double *val_coord, su2double *xyz);
-
-  /*!
-   * \brief The routine that computes the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 evaluated at (u, v, w)
-   *        Input: (u, v, w), (x, y, z)
-   *        Output: Hessian F (u, v, w).
-   * \param[in] uvw - Current value of the parametrics coordinates.
-   * \param[in] xyz - Cartesians coordinates of the target point to compose the functional.
-   * \param[in] val_Hessian - Value of the hessian.
-   */
-  void GetFFDHessian(su2double *uvw, su2double *xyz, su2double **val_Hessian);
-
   /*!
    * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
    *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)^2+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)^2
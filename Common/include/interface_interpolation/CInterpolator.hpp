@@ -142,10 +142,22 @@ public:
 protected:
   /*!
    * \brief Recontstruct the boundary connectivity from parallel partitioning and broadcasts it to all threads
+   * \note If bounding boxes are given, each rank only receives the vertices inside its box plus their
+   *       direct neighbours, nGlobalVertex is then the size of that subset.
    * \param[in] val_zone   - index of the zone
    * \param[in] val_marker - index of the marker
+   * \param[in] rankBoxes  - Optional, min and max coordinates of the box of each rank.
    */
-  void ReconstructBoundary(unsigned long val_zone, int val_marker);
+  void ReconstructBoundary(unsigned long val_zone, int val_marker, const vector<passivedouble>* rankBoxes = nullptr);
+
+  /*!
+   * \brief Implementation of ReconstructBoundary with bounding boxes, each rank sends the owned vertices
+   *        needed by the other ranks directly to them, nothing is gathered on the master.
+   * \param[in] geom       - Geometry of the zone.
+   * \param[in] val_marker - index of the marker
+   * \param[in] rankBoxes  - Min and max coordinates of the box of each rank.
+   */
+  void ReconstructBoundaryInBoxes(const CGeometry* geom, int val_marker, const vector<passivedouble>& rankBoxes);
 
   /*!
    * \brief Determine array sizes used to collect and send coordinate and global point information.
@@ -52,6 +52,17 @@ public:
   void SetTransferCoeff(const CConfig* const* config) override;
 
 private:
+  /*!
+   * \brief Compute the bounding boxes of the target vertices owned by each rank, used to limit
+   *        the boundary data each rank receives in ReconstructBoundary.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[out] targetBoxes - Min and max coordinates of the boxes of all ranks.
+   * \param[out] donorBoxes - Same boxes, enlarged to contain the donor elements that may intersect the target ones.
+   */
+  void ComputeRankBoundingBoxes(int markDonor, int markTarget, vector<passivedouble>& targetBoxes,
+                                vector<passivedouble>& donorBoxes) const;
+
   /*!
    * \brief For 3-Dimensional grids, build the dual surface element
    * \param[in] map         - array containing the index of the boundary points connected to the node
@@ -33,6 +33,7 @@
 #include "../geometry/CGeometry.hpp"
 #include "CSysVector.hpp"
 #include "CSysMatrix.hpp"
+#include "../toolboxes/CProfiler.hpp"
 
 /*!
  * \class CPreconditioner
@@ -106,6 +107,7 @@ public:
    * \param[out] v - CSysVector that is the result of the preconditioning
    */
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    SU2_PROFILE_SCOPE("Preconditioner_Apply");
     sparse_matrix.ComputeJacobiPreconditioner(u, v, geometry, config);
   }
 
@@ -113,6 +115,7 @@ public:
    * \note Request the associated matrix to build the preconditioner.
    */
   inline void Build() override {
+    SU2_PROFILE_SCOPE("Preconditioner_Build");
     sparse_matrix.BuildJacobiPreconditioner(transp);
   }
 };
@@ -160,6 +163,7 @@ public:
    * \param[out] v - CSysVector that is the result of the preconditioning.
    */
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    SU2_PROFILE_SCOPE("Preconditioner_Apply");
     sparse_matrix.ComputeILUPreconditioner(u, v, geometry, config);
   }
 
@@ -167,6 +171,7 @@ public:
    * \note Request the associated matrix to build the preconditioner.
    */
   inline void Build() override {
+    SU2_PROFILE_SCOPE("Preconditioner_Build");
     sparse_matrix.BuildILUPreconditioner(transp);
   }
 };
@@ -212,6 +217,7 @@ public:
    * \param[out] v - CSysVector that is the result of the preconditioning.
    */
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    SU2_PROFILE_SCOPE("Preconditioner_Apply");
     sparse_matrix.ComputeLU_SGSPreconditioner(u, v, geometry, config);
   }
 };
@@ -256,6 +262,7 @@ public:
    * \param[out] v - CSysVector that is the result of the preconditioning.
    */
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    SU2_PROFILE_SCOPE("Preconditioner_Apply");
     sparse_matrix.ComputeLineletPreconditioner(u, v, geometry, config);
   }
 
@@ -263,6 +270,7 @@ public:
    * \note Request the associated matrix to build the preconditioner.
    */
   inline void Build() override {
+    SU2_PROFILE_SCOPE("Preconditioner_Build");
     sparse_matrix.BuildJacobiPreconditioner(false);
   }
 };
@@ -313,6 +321,7 @@ public:
    * \param[out] v - CSysVector that is the result of the preconditioning.
    */
   inline void operator()(const CSysVector<ScalarType> & u, CSysVector<ScalarType> & v) const override {
+    SU2_PROFILE_SCOPE("Preconditioner_Apply");
     sparse_matrix.ComputePastixPreconditioner(u, v, geometry, config);
   }
 
@@ -320,6 +329,7 @@ public:
    * \note Request the associated matrix to build the preconditioner.
    */
   inline void Build() override {
+    SU2_PROFILE_SCOPE("Preconditioner_Build");
     sparse_matrix.BuildPastixPreconditioner(geometry, config, kind_fact, transp);
   }
 };
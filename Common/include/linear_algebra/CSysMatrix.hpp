@@ -389,11 +389,13 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    * \param[in] needTranspPtr - If "col_ptr" should be created, used for "SetDiagonalAsColumnSum".
+   * \param[in] mgSmoother - If the matrix is relaxed by MG_COARSE_SMOOTHER on the coarse levels (flow solvers).
    */
   void Initialize(unsigned long npoint, unsigned long npointdomain,
                   unsigned short nvar, unsigned short neqn,
                   bool EdgeConnect, CGeometry *geometry,
-                  const CConfig *config, bool needTranspPtr = false);
+                  const CConfig *config, bool needTranspPtr = false,
+                  bool mgSmoother = false);
 
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
@@ -102,6 +102,7 @@ private:
   LinearToleranceType tol_type = LinearToleranceType::RELATIVE; /*!< \brief How the linear solvers interpret the tolerance. */
   bool xIsZero = false;           /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;      /*!< \brief Recompute the residual after inner iterations, if monitoring. */
+  bool mgSmoother = false;        /*!< \brief Relax the coarse MG levels with MG_COARSE_SMOOTHER (flow solvers). */
   unsigned long monitorFreq = 10; /*!< \brief Monitoring frequency. */
 
   /*!
@@ -400,6 +401,12 @@ public:
    */
   inline void SetRecomputeResidual(bool recompRes) {recomputeRes = recompRes;}
 
+  /*!
+   * \brief Relax the coarse levels of the multigrid cycle with MG_COARSE_SMOOTHER instead of solving them.
+   * \note Only for the flow solvers, the other solvers are not cycled (but FULLMG solves them on coarse levels).
+   */
+  inline void SetMGCoarseSmoother(bool smoother) {mgSmoother = smoother;}
+
   /*!
    * \brief Set the screen output frequency during monitoring.
    */
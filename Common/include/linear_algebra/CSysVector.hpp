@@ -31,6 +31,7 @@
 #include "../parallelization/mpi_structure.hpp"
 #include "../parallelization/omp_structure.hpp"
 #include "../parallelization/vectorization.hpp"
+#include "../toolboxes/CProfiler.hpp"
 #include "vector_expressions.hpp"
 
 /*!
@@ -312,6 +313,7 @@ class CSysVector : public VecExpr::CVecExpr<CSysVector<ScalarType>, ScalarType>
     if (nElm != nElmDomain) {
       SU2_OMP_BARRIER
       SU2_OMP_MASTER {
+        SU2_PROFILE_SCOPE("MPI::Allreduce");
         sum = dotRes;
         const auto mpi_type = (sizeof(ScalarType) < sizeof(double)) ? MPI_FLOAT : MPI_DOUBLE;
         SelectMPIWrapper<ScalarType>::W::Allreduce(&sum, &dotRes, 1, mpi_type, MPI_SUM, SU2_MPI::GetComm());
@@ -29,6 +29,10 @@
 
 #pragma once
 
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
 /* LIBXSMM include files, if supported. */
 #ifdef HAVE_LIBXSMM
 #include "libxsmm.h"
@@ -56,17 +60,21 @@ public:
 
   /*!
    * \brief Function, which carries out a dense matrix product. It is a
-            limited version of the BLAS gemm functionality..
-   * \param[in]  M  - Number of rows of A and C.
-   * \param[in]  N  - Number of columns of B and C.
-   * \param[in]  K  - Number of columns of A and number of rows of B.
-   * \param[in]  A  - Input matrix in the multiplication.
-   * \param[in]  B  - Input matrix in the multiplication.
-   * \param[out] C  - Result of the matrix product A*B.
+            limited version of the BLAS gemm functionality. All matrices are
+            stored in row major order. The kernel for the sizes of the product
+            is taken from the kernel cache of the calling thread.
+   * \param[in]  M      - Number of rows of op(A) and C.
+   * \param[in]  N      - Number of columns of B and C.
+   * \param[in]  K      - Number of columns of op(A) and number of rows of B.
+   * \param[in]  A      - Input matrix in the multiplication.
+   * \param[in]  B      - Input matrix in the multiplication.
+   * \param[out] C      - Result of the matrix product op(A)*B.
+   * \param[in]  config - Definition of the problem, used for profiling only.
+   * \param[in]  transA - Whether op(A) is the transpose of A (K x M) or A itself (M x K).
    */
   void gemm(const int M,        const int N,        const int K,
             const su2double *A, const su2double *B, su2double *C,
-            const CConfig *config);
+            const CConfig *config, const bool transA = false);
 
   /*!
    * \brief Function, which carries out a dense matrix vector product
@@ -484,6 +492,64 @@ public:
 
 private:
 
+  /*!
+   * \brief Type of the native kernels for small matrix products, C = op(A)*B.
+   */
+  using SmallGemmKernel = void (*)(const int M, const int N, const int K,
+                                   const su2double *A, const su2double *B, su2double *C);
+
+  /*!
+   * \brief Kernel of the cache, which carries out a matrix product of fixed sizes.
+            If no kernel is set, the general gemm of the library is used.
+   */
+  struct GemmKernel {
+    SmallGemmKernel native = nullptr;   /*!< \brief Template specialized kernel. */
+#if defined(HAVE_LIBXSMM) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+    libxsmm_dmmfunction xsmm = nullptr; /*!< \brief JIT kernel generated by LIBXSMM. */
+#endif
+  };
+
+  std::vector<std::unordered_map<uint64_t, GemmKernel> > kernelCache; /*!< \brief Kernels of each thread, keyed on
+                                                                                   (M,N,K,transA). The caches are per
+                                                                                   thread to avoid locking. */
+
+  /*!
+   * \brief Function, which retrieves the kernel for the given sizes from the cache
+            of the calling thread. The kernel is created on the first request.
+   * \param[in] M      - Number of rows of op(A) and C.
+   * \param[in] N      - Number of columns of B and C.
+   * \param[in] K      - Number of columns of op(A) and number of rows of B.
+   * \param[in] transA - Whether op(A) is the transpose of A or A itself.
+   * \return The kernel to be used for the matrix product.
+   */
+  GemmKernel GetGemmKernel(const int M, const int N, const int K, const bool transA);
+
+  /*!
+   * \brief Function, which creates the kernel for a matrix product of the given sizes.
+   * \param[in] M      - Number of rows of op(A) and C.
+   * \param[in] N      - Number of columns of B and C.
+   * \param[in] K      - Number of columns of op(A) and number of rows of B.
+   * \param[in] transA - Whether op(A) is the transpose of A or A itself.
+   * \return The kernel to be used for the matrix product.
+   */
+  GemmKernel CreateGemmKernel(const int M, const int N, const int K, const bool transA) const;
+
+  /*!
+   * \brief Function, which carries out a matrix product with the given kernel.
+   * \param[in]  kernel - Kernel for the sizes of this product.
+   * \param[in]  M      - Number of rows of op(A) and C.
+   * \param[in]  N      - Number of columns of B and C.
+   * \param[in]  K      - Number of columns of op(A) and number of rows of B.
+   * \param[in]  A      - Input matrix in the multiplication.
+   * \param[in]  B      - Input matrix in the multiplication.
+   * \param[out] C      - Result of the matrix product op(A)*B.
+   * \param[in]  transA - Whether op(A) is the transpose of A or A itself.
+   */
+  void ExecuteGemmKernel(const GemmKernel &kernel,
+                         const int M,        const int N,        const int K,
+                         const su2double *A, const su2double *B, su2double *C,
+                         const bool transA);
+
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
     /* Blocking parameters for the outer kernel.  We multiply mc x kc blocks of
      the matrix A with kc x nc panels of the matrix B (this approach is referred
@@ -539,7 +539,8 @@ enum ENUM_FLUIDMODEL {
   INC_IDEAL_GAS = 5,      /*!< \brief Incompressible ideal gas model. */
   INC_IDEAL_GAS_POLY = 6, /*!< \brief Inc. ideal gas, polynomial gas model. */
   MUTATIONPP = 7,         /*!< \brief Mutation++ gas model for nonequilibrium flow. */
-  SU2_NONEQ = 8           /*!< \brief User defined gas model for nonequilibrium flow. */
+  SU2_NONEQ = 8,          /*!< \brief User defined gas model for nonequilibrium flow. */
+  LUT_GAS = 9             /*!< \brief Look-up table of a real gas (generated from another model or read from file). */
 };
 static const MapType<string, ENUM_FLUIDMODEL> FluidModel_Map = {
   MakePair("STANDARD_AIR", STANDARD_AIR)
@@ -551,6 +552,7 @@ static const MapType<string, ENUM_FLUIDMODEL> FluidModel_Map = {
   MakePair("INC_IDEAL_GAS_POLY", INC_IDEAL_GAS_POLY)
   MakePair("MUTATIONPP", MUTATIONPP)
   MakePair("SU2_NONEQ", SU2_NONEQ)
+  MakePair("LUT_GAS", LUT_GAS)
 };
 
 /*!
@@ -591,6 +593,18 @@ MakePair("WILKE", WILKE)
 MakePair("GUPTA-YOS", GUPTAYOS)
 };
 
+/*!
+ * \brief Types of time integration of the chemical and vibrational relaxation sources (NEMO)
+ */
+enum ENUM_CHEMISTRY_INTEGRATION {
+  COUPLED_CHEMISTRY = 0,   /*!< \brief Sources are part of the flow residual. */
+  POINT_IMPLICIT_CHEMISTRY = 1  /*!< \brief Sources are integrated per point after each flow update (operator splitting). */
+};
+static const MapType<string, ENUM_CHEMISTRY_INTEGRATION> ChemistryIntegration_Map = {
+MakePair("COUPLED", COUPLED_CHEMISTRY)
+MakePair("POINT_IMPLICIT", POINT_IMPLICIT_CHEMISTRY)
+};
+
 /*!
  * \brief Types of density models
  */
@@ -1749,12 +1763,28 @@ static const MapType<string, JUMP_DEFINITION> Jump_Map = {
 enum MG_CYCLE {
   V_CYCLE = 0,        /*!< \brief V cycle. */
   W_CYCLE = 1,        /*!< \brief W cycle. */
-  FULLMG_CYCLE = 2    /*!< \brief FullMG cycle. */
+  FULLMG_CYCLE = 2,   /*!< \brief FullMG cycle. */
+  F_CYCLE = 3         /*!< \brief F cycle (W cycle whose second visit of each level is a V cycle). */
 };
 static const MapType<string, MG_CYCLE> MG_Cycle_Map = {
   MakePair("V_CYCLE", V_CYCLE)
   MakePair("W_CYCLE", W_CYCLE)
   MakePair("FULLMG_CYCLE", FULLMG_CYCLE)
+  MakePair("F_CYCLE", F_CYCLE)
+};
+
+/*!
+ * \brief Smoothers of the implicit system on the coarse multigrid levels.
+ */
+enum ENUM_MG_COARSE_SMOOTHER {
+  MG_SMOOTHER_NONE = 0,     /*!< \brief Same linear solver as the fine level. */
+  MG_SMOOTHER_JACOBI = 1,   /*!< \brief Point (block) Jacobi sweeps. */
+  MG_SMOOTHER_LINELET = 2,  /*!< \brief Line Jacobi sweeps, along the linelets. */
+};
+static const MapType<string, ENUM_MG_COARSE_SMOOTHER> MG_Coarse_Smoother_Map = {
+  MakePair("NONE", MG_SMOOTHER_NONE)
+  MakePair("JACOBI", MG_SMOOTHER_JACOBI)
+  MakePair("LINELET", MG_SMOOTHER_LINELET)
 };
 
 /*!
@@ -2173,7 +2203,8 @@ enum MPI_QUANTITIES {
   MESH_DISPLACEMENTS   = 27,  /*!< \brief Mesh displacements at the interface. */
   SOLUTION_TIME_N      = 28,  /*!< \brief Solution at time n. */
   SOLUTION_TIME_N1     = 29,  /*!< \brief Solution at time n-1. */
-  PRIMITIVE            = 30   /*!< \brief Primitive solution communication. */
+  PRIMITIVE            = 30,  /*!< \brief Primitive solution communication. */
+  DELTA_TIME           = 31   /*!< \brief Local time step communication. */
 };
 
 /*!
@@ -34,6 +34,7 @@
 #endif
 
 #include <stdlib.h>
+#include <vector>
 #include "../basic_types/datatype_structure.hpp"
 #ifndef _MSC_VER
 #include <unistd.h>
@@ -148,6 +149,12 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { MPI_Comm_size(comm, size); }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) {
+    MPI_Comm_split(comm, color, key, newcomm);
+  }
+
+  static inline void Comm_free(Comm* comm) { MPI_Comm_free(comm); }
+
   static inline void Finalize() {
     if (winMinRankErrorInUse) MPI_Win_free(&winMinRankError);
     MPI_Finalize();
@@ -236,6 +243,18 @@ class CBaseMPIWrapper {
     MPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, recvdispls, recvtype, comm);
   }
 
+  static inline void Dist_graph_create_adjacent(Comm comm, int indegree, const int* sources, int outdegree,
+                                                const int* destinations, Comm* newcomm) {
+    MPI_Dist_graph_create_adjacent(comm, indegree, sources, MPI_UNWEIGHTED, outdegree, destinations, MPI_UNWEIGHTED,
+                                   MPI_INFO_NULL, 0, newcomm);
+  }
+
+  static inline void Neighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls,
+                                        Datatype sendtype, void* recvbuf, const int* recvcounts, const int* recvdispls,
+                                        Datatype recvtype, Comm comm) {
+    MPI_Neighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, recvdispls, recvtype, comm);
+  }
+
   static inline void Sendrecv(const void* sendbuf, int sendcnt, Datatype sendtype, int dest, int sendtag, void* recvbuf,
                               int recvcnt, Datatype recvtype, int source, int recvtag, Comm comm, Status* status) {
     MPI_Sendrecv(sendbuf, sendcnt, sendtype, dest, sendtag, recvbuf, recvcnt, recvtype, source, recvtag, comm, status);
@@ -447,6 +466,33 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
                    convertDatatype(recvtype), comm);
   }
 
+  static inline void Neighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls,
+                                        Datatype sendtype, void* recvbuf, const int* recvcounts, const int* recvdispls,
+                                        Datatype recvtype, Comm comm) {
+    /*--- Neighbourhood collectives are not differentiated by MeDi, use a regular Alltoallv
+     *    over the graph communicator with zero counts for the ranks that are not neighbours. ---*/
+    int indegree, outdegree, weighted, commSize;
+    MPI_Dist_graph_neighbors_count(comm, &indegree, &outdegree, &weighted);
+    MPI_Comm_size(comm, &commSize);
+
+    std::vector<int> sources(indegree), destinations(outdegree);
+    MPI_Dist_graph_neighbors(comm, indegree, sources.data(), MPI_UNWEIGHTED, outdegree, destinations.data(),
+                             MPI_UNWEIGHTED);
+
+    std::vector<int> allCounts(4*commSize, 0);
+    int *sendCnt = allCounts.data(), *sendDsp = sendCnt+commSize, *recvCnt = sendDsp+commSize, *recvDsp = recvCnt+commSize;
+    for (int i = 0; i < outdegree; ++i) {
+      sendCnt[destinations[i]] = sendcounts[i];
+      sendDsp[destinations[i]] = sdispls[i];
+    }
+    for (int i = 0; i < indegree; ++i) {
+      recvCnt[sources[i]] = recvcounts[i];
+      recvDsp[sources[i]] = recvdispls[i];
+    }
+    AMPI_Alltoallv(sendbuf, sendCnt, sendDsp, convertDatatype(sendtype), recvbuf, recvCnt, recvDsp,
+                   convertDatatype(recvtype), convertComm(comm));
+  }
+
   static inline void Sendrecv(const void* sendbuf, int sendcnt, Datatype sendtype, int dest, int sendtag, void* recvbuf,
                               int recvcnt, Datatype recvtype, int source, int recvtag, Comm comm, Status* status) {
     AMPI_Sendrecv(sendbuf, sendcnt, convertDatatype(sendtype), dest, sendtag, recvbuf, recvcnt,
@@ -528,6 +574,10 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { *size = 1; }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) { *newcomm = comm; }
+
+  static inline void Comm_free(Comm* comm) {}
+
   static inline void Finalize() {}
 
   static inline void Isend(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
@@ -599,6 +649,18 @@ class CBaseMPIWrapper {
     CopyData(sendbuf, recvbuf, recvcounts[0], recvtype);
   }
 
+  static inline void Dist_graph_create_adjacent(Comm comm, int indegree, const int* sources, int outdegree,
+                                                const int* destinations, Comm* newcomm) {
+    *newcomm = comm;
+  }
+
+  static inline void Neighbor_alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls,
+                                        Datatype sendtype, void* recvbuf, const int* recvcounts, const int* recvdispls,
+                                        Datatype recvtype, Comm comm) {
+    /*--- The only possible neighbour is this rank, callers must list it (even with no data). ---*/
+    CopyData(sendbuf, recvbuf, recvcounts[0], recvtype);
+  }
+
   static inline void Probe(int source, int tag, Comm comm, Status* status) {}
 
   static inline passivedouble Wtime(void) { return omp_get_wtime(); }
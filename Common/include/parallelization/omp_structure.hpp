@@ -47,7 +47,8 @@
 #endif
 
 /*--- Detect compilation with OpenMP support, protect agaisnt
- *    using OpenMP with Reverse AD (not supported yet). ---*/
+ *    using OpenMP with Reverse AD (not supported yet, the CoDiPack
+ *    tape is global and recording to it is not thread-safe). ---*/
 #if defined(_OPENMP) && !defined(CODI_REVERSE_TYPE)
 #define HAVE_OMP
 #include <omp.h>
@@ -86,6 +87,11 @@ inline constexpr int omp_get_thread_num() {return 0;}
  */
 inline constexpr bool omp_in_parallel() {return false;}
 
+/*!
+ * \brief Number of nested parallel regions enclosing the calling code.
+ */
+inline constexpr int omp_get_level() {return 0;}
+
 /*!
  * \brief Return the wall time.
  */
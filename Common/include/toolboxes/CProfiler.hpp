@@ -0,0 +1,163 @@
+/*!
+ * \file CProfiler.hpp
+ * \brief Low overhead, hierarchical profiler of scoped code regions, with
+ * per-thread accumulators, reduction of the timings over ranks and export
+ * to the Chrome trace format (chrome://tracing, Perfetto).
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+
+/*!
+ * \class CProfiler
+ * \brief Static profiler of named code regions, usually instrumented via SU2_PROFILE_SCOPE.
+ * \note Each thread keeps its own stack of open regions and its own accumulators, no
+ * synchronization is needed to begin or end a region. The exclusive time of a region
+ * excludes the time of the regions nested in it (on the same thread). The parent
+ * reported for a region is the first one it was found in.
+ * When the profiler is not enabled the cost of a scope is one (predictable) branch.
+ */
+class CProfiler {
+public:
+  /*!
+   * \brief Enable the profiler, must be called by all ranks, outside parallel regions.
+   * \param[in] trace - Also record individual events for the Chrome trace.
+   * \param[in] maxEvents - Maximum number of trace events stored per thread.
+   */
+  static void Enable(bool trace, unsigned long maxEvents = 1000000);
+
+  /*!
+   * \brief Stop collecting data (the data collected so far is kept).
+   */
+  static void Disable() { enabled = false; }
+
+  /*!
+   * \brief Check if the profiler is collecting data.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Get the identifier of a region, registering it if needed (thread safe).
+   * \note Regions with the same name share the identifier.
+   * \param[in] name - Name of the region.
+   */
+  static int RegisterRegion(const char* name);
+
+  /*!
+   * \brief Open a region on the calling thread.
+   * \param[in] id - Identifier of the region.
+   */
+  static void Begin(int id);
+
+  /*!
+   * \brief Close the innermost region of the calling thread.
+   * \param[in] id - Identifier of the region (to detect mismatched begin/end).
+   */
+  static void End(int id);
+
+  /*!
+   * \brief Reduce the timings over threads and ranks and write the summary to screen and to
+   *        a CSV file (min/avg/max over ranks of the inclusive and exclusive times), collective.
+   * \param[in] fileName - Name of the CSV file (without extension).
+   */
+  static void WriteSummary(const std::string& fileName);
+
+  /*!
+   * \brief Write the recorded events of all threads and ranks in Chrome trace (JSON) format, collective.
+   * \param[in] fileName - Name of the trace file (without extension).
+   */
+  static void WriteChromeTrace(const std::string& fileName);
+
+  /*!
+   * \brief Discard all the data collected so far (region names are kept).
+   */
+  static void Reset();
+
+private:
+  /*--- The profiler is enabled at the start of the run and only read afterwards. ---*/
+  static bool enabled;
+};
+
+/*!
+ * \class CProfilerScope
+ * \brief RAII marker of a code region, opens the region on construction and closes it on destruction.
+ */
+class CProfilerScope {
+private:
+  const int id;
+  const bool active;
+
+public:
+  inline explicit CProfilerScope(int id_) : id(id_), active(CProfiler::IsEnabled()) {
+    if (active) CProfiler::Begin(id);
+  }
+  inline ~CProfilerScope() {
+    if (active) CProfiler::End(id);
+  }
+  CProfilerScope(const CProfilerScope&) = delete;
+  CProfilerScope& operator=(const CProfilerScope&) = delete;
+};
+
+/*!
+ * \class CStageTimer
+ * \brief Wall time breakdown of a sequence of stages (e.g. of a preprocessing step), independent of CProfiler.
+ * \note Each call to Stage closes the current stage, stages with the same name are accumulated.
+ */
+class CStageTimer {
+private:
+  std::vector<std::string> names;
+  std::vector<double> times;
+  double start;
+
+public:
+  /*!
+   * \brief Construct and start timing the first stage.
+   */
+  CStageTimer();
+
+  /*!
+   * \brief End the current stage and start the next one.
+   * \param[in] name - Name of the stage that ended.
+   */
+  void Stage(const std::string& name);
+
+  /*!
+   * \brief Print the time of each stage (min/avg/max over ranks) on the master rank, collective.
+   * \param[in] title - Title of the table.
+   */
+  void WriteSummary(const std::string& title) const;
+};
+
+#define SU2_PROFILE_CONCAT_(A,B) A##B
+#define SU2_PROFILE_CONCAT(A,B) SU2_PROFILE_CONCAT_(A,B)
+
+/*!
+ * \brief Profile the remainder of the enclosing scope as region NAME (a string literal).
+ * \note The region is registered once (static initialization is thread safe).
+ */
+#define SU2_PROFILE_SCOPE(NAME)                                                          \
+  static const int SU2_PROFILE_CONCAT(su2ProfileId_, __LINE__) = CProfiler::RegisterRegion(NAME); \
+  const CProfilerScope SU2_PROFILE_CONCAT(su2ProfileScope_, __LINE__)(SU2_PROFILE_CONCAT(su2ProfileId_, __LINE__))
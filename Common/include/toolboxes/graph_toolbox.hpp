@@ -109,10 +109,10 @@ public:
    */
   CCompressedSparsePattern(su2vector<Index_t>&& outerPtr,
                            su2vector<Index_t>&& innerIdx) :
-    m_outerPtr(outerPtr), m_innerIdx(innerIdx)
+    m_outerPtr(std::move(outerPtr)), m_innerIdx(std::move(innerIdx))
   {
     /*--- perform a basic sanity check ---*/
-    assert(m_innerIdx.size() == m_outerPtr(m_outerPtr.size()-1));
+    assert(static_cast<Index_t>(m_innerIdx.size()) == m_outerPtr(m_outerPtr.size()-1));
   }
 
   /*!
@@ -133,7 +133,7 @@ public:
       m_innerIdx(i) = innerIdx.data()[i];
 
     /*--- perform a basic sanity check ---*/
-    assert(m_innerIdx.size() == m_outerPtr(m_outerPtr.size()-1));
+    assert(static_cast<Index_t>(m_innerIdx.size()) == m_outerPtr(m_outerPtr.size()-1));
   }
 
   /*!
@@ -62,6 +62,8 @@ public:
   /*!
    * \brief Virtual function, which computes the wall shear stress and heat flux
             from the data at the exchange location.
+   * \note The wall model of a boundary is shared by the threads of the FEM-DG task scheduler,
+           hence this is const, the only state that is modified is that of the (per-thread) FluidModel.
    * \param[in]  tExchange              - Temperature at the exchange location.
    * \param[in]  velExchange            - Velocity at the exchange location.
    * \param[in]  muExchange             - Laminar viscosity at the exchange location.
@@ -89,7 +91,7 @@ public:
                                           su2double       &tauWall,
                                           su2double       &qWall,
                                           su2double       &ViscosityWall,
-                                          su2double       &kOverCvWall);
+                                          su2double       &kOverCvWall) const;
 protected:
 
   su2double h_wm;    /*!< \brief The thickness of the wall model. This is also basically the exchange location */
@@ -147,7 +149,7 @@ public:
                                   su2double       &tauWall,
                                   su2double       &qWall,
                                   su2double       &ViscosityWall,
-                                  su2double       &kOverCvWall) override;
+                                  su2double       &kOverCvWall) const override;
 
 private:
 
@@ -206,7 +208,7 @@ public:
                                   su2double       &tauWall,
                                   su2double       &qWall,
                                   su2double       &ViscosityWall,
-                                  su2double       &kOverCvWall) override;
+                                  su2double       &kOverCvWall) const override;
 
 private:
 
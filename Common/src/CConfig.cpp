@@ -781,6 +781,83 @@ unsigned short CConfig::GetnDim(string val_mesh_filename, unsigned short val_for
   return (unsigned short) nDim;
 }
 
+unsigned long CConfig::GetnElem(string val_mesh_filename, unsigned short val_format, unsigned short val_iZone) {
+
+  unsigned long nElem = 0;
+
+  switch (val_format) {
+    case SU2: {
+
+      /*--- Local variables for reading the SU2 file. ---*/
+      string text_line;
+      ifstream mesh_file;
+
+      /*--- Open grid file ---*/
+      mesh_file.open(val_mesh_filename.c_str(), ios::in);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+
+      /*--- Read the SU2 mesh file until the element count of the requested zone
+            is found. Files without the IZONE keyword contain a single zone. ---*/
+      int iZone = -1;
+      while( getline (mesh_file, text_line) ) {
+
+        if(text_line.find ("IZONE=",0) != string::npos) {
+          text_line.erase (0,6); iZone = atoi(text_line.c_str())-1;
+          continue;
+        }
+
+        if((text_line.find ("NELEM=",0) != string::npos) && (iZone == -1 || iZone == val_iZone)) {
+          text_line.erase (0,6); nElem = atol(text_line.c_str());
+          break;
+        }
+      }
+
+      mesh_file.close();
+      break;
+    }
+
+    case CGNS_GRID: {
+
+#ifdef HAVE_CGNS
+
+      /*--- Local variables which are needed when calling the CGNS mid-level API. ---*/
+      int fn, nzones, file_type;
+      char zonename[CGNS_STRING_SIZE];
+      cgsize_t sizes[9];
+
+      if ( cg_is_cgns(val_mesh_filename.c_str(), &file_type) != CG_OK ) {
+        SU2_MPI::Error(val_mesh_filename +
+                       string(" was not found or is not a properly formatted CGNS file.\n") +
+                       string("Note that SU2 expects unstructured CGNS files in ADF data format."),
+                       CURRENT_FUNCTION);
+      }
+
+      /*--- The zones of the (only) database are the zones of the problem,
+            for unstructured zones the second size is the number of cells. ---*/
+      if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn) != CG_OK) cg_error_exit();
+      if (cg_nzones(fn, 1, &nzones) != CG_OK) cg_error_exit();
+      if (cg_zone_read(fn, 1, min(int(val_iZone)+1, nzones), zonename, sizes) != CG_OK) cg_error_exit();
+      if (cg_close(fn) != CG_OK) cg_error_exit();
+
+      nElem = sizes[1];
+
+#else
+      SU2_MPI::Error(string(" SU2 built without CGNS support. \n") +
+                     string(" To use CGNS, build SU2 accordingly."),
+                     CURRENT_FUNCTION);
+#endif
+
+      break;
+    }
+    default:
+      break;
+  }
+
+  return nElem;
+}
+
 void CConfig::SetPointersNull(void) {
 
   Marker_CfgFile_GeoEval      = nullptr;   Marker_All_GeoEval       = nullptr;
@@ -1035,6 +1112,8 @@ void CConfig::SetPointersNull(void) {
 
   Gas_Composition = nullptr;
 
+  Zone_Rank_Weights = nullptr;
+
 }
 
 void CConfig::SetRunTime_Options(void) {
@@ -1068,6 +1147,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("MULTIZONE", Multizone_Problem, NO);
   /*!\brief PHYSICAL_PROBLEM \n DESCRIPTION: Physical governing equations \n Options: see \link Solver_Map \endlink \n DEFAULT: NO_SOLVER \ingroup Config*/
   addEnumOption("MULTIZONE_SOLVER", Kind_MZSolver, Multizone_Map, MZ_BLOCK_GAUSS_SEIDEL);
+  /*!\brief CONCURRENT_ZONES \n DESCRIPTION: Iterate the zones of a multizone problem concurrently, each on its own group of ranks (requires MULTIZONE_SOLVER= BLOCK_JACOBI) \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("CONCURRENT_ZONES", Concurrent_Zones, false);
+  /*!\brief ZONE_RANK_WEIGHTS \n DESCRIPTION: Relative cost of each zone used to distribute the ranks when CONCURRENT_ZONES= YES, by default the number of elements of each zone \ingroup Config*/
+  addDoubleListOption("ZONE_RANK_WEIGHTS", nZone_Rank_Weights, Zone_Rank_Weights);
 #ifdef CODI_REVERSE_TYPE
   const bool discAdjDefault = true;
 #else
@@ -1158,6 +1241,11 @@ void CConfig::SetConfig_Options() {
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
   addBoolOption("VT_RESIDUAL_LIMITING", vt_transfer_res_limit, false);
+  /* DESCRIPTION: Time integration of the chemical and vibrational relaxation sources, COUPLED with the flow
+   * residual, or POINT_IMPLICIT to integrate them per point after each flow update (operator splitting) */
+  addEnumOption("CHEMISTRY_INTEGRATION", Kind_ChemistryIntegration, ChemistryIntegration_Map, COUPLED_CHEMISTRY);
+  /* DESCRIPTION: Maximum number of substeps of the POINT_IMPLICIT chemistry integration */
+  addUnsignedShortOption("CHEMISTRY_MAX_SUBSTEPS", nChemistry_MaxSubsteps, 50);
   /* DESCRIPTION: List of catalytic walls */
   addStringListOption("CATALYTIC_WALL", nWall_Catalytic, Wall_Catalytic);
   /*!\brief MARKER_MONITORING\n DESCRIPTION: Marker(s) of the surface where evaluate the non-dimensional coefficients \ingroup Config*/
@@ -1176,6 +1264,18 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the look-up table fluid model ---*/
+  /* DESCRIPTION: Fluid model used to generate the table (IDEAL_GAS, VW_GAS, PR_GAS) */
+  addEnumOption("LUT_BASE_MODEL", Kind_LUT_BaseModel, FluidModel_Map, PR_GAS);
+  /* DESCRIPTION: CSV file with the table, NONE to generate it from LUT_BASE_MODEL */
+  addStringOption("LUT_FILENAME", LUT_FileName, string("NONE"));
+  /* DESCRIPTION: Density range (min, max) of the generated table */
+  addDoubleArrayOption("LUT_DENSITY_RANGE", LUT_DensityRange.size(), LUT_DensityRange.data());
+  /* DESCRIPTION: Temperature range (min, max) of the generated table */
+  addDoubleArrayOption("LUT_TEMPERATURE_RANGE", LUT_TemperatureRange.size(), LUT_TemperatureRange.data());
+  /* DESCRIPTION: Number of density and energy points of the generated table */
+  addUShortArrayOption("LUT_SIZE", LUT_Size.size(), LUT_Size.data());
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -1597,6 +1697,17 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Use the adaptive controller (preconditioner reuse, Eisenstat-Walker tolerances, checked CFL ramp). */
+  addBoolOption("NEWTON_KRYLOV_ADAPT", NewtonKrylovAdapt, false);
+  /* DESCRIPTION: Adaptive controller parameters {EW gamma, EW alpha, max tolerance, rebuild rate, unstable rate, max reuse}. */
+  addDoubleArrayOption("NEWTON_KRYLOV_ADAPT_PARAM", NK_AdaptParam.size(), NK_AdaptParam.data());
+
+  /* DESCRIPTION: Only compute the fluxes of the points that are not converged (steady implicit problems). */
+  addBoolOption("ACTIVE_SET", ActiveSet, false);
+  /* DESCRIPTION: Points whose residuals are these orders of magnitude below the RMS residual are frozen. */
+  addDoubleOption("ACTIVE_SET_THRESHOLD", ActiveSet_Threshold, -2.0);
+  /* DESCRIPTION: Frequency of the full sweeps (all points), which update the active set. */
+  addUnsignedLongOption("ACTIVE_SET_FREQUENCY", ActiveSet_Freq, 10);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1634,6 +1745,8 @@ void CConfig::SetConfig_Options() {
   addDoubleListOption("RK_ALPHA_COEFF", nRKStep, RK_Alpha_Step);
   /* DESCRIPTION: Number of time levels for time accurate local time stepping. */
   addUnsignedShortOption("LEVELS_TIME_ACCURATE_LTS", nLevels_TimeAccurateLTS, 1);
+  /* DESCRIPTION: Number of power-of-two time levels of the multirate explicit integration of the FVM flow solvers. */
+  addUnsignedShortOption("MULTIRATE_TIME_LEVELS", nLevels_Multirate, 1);
   /* DESCRIPTION: Number of time DOFs used in the predictor step of ADER-DG. */
   addUnsignedShortOption("TIME_DOFS_ADER_DG", nTimeDOFsADER_DG, 2);
   /* DESCRIPTION: Unsteady Courant-Friedrichs-Lewy number of the finest grid */
@@ -1722,6 +1835,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("DISCADJ_LIN_SOLVER", Kind_DiscAdj_Linear_Solver, Linear_Solver_Map, FGMRES);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
   addEnumOption("DISCADJ_LIN_PREC", Kind_DiscAdj_Linear_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Record only the residual and solve the discrete adjoint system with the Krylov method above */
+  addBoolOption("DISCADJ_RESIDUAL_KRYLOV", DiscAdj_Residual_Krylov, false);
   /* DESCRIPTION: Linear solver for the discete adjoint systems */
 
   /*!\par CONFIG_CATEGORY: Convergence\ingroup Config*/
@@ -1771,6 +1886,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_COARSE_SMOOTHER\n DESCRIPTION: Point or line Jacobi sweeps of the (assembled) flow Jacobian, instead of the linear solver, on the coarse levels. OPTIONS: See \link MG_Coarse_Smoother_Map \endlink. DEFAULT: NONE \ingroup Config*/
+  addEnumOption("MG_COARSE_SMOOTHER", Kind_MG_Coarse_Smoother, MG_Coarse_Smoother_Map, MG_SMOOTHER_NONE);
+  /*!\brief MG_COARSE_SMOOTHER_ITER\n DESCRIPTION: Number of sweeps of the coarse level smoother. DEFAULT: 2 \ingroup Config*/
+  addUnsignedShortOption("MG_COARSE_SMOOTHER_ITER", MG_Coarse_Smoother_Iter, 2);
+  /*!\brief MG_AGGLOMERATION_BLOCK_SIZE\n DESCRIPTION: Size of the blocks of points agglomerated concurrently, 0 agglomerates the whole domain serially. DEFAULT: 0 \ingroup Config*/
+  addUnsignedLongOption("MG_AGGLOMERATION_BLOCK_SIZE", MG_Agglomeration_BlockSize, 0);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1804,6 +1925,10 @@ void CConfig::SetConfig_Options() {
   /*!\brief SLOPE_LIMITER_FLOW
    * DESCRIPTION: Slope limiter for the direct solution. \n OPTIONS: See \link Limiter_Map \endlink \n DEFAULT VENKATAKRISHNAN \ingroup Config*/
   addEnumOption("SLOPE_LIMITER_FLOW", Kind_SlopeLimit_Flow, Limiter_Map, VENKATAKRISHNAN);
+  /*!\brief FUSED_GRADIENT_LIMITER \n DESCRIPTION: Compute the reconstruction gradients and the limiters of the flow in one pass over the grid \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", Fused_Gradient_Limiter, false);
+  /*!\brief MUSCL_SINGLE_PRECISION \n DESCRIPTION: Store the limited reconstruction gradients of the flow in single precision (requires FUSED_GRADIENT_LIMITER) \ingroup Config*/
+  addBoolOption("MUSCL_SINGLE_PRECISION", MUSCL_Single_Precision, false);
   jst_coeff[0] = 0.5; jst_coeff[1] = 0.02;
   /*!\brief JST_SENSOR_COEFF \n DESCRIPTION: 2nd and 4th order artificial dissipation coefficients for the JST method \ingroup Config*/
   addDoubleArrayOption("JST_SENSOR_COEFF", 2, jst_coeff);
@@ -2002,6 +2127,14 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
+  /* DESCRIPTION: Profile the main stages and kernels of the solver with scoped timers, the min/avg/max
+   * timings over ranks are written to screen and to PROFILING_FILENAME.csv at the end of SU2_CFD  \ingroup Config*/
+  addBoolOption("WRT_PROFILING", Wrt_Profiling, false);
+  /* DESCRIPTION: Also write the profiled events of all threads and ranks in Chrome trace format (PROFILING_FILENAME.json)  \ingroup Config*/
+  addBoolOption("WRT_PROFILING_TRACE", Wrt_Profiling_Trace, false);
+  /*!\brief PROFILING_FILENAME
+   *  \n DESCRIPTION: Output file for the profiling summary and trace (w/o extension)  \ingroup Config*/
+  addStringOption("PROFILING_FILENAME", Profiling_FileName, string("profiling"));
   /*!\brief MARKER_ANALYZE_AVERAGE
    *  \n DESCRIPTION: Output averaged flow values on specified analyze marker.
    *  Options: AREA, MASSFLUX
@@ -2665,6 +2798,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Reuse the partitioning, the periodic matching, and the wall distance of previous runs on the same mesh and number of ranks */
+  addBoolOption("GEOMETRY_CACHE", Geometry_Cache, false);
+
+  /* DESCRIPTION: Base name of the geometry cache file (the number of ranks is appended) */
+  addStringOption("GEOMETRY_CACHE_FILENAME", Geometry_Cache_FileName, string("geometry_cache"));
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -3537,6 +3676,21 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
       SU2_MPI::Error("The option of FROZEN_MIXTURE is not yet working with Mutation++ support.", CURRENT_FUNCTION);
   }
 
+  if (nemo && Kind_ChemistryIntegration == POINT_IMPLICIT_CHEMISTRY) {
+    if (GetKind_FluidModel() != SU2_NONEQ)
+      SU2_MPI::Error("CHEMISTRY_INTEGRATION= POINT_IMPLICIT requires FLUID_MODEL= SU2_NONEQ.", CURRENT_FUNCTION);
+    if (nChemistry_MaxSubsteps == 0)
+      SU2_MPI::Error("CHEMISTRY_MAX_SUBSTEPS must be at least 1.", CURRENT_FUNCTION);
+    /*--- The split integration is over the time step of the flow update, the steady state would depend on the
+     *    (local) time step, and with dual time stepping on the pseudo time step instead of the physical one. ---*/
+    if ((TimeMarching != TIME_STEPPING) ||
+        ((Kind_TimeIntScheme_Flow != EULER_EXPLICIT) && (Kind_TimeIntScheme_Flow != RUNGE_KUTTA_EXPLICIT) &&
+         (Kind_TimeIntScheme_Flow != CLASSICAL_RK4_EXPLICIT)))
+      SU2_MPI::Error("CHEMISTRY_INTEGRATION= POINT_IMPLICIT requires TIME_MARCHING= TIME_STEPPING and an explicit\n"
+                     "TIME_DISCRE_FLOW (use CHEMISTRY_INTEGRATION= COUPLED for steady or implicit simulations).",
+                     CURRENT_FUNCTION);
+  }
+
   if(GetBoolTurbomachinery()){
     nBlades = new su2double[nZone];
     FreeStreamTurboNormal= new su2double[3];
@@ -4914,6 +5068,67 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     LeastSquaresRequired = true;
   }
 
+  if (NewtonKrylov && NewtonKrylovAdapt) {
+    const auto& prm = NK_AdaptParam;
+    if ((prm[0] <= 0.0) || (prm[0] > 1.0) || (prm[1] <= 1.0) || (prm[1] > 2.0) ||
+        (prm[2] <= 0.0) || (prm[2] >= 1.0) || (prm[3] <= 0.0) || (prm[4] < prm[3]) || (prm[5] < 1.0)) {
+      SU2_MPI::Error(string("Invalid NEWTON_KRYLOV_ADAPT_PARAM, the valid ranges are 0 < gamma <= 1, 1 < alpha <= 2,\n") +
+                     string("0 < max tolerance < 1, 0 < rebuild rate <= unstable rate, and max reuse >= 1."), CURRENT_FUNCTION);
+    }
+  }
+
+  if (Kind_MG_Coarse_Smoother != MG_SMOOTHER_NONE) {
+    if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || DiscreteAdjoint) {
+      SU2_MPI::Error("MG_COARSE_SMOOTHER requires TIME_DISCRE_FLOW= EULER_IMPLICIT, and it is not available for adjoints.", CURRENT_FUNCTION);
+    }
+    if (MG_Coarse_Smoother_Iter == 0) {
+      SU2_MPI::Error("MG_COARSE_SMOOTHER_ITER must be greater than 0.", CURRENT_FUNCTION);
+    }
+  }
+
+  if (ActiveSet) {
+    if ((TimeMarching != STEADY) || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || NewtonKrylov) {
+      SU2_MPI::Error("ACTIVE_SET requires a steady problem with TIME_DISCRE_FLOW= EULER_IMPLICIT (and no NEWTON_KRYLOV).", CURRENT_FUNCTION);
+    }
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+        (nMGLevels != 0) || (nMarker_PerBound > 0) || AD_Mode) {
+      SU2_MPI::Error(string("ACTIVE_SET is only available for the compressible EULER, NAVIER_STOKES and RANS\n") +
+                     string("solvers, without multigrid, periodic boundaries, or AD."), CURRENT_FUNCTION);
+    }
+    if ((ActiveSet_Freq < 2) || (ActiveSet_Threshold >= 0.0)) {
+      SU2_MPI::Error("ACTIVE_SET requires ACTIVE_SET_FREQUENCY > 1 and ACTIVE_SET_THRESHOLD < 0.", CURRENT_FUNCTION);
+    }
+  }
+
+  /*--- Multirate explicit time integration of the FVM flow solvers. ---*/
+
+  if (nLevels_Multirate == 0) nLevels_Multirate = 1;
+  if (nLevels_Multirate > 15) nLevels_Multirate = 15;
+
+  if (nLevels_Multirate > 1) {
+    if ((TimeMarching != TIME_STEPPING) || (Unst_CFL == 0.0)) {
+      SU2_MPI::Error("MULTIRATE_TIME_LEVELS requires TIME_MARCHING= TIME_STEPPING and UNST_CFL_NUMBER > 0.", CURRENT_FUNCTION);
+    }
+    if ((Kind_TimeIntScheme_Flow != RUNGE_KUTTA_EXPLICIT) && (Kind_TimeIntScheme_Flow != EULER_EXPLICIT)) {
+      SU2_MPI::Error("MULTIRATE_TIME_LEVELS requires TIME_DISCRE_FLOW= RUNGE-KUTTA_EXPLICIT or EULER_EXPLICIT.", CURRENT_FUNCTION);
+    }
+    if ((Kind_TimeIntScheme_Flow == RUNGE_KUTTA_EXPLICIT) && (RK_Alpha_Step[nRKStep-1] != 1.0)) {
+      SU2_MPI::Error("MULTIRATE_TIME_LEVELS requires the last RK_ALPHA_COEFF to be 1 (for conservation).", CURRENT_FUNCTION);
+    }
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES)) ||
+        (nMGLevels != 0) || (nMarker_PerBound > 0) || AD_Mode || (Comm_Level != COMM_FULL)) {
+      SU2_MPI::Error(string("MULTIRATE_TIME_LEVELS is only available for the compressible EULER and NAVIER_STOKES\n") +
+                     string("solvers, without multigrid, periodic boundaries, or AD, and with COMM_LEVEL= FULL."), CURRENT_FUNCTION);
+    }
+  }
+
+  if (Fused_Gradient_Limiter && ((nMarker_PerBound > 0) || AD_Mode)) {
+    SU2_MPI::Error("FUSED_GRADIENT_LIMITER is not compatible with periodic boundaries or with AD.", CURRENT_FUNCTION);
+  }
+  if (MUSCL_Single_Precision && (!Fused_Gradient_Limiter || UseVectorization)) {
+    SU2_MPI::Error("MUSCL_SINGLE_PRECISION requires FUSED_GRADIENT_LIMITER= YES and USE_VECTORIZATION= NO.", CURRENT_FUNCTION);
+  }
+
   if (Kind_Gradient_Method == LEAST_SQUARES) {
     SU2_MPI::Error(string("LEAST_SQUARES gradient method not allowed for viscous / source terms.\n") +
                    string("Please select either WEIGHTED_LEAST_SQUARES or GREEN_GAUSS."),
@@ -6499,6 +6714,11 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
       if (MGCycle == V_CYCLE) cout << "V Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
       if (MGCycle == W_CYCLE) cout << "W Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
       if (MGCycle == FULLMG_CYCLE) cout << "Full Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
+      if (MGCycle == F_CYCLE) cout << "F Multigrid Cycle, with " << nMGLevels << " multigrid levels."<< endl;
+      if (Kind_MG_Coarse_Smoother == MG_SMOOTHER_JACOBI)
+        cout << MG_Coarse_Smoother_Iter << " point Jacobi sweeps on the coarse levels." << endl;
+      if (Kind_MG_Coarse_Smoother == MG_SMOOTHER_LINELET)
+        cout << MG_Coarse_Smoother_Iter << " line Jacobi sweeps on the coarse levels." << endl;
 
       cout << "Damping factor for the residual restriction: " << Damp_Res_Restric <<"."<< endl;
       cout << "Damping factor for the correction prolongation: " << Damp_Correc_Prolong <<"."<< endl;
@@ -7750,6 +7970,7 @@ CConfig::~CConfig(void) {
   delete [] HistoryOutput;
   delete [] VolumeOutput;
   delete [] Mesh_Box_Size;
+  delete [] Zone_Rank_Weights;
   delete [] VolumeOutputFiles;
 
   delete [] ConvField;
@@ -9425,31 +9646,36 @@ void CConfig::GEMM_Tock(double val_start_time, int M, int N, int K) const {
   const double val_elapsed_time = val_stop_time - val_start_time;
 
   /* Create the CLong3T from the M-N-K values and check if it is already
-     stored in the map GEMM_Profile_MNK. */
+     stored in the map GEMM_Profile_MNK. The profiling data is shared,
+     hence only one thread at a time may update it. */
   CLong3T MNK(M, N, K);
-  map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
-  if(MI == GEMM_Profile_MNK.end()) {
+  SU2_OMP_CRITICAL
+  {
+    map<CLong3T, int>::iterator MI = GEMM_Profile_MNK.find(MNK);
 
-    /* Entry is not present yet. Create it. */
-    const int ind = GEMM_Profile_MNK.size();
-    GEMM_Profile_MNK[MNK] = ind;
+    if(MI == GEMM_Profile_MNK.end()) {
 
-    GEMM_Profile_NCalls.push_back(1);
-    GEMM_Profile_TotTime.push_back(val_elapsed_time);
-    GEMM_Profile_MinTime.push_back(val_elapsed_time);
-    GEMM_Profile_MaxTime.push_back(val_elapsed_time);
-  }
-  else {
+      /* Entry is not present yet. Create it. */
+      const int ind = GEMM_Profile_MNK.size();
+      GEMM_Profile_MNK[MNK] = ind;
 
-    /* Entry is already present. Determine its index in the
-       map and update the corresponding vectors. */
-    const int ind = MI->second;
-    ++GEMM_Profile_NCalls[ind];
-    GEMM_Profile_TotTime[ind] += val_elapsed_time;
-    GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
-    GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
-  }
+      GEMM_Profile_NCalls.push_back(1);
+      GEMM_Profile_TotTime.push_back(val_elapsed_time);
+      GEMM_Profile_MinTime.push_back(val_elapsed_time);
+      GEMM_Profile_MaxTime.push_back(val_elapsed_time);
+    }
+    else {
+
+      /* Entry is already present. Determine its index in the
+         map and update the corresponding vectors. */
+      const int ind = MI->second;
+      ++GEMM_Profile_NCalls[ind];
+      GEMM_Profile_TotTime[ind] += val_elapsed_time;
+      GEMM_Profile_MinTime[ind]  = min(GEMM_Profile_MinTime[ind], val_elapsed_time);
+      GEMM_Profile_MaxTime[ind]  = max(GEMM_Profile_MaxTime[ind], val_elapsed_time);
+    }
+  } // end SU2_OMP_CRITICAL
 
 #endif
 
@@ -28,6 +28,7 @@
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
 /*--- Cross product ---*/
 
@@ -751,6 +752,8 @@ void CGeometry::CompleteComms(CGeometry *geometry,
 
   if (nP2PRecv == 0) return;
 
+  SU2_PROFILE_SCOPE("MPI::CompleteComms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
@@ -1391,31 +1394,51 @@ su2double CGeometry::Point2Plane_Distance(const su2double *Coord, const su2doubl
 
 void CGeometry::SetEdges(void) {
 
-  nEdge = 0;
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
-      auto jPoint = nodes->GetPoint(iPoint, iNode);
-      for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
-        if (nodes->GetPoint(jPoint, jNode) == iPoint) {
-          auto TestEdge = nodes->GetEdge(jPoint, jNode);
-          if (TestEdge == -1) {
-            nodes->SetEdge(iPoint, nEdge, iNode);
-            nodes->SetEdge(jPoint, nEdge, jNode);
-            nEdge++;
-          }
-          break;
-        }
-      }
+  SU2_PROFILE_SCOPE("Geometry::SetEdges");
+
+  /*--- An edge is numbered by its lowest point, in the order in which the points and their
+   *    neighbors are visited. Each point owns a contiguous range of edges, starting at a
+   *    position given by a prefix sum of the counts. The result is the same as that of a
+   *    sequential loop over points, regardless of the number of threads. ---*/
+
+  vector<unsigned long> edgeStart(nPoint+1);
+
+  SU2_OMP_PARALLEL
+  {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      unsigned long nEdgePoint = 0;
+      for (auto jPoint : nodes->GetPoints(iPoint)) nEdgePoint += (iPoint < jPoint);
+      edgeStart[iPoint+1] = nEdgePoint;
     }
-  }
 
-  edges = new CEdge(nEdge,nDim);
+    SU2_OMP_MASTER
+    {
+      edgeStart[0] = 0;
+      for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) edgeStart[iPoint+1] += edgeStart[iPoint];
+      nEdge = edgeStart[nPoint];
+      edges = new CEdge(nEdge,nDim);
+    }
+    SU2_OMP_BARRIER
+
+    /*--- Each position of the adjacency belongs to one edge, hence there are no races. ---*/
+
+    SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+    for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+      auto iEdge = edgeStart[iPoint];
+      for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+        const auto jPoint = nodes->GetPoint(iPoint, iNode);
+        if (jPoint <= iPoint) continue;
 
-  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
-    for (auto jPoint : nodes->GetPoints(iPoint)) {
-      if (iPoint < jPoint) {
-        auto iEdge = FindEdge(iPoint, jPoint);
+        nodes->SetEdge(iPoint, iEdge, iNode);
+        for (auto jNode = 0u; jNode < nodes->GetnPoint(jPoint); jNode++) {
+          if (nodes->GetPoint(jPoint, jNode) == iPoint) {
+            nodes->SetEdge(jPoint, iEdge, jNode);
+            break;
+          }
+        }
         edges->SetNodes(iEdge, iPoint, jPoint);
+        ++iEdge;
       }
     }
   }
@@ -3871,24 +3894,9 @@ const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* effic
       return elemColoring;
     }
 
-    /*--- Create a temporary sparse pattern from the elements. ---*/
-    vector<unsigned long> outerPtr(nElem+1);
-    vector<unsigned long> innerIdx; innerIdx.reserve(nElem);
-
-    for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
-      outerPtr[iElem] = innerIdx.size();
-
-      for (unsigned short iNode = 0; iNode < elem[iElem]->GetnNodes(); ++iNode) {
-        innerIdx.push_back(elem[iElem]->GetNode(iNode));
-      }
-    }
-    outerPtr[nElem] = innerIdx.size();
-
-    CCompressedSparsePatternUL pattern(outerPtr, innerIdx);
-
     /*--- Color the elements. ---*/
     constexpr bool balanceColors = true;
-    elemColoring = colorSparsePattern(pattern, elemColorGroupSize, balanceColors);
+    elemColoring = colorSparsePattern(GetElementPattern(), elemColorGroupSize, balanceColors);
 
     /*--- Same as for the edge coloring. ---*/
     if (elemColoring.empty()) SetNaturalElementColoring();
@@ -3900,6 +3908,39 @@ const CCompressedSparsePatternUL& CGeometry::GetElementColoring(su2double* effic
   return elemColoring;
 }
 
+const CCompressedSparsePatternUL& CGeometry::GetDualGridColoring()
+{
+  if (dualGridColoring.empty() && (nElem > 0)) {
+
+    /*--- Same as the element coloring with threads, but built for any number of them. ---*/
+    constexpr bool balanceColors = true;
+    dualGridColoring = colorSparsePattern(GetElementPattern(), 1, balanceColors);
+    dualGridColorGroupSize = 1;
+
+    if (dualGridColoring.empty()) {
+      dualGridColoring = createNaturalColoring(nElem);
+      dualGridColorGroupSize = nElem;
+    }
+  }
+  return dualGridColoring;
+}
+
+CCompressedSparsePatternUL CGeometry::GetElementPattern() const
+{
+  vector<unsigned long> outerPtr(nElem+1);
+  vector<unsigned long> innerIdx; innerIdx.reserve(nElem);
+
+  for (unsigned long iElem = 0; iElem < nElem; ++iElem) {
+    outerPtr[iElem] = innerIdx.size();
+
+    const auto elemNodes = elemStore.GetNodes(iElem);
+    innerIdx.insert(innerIdx.end(), elemNodes, elemNodes+elemStore.GetnNodes(iElem));
+  }
+  outerPtr[nElem] = innerIdx.size();
+
+  return CCompressedSparsePatternUL(outerPtr, innerIdx);
+}
+
 void CGeometry::SetNaturalElementColoring()
 {
   if (nElem == 0) return;
@@ -3908,6 +3949,17 @@ void CGeometry::SetNaturalElementColoring()
   if (omp_get_max_threads() > 1) elemColorGroupSize = nElem;
 }
 
+bool CGeometry::WallDistanceNeeded(const CConfig *config) {
+
+  const auto kindSolver = static_cast<ENUM_MAIN_SOLVER>(config->GetKind_Solver());
+  return (kindSolver == RANS ||
+          kindSolver == INC_RANS ||
+          kindSolver == DISC_ADJ_RANS ||
+          kindSolver == DISC_ADJ_INC_RANS ||
+          kindSolver == FEM_LES ||
+          kindSolver == FEM_RANS);
+}
+
 void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeometry ****geometry_container){
 
   int nZone = config_container[ZONE_0]->GetnZone();
@@ -3919,15 +3971,7 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
 
       /*--- Check if a zone needs the wall distance and store a boolean ---*/
 
-      ENUM_MAIN_SOLVER kindSolver = static_cast<ENUM_MAIN_SOLVER>(config_container[iZone]->GetKind_Solver());
-      if (kindSolver == RANS ||
-          kindSolver == INC_RANS ||
-          kindSolver == DISC_ADJ_RANS ||
-          kindSolver == DISC_ADJ_INC_RANS ||
-          kindSolver == FEM_LES ||
-          kindSolver == FEM_RANS){
-        wallDistanceNeeded[iZone] = true;
-      }
+      wallDistanceNeeded[iZone] = WallDistanceNeeded(config_container[iZone]);
 
       /*--- Set the wall distances in all zones to the numerical limit.
      * This is necessary, because before a computed distance is set, it will be checked
@@ -0,0 +1,468 @@
+/*!
+ * \file CGeometryCache.cpp
+ * \brief Cache file of geometry preprocessing results (partitioning and wall distance).
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/geometry/CGeometryCache.hpp"
+#include "../../include/geometry/CGeometry.hpp"
+#include "../../include/toolboxes/CLinearPartitioner.hpp"
+
+namespace {
+
+/*--- FNV-1a hash, "hash" is the running value. ---*/
+void HashBytes(const void* data, size_t bytes, unsigned long& hash) {
+  const auto ptr = static_cast<const unsigned char*>(data);
+  for (size_t i = 0; i < bytes; ++i) {
+    hash ^= ptr[i];
+    hash *= 0x100000001b3ul;
+  }
+}
+
+template<class T>
+void Hash(const T& value, unsigned long& hash) { HashBytes(&value, sizeof(T), hash); }
+
+const unsigned long HASH_SEED = 0xcbf29ce484222325ul;
+
+/*--- Hash of the connectivity of the volume elements. ---*/
+void HashElements(const CPrimalGridStore& store, unsigned long& hash) {
+  for (auto iElem = 0ul; iElem < store.GetnElem(); ++iElem) {
+    Hash(store.GetGlobalIndex(iElem), hash);
+    Hash(store.GetVTK_Type(iElem), hash);
+    HashBytes(store.GetNodes(iElem), store.GetnNodes(iElem)*sizeof(unsigned long), hash);
+  }
+}
+
+/*--- Hash of the connectivity of the boundary elements of a marker. ---*/
+void HashElements(CPrimalGrid* const* bound, unsigned long nElem, unsigned long& hash) {
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    Hash(bound[iElem]->GetVTK_Type(), hash);
+    for (unsigned short iNode = 0; iNode < bound[iElem]->GetnNodes(); ++iNode)
+      Hash(bound[iElem]->GetNode(iNode), hash);
+  }
+}
+
+/*--- Vertices of the owned points of the periodic markers, in the order in which
+ *    CGeometry::MatchPeriodic processes them (by pair of markers). ---*/
+vector<CVertex*> PeriodicVertices(const CGeometry* geometry, const CConfig* config) {
+  vector<CVertex*> vertices;
+  const auto nPeriodic = config->GetnMarker_Periodic();
+
+  for (unsigned short iPeriodic = 1; iPeriodic <= nPeriodic/2; ++iPeriodic) {
+    for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker) {
+      if (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) continue;
+      const auto jPeriodic = config->GetMarker_All_PerBound(iMarker);
+      if ((jPeriodic != iPeriodic) && (jPeriodic != iPeriodic + nPeriodic/2)) continue;
+
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        if (geometry->nodes->GetDomain(geometry->vertex[iMarker][iVertex]->GetNode()))
+          vertices.push_back(geometry->vertex[iMarker][iVertex]);
+      }
+    }
+  }
+  return vertices;
+}
+
+}
+
+CGeometryCache::CGeometryCache(const CConfig* config, const CGeometry* geometry) {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  fileName = config->GetMultizone_FileName(config->GetGeometry_Cache_FileName() + "_" + to_string(size),
+                                           config->GetiZone(), ".dat");
+  nPointGlobal = geometry->GetGlobal_nPointDomain();
+
+  /*--- Local part of the key, the mesh as read by this rank. ---*/
+
+  unsigned long localKey = HASH_SEED;
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    for (auto iDim = 0u; iDim < geometry->GetnDim(); ++iDim) {
+      const passivedouble coord = SU2_TYPE::GetValue(geometry->nodes->GetCoord(iPoint, iDim));
+      Hash(coord, localKey);
+    }
+  }
+  HashElements(geometry->GetElemStore(), localKey);
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker)
+    HashElements(geometry->bound[iMarker], geometry->GetnElem_Bound(iMarker), localKey);
+
+  /*--- Combine the keys of all ranks (in rank order) with the global data and options. ---*/
+
+  vector<unsigned long> allKeys(size);
+  SU2_MPI::Allgather(&localKey, 1, MPI_UNSIGNED_LONG, allKeys.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  key = HASH_SEED;
+  HashBytes(allKeys.data(), size*sizeof(unsigned long), key);
+  Hash(nPointGlobal, key);
+  Hash(size, key);
+  Hash(config->GetKind_Solver(), key);
+  Hash(config->GetParMETIS_Tolerance(), key);
+  Hash(config->GetParMETIS_PointWeight(), key);
+  Hash(config->GetParMETIS_EdgeWeight(), key);
+
+  /*--- Markers as defined in the config file (the "All" markers are rank dependent). ---*/
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_CfgFile(); ++iMarker) {
+    const auto tag = config->GetMarker_CfgFile_TagBound(iMarker);
+    HashBytes(tag.data(), tag.size(), key);
+    Hash(config->GetMarker_CfgFile_KindBC(tag), key);
+    const auto roughness = config->GetWallRoughnessProperties(tag);
+    Hash(roughness.first, key);
+    Hash(SU2_TYPE::GetValue(roughness.second), key);
+
+    if (config->GetMarker_CfgFile_KindBC(tag) == PERIODIC_BOUNDARY) {
+      for (const auto values : {config->GetPeriodicRotCenter(tag), config->GetPeriodicRotAngles(tag),
+                                config->GetPeriodicTranslation(tag)}) {
+        for (auto iDim = 0u; iDim < 3; ++iDim) Hash(SU2_TYPE::GetValue(values[iDim]), key);
+      }
+    }
+  }
+
+  /*--- Check the file. ---*/
+
+  unsigned long header[HEADER_SIZE] = {0};
+  int match = AccessHeader(header, false, false) &&
+              (header[MAGIC] == MAGIC_NUMBER) && (header[VERSION] == FORMAT_VERSION) &&
+              (header[KEY] == key) && (header[NRANK] == static_cast<unsigned long>(size)) &&
+              (header[NPOINT] == nPointGlobal);
+
+  /*--- The cache is accessed collectively, all ranks must agree. ---*/
+  int allMatch = 0;
+  SU2_MPI::Allreduce(&match, &allMatch, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+  valid = (allMatch != 0);
+  hasWallDistance = valid && (header[HAS_WALL_DISTANCE] != 0);
+  hasPeriodic = valid && (header[HAS_PERIODIC] != 0);
+
+  if (rank == MASTER_NODE && !valid)
+    cout << "The geometry cache " << fileName << " does not exist or does not match the mesh and options." << endl;
+}
+
+bool CGeometryCache::AccessHeader(unsigned long* header, bool write, bool create) const {
+
+  int ok = 0;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+#ifndef HAVE_MPI
+    FILE* file = fopen(fileName.c_str(), write? (create? "wb" : "r+b") : "rb");
+    if (file) {
+      const auto count = write? fwrite(header, sizeof(unsigned long), HEADER_SIZE, file) :
+                                fread(header, sizeof(unsigned long), HEADER_SIZE, file);
+      ok = (count == HEADER_SIZE);
+      fclose(file);
+    }
+#else
+    MPI_File fhw;
+    const int mode = write? (create? (MPI_MODE_WRONLY | MPI_MODE_CREATE) : MPI_MODE_WRONLY) : MPI_MODE_RDONLY;
+    if (MPI_File_open(MPI_COMM_SELF, const_cast<char*>(fileName.c_str()), mode, MPI_INFO_NULL, &fhw) == MPI_SUCCESS) {
+      if (create) MPI_File_set_size(fhw, 0);
+      MPI_Status status;
+      int count = 0;
+      if (write) MPI_File_write_at(fhw, 0, header, HEADER_SIZE, MPI_UNSIGNED_LONG, &status);
+      else MPI_File_read_at(fhw, 0, header, HEADER_SIZE, MPI_UNSIGNED_LONG, &status);
+      MPI_Get_count(&status, MPI_UNSIGNED_LONG, &count);
+      ok = (count == HEADER_SIZE);
+      MPI_File_close(&fhw);
+    }
+#endif
+  }
+
+  SU2_MPI::Bcast(&ok, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  if (!write) SU2_MPI::Bcast(header, HEADER_SIZE, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  return ok;
+}
+
+bool CGeometryCache::WriteHeader(bool create) const {
+
+  unsigned long header[HEADER_SIZE] = {0};
+  header[MAGIC] = MAGIC_NUMBER;
+  header[VERSION] = FORMAT_VERSION;
+  header[KEY] = key;
+  header[NRANK] = SU2_MPI::GetSize();
+  header[NPOINT] = nPointGlobal;
+  header[HAS_WALL_DISTANCE] = hasWallDistance;
+  header[HAS_PERIODIC] = hasPeriodic;
+  return AccessHeader(header, true, create);
+}
+
+void CGeometryCache::AccessSection(unsigned long offset, const vector<unsigned long>& index,
+                                   void* data, unsigned long bytes, bool write) const {
+#ifndef HAVE_MPI
+  /*--- A single rank, the whole section is accessed. ---*/
+
+  vector<char> section(nPointGlobal*bytes);
+  auto values = static_cast<char*>(data);
+  FILE* file = fopen(fileName.c_str(), "r+b");
+  bool ok = file && (fseek(file, offset, SEEK_SET) == 0);
+
+  if (write) {
+    for (auto i = 0ul; i < index.size(); ++i)
+      copy(values + i*bytes, values + (i+1)*bytes, &section[index[i]*bytes]);
+    ok = ok && (fwrite(section.data(), 1, section.size(), file) == section.size());
+  }
+  else {
+    ok = ok && (fread(section.data(), 1, section.size(), file) == section.size());
+    for (auto i = 0ul; i < index.size(); ++i)
+      copy(&section[index[i]*bytes], &section[(index[i]+1)*bytes], values + i*bytes);
+  }
+  if (file) fclose(file);
+#else
+  /*--- Each rank accesses its values through a file view. ---*/
+
+  const MPI_Datatype etype = (bytes == sizeof(int))? MPI_INT : MPI_DOUBLE;
+  const int count = index.size();
+
+  vector<int> blocklen(count, 1);
+  vector<MPI_Aint> displace(count);
+  for (int i = 0; i < count; ++i) displace[i] = index[i]*bytes;
+
+  MPI_Datatype filetype;
+  MPI_Type_create_hindexed(count, blocklen.data(), displace.data(), etype, &filetype);
+  MPI_Type_commit(&filetype);
+
+  MPI_File fhw;
+  const int mode = write? MPI_MODE_WRONLY : MPI_MODE_RDONLY;
+  bool ok = (MPI_File_open(SU2_MPI::GetComm(), const_cast<char*>(fileName.c_str()), mode, MPI_INFO_NULL, &fhw) == MPI_SUCCESS);
+
+  if (ok) {
+    MPI_File_set_view(fhw, offset, etype, filetype, const_cast<char*>("native"), MPI_INFO_NULL);
+    int err = write? MPI_File_write_all(fhw, data, count, etype, MPI_STATUS_IGNORE) :
+                     MPI_File_read_all(fhw, data, count, etype, MPI_STATUS_IGNORE);
+    ok = (err == MPI_SUCCESS);
+    MPI_File_close(&fhw);
+  }
+  MPI_Type_free(&filetype);
+#endif
+
+  if (!ok) SU2_MPI::Error("Could not access the geometry cache " + fileName, CURRENT_FUNCTION);
+}
+
+void CGeometryCache::AccessBlock(unsigned long offset, unsigned long count, unsigned long* data, bool write) const {
+#ifndef HAVE_MPI
+  FILE* file = fopen(fileName.c_str(), write? "r+b" : "rb");
+  bool ok = file && (fseek(file, offset, SEEK_SET) == 0);
+  if (write) ok = ok && (fwrite(data, sizeof(unsigned long), count, file) == count);
+  else ok = ok && (fread(data, sizeof(unsigned long), count, file) == count);
+  if (file) fclose(file);
+#else
+  MPI_File fhw;
+  const int mode = write? MPI_MODE_WRONLY : MPI_MODE_RDONLY;
+  bool ok = (MPI_File_open(SU2_MPI::GetComm(), const_cast<char*>(fileName.c_str()), mode, MPI_INFO_NULL, &fhw) == MPI_SUCCESS);
+
+  if (ok) {
+    int err = write? MPI_File_write_at_all(fhw, offset, data, count, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE) :
+                     MPI_File_read_at_all(fhw, offset, data, count, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    ok = (err == MPI_SUCCESS);
+    MPI_File_close(&fhw);
+  }
+#endif
+
+  if (!ok) SU2_MPI::Error("Could not access the geometry cache " + fileName, CURRENT_FUNCTION);
+}
+
+bool CGeometryCache::LoadPartition(CGeometry* geometry) const {
+
+  if (!valid) return false;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE)
+    cout << "Loading the partitioning from the geometry cache " << fileName << "." << endl;
+
+  /*--- The points of each rank are contiguous (linear partitioning). ---*/
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto first = CLinearPartitioner(nPointGlobal, 0).GetFirstIndexOnRank(SU2_MPI::GetRank());
+
+  vector<unsigned long> index(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) index[iPoint] = first + iPoint;
+
+  vector<int> colors(nPoint);
+  AccessSection(PartitionOffset(), index, colors.data(), sizeof(int), false);
+
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    geometry->nodes->SetColor(iPoint, colors[iPoint]);
+
+  return true;
+}
+
+void CGeometryCache::SavePartition(const CGeometry* geometry) {
+
+  hasWallDistance = hasPeriodic = false;
+
+  if (!WriteHeader(true)) {
+    if (SU2_MPI::GetRank() == MASTER_NODE)
+      cout << "WARNING: Could not create the geometry cache " << fileName << "." << endl;
+    return;
+  }
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto first = CLinearPartitioner(nPointGlobal, 0).GetFirstIndexOnRank(SU2_MPI::GetRank());
+
+  vector<unsigned long> index(nPoint);
+  vector<int> colors(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    index[iPoint] = first + iPoint;
+    colors[iPoint] = geometry->nodes->GetColor(iPoint);
+  }
+  AccessSection(PartitionOffset(), index, colors.data(), sizeof(int), true);
+
+  valid = true;
+}
+
+bool CGeometryCache::LoadWallDistance(CGeometry* geometry) const {
+
+  if (!hasWallDistance) return false;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE)
+    cout << "Loading the wall distance from the geometry cache " << fileName << "." << endl;
+
+  /*--- All points (including halos) sorted by global index. ---*/
+
+  const auto nPoint = geometry->GetnPoint();
+
+  vector<pair<unsigned long, unsigned long> > order(nPoint);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    order[iPoint] = make_pair(geometry->nodes->GetGlobalIndex(iPoint), iPoint);
+  sort(order.begin(), order.end());
+
+  vector<unsigned long> index(nPoint);
+  for (auto i = 0ul; i < nPoint; ++i) index[i] = order[i].first;
+
+  vector<passivedouble> distance(nPoint), roughness(nPoint);
+  AccessSection(WallDistanceOffset(), index, distance.data(), sizeof(passivedouble), false);
+  AccessSection(RoughnessOffset(), index, roughness.data(), sizeof(passivedouble), false);
+
+  for (auto i = 0ul; i < nPoint; ++i) {
+    geometry->nodes->SetWall_Distance(order[i].second, distance[i]);
+    geometry->nodes->SetRoughnessHeight(order[i].second, roughness[i]);
+  }
+
+  return true;
+}
+
+void CGeometryCache::SaveWallDistance(const CGeometry* geometry) {
+
+  if (!valid) return;
+
+  /*--- Domain points sorted by global index (each point is written by its owner). ---*/
+
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  vector<pair<unsigned long, unsigned long> > order(nPointDomain);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint)
+    order[iPoint] = make_pair(geometry->nodes->GetGlobalIndex(iPoint), iPoint);
+  sort(order.begin(), order.end());
+
+  vector<unsigned long> index(nPointDomain);
+  vector<passivedouble> distance(nPointDomain), roughness(nPointDomain);
+  for (auto i = 0ul; i < nPointDomain; ++i) {
+    index[i] = order[i].first;
+    distance[i] = SU2_TYPE::GetValue(geometry->nodes->GetWall_Distance(order[i].second));
+    roughness[i] = SU2_TYPE::GetValue(geometry->nodes->GetRoughnessHeight(order[i].second));
+  }
+  AccessSection(WallDistanceOffset(), index, distance.data(), sizeof(passivedouble), true);
+  AccessSection(RoughnessOffset(), index, roughness.data(), sizeof(passivedouble), true);
+
+  /*--- Only flag the section after it is complete. ---*/
+
+  hasWallDistance = true;
+  hasWallDistance = WriteHeader(false);
+}
+
+bool CGeometryCache::LoadPeriodic(CGeometry* geometry, const CConfig* config) const {
+
+  if (!hasPeriodic) return false;
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  if (rank == MASTER_NODE)
+    cout << "Loading the periodic matching from the geometry cache " << fileName << "." << endl;
+
+  const auto vertices = PeriodicVertices(geometry, config);
+
+  /*--- Number of records of each rank, then the records of this rank. ---*/
+
+  vector<unsigned long> counts(size);
+  AccessBlock(PeriodicOffset(), size, counts.data(), false);
+
+  unsigned long first = 0;
+  for (int iRank = 0; iRank < rank; ++iRank) first += counts[iRank];
+
+  int match = (counts[rank] == vertices.size());
+
+  vector<unsigned long> records(match? vertices.size()*PERIODIC_RECORD_SIZE : 0);
+  AccessBlock(PeriodicOffset() + (size + first*PERIODIC_RECORD_SIZE)*sizeof(unsigned long),
+              records.size(), records.data(), false);
+
+  for (auto i = 0ul; match && (i < vertices.size()); ++i)
+    match = (records[i*PERIODIC_RECORD_SIZE] == geometry->nodes->GetGlobalIndex(vertices[i]->GetNode()));
+
+  /*--- All ranks must agree, otherwise the points are matched again. ---*/
+  int allMatch = 0;
+  SU2_MPI::Allreduce(&match, &allMatch, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  if (!allMatch) return false;
+
+  for (auto i = 0ul; i < vertices.size(); ++i) {
+    const auto record = &records[i*PERIODIC_RECORD_SIZE];
+    vertices[i]->SetDonorPoint(record[1], record[2], record[3], record[4], record[5]);
+  }
+
+  return true;
+}
+
+void CGeometryCache::SavePeriodic(const CGeometry* geometry, const CConfig* config) {
+
+  if (!valid) return;
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  const auto vertices = PeriodicVertices(geometry, config);
+
+  vector<unsigned long> records(vertices.size()*PERIODIC_RECORD_SIZE);
+  for (auto i = 0ul; i < vertices.size(); ++i) {
+    auto record = &records[i*PERIODIC_RECORD_SIZE];
+    record[0] = geometry->nodes->GetGlobalIndex(vertices[i]->GetNode());
+    record[1] = vertices[i]->GetDonorPoint();
+    record[2] = vertices[i]->GetDonorGlobalIndex();
+    record[3] = vertices[i]->GetDonorVertex();
+    record[4] = vertices[i]->GetDonorMarker();
+    record[5] = vertices[i]->GetDonorProcessor();
+  }
+
+  /*--- The master writes the number of records of each rank. ---*/
+
+  unsigned long count = vertices.size();
+  vector<unsigned long> counts(size);
+  SU2_MPI::Allgather(&count, 1, MPI_UNSIGNED_LONG, counts.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  AccessBlock(PeriodicOffset(), (rank == MASTER_NODE)? size : 0, counts.data(), true);
+
+  unsigned long first = 0;
+  for (int iRank = 0; iRank < rank; ++iRank) first += counts[iRank];
+
+  AccessBlock(PeriodicOffset() + (size + first*PERIODIC_RECORD_SIZE)*sizeof(unsigned long),
+              records.size(), records.data(), true);
+
+  hasPeriodic = true;
+  hasPeriodic = WriteHeader(false);
+}
@@ -29,6 +29,7 @@
 #include "../../include/geometry/CMultiGridQueue.hpp"
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_container, unsigned short iMesh) : CGeometry() {
 
@@ -40,13 +41,13 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   /*--- Local variables ---*/
 
-  unsigned long iPoint, Index_CoarseCV, iElem, iVertex, iteration, nVertexS, nVertexR,
+  unsigned long iPoint, Index_CoarseCV, iVertex, nVertexS, nVertexR,
                 nBufferS_Vector, nBufferR_Vector, iParent, jVertex,Local_nPointCoarse, Local_nPointFine, Global_nPointCoarse, Global_nPointFine,
                 *Buffer_Receive_Parent = nullptr, *Buffer_Send_Parent = nullptr, *Buffer_Receive_Children = nullptr, *Buffer_Send_Children = nullptr,
                 *Parent_Remote = nullptr,         *Children_Remote = nullptr,    *Parent_Local = nullptr,            *Children_Local = nullptr;
   short marker_seed;
   bool agglomerate_seed = true;
-  unsigned short nChildren, iNode, counter, iMarker, jMarker, priority, MarkerS, MarkerR, *nChildren_MPI;
+  unsigned short nChildren, counter, iMarker, jMarker, MarkerS, MarkerR, *nChildren_MPI;
   vector<unsigned long> Suitable_Indirect_Neighbors, Aux_Parent;
   vector<unsigned long>::iterator it;
 
@@ -71,25 +72,26 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
   if (iMesh == MESH_1) {
 
-    for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++)
-      fine_grid->nodes->SetAgglomerate_Indirect(iPoint, false);
+    /*--- Each point checks the type of its elements, rather than each element
+     *    marking its points, to avoid concurrent writes. ---*/
 
-    for (iElem = 0; iElem < fine_grid->GetnElem(); iElem++) {
-      if ((fine_grid->elem[iElem]->GetVTK_Type() == HEXAHEDRON) ||
-          (fine_grid->elem[iElem]->GetVTK_Type() == QUADRILATERAL)) {
-        for (iNode = 0; iNode < fine_grid->elem[iElem]->GetnNodes(); iNode++) {
-          iPoint = fine_grid->elem[iElem]->GetNode(iNode);
-          fine_grid->nodes->SetAgglomerate_Indirect(iPoint, true);
-        }
+    const auto& elemStore = fine_grid->GetElemStore();
+    const auto nPointFine = fine_grid->GetnPoint();
+
+    SU2_OMP_PARALLEL_(for schedule(static,roundUpDiv(nPointFine,omp_get_max_threads())))
+    for (auto iPointFine = 0ul; iPointFine < nPointFine; iPointFine++) {
+      bool indirect = false;
+      for (auto iElemFine : fine_grid->nodes->GetElems(iPointFine)) {
+        const auto type = elemStore.GetVTK_Type(iElemFine);
+        indirect |= (type == HEXAHEDRON) || (type == QUADRILATERAL);
       }
+      fine_grid->nodes->SetAgglomerate_Indirect(iPointFine, indirect);
     }
 
   }
 
   /*--- Create the coarse grid structure using as baseline the fine grid ---*/
 
-  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
-
   nPointNode = fine_grid->GetnPoint();
 
   nodes = new CPoint(fine_grid->GetnPoint(), nDim, iMesh, config);
@@ -229,156 +231,72 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       }
     }
 
-  /*--- Update the queue with the results from the boundary agglomeration ---*/
-
-  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
-
-    /*--- The CV has been agglomerated, remove form the list ---*/
-
-    if (fine_grid->nodes->GetAgglomerate(iPoint) == true) {
-
-      MGQueue_InnerCV.RemoveCV(iPoint);
-
-    }
-
-    else {
+  /*--- The domain points that were not agglomerated on the boundaries are agglomerated with a
+   *    single priority queue over the whole domain, or, if MG_AGGLOMERATION_BLOCK_SIZE is set,
+   *    split into compact blocks which are agglomerated concurrently (seeds and children from the
+   *    same block, as with the MPI partitions). The blocks do not depend on the number of threads
+   *    and the agglomerates are numbered in block order, so the coarse grid does not either. ---*/
 
-      /*--- Count the number of agglomerated neighbors, and modify the queue ---*/
+  const auto blockSize = config->GetMG_Agglomeration_BlockSize();
 
-      priority = 0;
-      for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
-        if (fine_grid->nodes->GetAgglomerate(jPoint) == true) priority++;
-      }
-      MGQueue_InnerCV.MoveCV(iPoint, priority);
-    }
+  if (blockSize == 0) {
+    AgglomerateDomain(fine_grid, config, Index_CoarseCV);
   }
+  else {
 
-  /*--- Agglomerate the domain nodes ---*/
-
-  iteration = 0;
-  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
-
-    iPoint = MGQueue_InnerCV.NextCV();
-    iteration ++;
-
-    /*--- If the element has not being previously agglomerated, belongs to the physical domain,
-     and satisfies several geometrical criteria then the seed CV is acepted for agglomeration ---*/
-
-    if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) &&
-        (fine_grid->nodes->GetDomain(iPoint)) &&
-        (GeometricalCheck(iPoint, fine_grid, config))) {
-
-      nChildren = 1;
-
-      /*--- We set an index for the parent control volume ---*/
-
-      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
-
-      /*--- We add the seed point (child) to the parent control volume ---*/
-
-      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
-
-      /*--- Update the queue with the seed point (remove the seed and
-       increase the priority of the neighbors) ---*/
-
-      MGQueue_InnerCV.Update(iPoint, fine_grid);
-
-      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
-
-      for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
-
-        /*--- Determine if the CVPoint can be agglomerated ---*/
-
-        if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
-            (fine_grid->nodes->GetDomain(CVPoint)) &&
-            (GeometricalCheck(CVPoint, fine_grid, config))) {
-
-          /*--- We set the value of the parent ---*/
-
-          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+    const auto nPointFine = fine_grid->GetnPoint();
 
-          /*--- We set the value of the child ---*/
+    vector<vector<unsigned long> > blocks;
+    vector<unsigned long> blockOf, localIndex;
+    SetAgglomerationBlocks(fine_grid, blockSize, blocks, blockOf, localIndex);
+    const auto nBlock = blocks.size();
 
-          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
-          nChildren++;
+    /*--- Initial priority of the points, the number of neighbors agglomerated on the boundaries. ---*/
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
-
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
-
-        }
+    vector<short> priority(nPointFine, 0);
+    vector<vector<vector<unsigned long> > > blockAgglomerates(nBlock);
+    vector<vector<char> > blockIndirect(nBlock);
 
+    SU2_OMP_PARALLEL
+    {
+      SU2_OMP_FOR_STAT(roundUpDiv(nPointFine,omp_get_num_threads()))
+      for (auto iPointFine = 0ul; iPointFine < nPointFine; iPointFine++) {
+        if (blockOf[iPointFine] == nBlock) continue;
+        for (auto jPoint : fine_grid->nodes->GetPoints(iPointFine))
+          priority[iPointFine] += fine_grid->nodes->GetAgglomerate(jPoint);
       }
 
-      /*--- Subrotuine to identify the indirect neighbors ---*/
-
-      Suitable_Indirect_Neighbors.clear();
-      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
-        SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
-
-      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
-
-      for (auto CVPoint : Suitable_Indirect_Neighbors) {
-
-        /*--- The new point can be agglomerated ---*/
-
-        if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
-            (fine_grid->nodes->GetDomain(CVPoint))) {
-
-          /*--- We set the value of the parent ---*/
-
-          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
-
-          /*--- We set the indirect agglomeration information ---*/
-
-          if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint))
-            nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
-
-          /*--- We set the value of the child ---*/
+      SU2_OMP_FOR_DYN(1)
+      for (auto iBlock = 0ul; iBlock < nBlock; iBlock++) {
+        AgglomerateBlock(iBlock, blocks, blockOf, localIndex, priority, fine_grid, config,
+                         blockAgglomerates[iBlock], blockIndirect[iBlock]);
+      }
+    }
 
-          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
-          nChildren++;
+    /*--- Number the agglomerates of the blocks after those of the boundaries. ---*/
 
-          /*--- Update the queue with the new control volume (remove the CV and
-           increase the priority of the neighbors) ---*/
+    vector<unsigned long> blockOffset(nBlock+1, Index_CoarseCV);
+    for (auto iBlock = 0ul; iBlock < nBlock; iBlock++)
+      blockOffset[iBlock+1] = blockOffset[iBlock] + blockAgglomerates[iBlock].size();
+    Index_CoarseCV = blockOffset[nBlock];
 
-          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+    SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+    for (auto iBlock = 0ul; iBlock < nBlock; iBlock++) {
+      for (auto iAgglo = 0ul; iAgglo < blockAgglomerates[iBlock].size(); iAgglo++) {
+        const auto iCoarsePoint = blockOffset[iBlock] + iAgglo;
+        const auto& children = blockAgglomerates[iBlock][iAgglo];
 
+        for (auto iChildren = 0u; iChildren < children.size(); iChildren++) {
+          fine_grid->nodes->SetParent_CV(children[iChildren], iCoarsePoint);
+          nodes->SetChildren_CV(iCoarsePoint, iChildren, children[iChildren]);
         }
+        nodes->SetnChildren_CV(iCoarsePoint, children.size());
+        if (blockIndirect[iBlock][iAgglo]) nodes->SetAgglomerate_Indirect(iCoarsePoint, true);
       }
-
-      /*--- Update the number of control of childrens ---*/
-
-      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
-      Index_CoarseCV++;
-    }
-    else {
-
-      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
-       move the point to the lowest priority ---*/
-
-      MGQueue_InnerCV.MoveCV(iPoint, -1);
     }
 
   }
 
-  /*--- Add all the elements that have not being agglomerated, in the previous stage ---*/
-
-  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
-    if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) && (fine_grid->nodes->GetDomain(iPoint))) {
-
-      nChildren = 1;
-      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
-      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
-        nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
-      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
-      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
-      Index_CoarseCV++;
-
-    }
-  }
-
   nPointDomain = Index_CoarseCV;
 
   /*--- Check that there are no hanging nodes ---*/
@@ -387,25 +305,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   unsigned short iChildren;
 
   /*--- Find the point surrounding a point ---*/
-  {
-    /*--- Temporary, CPoint (nodes) then compresses the information ---*/
-    vector<vector<unsigned long> > points(fine_grid->GetnPoint());
 
-    for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
-      for (iChildren = 0; iChildren <  nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-        for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-          iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
-          if (iParent != iCoarsePoint) {
-            auto End = points[iCoarsePoint].end();
-            if (find(points[iCoarsePoint].begin(), End, iParent) == End)
-              points[iCoarsePoint].push_back(iParent);
-          }
-        }
-      }
-    }
-    nodes->SetPoints(points);
-  }
+  SetCoarsePoints(fine_grid, nPointDomain);
 
   /*--- Detect isolated points and merge them with its correct neighbor ---*/
 
@@ -615,6 +516,12 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
   SU2_MPI::Allreduce(&Local_nPointCoarse, &Global_nPointCoarse, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   SU2_MPI::Allreduce(&Local_nPointFine, &Global_nPointFine, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
+  /*--- Quality of the agglomeration (computed by all ranks even if the level is discarded). ---*/
+
+  unsigned long maxChildren = 0;
+  passivedouble avgAspectRatio = 0.0, maxAspectRatio = 0.0;
+  ComputeAgglomerationQuality(fine_grid, config, maxChildren, avgAspectRatio, maxAspectRatio);
+
   su2double Coeff = 1.0, CFL = 0.0, factor = 1.5;
 
   if (iMesh != MESH_0) {
@@ -637,16 +544,19 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
       MGTable.AddColumn("CVs", 10);
       MGTable.AddColumn("Aggl. Rate", 10);
       MGTable.AddColumn("CFL", 10);
+      MGTable.AddColumn("Max Child.", 10);
+      MGTable.AddColumn("Avg. AR", 10);
+      MGTable.AddColumn("Max AR", 10);
       MGTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
 
 
       if (iMesh == 1){
         MGTable.PrintHeader();
-        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1);
+        MGTable << iMesh - 1 << Global_nPointFine << "1/1.00" << config->GetCFL(iMesh -1) << 1 << "-" << "-";
       }
       stringstream ss;
       ss << "1/" << std::setprecision(3) << ratio;
-      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL;
+      MGTable << iMesh << Global_nPointCoarse << ss.str() << CFL << maxChildren << avgAspectRatio << maxAspectRatio;
       if (iMesh == config->GetnMGLevels()){
         MGTable.PrintFooter();
       }
@@ -659,6 +569,392 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry **geometry, CConfig *config_con
 
 }
 
+void CMultiGridGeometry::ComputeAgglomerationQuality(CGeometry *fine_grid, const CConfig *config, unsigned long &maxChildren,
+                                                     passivedouble &avgAspectRatio, passivedouble &maxAspectRatio) const {
+
+  /*--- The aspect ratio of a coarse control volume is the area of its faces relative to the area
+   *    of a cube (square in 2D) of the same volume, 1 for cubes, large for stretched or irregular
+   *    agglomerates. The faces are those of the children that are not shared with a sibling, and
+   *    the boundary faces that are not interfaces between ranks. Only domain points are
+   *    considered as the halos are the domain points of other ranks. ---*/
+
+  vector<passivedouble> aspectRatio(nPointDomain, 0.0);
+  unsigned long localMaxChildren = 0;
+
+  SU2_OMP_PARALLEL
+  {
+  unsigned long maxChildrenThread = 0;
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPointDomain,2*omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPointDomain; iCoarsePoint++) {
+
+    const auto nChildren = nodes->GetnChildren_CV(iCoarsePoint);
+    maxChildrenThread = max<unsigned long>(maxChildrenThread, nChildren);
+
+    su2double volume = 0.0, area = 0.0;
+
+    for (auto iChildren = 0u; iChildren < nChildren; iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+      volume += fine_grid->nodes->GetVolume(iFinePoint);
+
+      for (auto jFinePoint : fine_grid->nodes->GetPoints(iFinePoint)) {
+        if (fine_grid->nodes->GetParent_CV(jFinePoint) != iCoarsePoint) {
+          const auto iEdge = fine_grid->FindEdge(iFinePoint, jFinePoint);
+          area += GeometryToolbox::Norm(nDim, fine_grid->edges->GetNormal(iEdge));
+        }
+      }
+
+      if (!fine_grid->nodes->GetBoundary(iFinePoint)) continue;
+
+      for (auto iMarker = 0u; iMarker < fine_grid->GetnMarker(); iMarker++) {
+        const auto iVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+        if ((iVertex >= 0) && (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE))
+          area += GeometryToolbox::Norm(nDim, fine_grid->vertex[iMarker][iVertex]->GetNormal());
+      }
+    }
+
+    if (volume > 0.0) {
+      const su2double cubeArea = (nDim == 2)? 4.0*sqrt(volume) : 6.0*pow(volume, 2.0/3.0);
+      aspectRatio[iCoarsePoint] = SU2_TYPE::GetValue(area / cubeArea);
+    }
+  }
+
+  SU2_OMP_CRITICAL
+  localMaxChildren = max(localMaxChildren, maxChildrenThread);
+  }
+
+  /*--- Reduce in a fixed order, the result does not depend on the number of threads. ---*/
+
+  passivedouble local[] = {0.0, 0.0}, global[] = {0.0, 0.0}, localMax = 0.0;
+
+  for (const auto value : aspectRatio) {
+    if (value == 0.0) continue;
+    local[0] += value;
+    local[1] += 1.0;
+    localMax = max(localMax, value);
+  }
+
+  SU2_MPI::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&localMax, &maxAspectRatio, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&localMaxChildren, &maxChildren, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+  avgAspectRatio = global[0] / max(global[1], 1.0);
+
+}
+
+void CMultiGridGeometry::AgglomerateDomain(CGeometry *fine_grid, CConfig *config, unsigned long& Index_CoarseCV) {
+
+  unsigned long iPoint, iteration;
+  unsigned short nChildren, priority;
+  vector<unsigned long> Suitable_Indirect_Neighbors;
+
+  CMultiGridQueue MGQueue_InnerCV(fine_grid->GetnPoint());
+
+  /*--- Update the queue with the results from the boundary agglomeration ---*/
+
+  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
+
+    /*--- The CV has been agglomerated, remove form the list ---*/
+
+    if (fine_grid->nodes->GetAgglomerate(iPoint) == true) {
+
+      MGQueue_InnerCV.RemoveCV(iPoint);
+
+    }
+
+    else {
+
+      /*--- Count the number of agglomerated neighbors, and modify the queue ---*/
+
+      priority = 0;
+      for (auto jPoint : fine_grid->nodes->GetPoints(iPoint)) {
+        if (fine_grid->nodes->GetAgglomerate(jPoint) == true) priority++;
+      }
+      MGQueue_InnerCV.MoveCV(iPoint, priority);
+    }
+  }
+
+  /*--- Agglomerate the domain nodes ---*/
+
+  iteration = 0;
+  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < fine_grid->GetnPoint())) {
+
+    iPoint = MGQueue_InnerCV.NextCV();
+    iteration ++;
+
+    /*--- If the element has not being previously agglomerated, belongs to the physical domain,
+     and satisfies several geometrical criteria then the seed CV is acepted for agglomeration ---*/
+
+    if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) &&
+        (fine_grid->nodes->GetDomain(iPoint)) &&
+        (GeometricalCheck(iPoint, fine_grid, config))) {
+
+      nChildren = 1;
+
+      /*--- We set an index for the parent control volume ---*/
+
+      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+
+      /*--- We add the seed point (child) to the parent control volume ---*/
+
+      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
+
+      /*--- Update the queue with the seed point (remove the seed and
+       increase the priority of the neighbors) ---*/
+
+      MGQueue_InnerCV.Update(iPoint, fine_grid);
+
+      /*--- Now we do a sweep over all the nodes that surround the seed point ---*/
+
+      for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
+
+        /*--- Determine if the CVPoint can be agglomerated ---*/
+
+        if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
+            (fine_grid->nodes->GetDomain(CVPoint)) &&
+            (GeometricalCheck(CVPoint, fine_grid, config))) {
+
+          /*--- We set the value of the parent ---*/
+
+          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+
+          /*--- We set the value of the child ---*/
+
+          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
+          nChildren++;
+
+          /*--- Update the queue with the new control volume (remove the CV and
+           increase the priority of the neighbors) ---*/
+
+          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+
+        }
+
+      }
+
+      /*--- Subrotuine to identify the indirect neighbors ---*/
+
+      Suitable_Indirect_Neighbors.clear();
+      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+        SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, Index_CoarseCV, fine_grid);
+
+      /*--- Now we do a sweep over all the indirect nodes that can be added ---*/
+
+      for (auto CVPoint : Suitable_Indirect_Neighbors) {
+
+        /*--- The new point can be agglomerated ---*/
+
+        if ((fine_grid->nodes->GetAgglomerate(CVPoint) == false) &&
+            (fine_grid->nodes->GetDomain(CVPoint))) {
+
+          /*--- We set the value of the parent ---*/
+
+          fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
+
+          /*--- We set the indirect agglomeration information ---*/
+
+          if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint))
+            nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
+
+          /*--- We set the value of the child ---*/
+
+          nodes->SetChildren_CV(Index_CoarseCV, nChildren, CVPoint);
+          nChildren++;
+
+          /*--- Update the queue with the new control volume (remove the CV and
+           increase the priority of the neighbors) ---*/
+
+          MGQueue_InnerCV.Update(CVPoint, fine_grid);
+
+        }
+      }
+
+      /*--- Update the number of control of childrens ---*/
+
+      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
+      Index_CoarseCV++;
+    }
+    else {
+
+      /*--- The seed point can not be agglomerated because of size, domain, streching, etc.
+       move the point to the lowest priority ---*/
+
+      MGQueue_InnerCV.MoveCV(iPoint, -1);
+    }
+
+  }
+
+  /*--- Add all the elements that have not being agglomerated, in the previous stage ---*/
+
+  for (iPoint = 0; iPoint < fine_grid->GetnPoint(); iPoint ++) {
+    if ((fine_grid->nodes->GetAgglomerate(iPoint) == false) && (fine_grid->nodes->GetDomain(iPoint))) {
+
+      nChildren = 1;
+      fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+      if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+        nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
+      nodes->SetChildren_CV(Index_CoarseCV, 0, iPoint);
+      nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
+      Index_CoarseCV++;
+
+    }
+  }
+
+}
+
+void CMultiGridGeometry::SetAgglomerationBlocks(const CGeometry *fine_grid, unsigned long blockSize,
+                                                vector<vector<unsigned long> >& blocks,
+                                                vector<unsigned long>& blockOf, vector<unsigned long>& localIndex) {
+
+  const auto nPointFine = fine_grid->GetnPoint();
+  const auto NO_BLOCK = nPointFine;
+
+  auto isFree = [&](unsigned long iPoint) {
+    return fine_grid->nodes->GetDomain(iPoint) && !fine_grid->nodes->GetAgglomerate(iPoint);
+  };
+
+  blocks.clear();
+  blockOf.assign(nPointFine, NO_BLOCK);
+  localIndex.assign(nPointFine, 0);
+
+  /*--- Free points adjacent to the last block that did not fit in it, the next block starts from them. ---*/
+  vector<unsigned long> front;
+  unsigned long nextPoint = 0;
+
+  while (true) {
+
+    /*--- Seed of the new block, the front of the previous block or the first free point. ---*/
+    auto seed = NO_BLOCK;
+    for (auto iPoint : front)
+      if (blockOf[iPoint] == NO_BLOCK) { seed = iPoint; break; }
+    if (seed == NO_BLOCK) {
+      while ((nextPoint < nPointFine) && !(isFree(nextPoint) && (blockOf[nextPoint] == NO_BLOCK))) nextPoint++;
+      if (nextPoint == nPointFine) break;
+      seed = nextPoint;
+    }
+    front.clear();
+
+    const auto iBlock = blocks.size();
+    blocks.emplace_back();
+    auto& block = blocks.back();
+
+    /*--- Breadth-first growth, the block itself is the queue. ---*/
+    block.push_back(seed);
+    blockOf[seed] = iBlock;
+
+    for (auto next = 0ul; next < block.size(); next++) {
+      for (auto jPoint : fine_grid->nodes->GetPoints(block[next])) {
+        if (!isFree(jPoint) || (blockOf[jPoint] != NO_BLOCK)) continue;
+        if (block.size() < blockSize) {
+          blockOf[jPoint] = iBlock;
+          block.push_back(jPoint);
+        }
+        else {
+          front.push_back(jPoint);
+        }
+      }
+    }
+  }
+
+  /*--- Unused points get the number of blocks. ---*/
+  for (auto& iBlock : blockOf) if (iBlock == NO_BLOCK) iBlock = blocks.size();
+
+  for (const auto& block : blocks)
+    for (auto iLocal = 0ul; iLocal < block.size(); iLocal++)
+      localIndex[block[iLocal]] = iLocal;
+
+}
+
+void CMultiGridGeometry::AgglomerateBlock(unsigned long iBlock, const vector<vector<unsigned long> >& blocks,
+                                          const vector<unsigned long>& blockOf, const vector<unsigned long>& localIndex,
+                                          const vector<short>& priority, CGeometry *fine_grid, CConfig *config,
+                                          vector<vector<unsigned long> >& agglomerates, vector<char>& indirect) {
+
+  /*--- Same algorithm as the serial agglomeration of the whole domain, but the points of other blocks
+   *    are never considered (they are being agglomerated by other threads). The queue is indexed by
+   *    the position of the points in the block. ---*/
+
+  const auto& points = blocks[iBlock];
+  const auto nLocal = points.size();
+
+  auto inBlock = [&](unsigned long iPoint) { return blockOf[iPoint] == iBlock; };
+
+  CMultiGridQueue MGQueue_InnerCV(nLocal);
+
+  for (auto iLocal = 0ul; iLocal < nLocal; iLocal++)
+    MGQueue_InnerCV.MoveCV(iLocal, priority[points[iLocal]]);
+
+  /*--- Remove a point from the queue and increase the priority of its neighbors. ---*/
+  auto update = [&](unsigned long iPoint) {
+    MGQueue_InnerCV.RemoveCV(localIndex[iPoint]);
+    for (auto jPoint : fine_grid->nodes->GetPoints(iPoint))
+      if (inBlock(jPoint) && !fine_grid->nodes->GetAgglomerate(jPoint))
+        MGQueue_InnerCV.IncrPriorityCV(localIndex[jPoint]);
+  };
+
+  vector<unsigned long> Suitable_Indirect_Neighbors;
+  unsigned long iteration = 0;
+
+  while (!MGQueue_InnerCV.EmptyQueue() && (iteration < nLocal)) {
+
+    const auto iPoint = points[MGQueue_InnerCV.NextCV()];
+    iteration++;
+
+    if (fine_grid->nodes->GetAgglomerate(iPoint) || !GeometricalCheck(iPoint, fine_grid, config)) {
+
+      /*--- The seed point can not be agglomerated, move it to the lowest priority. ---*/
+      MGQueue_InnerCV.MoveCV(localIndex[iPoint], -1);
+      continue;
+    }
+
+    /*--- The parent is the index of the agglomerate in the block for now. ---*/
+    const auto iAgglo = agglomerates.size();
+    agglomerates.emplace_back(1, iPoint);
+    indirect.push_back(false);
+    auto& children = agglomerates.back();
+
+    fine_grid->nodes->SetParent_CV(iPoint, iAgglo);
+    update(iPoint);
+
+    /*--- Sweep over the nodes that surround the seed point. ---*/
+
+    for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
+      if (inBlock(CVPoint) && !fine_grid->nodes->GetAgglomerate(CVPoint) &&
+          GeometricalCheck(CVPoint, fine_grid, config)) {
+        fine_grid->nodes->SetParent_CV(CVPoint, iAgglo);
+        children.push_back(CVPoint);
+        update(CVPoint);
+      }
+    }
+
+    /*--- Sweep over the indirect nodes that can be added. ---*/
+
+    Suitable_Indirect_Neighbors.clear();
+    if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+      SetSuitableNeighbors(&Suitable_Indirect_Neighbors, iPoint, iAgglo, fine_grid);
+
+    for (auto CVPoint : Suitable_Indirect_Neighbors) {
+      if (inBlock(CVPoint) && !fine_grid->nodes->GetAgglomerate(CVPoint)) {
+        fine_grid->nodes->SetParent_CV(CVPoint, iAgglo);
+        if (fine_grid->nodes->GetAgglomerate_Indirect(CVPoint)) indirect.back() = true;
+        children.push_back(CVPoint);
+        update(CVPoint);
+      }
+    }
+  }
+
+  /*--- Add the points that could not be agglomerated. ---*/
+
+  for (auto iPoint : points) {
+    if (!fine_grid->nodes->GetAgglomerate(iPoint)) {
+      fine_grid->nodes->SetParent_CV(iPoint, agglomerates.size());
+      agglomerates.emplace_back(1, iPoint);
+      indirect.push_back(fine_grid->nodes->GetAgglomerate_Indirect(iPoint));
+    }
+  }
+
+}
+
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config) {
 
   bool agglomerate_CV = false;
@@ -902,34 +1198,41 @@ void CMultiGridGeometry::SetSuitableNeighbors(vector<unsigned long> *Suitable_In
 
 }
 
-void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
-
-  unsigned long iFinePoint, iParent, iCoarsePoint;
-  unsigned short iChildren;
+void CMultiGridGeometry::SetCoarsePoints(CGeometry *fine_grid, unsigned long nCoarsePoint) {
 
-  /*--- Set the point surrounding a point ---*/
+  /*--- Temporary, CPoint (nodes) then compresses the information. Each coarse point
+   *    only writes its own list, whose order is that of the children and of their
+   *    neighbors, i.e. it does not depend on the number of threads. ---*/
 
-  vector<vector<unsigned long> > points(nPoint);
+  vector<vector<unsigned long> > points(nCoarsePoint);
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
-    for (iChildren = 0; iChildren <  nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  SU2_OMP_PARALLEL_(for schedule(dynamic,roundUpDiv(nCoarsePoint,2*omp_get_max_threads())))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nCoarsePoint; iCoarsePoint++) {
+    auto& neighbors = points[iCoarsePoint];
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
       for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-        iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
-        if (iParent != iCoarsePoint) {
-          auto End = points[iCoarsePoint].end();
-          if (find(points[iCoarsePoint].begin(), End, iParent) == End)
-            points[iCoarsePoint].push_back(iParent);
-        }
+        const auto iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+        if ((iParent != iCoarsePoint) && (find(neighbors.begin(), neighbors.end(), iParent) == neighbors.end()))
+          neighbors.push_back(iParent);
       }
     }
   }
   nodes->SetPoints(points);
 
+}
+
+void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
+
+  /*--- Set the point surrounding a point ---*/
+
+  SetCoarsePoints(fine_grid, nPoint);
+
   /*--- Set the number of neighbors variable, this is
    important for JST and multigrid in parallel ---*/
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
+  SU2_OMP_PARALLEL_(for schedule(static,roundUpDiv(nPoint,omp_get_max_threads())))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++)
     nodes->SetnNeighbor(iCoarsePoint, nodes->GetnPoint(iCoarsePoint));
 
 }
@@ -943,11 +1246,11 @@ void CMultiGridGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) {
 
   /*--- If any children node belong to the boundary then the entire control
    volume will belong to the boundary ---*/
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
-    for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-      if (fine_grid->nodes->GetBoundary(iFinePoint)) {
-        nodes->SetBoundary(iCoarsePoint, nMarker);
+  SU2_OMP_PARALLEL_(for schedule(static,roundUpDiv(nPoint,omp_get_max_threads())))
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iChild = 0u; iChild < nodes->GetnChildren_CV(iPoint); iChild++) {
+      if (fine_grid->nodes->GetBoundary(nodes->GetChildren_CV(iPoint, iChild))) {
+        nodes->SetBoundary(iPoint, nMarker);
         break;
       }
     }
@@ -1080,20 +1383,18 @@ void CMultiGridGeometry::MatchPeriodic(CConfig *config, unsigned short val_perio
 
 void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid, unsigned short action) {
 
-  SU2_OMP_MASTER {
+  SU2_PROFILE_SCOPE("Geometry::SetControlVolume (MG)");
 
-  unsigned long iFinePoint, iCoarsePoint, iEdge, iParent;
-  long FineEdge, CoarseEdge;
-  unsigned short iChildren;
-  bool change_face_orientation;
-  su2double Coarse_Volume, Area;
+  /*--- The coordinates are restricted (SetCoord) after this, the LS matrices are rebuilt on demand. ---*/
+  SU2_OMP_MASTER
+  InvalidateLeastSquaresMatrices();
 
   /*--- Compute the area of the coarse volume ---*/
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
-    nodes->SetVolume(iCoarsePoint, 0.0);
-    Coarse_Volume = 0.0;
-    for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  SU2_OMP_FOR_STAT(roundUpDiv(nPoint, omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    su2double Coarse_Volume = 0.0;
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
       Coarse_Volume += fine_grid->nodes->GetVolume(iFinePoint);
     }
     nodes->SetVolume(iCoarsePoint, Coarse_Volume);
@@ -1101,23 +1402,30 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
 
   /*--- Update or not the values of faces at the edge ---*/
   if (action != ALLOCATE) {
-    edges->SetZeroValues();
+    su2double ZeroArea[MAXNDIM] = {0.0};
+
+    SU2_OMP_FOR_STAT(1024)
+    for (auto iEdge = 0ul; iEdge < nEdge; iEdge++)
+      edges->SetNormal(iEdge, ZeroArea);
   }
 
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
-    for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-      iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+  /*--- A coarse edge only receives contributions when visiting its largest point,
+   *    therefore the coarse points can be processed concurrently. ---*/
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint, 2*omp_get_max_threads()))
+  for (auto iCoarsePoint = 0ul; iCoarsePoint < nPoint; iCoarsePoint++) {
+    for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+      auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
 
       for (auto iFinePoint_Neighbor : fine_grid->nodes->GetPoints(iFinePoint)) {
-        iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
+        auto iParent = fine_grid->nodes->GetParent_CV(iFinePoint_Neighbor);
         if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
 
-          FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+          auto FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
 
-          change_face_orientation = false;
+          bool change_face_orientation = false;
           if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
 
-          CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          auto CoarseEdge = FindEdge(iParent, iCoarsePoint);
 
           const auto Normal = fine_grid->edges->GetNormal(FineEdge);
 
@@ -1130,61 +1438,50 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
         }
       }
     }
+  }
 
   /*--- Check if there is a normal with null area ---*/
 
-  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+  SU2_OMP_FOR_STAT(1024)
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
     const auto NormalFace = edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, NormalFace);
+    const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
     if (Area == 0.0) {
       su2double DefaultNormal[3] = {EPS*EPS};
       edges->SetNormal(iEdge, DefaultNormal);
     }
   }
-
-  } SU2_OMP_BARRIER
 }
 
 void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_grid, unsigned short action) {
 
-  SU2_OMP_MASTER {
+  /*--- Each coarse vertex only accumulates the normals of its children. ---*/
 
-  unsigned long iCoarsePoint, iFinePoint, FineVertex, iVertex;
-  unsigned short iMarker, iChildren, iDim;
-  su2double *Normal, Area, *NormalFace = nullptr;
+  for (auto iMarker = 0u; iMarker < nMarker; iMarker++) {
+    SU2_OMP_FOR_STAT(roundUpDiv(nVertex[iMarker], omp_get_num_threads()))
+    for (auto iVertex = 0ul; iVertex < nVertex[iMarker]; iVertex++) {
 
-  Normal = new su2double [nDim];
+      if (action != ALLOCATE) vertex[iMarker][iVertex]->SetZeroValues();
 
-  if (action != ALLOCATE) {
-    for (iMarker = 0; iMarker < nMarker; iMarker++)
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
-        vertex[iMarker][iVertex]->SetZeroValues();
-  }
+      const auto iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
 
-  for (iMarker = 0; iMarker < nMarker; iMarker ++)
-    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
-      for (iChildren = 0; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren ++) {
-        iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
-        if (fine_grid->nodes->GetVertex(iFinePoint, iMarker)!=-1) {
-          FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+      for (auto iChildren = 0u; iChildren < nodes->GetnChildren_CV(iCoarsePoint); iChildren++) {
+        const auto iFinePoint = nodes->GetChildren_CV(iCoarsePoint, iChildren);
+        const auto FineVertex = fine_grid->nodes->GetVertex(iFinePoint, iMarker);
+        if (FineVertex != -1) {
+          su2double Normal[MAXNDIM] = {0.0};
           fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
           vertex[iMarker][iVertex]->AddNormal(Normal);
         }
       }
-    }
 
-  delete[] Normal;
+      /*--- Check if there is a normal with null area ---*/
 
-  /*--- Check if there is a normal with null area ---*/
-  for (iMarker = 0; iMarker < nMarker; iMarker ++)
-    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-      NormalFace = vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, NormalFace);
-      if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+      auto NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      const su2double Area = GeometryToolbox::Norm(nDim, NormalFace);
+      if (Area == 0.0) for (auto iDim = 0u; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
     }
-
-  } SU2_OMP_BARRIER
+  }
 }
 
 void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
@@ -30,6 +30,7 @@
 #include "../../include/toolboxes/printing_toolbox.hpp"
 #include "../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
@@ -480,7 +481,7 @@ void CPhysicalGeometry::DistributeColoring(const CConfig *config,
    We need to complete the coloring information such that the repeated
    points on each rank also have their color values. ---*/
 
-  unsigned short iNode, jNode;
+  unsigned short iNode;
   unsigned long iPoint, iNeighbor, jPoint, iElem, iProcessor;
 
   unordered_set<unsigned long> Point_Map;
@@ -497,9 +498,11 @@ void CPhysicalGeometry::DistributeColoring(const CConfig *config,
    repeats) and their neighbors so that we can efficiently loop through the
    points and decide how to distribute the colors. ---*/
 
+  const auto& elemStore = geometry->GetElemStore();
+
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    for (iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++) {
-      iPoint = geometry->elem[iElem]->GetNode(iNode);
+    for (iNode = 0; iNode < elemStore.GetnNodes(iElem); iNode++) {
+      iPoint = elemStore.GetNode(iElem, iNode);
       Point_Map.insert(iPoint);
     }
   }
@@ -537,12 +540,11 @@ void CPhysicalGeometry::DistributeColoring(const CConfig *config,
   Neighbors.clear();
   Neighbors.resize(Point_Map.size());
   for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    for (iNode = 0; iNode < geometry->elem[iElem]->GetnNodes(); iNode++) {
-      iPoint = Global2Local[geometry->elem[iElem]->GetNode(iNode)];
-      for (jNode = 0; jNode < geometry->elem[iElem]->GetnNodes(); jNode++) {
-        jPoint = geometry->elem[iElem]->GetNode(jNode);
-        Neighbors[iPoint].push_back(jPoint);
-      }
+    const auto nNodes = elemStore.GetnNodes(iElem);
+    const auto elemNodes = elemStore.GetNodes(iElem);
+    for (iNode = 0; iNode < nNodes; iNode++) {
+      iPoint = Global2Local[elemNodes[iNode]];
+      Neighbors[iPoint].insert(Neighbors[iPoint].end(), elemNodes, elemNodes+nNodes);
     }
   }
 
@@ -754,7 +756,7 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
   unsigned short NODES_PER_ELEMENT = 0;
 
   unsigned long iProcessor;
-  unsigned long iElem, iNode, jNode, nElem_Total = 0, Global_Index;
+  unsigned long iNode, jNode, nElem_Total = 0, Global_Index;
   unsigned long *Conn_Elem  = nullptr;
   unsigned long *ID_Elems   = nullptr;
 
@@ -811,27 +813,31 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
   }
   nElem_Send[size] = 0; nElem_Recv[size] = 0;
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++ ) {
-    if (geometry->elem[iElem]->GetVTK_Type() == Elem_Type) {
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
+  /*--- Only the elements of this type are visited (in ascending order). ---*/
 
-        /*--- Get the index of the current point. ---*/
+  const auto& elemStore = geometry->GetElemStore();
+  const auto& elemOfType = elemStore.GetElemOfType(Elem_Type);
 
-        Global_Index = geometry->elem[iElem]->GetNode(iNode);
+  for (auto iElem : elemOfType) {
+    const auto elemNodes = elemStore.GetNodes(iElem);
+    for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
 
-        /*--- We have the color stored in a map for all local points. ---*/
+      /*--- Get the index of the current point. ---*/
 
-        iProcessor = Color_List[Global_Index];
+      Global_Index = elemNodes[iNode];
 
-        /*--- If we have not visited this element yet, increment our
-         number of elements that must be sent to a particular proc. ---*/
+      /*--- We have the color stored in a map for all local points. ---*/
 
-        if ((nElem_Flag[iProcessor] != (int)iElem)) {
-          nElem_Flag[iProcessor] = (int)iElem;
-          nElem_Send[iProcessor+1]++;
-        }
+      iProcessor = Color_List[Global_Index];
+
+      /*--- If we have not visited this element yet, increment our
+       number of elements that must be sent to a particular proc. ---*/
 
+      if ((nElem_Flag[iProcessor] != (int)iElem)) {
+        nElem_Flag[iProcessor] = (int)iElem;
+        nElem_Send[iProcessor+1]++;
       }
+
     }
   }
 
@@ -885,43 +891,42 @@ void CPhysicalGeometry::DistributeVolumeConnectivity(const CConfig *config,
   /*--- Loop through our elements and load the elems and their
    additional data that we will send to the other procs. ---*/
 
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    if (geometry->elem[iElem]->GetVTK_Type() == Elem_Type) {
-      for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
+  for (auto iElem : elemOfType) {
+    const auto elemNodes = elemStore.GetNodes(iElem);
+    for (iNode = 0; iNode < NODES_PER_ELEMENT; iNode++ ) {
 
-        /*--- Get the index of the current point. ---*/
+      /*--- Get the index of the current point. ---*/
 
-        Global_Index = geometry->elem[iElem]->GetNode(iNode);
+      Global_Index = elemNodes[iNode];
 
-        /*--- We have the color stored in a map for all local points. ---*/
+      /*--- We have the color stored in a map for all local points. ---*/
 
-        iProcessor = Color_List[Global_Index];
+      iProcessor = Color_List[Global_Index];
 
-        /*--- Load connectivity and IDs into the buffer for sending ---*/
+      /*--- Load connectivity and IDs into the buffer for sending ---*/
 
-        if (nElem_Flag[iProcessor] != (int)iElem) {
+      if (nElem_Flag[iProcessor] != (int)iElem) {
 
-          nElem_Flag[iProcessor] = (int)iElem;
-          unsigned long nn = index[iProcessor];
-          unsigned long mm = idIndex[iProcessor];
+        nElem_Flag[iProcessor] = (int)iElem;
+        unsigned long nn = index[iProcessor];
+        unsigned long mm = idIndex[iProcessor];
 
-          /*--- Load the connectivity values. Note that elements are already
-          stored directly based on their global index for the nodes.---*/
+        /*--- Load the connectivity values. Note that elements are already
+        stored directly based on their global index for the nodes.---*/
 
-          for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
-            connSend[nn] = geometry->elem[iElem]->GetNode(jNode); nn++;
-          }
+        for (jNode = 0; jNode < NODES_PER_ELEMENT; jNode++) {
+          connSend[nn] = elemNodes[jNode]; nn++;
+        }
 
-          /*--- Global ID for this element. ---*/
+        /*--- Global ID for this element. ---*/
 
-          idSend[mm] = Local2GlobalElem[iElem];
+        idSend[mm] = Local2GlobalElem[iElem];
 
-          /*--- Increment the index by the message length ---*/
+        /*--- Increment the index by the message length ---*/
 
-          index[iProcessor] += NODES_PER_ELEMENT;
-          idIndex[iProcessor]++;
+        index[iProcessor] += NODES_PER_ELEMENT;
+        idIndex[iProcessor]++;
 
-        }
       }
     }
   }
@@ -2564,6 +2569,10 @@ void CPhysicalGeometry::LoadVolumeElements(CConfig *config, CGeometry *geometry)
       cout << Global_nelem_pyramid  << " pyramids."       << endl;
   }
 
+  /*--- The flat store takes over the nodes of the elements. ---*/
+
+  elemStore.Build(elem, nElem);
+
 }
 
 void CPhysicalGeometry::LoadSurfaceElements(CConfig *config, CGeometry *geometry) {
@@ -3893,6 +3902,10 @@ void CPhysicalGeometry::LoadLinearlyPartitionedVolumeElements(CConfig        *co
   reduce(nelem_prism, Global_nelem_prism);
   reduce(nelem_pyramid, Global_nelem_pyramid);
 
+  /*--- The flat store takes over the nodes of the elements. ---*/
+
+  elemStore.Build(elem, nElem);
+
 }
 
 void CPhysicalGeometry::LoadUnpartitionedSurfaceElements(CConfig        *config,
@@ -4052,13 +4065,13 @@ void CPhysicalGeometry::PrepareAdjacency(const CConfig *config) {
 
     /*--- Store the connectivity for this element more easily. ---*/
     unsigned long connectivity[8] = {0};
-    for (unsigned long iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-      connectivity[iNode] = elem[iElem]->GetNode(iNode);
+    for (unsigned long iNode = 0; iNode < elemStore.GetnNodes(iElem); iNode++) {
+      connectivity[iNode] = elemStore.GetNode(iElem, iNode);
     }
 
     /*--- Instantiate this element and build adjacency structure. ---*/
 
-    switch(elem[iElem]->GetVTK_Type()) {
+    switch(elemStore.GetVTK_Type(iElem)) {
 
       case TRIANGLE:
 
@@ -4411,7 +4424,6 @@ void CPhysicalGeometry::Check_IntElem_Orientation(const CConfig *config) {
       cout << "All volume elements are correctly orientend." << endl;
     }
   }
-
 }
 
 void CPhysicalGeometry::Check_BoundElem_Orientation(const CConfig *config) {
@@ -4546,7 +4558,6 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(const CConfig *config) {
       cout << "All surface elements are correctly orientend." << endl;
     }
   }
-
 }
 
 void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
@@ -4676,28 +4687,63 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
 void CPhysicalGeometry::SetPoint_Connectivity() {
 
+  SU2_PROFILE_SCOPE("Geometry::SetPoint_Connectivity");
+
   vector<vector<unsigned long> > points(nPoint);
 
+  /*--- Elements surrounding points (the transpose of the element connectivity), in CSR format. ---*/
+
+  su2vector<long> elemStart(nPoint+1), elemIdx, fillPos(nPoint);
+
   SU2_OMP_PARALLEL
   {
   unsigned short Node_Neighbor, iNode, iNeighbor;
   unsigned long jElem, Point_Neighbor, iPoint, iElem;
 
-  /*--- Loop over all the elements ---*/
+  /*--- Count the elements of each point, and get the start positions by prefix sum. ---*/
+
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (iPoint = 0; iPoint <= nPoint; iPoint++) elemStart(iPoint) = 0;
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nElem,omp_get_num_threads()))
+  for (iElem = 0; iElem < nElem; iElem++) {
+    for (iNode = 0; iNode < elemStore.GetnNodes(iElem); iNode++) {
+      auto& count = elemStart(elemStore.GetNode(iElem, iNode)+1);
+      SU2_OMP_ATOMIC
+      count++;
+    }
+  }
+
   SU2_OMP_MASTER
   {
-    vector<vector<long> > elems(nPoint);
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      elemStart(iPoint+1) += elemStart(iPoint);
+      fillPos(iPoint) = elemStart(iPoint);
+    }
+    elemIdx.resize(elemStart(nPoint));
+  }
+  SU2_OMP_BARRIER
 
-    for (iElem = 0; iElem < nElem; iElem++) {
+  /*--- Fill the lists. The insertion order depends on the threads, sorting the lists
+   *    afterwards gives the same (ascending) order as a sequential loop over elements. ---*/
 
-      /*--- Loop over all the nodes of an element ---*/
-      for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
-        iPoint = elem[iElem]->GetNode(iNode);
-        elems[iPoint].push_back(iElem);
-      }
+  SU2_OMP_FOR_STAT(roundUpDiv(nElem,omp_get_num_threads()))
+  for (iElem = 0; iElem < nElem; iElem++) {
+    for (iNode = 0; iNode < elemStore.GetnNodes(iElem); iNode++) {
+      auto& next = fillPos(elemStore.GetNode(iElem, iNode));
+      long pos;
+      SU2_OMP(atomic capture)
+      pos = next++;
+      elemIdx(pos) = iElem;
     }
-    nodes->SetElems(elems);
   }
+
+  SU2_OMP_FOR_DYN(roundUpDiv(nPoint,2*omp_get_max_threads()))
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    sort(elemIdx.data()+elemStart(iPoint), elemIdx.data()+elemStart(iPoint+1));
+
+  SU2_OMP_MASTER
+  nodes->SetElems(CCompressedSparsePatternL(move(elemStart), move(elemIdx)));
   SU2_OMP_BARRIER
 
   /*--- Loop over all the points ---*/
@@ -4890,7 +4936,6 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
       }
     }
   }
-
 }
 
 void CPhysicalGeometry::SetElement_Connectivity(void) {
@@ -4967,70 +5012,77 @@ void CPhysicalGeometry::SetBoundVolume(void) {
 }
 
 void CPhysicalGeometry::SetVertex(CConfig *config) {
-  unsigned long  iPoint, iVertex, iElem;
-  unsigned short iMarker, iNode;
 
+  SU2_PROFILE_SCOPE("Geometry::SetVertex");
+
+  nVertex = new unsigned long [nMarker];
+  vertex = new CVertex**[nMarker];
+
+  /*--- Each marker only writes its own column of the vertex indices of the nodes,
+   *    therefore the markers can be processed concurrently. ---*/
+
+  SU2_OMP_PARALLEL
+  {
   /*--- Initialize the Vertex vector for each node of the grid ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iMarker = 0; iMarker < nMarker; iMarker++)
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++)
       nodes->SetVertex(iPoint, -1, iMarker);
 
-  /*--- Create and compute the vector with the number of vertex per marker ---*/
+  SU2_OMP_FOR_DYN(1)
+  for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
 
-  nVertex = new unsigned long [nMarker];
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    const bool sendRecv = (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE);
 
-    /*--- Initialize the number of Bound Vertex for each Marker ---*/
+    /*--- Count the vertices of the marker. ---*/
 
     nVertex[iMarker] = 0;
-    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
-      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-        iPoint = bound[iMarker][iElem]->GetNode(iNode);
+    for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++) {
+      for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
 
         /*--- Set the vertex in the node information ---*/
 
-        if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
+        if ((nodes->GetVertex(iPoint, iMarker) == -1) || sendRecv) {
           nodes->SetVertex(iPoint, nVertex[iMarker], iMarker);
           nVertex[iMarker]++;
         }
       }
-  }
+    }
 
-  /*--- Initialize the Vertex vector for each node, the previous result is deleted ---*/
+    /*--- Reset the vertex of the nodes of the marker, the previous result is deleted. ---*/
 
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    for (iMarker = 0; iMarker < nMarker; iMarker++)
-      nodes->SetVertex(iPoint, -1, iMarker);
+    for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++)
+      for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++)
+        nodes->SetVertex(bound[iMarker][iElem]->GetNode(iNode), -1, iMarker);
 
-  /*--- Create the bound vertex structure, note that the order
-   is the same as in the input file, this is important for Send/Receive part ---*/
+    /*--- Create the bound vertex structure, note that the order
+     is the same as in the input file, this is important for Send/Receive part ---*/
 
-  vertex = new CVertex**[nMarker];
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
     vertex[iMarker] = new CVertex* [nVertex[iMarker]];
     nVertex[iMarker] = 0;
 
-    /*--- Initialize the number of Bound Vertex for each Marker ---*/
-
-    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
-      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
-        iPoint = bound[iMarker][iElem]->GetNode(iNode);
+    for (auto iElem = 0ul; iElem < nElem_Bound[iMarker]; iElem++) {
+      for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        const auto iPoint = bound[iMarker][iElem]->GetNode(iNode);
 
         /*--- Set the vertex in the node information ---*/
 
-        if ((nodes->GetVertex(iPoint, iMarker) == -1) || (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) {
-          iVertex = nVertex[iMarker];
+        if ((nodes->GetVertex(iPoint, iMarker) == -1) || sendRecv) {
+          const auto iVertex = nVertex[iMarker];
           vertex[iMarker][iVertex] = new CVertex(iPoint, nDim);
 
-          if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
+          if (sendRecv) {
             vertex[iMarker][iVertex]->SetRotation_Type(bound[iMarker][iElem]->GetRotation_Type());
           }
           nodes->SetVertex(iPoint, nVertex[iMarker], iMarker);
           nVertex[iMarker]++;
         }
       }
+    }
   }
+  } // end SU2_OMP_PARALLEL
 }
 
 void CPhysicalGeometry::ComputeNSpan(CConfig *config, unsigned short val_iZone, unsigned short marker_flag, bool allocate) {
@@ -7554,6 +7606,8 @@ void CPhysicalGeometry::FindUniqueNode_PeriodicBound(const CConfig *config) {
 
 void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action) {
 
+  SU2_PROFILE_SCOPE("Geometry::SetControlVolume");
+
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
     su2double ZeroArea[MAXNDIM] = {0.0};
@@ -7567,129 +7621,158 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
       nodes->SetVolume(iPoint, 0.0);
   }
 
-  SU2_OMP_MASTER { /*--- The following is difficult to parallelize with threads. ---*/
+  /*--- The volumes and normals are accumulated element by element. The elements of a color
+   *    share no points, and therefore no edges, so they can be processed concurrently. Each point
+   *    and edge receives at most one contribution per color, and the colors are processed in order,
+   *    therefore the sums do not depend on the number of threads (the coloring does not either). ---*/
 
-  su2double my_DomainVolume = 0.0;
-  for (auto iElem = 0ul; iElem < nElem; iElem++) {
+  SU2_OMP_MASTER
+  {
+    GetDualGridColoring();
+    InvalidateLeastSquaresMatrices();
+  }
+  SU2_OMP_BARRIER
 
-    const auto nNodes = elem[iElem]->GetnNodes();
+  const auto& coloring = dualGridColoring;
+  const auto nColor = coloring.getOuterSize();
 
-    /*--- To make preaccumulation more effective, use as few inputs
-     as possible, recomputing intermediate quantities as needed. ---*/
-    AD::StartPreacc();
+  for (auto iColor = 0ul; iColor < nColor; ++iColor) {
 
-    /*--- Get pointers to the coordinates of all the element nodes ---*/
-    array<const su2double*, N_POINTS_MAXIMUM> Coord;
+    const GridColor<> color(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), dualGridColorGroupSize);
 
-    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
-      auto iPoint = elem[iElem]->GetNode(iNode);
-      Coord[iNode] = nodes->GetCoord(iPoint);
-#ifdef CODI_REVERSE_TYPE
-      /*--- The same points and edges will be referenced multiple times as they are common
-       to many of the element's faces, therefore they are "registered" here only once. ---*/
-      AD::SetPreaccIn(nodes->Volume(iPoint));
-      for (unsigned short jNode = iNode+1; jNode < nNodes; jNode++) {
-        auto jPoint = elem[iElem]->GetNode(jNode);
-        auto iEdge = FindEdge(iPoint, jPoint, false);
-        if (iEdge >= 0) AD::SetPreaccIn(edges->Normal[iEdge], nDim);
-      }
-#endif
-    }
-    AD::SetPreaccIn(Coord, nNodes, nDim);
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
 
-    /*--- Compute the element median CG coordinates ---*/
-    auto Coord_Elem_CG = elem[iElem]->SetCoord_CG(Coord);
-    AD::SetPreaccOut(Coord_Elem_CG, nDim);
+      const auto iElem = color.indices[k];
 
-    for (unsigned short iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+      /*--- Connectivity from the flat store, the CG is still kept by the element object. ---*/
+      const auto element = elemStore[iElem];
+      const auto nNodes = element.GetnNodes();
 
-      /*--- In 2D all the faces have only one edge ---*/
-      unsigned short nEdgesFace = 1;
+      /*--- To make preaccumulation more effective, use as few inputs
+       as possible, recomputing intermediate quantities as needed. ---*/
+      AD::StartPreacc();
 
-      /*--- In 3D the number of edges per face is the same as the number of point
-       per face and the median CG of the face is needed. ---*/
-      su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
-      if (nDim == 3) {
-        nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+      /*--- Get pointers to the coordinates of all the element nodes ---*/
+      array<const su2double*, N_POINTS_MAXIMUM> Coord;
 
-        for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
-          auto NodeFace = elem[iElem]->GetFaces(iFace, iNode);
-          for (unsigned short iDim = 0; iDim < nDim; iDim++)
-            Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim]/nEdgesFace;
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        auto iPoint = element.GetNode(iNode);
+        Coord[iNode] = nodes->GetCoord(iPoint);
+#ifdef CODI_REVERSE_TYPE
+        /*--- The same points and edges will be referenced multiple times as they are common
+         to many of the element's faces, therefore they are "registered" here only once. ---*/
+        AD::SetPreaccIn(nodes->Volume(iPoint));
+        for (unsigned short jNode = iNode+1; jNode < nNodes; jNode++) {
+          auto jPoint = element.GetNode(jNode);
+          auto iEdge = FindEdge(iPoint, jPoint, false);
+          if (iEdge >= 0) AD::SetPreaccIn(edges->Normal[iEdge], nDim);
         }
+#endif
       }
+      AD::SetPreaccIn(Coord, nNodes, nDim);
 
-      /*-- Loop over the edges of a face ---*/
-      for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+      /*--- Compute the element median CG coordinates ---*/
+      auto Coord_Elem_CG = elem[iElem]->SetCoord_CG(Coord);
+      AD::SetPreaccOut(Coord_Elem_CG, nDim);
 
-        const auto face_iNode = elem[iElem]->GetFaces(iFace,iEdgesFace);
-        unsigned short face_jNode;
+      for (unsigned short iFace = 0; iFace < element.GetnFaces(); iFace++) {
 
-        if (nDim == 2) {
-          /*--- In 2D only one edge (two points) per edge ---*/
-          face_jNode = elem[iElem]->GetFaces(iFace,1);
-        }
-        else {
-          /*--- In 3D we "circle around" the face ---*/
-          face_jNode = elem[iElem]->GetFaces(iFace, (iEdgesFace+1)%nEdgesFace);
+        /*--- In 2D all the faces have only one edge ---*/
+        unsigned short nEdgesFace = 1;
+
+        /*--- In 3D the number of edges per face is the same as the number of point
+         per face and the median CG of the face is needed. ---*/
+        su2double Coord_FaceElem_CG[MAXNDIM] = {0.0};
+        if (nDim == 3) {
+          nEdgesFace = element.GetnNodesFace(iFace);
+
+          for (unsigned short iNode = 0; iNode < nEdgesFace; iNode++) {
+            auto NodeFace = element.GetFaces(iFace, iNode);
+            for (unsigned short iDim = 0; iDim < nDim; iDim++)
+              Coord_FaceElem_CG[iDim] += Coord[NodeFace][iDim]/nEdgesFace;
+          }
         }
 
-        const auto face_iPoint = elem[iElem]->GetNode(face_iNode);
-        const auto face_jPoint = elem[iElem]->GetNode(face_jNode);
+        /*-- Loop over the edges of a face ---*/
+        for (unsigned short iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
 
-        /*--- We define a direction (from the smalest index to the greatest) --*/
-        const bool change_face_orientation = (face_iPoint > face_jPoint);
-        const auto iEdge = FindEdge(face_iPoint, face_jPoint);
+          const auto face_iNode = element.GetFaces(iFace,iEdgesFace);
+          unsigned short face_jNode;
 
-        su2double Coord_Edge_CG[MAXNDIM] = {0.0};
-        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-          Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
-        }
+          if (nDim == 2) {
+            /*--- In 2D only one edge (two points) per edge ---*/
+            face_jNode = element.GetFaces(iFace,1);
+          }
+          else {
+            /*--- In 3D we "circle around" the face ---*/
+            face_jNode = element.GetFaces(iFace, (iEdgesFace+1)%nEdgesFace);
+          }
 
-        su2double Volume_i, Volume_j;
+          const auto face_iPoint = element.GetNode(face_iNode);
+          const auto face_jPoint = element.GetNode(face_jNode);
 
-        if (nDim == 2) {
-          /*--- Two dimensional problem ---*/
-          if (change_face_orientation)
-            edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
-          else
-            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+          /*--- We define a direction (from the smalest index to the greatest) --*/
+          const bool change_face_orientation = (face_iPoint > face_jPoint);
+          const auto iEdge = FindEdge(face_iPoint, face_jPoint);
 
-          Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
-          Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
-        }
-        else {
-          /*--- Three dimensional problem ---*/
-          if (change_face_orientation)
-            edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
-          else
-            edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-
-          Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-          Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
-        }
+          su2double Coord_Edge_CG[MAXNDIM] = {0.0};
+          for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+            Coord_Edge_CG[iDim] = 0.5 * (Coord[face_iNode][iDim] + Coord[face_jNode][iDim]);
+          }
 
-        nodes->AddVolume(face_iPoint, Volume_i);
-        nodes->AddVolume(face_jPoint, Volume_j);
+          su2double Volume_i, Volume_j;
 
-        my_DomainVolume += Volume_i+Volume_j;
+          if (nDim == 2) {
+            /*--- Two dimensional problem ---*/
+            if (change_face_orientation)
+              edges->SetNodes_Coord(iEdge, Coord_Elem_CG, Coord_Edge_CG);
+            else
+              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_Elem_CG);
+
+            Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_Elem_CG);
+            Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_Elem_CG);
+          }
+          else {
+            /*--- Three dimensional problem ---*/
+            if (change_face_orientation)
+              edges->SetNodes_Coord(iEdge, Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+            else
+              edges->SetNodes_Coord(iEdge, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+
+            Volume_i = CEdge::GetVolume(Coord[face_iNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+            Volume_j = CEdge::GetVolume(Coord[face_jNode], Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+          }
+
+          nodes->AddVolume(face_iPoint, Volume_i);
+          nodes->AddVolume(face_jPoint, Volume_j);
+        }
       }
-    }
 
 #ifdef CODI_REVERSE_TYPE
-    for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
-      auto iPoint = elem[iElem]->GetNode(iNode);
-      AD::SetPreaccOut(nodes->Volume(iPoint));
-      for (unsigned short jNode = iNode+1; jNode < nNodes; jNode++) {
-        auto jPoint = elem[iElem]->GetNode(jNode);
-        auto iEdge = FindEdge(iPoint, jPoint, false);
-        if (iEdge >= 0) AD::SetPreaccOut(edges->Normal[iEdge], nDim);
+      for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
+        auto iPoint = element.GetNode(iNode);
+        AD::SetPreaccOut(nodes->Volume(iPoint));
+        for (unsigned short jNode = iNode+1; jNode < nNodes; jNode++) {
+          auto jPoint = element.GetNode(jNode);
+          auto iEdge = FindEdge(iPoint, jPoint, false);
+          if (iEdge >= 0) AD::SetPreaccOut(edges->Normal[iEdge], nDim);
+        }
       }
-    }
 #endif
-    AD::EndPreacc();
+      AD::EndPreacc();
+    }
   }
 
+  SU2_OMP_MASTER {
+
+  /*--- All the element contributions went to the points, summing the volume
+   *    of the points gives the same total (in a deterministic order). ---*/
+  su2double my_DomainVolume = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    my_DomainVolume += nodes->GetVolume(iPoint);
+
   su2double DomainVolume;
   SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
   config->SetDomainVolume(DomainVolume);
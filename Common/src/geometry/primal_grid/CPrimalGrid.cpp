@@ -43,13 +43,23 @@ CPrimalGrid::CPrimalGrid(void) {
 
 CPrimalGrid::~CPrimalGrid() {
 
- delete[] Nodes;
+ if (!NodesInStore) delete[] Nodes;
  delete[] Neighbor_Elements;
  delete[] ElementOwnsFace;
  delete[] PeriodIndexNeighbors;
  delete[] JacobianFaceIsConstant;
 }
 
+void CPrimalGrid::SetNodesStorage(unsigned long* storage) {
+
+  for (unsigned short iNode = 0; iNode < GetnNodes(); ++iNode)
+    storage[iNode] = Nodes[iNode];
+
+  if (!NodesInStore) delete[] Nodes;
+  Nodes = storage;
+  NodesInStore = true;
+}
+
 void CPrimalGrid::GetAllNeighbor_Elements() {
   cout << "( ";
   for (unsigned short iFace = 0; iFace < GetnFaces(); iFace++)
@@ -0,0 +1,88 @@
+/*!
+ * \file CPrimalGridStore.cpp
+ * \brief Flat (structure of arrays) storage of the connectivity of primal grid elements.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/geometry/primal_grid/CPrimalGridStore.hpp"
+#include "../../../include/geometry/primal_grid/CPrimalGrid.hpp"
+
+void CPrimalGridStore::Build(CPrimalGrid* const* elem, unsigned long nElem) {
+
+  /*--- Count the nodes to allocate once. ---*/
+
+  decltype(nodeStart)(nElem+1).swap(nodeStart);
+  nodeStart[0] = 0;
+  for (auto iElem = 0ul; iElem < nElem; ++iElem)
+    nodeStart[iElem+1] = nodeStart[iElem] + elem[iElem]->GetnNodes();
+
+  decltype(vtkType)(nElem).swap(vtkType);
+  decltype(globalIndex)(nElem).swap(globalIndex);
+  for (auto& list : elemOfType) std::vector<unsigned long>().swap(list);
+  for (auto& topo : topology) topo = CTopology();
+
+  /*--- The old nodes are released at the end, the elements may still refer to them. ---*/
+  decltype(nodes) newNodes(nodeStart[nElem]);
+
+  bool known[MAX_VTK_TYPE] = {false};
+
+  for (auto iElem = 0ul; iElem < nElem; ++iElem) {
+    const auto type = elem[iElem]->GetVTK_Type();
+    if (type >= MAX_VTK_TYPE)
+      SU2_MPI::Error("Unsupported element type.", CURRENT_FUNCTION);
+
+    vtkType[iElem] = type;
+    globalIndex[iElem] = elem[iElem]->GetGlobalIndex();
+    elemOfType[type].push_back(iElem);
+
+    /*--- The topology is the same for all elements of a type, get it from the first one. ---*/
+
+    if (!known[type]) {
+      known[type] = true;
+
+      auto& topo = topology[type];
+      topo.nNodes = elem[iElem]->GetnNodes();
+      topo.nFaces = elem[iElem]->GetnFaces();
+      assert(topo.nFaces <= MAX_FACES);
+
+      for (unsigned short iFace = 0; iFace < topo.nFaces; ++iFace) {
+        topo.nNodesFace[iFace] = elem[iElem]->GetnNodesFace(iFace);
+        assert(topo.nNodesFace[iFace] <= MAX_NODES_FACE);
+        for (unsigned short iNode = 0; iNode < topo.nNodesFace[iFace]; ++iNode)
+          topo.faces[iFace][iNode] = elem[iElem]->GetFaces(iFace, iNode);
+      }
+    }
+
+    elem[iElem]->SetNodesStorage(&newNodes[nodeStart[iElem]]);
+  }
+  nodes.swap(newNodes);
+}
+
+unsigned long CPrimalGridStore::GetMemoryUsage() const {
+
+  unsigned long bytes = vtkType.capacity() * sizeof(unsigned char);
+  bytes += (nodeStart.capacity() + nodes.capacity() + globalIndex.capacity()) * sizeof(unsigned long);
+  for (const auto& list : elemOfType) bytes += list.capacity() * sizeof(unsigned long);
+  return bytes;
+}
@@ -61,68 +61,115 @@ void CBSplineBlending::SetOrder(short val_order, short n_controlpoints){
 
   /*--- Allocate the temporary vectors for the basis evaluation ---*/
 
-  N.resize(Order, vector<su2double>(Order, 0.0));
+  N.assign(Order*Order, 0.0);
 }
 
 su2double CBSplineBlending::GetBasis(short val_i, su2double val_t){
+  return EvalBasis(val_i, val_t, N.data());
+}
 
-  /*--- Evaluation is based on the algorithm from "The NURBS Book (Les Piegl and Wayne Tiller)" ---*/
+su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short val_order_der){
+  return EvalDerivative(val_i, val_t, val_order_der, N.data());
+}
 
-  /*--- Special cases ---*/
+void CBSplineBlending::GetBasisTable(su2double val_t, unsigned short n_basis, su2double* basis,
+                                     su2double* der1, su2double* der2) const {
 
-  if ((val_i == 0 && val_t == U[0]) || (val_i == (short)U.size()-1 && val_t == U.back())) {return 1.0;}
+  /*--- Local work matrix, this is what makes this evaluation thread-safe.
+   *    Typical orders fit on the stack, larger ones fall back to the heap. ---*/
 
-  /*--- Local property of BSplines ---*/
+  su2double stackWork[MAX_STACK_ORDER*MAX_STACK_ORDER];
+  vector<su2double> heapWork;
+  su2double* Nw = stackWork;
+  if (Order > MAX_STACK_ORDER) {
+    heapWork.resize(Order*Order);
+    Nw = heapWork.data();
+  }
 
-  if ((val_t < U[val_i]) || (val_t >= U[val_i+Order])){ return 0.0;}
+  for (unsigned short iBasis = 0; iBasis < n_basis; iBasis++) {
+
+    /*--- Outside of the support only the special (end point) cases are non-zero. ---*/
+
+    if ((val_t < U[iBasis]) || (val_t >= U[iBasis+Order])) {
+      basis[iBasis] = EvalBasis(iBasis, val_t, Nw);
+      if (der1) der1[iBasis] = 0.0;
+      if (der2) der2[iBasis] = 0.0;
+      continue;
+    }
+
+    /*--- One evaluation of the recursion serves the basis and both derivatives. ---*/
+
+    FillWork(iBasis, val_t, Nw);
+
+    const bool special = (iBasis == 0 && val_t == U[0]) || (iBasis == KnotSize-1 && val_t == U.back());
+    basis[iBasis] = special? 1.0 : Nw[Order-1];
+    if (der1) der1[iBasis] = DerivativeFromWork(iBasis, 1, Nw);
+    if (der2) der2[iBasis] = DerivativeFromWork(iBasis, 2, Nw);
+  }
+}
+
+void CBSplineBlending::FillWork(short val_i, su2double val_t, su2double* Nw) const {
+
+  /*--- Evaluation is based on the algorithm from "The NURBS Book (Les Piegl and Wayne Tiller)",
+   *    Nw[j*Order+k] holds the (i+j)-th basis function of order k+1. ---*/
 
   unsigned short j,k;
   su2double saved, temp;
 
   for (j = 0; j < Order; j++){
-    if ((val_t >= U[val_i+j]) && (val_t < U[val_i+j+1])) N[j][0] = 1.0;
-    else N[j][0] = 0;
+    if ((val_t >= U[val_i+j]) && (val_t < U[val_i+j+1])) Nw[j*Order] = 1.0;
+    else Nw[j*Order] = 0;
   }
 
   for (k = 1; k < Order; k++){
-    if (N[0][k-1] == 0.0) saved = 0.0;
-    else saved = ((val_t - U[val_i])*N[0][k-1])/(U[val_i+k] - U[val_i]);
+    if (Nw[k-1] == 0.0) saved = 0.0;
+    else saved = ((val_t - U[val_i])*Nw[k-1])/(U[val_i+k] - U[val_i]);
     for (j = 0; j < Order-k; j++){
-      if (N[j+1][k-1] == 0.0){
-        N[j][k] = saved; saved = 0.0;
+      if (Nw[(j+1)*Order+k-1] == 0.0){
+        Nw[j*Order+k] = saved; saved = 0.0;
       } else {
-        temp     = N[j+1][k-1]/(U[val_i+j+k+1] - U[val_i+j+1]);
-        N[j][k]  = saved+(U[val_i+j+k+1] - val_t)*temp;
-        saved    = (val_t - U[val_i+j+1])*temp;
+        temp          = Nw[(j+1)*Order+k-1]/(U[val_i+j+k+1] - U[val_i+j+1]);
+        Nw[j*Order+k] = saved+(U[val_i+j+k+1] - val_t)*temp;
+        saved         = (val_t - U[val_i+j+1])*temp;
       }
     }
   }
-  return N[0][Order-1];
 }
 
-su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short val_order_der){
+su2double CBSplineBlending::EvalBasis(short val_i, su2double val_t, su2double* Nw) const {
+
+  /*--- Special cases ---*/
+
+  if ((val_i == 0 && val_t == U[0]) || (val_i == (short)U.size()-1 && val_t == U.back())) {return 1.0;}
+
+  /*--- Local property of BSplines ---*/
 
   if ((val_t < U[val_i]) || (val_t >= U[val_i+Order])){ return 0.0;}
 
-  /*--- Evaluate the i+p basis functions up to the order p (stored in the matrix N). ---*/
+  FillWork(val_i, val_t, Nw);
+
+  return Nw[Order-1];
+}
 
-  GetBasis(val_i, val_t);
+su2double CBSplineBlending::DerivativeFromWork(short val_i, short val_order_der, const su2double* Nw) const {
 
   /*--- Use the recursive definition for the derivative (hardcoded for 1st and 2nd derivative). ---*/
 
-  if (val_order_der == 0){ return N[0][Order-1];}
+  const auto W = [&](unsigned short j, unsigned short k) { return Nw[j*Order+k]; };
+
+  if (val_order_der == 0){ return W(0,Order-1);}
 
   if (val_order_der == 1){
-    return (Order-1.0)/(1e-10 + U[val_i+Order-1] - U[val_i]  )*N[0][Order-2]
-         - (Order-1.0)/(1e-10 + U[val_i+Order]   - U[val_i+1])*N[1][Order-2];
+    return (Order-1.0)/(1e-10 + U[val_i+Order-1] - U[val_i]  )*W(0,Order-2)
+         - (Order-1.0)/(1e-10 + U[val_i+Order]   - U[val_i+1])*W(1,Order-2);
   }
 
   if (val_order_der == 2 && Order > 2){
-    const su2double left = (Order-2.0)/(1e-10 + U[val_i+Order-2] - U[val_i])  *N[0][Order-3]
-                         - (Order-2.0)/(1e-10 + U[val_i+Order-1] - U[val_i+1])*N[1][Order-3];
+    const su2double left = (Order-2.0)/(1e-10 + U[val_i+Order-2] - U[val_i])  *W(0,Order-3)
+                         - (Order-2.0)/(1e-10 + U[val_i+Order-1] - U[val_i+1])*W(1,Order-3);
 
-    const su2double right = (Order-2.0)/(1e-10 + U[val_i+Order-1] - U[val_i+1])*N[1][Order-3]
-                          - (Order-2.0)/(1e-10 + U[val_i+Order]   - U[val_i+2])*N[2][Order-3];
+    const su2double right = (Order-2.0)/(1e-10 + U[val_i+Order-1] - U[val_i+1])*W(1,Order-3)
+                          - (Order-2.0)/(1e-10 + U[val_i+Order]   - U[val_i+2])*W(2,Order-3);
 
     return (Order-1.0)/(1e-10 + U[val_i+Order-1] - U[val_i]  )*left
          - (Order-1.0)/(1e-10 + U[val_i+Order]   - U[val_i+1])*right;
@@ -135,3 +182,15 @@ su2double CBSplineBlending::GetDerivative(short val_i, su2double val_t, short va
   }
   return 0.0;
 }
+
+su2double CBSplineBlending::EvalDerivative(short val_i, su2double val_t, short val_order_der,
+                                           su2double* Nw) const {
+
+  if ((val_t < U[val_i]) || (val_t >= U[val_i+Order])){ return 0.0;}
+
+  /*--- Evaluate the i+p basis functions up to the order p (stored in the matrix Nw). ---*/
+
+  FillWork(val_i, val_t, Nw);
+
+  return DerivativeFromWork(val_i, val_order_der, Nw);
+}
@@ -39,6 +39,18 @@ void CBezierBlending::SetOrder(short val_order, short n_controlpoints){
   Order  = val_order;
   Degree = Order - 1;
   binomial.resize(Order+1, 0.0);
+
+  /*--- Rows n, n-1, and n-2 of the Pascal triangle, used by the thread-safe evaluation. ---*/
+
+  const short n = Degree;
+  vector<su2double> row(n+1, 0.0);
+  for (auto& r : binomRow) r = row;
+  row[0] = 1.0;
+  for (short i = 0; i <= n; ++i) {
+    for (short j = i; j > 0; --j) row[j] += row[j-1];
+    for (short k = 0; k < 3; ++k)
+      if (i == n-k) binomRow[k] = row;
+  }
 }
 
 su2double CBezierBlending::GetBasis(short val_i, su2double val_t){
@@ -69,6 +81,48 @@ su2double CBezierBlending::GetBernstein(short val_n, short val_i, su2double val_
   return value;
 }
 
+void CBezierBlending::GetBasisTable(su2double val_t, unsigned short n_basis, su2double* basis,
+                                    su2double* der1, su2double* der2) const {
+
+  const short n = Degree;
+  const su2double *binom = binomRow[0].data(), *binom1 = binomRow[1].data(), *binom2 = binomRow[2].data();
+
+  /*--- Powers of t and 1-t by repeated multiplication (exact 0/1 at the end points),
+   *    typical orders fit on the stack, larger ones fall back to the heap. ---*/
+
+  su2double stackPow[2*MAX_STACK_ORDER];
+  vector<su2double> heapPow;
+  su2double* tPow = stackPow;
+  if (Order > MAX_STACK_ORDER) {
+    heapPow.resize(2*Order);
+    tPow = heapPow.data();
+  }
+  su2double* sPow = tPow + Order;
+
+  tPow[0] = sPow[0] = 1.0;
+  for (short k = 1; k <= n; ++k) {
+    tPow[k] = tPow[k-1] * val_t;
+    sPow[k] = sPow[k-1] * (1.0 - val_t);
+  }
+
+  /*--- The derivatives are combinations of the lower order polynomials. ---*/
+
+  for (short i = 0; i < n_basis; ++i) {
+    basis[i] = EvalBernstein(n, i, binom, tPow, sPow);
+    if (der1) {
+      if (n < 1) der1[i] = 0.0;
+      else der1[i] = n*(EvalBernstein(n-1, i-1, binom1, tPow, sPow) -
+                        EvalBernstein(n-1, i, binom1, tPow, sPow));
+    }
+    if (der2) {
+      if (n < 2) der2[i] = 0.0;
+      else der2[i] = n*(n-1)*(EvalBernstein(n-2, i-2, binom2, tPow, sPow) -
+                          2.0*EvalBernstein(n-2, i-1, binom2, tPow, sPow) +
+                              EvalBernstein(n-2, i, binom2, tPow, sPow));
+    }
+  }
+}
+
 su2double CBezierBlending::GetDerivative(short val_i, su2double val_t, short val_order_der){
   return GetBernsteinDerivative(Degree, val_i, val_t, val_order_der);
 }
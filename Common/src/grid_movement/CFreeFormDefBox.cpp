@@ -28,6 +28,9 @@
 #include "../../include/grid_movement/CFreeFormDefBox.hpp"
 #include "../../include/grid_movement/CBezierBlending.hpp"
 #include "../../include/grid_movement/CBSplineBlending.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
+
+#include <random>
 
 CFreeFormDefBox::CFreeFormDefBox(void) : CGridMovement() { }
 
@@ -48,7 +51,6 @@ CFreeFormDefBox::CFreeFormDefBox(const unsigned short Degree[], unsigned short B
 
   ParamCoord = new su2double[nDim]; ParamCoord_ = new su2double[nDim];
   cart_coord = new su2double[nDim]; cart_coord_ = new su2double[nDim];
-  Gradient = new su2double[nDim];
 
   lDegree = Degree[0]; lOrder = lDegree+1;
   mDegree = Degree[1]; mOrder = mDegree+1;
@@ -115,7 +117,6 @@ CFreeFormDefBox::~CFreeFormDefBox(void) {
 
   delete [] ParamCoord;
   delete [] cart_coord;
-  delete [] Gradient;
 
   for (iCornerPoints = 0; iCornerPoints < nCornerPoints; iCornerPoints++)
     delete [] Coord_Corner_Points[iCornerPoints];
@@ -757,6 +758,13 @@ su2double *CFreeFormDefBox::GetParametricCoord_Analytical(const su2double *cart_
 su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
   unsigned short iDim, iDegree, jDegree, kDegree;
 
+  /*--- Tabulate the blending functions once per direction. ---*/
+
+  vector<su2double> Basis_l(lOrder), Basis_m(mOrder), Basis_n(nOrder);
+  BlendingFunction[0]->GetBasisTable(ParamCoord[0], lOrder, Basis_l.data(), nullptr, nullptr);
+  BlendingFunction[1]->GetBasisTable(ParamCoord[1], mOrder, Basis_m.data(), nullptr, nullptr);
+  BlendingFunction[2]->GetBasisTable(ParamCoord[2], nOrder, Basis_n.data(), nullptr, nullptr);
+
   for (iDim = 0; iDim < nDim; iDim++)
     cart_coord[iDim] = 0.0;
 
@@ -765,94 +773,158 @@ su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) const {
       for (kDegree = 0; kDegree <= nDegree; kDegree++)
         for (iDim = 0; iDim < nDim; iDim++) {
           cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+          * Basis_l[iDegree] * Basis_m[jDegree] * Basis_n[kDegree];
         }
 
   return cart_coord;
 }
 
+void CFreeFormDefBox::GetControlPointsFlat(vector<su2double>& cp) const {
 
-su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
+  cp.resize(size_t(lOrder)*mOrder*nOrder*3);
 
-  unsigned short iDim, jDim, lmn[3];
+  size_t iCP = 0;
+  for (unsigned short iOrder = 0; iOrder < lOrder; iOrder++)
+    for (unsigned short jOrder = 0; jOrder < mOrder; jOrder++)
+      for (unsigned short kOrder = 0; kOrder < nOrder; kOrder++)
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          cp[iCP++] = Coord_Control_Points[iOrder][jOrder][kOrder][iDim];
+}
 
-  /*--- Set the Degree of the spline ---*/
+void CFreeFormDefBox::EvalCartesianCoord(const su2double *cp, const su2double *uvw, su2double *xyz,
+                                         su2double (*dxyz)[3], su2double (*d2xyz)[3][3],
+                                         vector<su2double>& work) const {
 
-  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  /*--- Combinations of derivative orders in the v and w directions that are needed
+   *    after contracting the k and j indices, (0,0) is always first. ---*/
 
-  for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
+  constexpr unsigned short nComb = 6;
+  constexpr unsigned short comb[nComb][2] = {{0,0}, {1,0}, {0,1}, {2,0}, {1,1}, {0,2}};
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz,  lmn) *
-      GetDerivative3(val_coord, iDim, jDim, lmn);
+  const bool deriv = (dxyz != nullptr);
+  const unsigned short nDer = deriv? 3 : 1;
+  const unsigned short nCombUsed = deriv? nComb : 1;
+  const unsigned short L = lOrder, M = mOrder, N = nOrder;
+  const unsigned short maxOrder = max(L, max(M, N));
 
-  return Gradient;
+  /*--- Work space: 1D tables of the blending functions and their derivatives,
+   *    the partial sums over k, and the partial sums over j. ---*/
 
-}
+  const size_t sizeTables = 3*3*size_t(maxOrder);
+  const size_t sizeK = size_t(L)*M*3*3;
+  const size_t sizeJ = size_t(L)*nComb*3;
+  if (work.size() < sizeTables+sizeK+sizeJ) work.resize(sizeTables+sizeK+sizeJ);
 
-void CFreeFormDefBox::GetFFDHessian(su2double *uvw, su2double *xyz, su2double **val_Hessian) {
+  su2double* tables = work.data();
+  su2double* sumK = tables + sizeTables;
+  su2double* sumJ = sumK + sizeK;
 
-  unsigned short iDim, jDim, lmn[3];
+  auto B = [&](unsigned short iParam, unsigned short iDer) { return tables + (iParam*3+iDer)*maxOrder; };
 
-  /*--- Set the Degree of the spline ---*/
+  for (unsigned short iParam = 0; iParam < 3; iParam++) {
+    BlendingFunction[iParam]->GetBasisTable(uvw[iParam], (iParam==0)? L : ((iParam==1)? M : N),
+                                            B(iParam,0), deriv? B(iParam,1) : nullptr, deriv? B(iParam,2) : nullptr);
+  }
 
-  lmn[0] = lDegree; lmn[1] = mDegree; lmn[2] = nDegree;
+  /*--- Contract k (the innermost index of the control points, contiguous in memory). ---*/
+
+  for (unsigned short i = 0; i < L; i++) {
+    for (unsigned short j = 0; j < M; j++) {
+      const su2double* cp_ij = cp + (size_t(i)*M+j)*N*3;
+      su2double* sumK_ij = sumK + (size_t(i)*M+j)*9;
+      for (unsigned short iDer = 0; iDer < nDer; iDer++) {
+        const su2double* Bw = B(2,iDer);
+        su2double sum[3] = {0.0, 0.0, 0.0};
+        for (unsigned short k = 0; k < N; k++)
+          for (unsigned short iDim = 0; iDim < 3; iDim++)
+            sum[iDim] += cp_ij[k*3+iDim] * Bw[k];
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          sumK_ij[iDer*3+iDim] = sum[iDim];
+      }
+    }
+  }
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++)
-      val_Hessian[iDim][jDim] = 0.0;
+  /*--- Contract j. ---*/
+
+  for (unsigned short i = 0; i < L; i++) {
+    for (unsigned short iComb = 0; iComb < nCombUsed; iComb++) {
+      const su2double* Bv = B(1,comb[iComb][0]);
+      const unsigned short derW = comb[iComb][1];
+      su2double sum[3] = {0.0, 0.0, 0.0};
+      for (unsigned short j = 0; j < M; j++)
+        for (unsigned short iDim = 0; iDim < 3; iDim++)
+          sum[iDim] += sumK[((size_t(i)*M+j)*3+derW)*3+iDim] * Bv[j];
+      for (unsigned short iDim = 0; iDim < 3; iDim++)
+        sumJ[(i*nComb+iComb)*3+iDim] = sum[iDim];
+    }
+  }
 
-  /*--- Note that being all the functions linear combinations of polynomials, they are C^\infty,
-   and the Hessian will be symmetric; no need to compute the under-diagonal part, for example ---*/
+  /*--- Contract i, d^{a+b+c}X / du^a dv^b dw^c. ---*/
 
-  for (iDim = 0; iDim < nDim; iDim++) {
-    val_Hessian[0][0] += 2.0 * GetDerivative3(uvw, iDim,0, lmn) * GetDerivative3(uvw, iDim,0, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,0,0, lmn);
+  auto contractI = [&](unsigned short derU, unsigned short iComb, unsigned short iDim) {
+    const su2double* Bu = B(0,derU);
+    su2double sum = 0.0;
+    for (unsigned short i = 0; i < L; i++) sum += sumJ[(i*nComb+iComb)*3+iDim] * Bu[i];
+    return sum;
+  };
+
+  for (unsigned short iDim = 0; iDim < 3; iDim++) {
+    xyz[iDim] = contractI(0, 0, iDim);
+    if (!deriv) continue;
+
+    dxyz[iDim][0] = contractI(1, 0, iDim);
+    dxyz[iDim][1] = contractI(0, 1, iDim);
+    dxyz[iDim][2] = contractI(0, 2, iDim);
+
+    if (!d2xyz) continue;
 
-    val_Hessian[1][1] += 2.0 * GetDerivative3(uvw, iDim,1, lmn) * GetDerivative3(uvw, iDim,1, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,1,1, lmn);
+    d2xyz[iDim][0][0] = contractI(2, 0, iDim);
+    d2xyz[iDim][1][1] = contractI(0, 3, iDim);
+    d2xyz[iDim][2][2] = contractI(0, 5, iDim);
+    d2xyz[iDim][0][1] = d2xyz[iDim][1][0] = contractI(1, 1, iDim);
+    d2xyz[iDim][0][2] = d2xyz[iDim][2][0] = contractI(1, 2, iDim);
+    d2xyz[iDim][1][2] = d2xyz[iDim][2][1] = contractI(0, 4, iDim);
+  }
+}
 
-    val_Hessian[2][2] += 2.0 * GetDerivative3(uvw, iDim,2, lmn) * GetDerivative3(uvw, iDim,2, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,2,2, lmn);
+su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, const su2double *ParamCoordGuess, CConfig *config) {
 
-    val_Hessian[0][1] += 2.0 * GetDerivative3(uvw, iDim,0, lmn) * GetDerivative3(uvw, iDim,1, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,0,1, lmn);
+  vector<su2double> cp, work;
+  su2double MinNormError = 0.0;
 
-    val_Hessian[0][2] += 2.0 * GetDerivative3(uvw, iDim,0, lmn) * GetDerivative3(uvw, iDim,2, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,0,2, lmn);
+  GetControlPointsFlat(cp);
+
+  /*--- The code has hit the max number of iterations ---*/
 
-    val_Hessian[1][2] += 2.0 * GetDerivative3(uvw, iDim,1, lmn) * GetDerivative3(uvw, iDim,2, lmn) +
-    GetDerivative2(uvw, iDim,xyz, lmn) * GetDerivative5(uvw, iDim,1,2, lmn);
+  if (!GetParametricCoord_Newton(cp.data(), xyz, ParamCoordGuess, ParamCoord, config, iPoint, work, MinNormError)) {
+    cout << "Unknown point: (" << xyz[0] <<", "<< xyz[1] <<", "<< xyz[2] <<"). Increase the value of FFD_ITERATIONS." << endl;
   }
 
-  val_Hessian[1][0] = val_Hessian[0][1];
-  val_Hessian[2][0] = val_Hessian[0][2];
-  val_Hessian[2][1] = val_Hessian[1][2];
+  /*--- Real Solution is now ParamCoord; Return it ---*/
+
+  return ParamCoord;
 
 }
 
-su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double *xyz, const su2double *ParamCoordGuess, CConfig *config) {
+bool CFreeFormDefBox::GetParametricCoord_Newton(const su2double *cp, const su2double *xyz, const su2double *ParamCoordGuess,
+                                                su2double *uvw, const CConfig *config, unsigned long seed,
+                                                vector<su2double>& work, su2double& MinNormError) const {
 
-  su2double *IndepTerm, SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0,0.0,0.0};
-  unsigned short iDim, jDim, RandonCounter;
+  su2double SOR_Factor = 1.0, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0,0.0,0.0};
+  su2double Coord[3], dCoord[3][3], d2Coord[3][3][3], Grad[3], Hess[3][3], IndepTerm[3];
+  unsigned short iDim, jDim, kDim, RandonCounter;
   unsigned long iter;
 
-  su2double tol = config->GetFFD_Tol()*1E-3;
-  unsigned short it_max = config->GetnFFD_Iter();
-  unsigned short Random_Trials = 500;
+  const su2double tol = config->GetFFD_Tol()*1E-3;
+  const unsigned short it_max = config->GetnFFD_Iter();
+  const unsigned short Random_Trials = 500;
+  const bool bspline = (config->GetFFD_Blending() == BSPLINE_UNIFORM);
 
-  /*--- Allocate the Hessian ---*/
+  /*--- Local generator for the random restarts, rand() is neither thread-safe nor reproducible. ---*/
 
-  Hessian = new su2double* [nDim];
-  IndepTerm = new su2double [nDim];
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Hessian[iDim] = new su2double[nDim];
-    ParamCoord[iDim] = ParamCoordGuess[iDim];
-    IndepTerm [iDim] = 0.0;
-  }
+  minstd_rand generator(seed+1);
+
+  for (iDim = 0; iDim < 3; iDim++) uvw[iDim] = ParamCoordGuess[iDim];
 
   RandonCounter = 0; MinNormError = 1E6;
 
@@ -860,50 +932,61 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
 
   for (iter = 0; iter < (unsigned long)it_max*Random_Trials; iter++) {
 
-    /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
+    /*--- Gradient and Hessian of F(u,v,w) = ||X(u,v,w)-(x,y,z)||^2 ---*/
 
-    Gradient = GetFFDGradient(ParamCoord, xyz);
+    EvalCartesianCoord(cp, uvw, Coord, dCoord, d2Coord, work);
 
-    for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = - Gradient[iDim];
+    for (jDim = 0; jDim < 3; jDim++) {
+      Grad[jDim] = 0.0;
+      for (kDim = 0; kDim < 3; kDim++) Hess[jDim][kDim] = 0.0;
+    }
+    for (iDim = 0; iDim < 3; iDim++) {
+      const su2double delta = 2.0*(Coord[iDim] - xyz[iDim]);
+      for (jDim = 0; jDim < 3; jDim++) {
+        Grad[jDim] += delta * dCoord[iDim][jDim];
+        for (kDim = 0; kDim < 3; kDim++)
+          Hess[jDim][kDim] += 2.0 * dCoord[iDim][jDim] * dCoord[iDim][kDim] + delta * d2Coord[iDim][jDim][kDim];
+      }
+    }
 
-    /*--- Hessian = The Matrix of our system, getHessian(sol_old,xyz,...) ---*/
+    /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
 
-    GetFFDHessian(ParamCoord, xyz, Hessian);
+    for (iDim = 0; iDim < 3; iDim++) IndepTerm[iDim] = - Grad[iDim];
 
     /*--- Adjoint to Hessian ---*/
 
-    AdjHessian[0][0] = Hessian[1][1]*Hessian[2][2]-Hessian[1][2]*Hessian[2][1];
-    AdjHessian[0][1] = Hessian[0][2]*Hessian[2][1]-Hessian[0][1]*Hessian[2][2];
-    AdjHessian[0][2] = Hessian[0][1]*Hessian[1][2]-Hessian[0][2]*Hessian[1][1];
-    AdjHessian[1][0] = Hessian[1][2]*Hessian[2][0]-Hessian[1][0]*Hessian[2][2];
-    AdjHessian[1][1] = Hessian[0][0]*Hessian[2][2]-Hessian[0][2]*Hessian[2][0];
-    AdjHessian[1][2] = Hessian[0][2]*Hessian[1][0]-Hessian[0][0]*Hessian[1][2];
-    AdjHessian[2][0] = Hessian[1][0]*Hessian[2][1]-Hessian[1][1]*Hessian[2][0];
-    AdjHessian[2][1] = Hessian[0][1]*Hessian[2][0]-Hessian[0][0]*Hessian[2][1];
-    AdjHessian[2][2] = Hessian[0][0]*Hessian[1][1]-Hessian[0][1]*Hessian[1][0];
+    AdjHessian[0][0] = Hess[1][1]*Hess[2][2]-Hess[1][2]*Hess[2][1];
+    AdjHessian[0][1] = Hess[0][2]*Hess[2][1]-Hess[0][1]*Hess[2][2];
+    AdjHessian[0][2] = Hess[0][1]*Hess[1][2]-Hess[0][2]*Hess[1][1];
+    AdjHessian[1][0] = Hess[1][2]*Hess[2][0]-Hess[1][0]*Hess[2][2];
+    AdjHessian[1][1] = Hess[0][0]*Hess[2][2]-Hess[0][2]*Hess[2][0];
+    AdjHessian[1][2] = Hess[0][2]*Hess[1][0]-Hess[0][0]*Hess[1][2];
+    AdjHessian[2][0] = Hess[1][0]*Hess[2][1]-Hess[1][1]*Hess[2][0];
+    AdjHessian[2][1] = Hess[0][1]*Hess[2][0]-Hess[0][0]*Hess[2][1];
+    AdjHessian[2][2] = Hess[0][0]*Hess[1][1]-Hess[0][1]*Hess[1][0];
 
     /*--- Determinant of Hessian ---*/
 
-    Determinant = Hessian[0][0]*AdjHessian[0][0]+Hessian[0][1]*AdjHessian[1][0]+Hessian[0][2]*AdjHessian[2][0];
+    Determinant = Hess[0][0]*AdjHessian[0][0]+Hess[0][1]*AdjHessian[1][0]+Hess[0][2]*AdjHessian[2][0];
 
     /*--- Hessian inverse ---*/
 
     if (Determinant != 0) {
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (iDim = 0; iDim < 3; iDim++) {
         Temp[iDim] = 0.0;
-        for (jDim = 0; jDim < nDim; jDim++) {
+        for (jDim = 0; jDim < 3; jDim++) {
           Temp[iDim] += AdjHessian[iDim][jDim]*IndepTerm[jDim]/Determinant;
         }
       }
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (iDim = 0; iDim < 3; iDim++) {
         IndepTerm[iDim] = Temp[iDim];
       }
     }
 
     /*--- Update with Successive over-relaxation ---*/
 
-    for (iDim = 0; iDim < nDim; iDim++) {
-      ParamCoord[iDim] = (1.0-SOR_Factor)*ParamCoord[iDim] + SOR_Factor*(ParamCoord[iDim] + IndepTerm[iDim]);
+    for (iDim = 0; iDim < 3; iDim++) {
+      uvw[iDim] = (1.0-SOR_Factor)*uvw[iDim] + SOR_Factor*(uvw[iDim] + IndepTerm[iDim]);
     }
 
     /*--- If the gradient is small, we have converged ---*/
@@ -913,7 +996,7 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     /*--- Compute the norm of the error ---*/
 
     NormError = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
+    for (iDim = 0; iDim < 3; iDim++)
       NormError += IndepTerm[iDim]*IndepTerm[iDim];
     NormError = sqrt(NormError);
 
@@ -924,13 +1007,10 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     if (((iter % it_max) == 0) && (iter != 0)) {
 
       RandonCounter++;
-      if (RandonCounter == Random_Trials) {
-        cout << endl << "Unknown point: "<< iPoint <<" (" << xyz[0] <<", "<< xyz[1] <<", "<< xyz[2] <<"). Min Error: "<< MinNormError <<". Iter: "<< iter <<"."<< endl;
-      }
-      else {
+      if (RandonCounter < Random_Trials) {
         SOR_Factor = 0.1;
-        for (iDim = 0; iDim < nDim; iDim++)
-          ParamCoord[iDim] = su2double(rand())/su2double(RAND_MAX);
+        for (iDim = 0; iDim < 3; iDim++)
+          uvw[iDim] = su2double(generator()-generator.min()) / su2double(generator.max()-generator.min());
       }
 
     }
@@ -938,33 +1018,94 @@ su2double *CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     /* --- Splines are not defined outside of [0,1]. So if the parametric coords are outside of
      *  [0,1] the step was too big and we have to use a smaller relaxation factor. ---*/
 
-    if ((config->GetFFD_Blending() == BSPLINE_UNIFORM)     &&
-        (((ParamCoord[0] < 0.0) || (ParamCoord[0] > 1.0))  ||
-         ((ParamCoord[1] < 0.0) || (ParamCoord[1] > 1.0))  ||
-         ((ParamCoord[2] < 0.0) || (ParamCoord[2] > 1.0)))) {
+    if (bspline &&
+        (((uvw[0] < 0.0) || (uvw[0] > 1.0))  ||
+         ((uvw[1] < 0.0) || (uvw[1] > 1.0))  ||
+         ((uvw[2] < 0.0) || (uvw[2] > 1.0)))) {
 
-      for (iDim = 0; iDim < nDim; iDim++){
-        ParamCoord[iDim] = ParamCoordGuess[iDim];
+      for (iDim = 0; iDim < 3; iDim++){
+        uvw[iDim] = ParamCoordGuess[iDim];
       }
       SOR_Factor = 0.9*SOR_Factor;
     }
 
   }
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Hessian[iDim];
-  delete [] Hessian;
-  delete [] IndepTerm;
+  return (iter < (unsigned long)it_max*Random_Trials);
 
-  /*--- The code has hit the max number of iterations ---*/
+}
 
-  if (iter == (unsigned long)it_max*Random_Trials) {
-    cout << "Unknown point: (" << xyz[0] <<", "<< xyz[1] <<", "<< xyz[2] <<"). Increase the value of FFD_ITERATIONS." << endl;
-  }
+void CFreeFormDefBox::GetParametricCoord_Batch(unsigned long nPoint, unsigned short nDim, const su2double *xyz,
+                                               su2double *uvw, su2double *diff, bool chain_guess,
+                                               const CConfig *config) const {
 
-  /*--- Real Solution is now ParamCoord; Return it ---*/
+  /*--- Fixed size chunks are distributed over the threads. With chained guesses each point starts from the
+   *    (clamped) solution of the previous one in the same chunk, the first point of each chunk starts from
+   *    its own guess, hence the results do not depend on the number of threads. ---*/
 
-  return ParamCoord;
+  const unsigned long chunkSize = 64;
+  const unsigned long nChunk = roundUpDiv(nPoint, chunkSize);
+  const su2double tol = config->GetFFD_Tol();
+  const su2double lower_limit = -tol;
+  const su2double upper_limit = 1.0 + tol;
+
+  vector<su2double> cp;
+  GetControlPointsFlat(cp);
+
+  vector<char> converged(nPoint, true);
+
+  SU2_OMP_PARALLEL
+  {
+    vector<su2double> work;
+    su2double Coord[3], MinNormError;
+
+    SU2_OMP_FOR_DYN(1)
+    for (unsigned long iChunk = 0; iChunk < nChunk; ++iChunk) {
+
+      const unsigned long begin = iChunk*chunkSize;
+      const unsigned long end = min(nPoint, begin+chunkSize);
+
+      su2double guess[3] = {uvw[3*begin], uvw[3*begin+1], uvw[3*begin+2]};
+
+      for (unsigned long iPoint = begin; iPoint < end; ++iPoint) {
+
+        su2double* uvw_i = &uvw[3*iPoint];
+        const su2double* xyz_i = &xyz[3*iPoint];
+
+        if (!chain_guess) {
+          for (unsigned short iDim = 0; iDim < 3; iDim++) guess[iDim] = uvw_i[iDim];
+        }
+
+        converged[iPoint] = GetParametricCoord_Newton(cp.data(), xyz_i, guess, uvw_i, config, iPoint, work, MinNormError);
+
+        /*--- Recompute the cartesian coordinates to check that everything is correct ---*/
+
+        EvalCartesianCoord(cp.data(), uvw_i, Coord, nullptr, nullptr, work);
+
+        su2double Diff = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
+          Diff += pow(Coord[iDim]-xyz_i[iDim], 2);
+        diff[iPoint] = sqrt(Diff);
+
+        /*--- Points inside the box are used as the guess for the next point, after the same
+         *    rectification to [tol, 1-tol] that is applied to the stored parametric coordinates. ---*/
+
+        if (chain_guess &&
+            (uvw_i[0] >= lower_limit) && (uvw_i[0] <= upper_limit) &&
+            (uvw_i[1] >= lower_limit) && (uvw_i[1] <= upper_limit) &&
+            (uvw_i[2] >= lower_limit) && (uvw_i[2] <= upper_limit)) {
+          for (unsigned short iDim = 0; iDim < 3; iDim++)
+            guess[iDim] = min(max(uvw_i[iDim], tol), 1.0-tol);
+        }
+      }
+    }
+  } // end SU2_OMP_PARALLEL
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    if (!converged[iPoint])
+      cout << "Unknown point: (" << xyz[3*iPoint] <<", "<< xyz[3*iPoint+1] <<", "<< xyz[3*iPoint+2]
+           <<"). Increase the value of FFD_ITERATIONS." << endl;
+  }
 
 }
 
@@ -731,8 +731,8 @@ void CSurfaceMovement::CopyBoundary(CGeometry *geometry, CConfig *config) {
 void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
 
   unsigned short iMarker, iDim, iOrder, jOrder, kOrder, lOrder, mOrder, nOrder;
-  unsigned long iVertex, iPoint, TotalVertex = 0;
-  su2double *CartCoordNew, *ParamCoord, CartCoord[3], ParamCoordGuess[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
+  unsigned long iVertex, iPoint;
+  su2double *ParamCoord, CartCoord[3], MaxDiff, my_MaxDiff = 0.0, Diff, *Coord;
   unsigned short nDim = geometry->GetnDim();
   su2double X_0, Y_0, Z_0, Xbar, Ybar, Zbar;
 
@@ -770,17 +770,11 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
     FFDBox->BlendingFunction[1]->SetOrder(2, 2);
     FFDBox->BlendingFunction[2]->SetOrder(2, 2);
   }
-  /*--- Point inversion algorithm with a basic box ---*/
-
-  ParamCoordGuess[0]  = 0.5; ParamCoordGuess[1] = 0.5; ParamCoordGuess[2] = 0.5;
-  CartCoord[0]        = 0.0; CartCoord[1]       = 0.0; CartCoord[2]       = 0.0;
+  /*--- Gather the surface points that are inside the FFD box, in cartesian or polar coordinates. ---*/
 
-  /*--- Count the number of vertices ---*/
-
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    if (config->GetMarker_All_DV(iMarker) == YES)
-      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
-        TotalVertex++;
+  vector<unsigned short> MarkerIdx;
+  vector<unsigned long> VertexIdx, PointIdx;
+  vector<su2double> CartCoords;
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
 
@@ -790,6 +784,7 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
 
         /*--- Get the cartesian coordinates ---*/
 
+        CartCoord[0] = 0.0; CartCoord[1] = 0.0; CartCoord[2] = 0.0;
         for (iDim = 0; iDim < nDim; iDim++)
           CartCoord[iDim] = geometry->vertex[iMarker][iVertex]->GetCoord(iDim);
 
@@ -819,72 +814,68 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
         /*--- If the point is inside the FFD, compute the value of the parametric coordinate ---*/
 
         if (FFDBox->GetPointFFD(geometry, config, iPoint)) {
+          MarkerIdx.push_back(iMarker);
+          VertexIdx.push_back(iVertex);
+          PointIdx.push_back(iPoint);
+          CartCoords.insert(CartCoords.end(), CartCoord, CartCoord+3);
+        }
+      }
+    }
+  }
 
-          /*--- Find the parametric coordinate ---*/
-
-          ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
-
-          /*--- Compute the cartesian coordinates using the parametric coordinates
-           to check that everything is correct ---*/
-
-          CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+  /*--- Point inversion algorithm with a basic box, the guess for each point is the solution of
+   *    the previous one, in chunks of points (processed in parallel) that start from the center of the box. ---*/
 
-          /*--- Compute max difference between original value and the recomputed value ---*/
+  const unsigned long nInside = PointIdx.size();
+  vector<su2double> ParamCoords(3*nInside, 0.5), Diffs(nInside);
 
-          Diff = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++)
-            Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
-          Diff = sqrt(Diff);
-          my_MaxDiff = max(my_MaxDiff, Diff);
+  FFDBox->GetParametricCoord_Batch(nInside, nDim, CartCoords.data(), ParamCoords.data(), Diffs.data(), true, config);
 
-          /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
+  for (unsigned long iInside = 0; iInside < nInside; iInside++) {
 
-          if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
-              ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
+    ParamCoord = &ParamCoords[3*iInside];
+    const su2double* CartCoord_i = &CartCoords[3*iInside];
+    Diff = Diffs[iInside];
 
+    /*--- Compute max difference between original value and the recomputed value ---*/
 
-            /*--- Rectification of the initial tolerance (we have detected situations
-             where 0.0 and 1.0 doesn't work properly ---*/
+    my_MaxDiff = max(my_MaxDiff, Diff);
 
-            su2double lower_limit = config->GetFFD_Tol();
-            su2double upper_limit = 1.0-config->GetFFD_Tol();
+    /*--- If the parametric coordinates are in (0,1) the point belongs to the FFDBox, using the input tolerance  ---*/
 
-            if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
-            if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
-            if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
-            if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
-            if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
-            if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
+    if (((ParamCoord[0] >= - config->GetFFD_Tol()) && (ParamCoord[0] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[1] >= - config->GetFFD_Tol()) && (ParamCoord[1] <= 1.0 + config->GetFFD_Tol())) &&
+        ((ParamCoord[2] >= - config->GetFFD_Tol()) && (ParamCoord[2] <= 1.0 + config->GetFFD_Tol()))) {
 
-            /*--- Set the value of the parametric coordinate ---*/
 
-            FFDBox->Set_MarkerIndex(iMarker);
-            FFDBox->Set_VertexIndex(iVertex);
-            FFDBox->Set_PointIndex(iPoint);
-            FFDBox->Set_ParametricCoord(ParamCoord);
-            FFDBox->Set_CartesianCoord(CartCoord);
+      /*--- Rectification of the initial tolerance (we have detected situations
+       where 0.0 and 1.0 doesn't work properly ---*/
 
-            ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
+      su2double lower_limit = config->GetFFD_Tol();
+      su2double upper_limit = 1.0-config->GetFFD_Tol();
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+      if (ParamCoord[0] < lower_limit) ParamCoord[0] = lower_limit;
+      if (ParamCoord[1] < lower_limit) ParamCoord[1] = lower_limit;
+      if (ParamCoord[2] < lower_limit) ParamCoord[2] = lower_limit;
+      if (ParamCoord[0] > upper_limit) ParamCoord[0] = upper_limit;
+      if (ParamCoord[1] > upper_limit) ParamCoord[1] = upper_limit;
+      if (ParamCoord[2] > upper_limit) ParamCoord[2] = upper_limit;
 
-          }
-          else {
+      /*--- Set the value of the parametric coordinate ---*/
 
-            if (Diff >= config->GetFFD_Tol()) {
-              cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
-              << CartCoord[0] <<" "<< CartCoord[1] <<" "<< CartCoord[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
-            }
+      FFDBox->Set_MarkerIndex(MarkerIdx[iInside]);
+      FFDBox->Set_VertexIndex(VertexIdx[iInside]);
+      FFDBox->Set_PointIndex(PointIdx[iInside]);
+      FFDBox->Set_ParametricCoord(ParamCoord);
+      FFDBox->Set_CartesianCoord(CartCoord_i);
 
-          }
+    }
 
-        }
-      }
+    if (Diff >= config->GetFFD_Tol()) {
+      cout << "Please check this point: Local (" << ParamCoord[0] <<" "<< ParamCoord[1] <<" "<< ParamCoord[2] <<") <-> Global ("
+      << CartCoord_i[0] <<" "<< CartCoord_i[1] <<" "<< CartCoord_i[2] <<") <-> Error "<< Diff <<" vs "<< config->GetFFD_Tol() <<"." << endl;
     }
+
   }
 
 #ifdef HAVE_MPI
@@ -1378,11 +1369,14 @@ void CSurfaceMovement::CheckFFDIntersections(CGeometry *geometry, CConfig *confi
 void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *config, CFreeFormDefBox *FFDBox, unsigned short iFFDBox) {
   unsigned short iMarker, iDim;
   unsigned long iVertex, iPoint, iSurfacePoints;
-  su2double CartCoord[3] = {0.0,0.0,0.0}, *CartCoordNew, *CartCoordOld;
-  su2double *ParamCoord, *var_coord, ParamCoordGuess[3] = {0.0,0.0,0.0};
-  su2double MaxDiff, my_MaxDiff = 0.0, Diff;
+  su2double CartCoord[3] = {0.0,0.0,0.0}, *CartCoordOld;
+  su2double *ParamCoord, *var_coord;
+  su2double MaxDiff, my_MaxDiff = 0.0;
 
-  /*--- Recompute the parametric coordinates ---*/
+  /*--- Gather the surface points that need to be updated ---*/
+
+  vector<unsigned long> SurfacePointIdx;
+  vector<su2double> CartCoords, ParamCoords;
 
   for (iSurfacePoints = 0; iSurfacePoints < FFDBox->GetnSurfacePoint(); iSurfacePoints++) {
 
@@ -1398,7 +1392,8 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
       iPoint = FFDBox->Get_PointIndex(iSurfacePoints);
 
       /*--- Get the parametric and cartesians coordinates of the
-       surface point (they don't mach) ---*/
+       surface point (they don't mach), the previous value of the
+       parametric coordinates is used as the guess. ---*/
 
       ParamCoord = FFDBox->Get_ParametricCoord(iSurfacePoints);
 
@@ -1411,29 +1406,29 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
         CartCoord[iDim] = CartCoordOld[iDim] + var_coord[iDim];
       FFDBox->Set_CartesianCoord(CartCoord, iSurfacePoints);
 
-      /*--- Find the parametric coordinate using as ParamCoordGuess the previous value ---*/
+      SurfacePointIdx.push_back(iSurfacePoints);
+      CartCoords.insert(CartCoords.end(), CartCoord, CartCoord+3);
+      ParamCoords.insert(ParamCoords.end(), ParamCoord, ParamCoord+3);
+    }
+  }
 
-      ParamCoordGuess[0] = ParamCoord[0]; ParamCoordGuess[1] = ParamCoord[1]; ParamCoordGuess[2] = ParamCoord[2];
-      ParamCoord = FFDBox->GetParametricCoord_Iterative(iPoint, CartCoord, ParamCoordGuess, config);
+  /*--- Recompute the parametric coordinates ---*/
 
-      /*--- Set the new value of the parametric coordinates ---*/
+  const unsigned long nUpdate = SurfacePointIdx.size();
+  vector<su2double> Diffs(nUpdate);
 
-      FFDBox->Set_ParametricCoord(ParamCoord, iSurfacePoints);
+  FFDBox->GetParametricCoord_Batch(nUpdate, geometry->GetnDim(), CartCoords.data(), ParamCoords.data(),
+                                   Diffs.data(), false, config);
 
-      /*--- Compute the cartesian coordinates using the parametric coordinates
-       to check that everything is correct ---*/
+  for (unsigned long iUpdate = 0; iUpdate < nUpdate; iUpdate++) {
 
-      CartCoordNew = FFDBox->EvalCartesianCoord(ParamCoord);
+    /*--- Set the new value of the parametric coordinates ---*/
 
-      /*--- Compute max difference between original value and the recomputed value ---*/
+    FFDBox->Set_ParametricCoord(&ParamCoords[3*iUpdate], SurfacePointIdx[iUpdate]);
 
-      Diff = 0.0;
-      for (iDim = 0; iDim < geometry->GetnDim(); iDim++)
-        Diff += (CartCoordNew[iDim]-CartCoord[iDim])*(CartCoordNew[iDim]-CartCoord[iDim]);
-      Diff = sqrt(Diff);
-      my_MaxDiff = max(my_MaxDiff, Diff);
+    /*--- Max difference between original value and the recomputed value ---*/
 
-    }
+    my_MaxDiff = max(my_MaxDiff, Diffs[iUpdate]);
   }
 
 #ifdef HAVE_MPI
@@ -29,6 +29,8 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 
+#include <unordered_map>
+
 
 CInterpolator::CInterpolator(CGeometry ****geometry_container, const CConfig* const* config,
                              unsigned int iZone, unsigned int jZone) :
@@ -167,16 +169,21 @@ unsigned long CInterpolator::Collect_ElementInfo(int markDonor, unsigned short n
   return dstIdx;
 }
 
-void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
+void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker, const vector<passivedouble>* rankBoxes){
 
   CGeometry *geom = Geometry[val_zone][INST_0][MESH_0];
 
-  unsigned long iVertex, jVertex, kVertex;
+  unsigned long iVertex, jVertex;
 
-  unsigned long count, iTmp, *uptr, dPoint, EdgeIndex, jEdge, nEdges, nNodes, nVertex, iDim, nDim, iPoint;
+  unsigned long count, *uptr, dPoint, EdgeIndex, jEdge, nEdges, nNodes, nVertex, iDim, nDim, iPoint;
 
   unsigned long nGlobalLinkedNodes, nLocalVertex, nLocalLinkedNodes;
 
+  if (rankBoxes != nullptr) {
+    ReconstructBoundaryInBoxes(geom, val_marker, *rankBoxes);
+    return;
+  }
+
   nDim = geom->GetnDim();
 
   if( val_marker != -1 )
@@ -194,7 +201,7 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
 
 #ifdef HAVE_MPI
   int nProcessor = size, iRank;
-  unsigned long iTmp2, tmp_index, tmp_index_2;
+  unsigned long iTmp, iTmp2, tmp_index, tmp_index_2;
 #endif
 
   /*--- Copy coordinates and point to the auxiliar vector ---*/
@@ -352,29 +359,24 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
     Buffer_Receive_LinkedNodes[iVertex] = Buffer_Send_LinkedNodes[iVertex];
 #endif
 
+  /*--- Renumber the linked nodes from global point index to position in the reconstructed boundary,
+   *    the linked nodes that are not part of it are removed. ---*/
+
   if (rank == MASTER_NODE){
+    unordered_map<long, unsigned long> globalToBoundary;
+    globalToBoundary.reserve(nGlobalVertex);
+    for (iVertex = 0; iVertex < nGlobalVertex; iVertex++)
+      globalToBoundary[Buffer_Receive_GlobalPoint[iVertex]] = iVertex;
+
     for (iVertex = 0; iVertex < nGlobalVertex; iVertex++){
       count = 0;
       uptr = &Buffer_Receive_LinkedNodes[ Buffer_Receive_StartLinkedNodes[iVertex] ];
 
       for (jVertex = 0; jVertex < Buffer_Receive_nLinkedNodes[iVertex]; jVertex++){
-        iTmp = uptr[ jVertex ];
-        for (kVertex = 0; kVertex < nGlobalVertex; kVertex++){
-          if( Buffer_Receive_GlobalPoint[kVertex] == long(iTmp) ){
-            uptr[ jVertex ] = kVertex;
-            count++;
-            break;
-          }
-        }
-
-        if( count != (jVertex+1) ){
-          for (kVertex = jVertex; kVertex < Buffer_Receive_nLinkedNodes[iVertex]-1; kVertex++){
-            uptr[ kVertex ] = uptr[ kVertex + 1];
-          }
-          Buffer_Receive_nLinkedNodes[iVertex]--;
-          jVertex--;
-        }
+        const auto it = globalToBoundary.find(long(uptr[ jVertex ]));
+        if (it != globalToBoundary.end()) uptr[ count++ ] = it->second;
       }
+      Buffer_Receive_nLinkedNodes[iVertex] = count;
     }
   }
 
@@ -393,3 +395,155 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
   delete [] Buffer_Send_StartLinkedNodes; Buffer_Send_StartLinkedNodes = nullptr;
 
 }
+
+void CInterpolator::ReconstructBoundaryInBoxes(const CGeometry* geom, int val_marker,
+                                               const vector<passivedouble>& rankBoxes) {
+
+  const unsigned short nDim = geom->GetnDim();
+  const unsigned long nVertex = (val_marker != -1)? geom->GetnVertex(val_marker) : 0;
+
+  auto InBox = [&](unsigned long iPoint, int iRank) {
+    const passivedouble* boxMin = &rankBoxes[2*nDim*iRank];
+    const passivedouble* boxMax = boxMin + nDim;
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      const su2double x = geom->nodes->GetCoord(iPoint, iDim);
+      if ((x < boxMin[iDim]) || (x > boxMax[iDim])) return false;
+    }
+    return true;
+  };
+
+  /*--- Each rank needs the vertices inside its box, plus their direct neighbours such that the dual
+   *    elements of the former can be built. Each owned vertex is therefore sent to the ranks whose box
+   *    contains it or one of its neighbours on the marker (the coordinates of halo neighbours are known
+   *    locally). The coordinates go in one buffer, the global index, the number of linked nodes, and
+   *    their global indices in another. ---*/
+
+  vector<vector<su2double> > sendCoord(size);
+  vector<vector<unsigned long> > sendIdx(size);
+  vector<unsigned long> linked;
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+
+    const auto iPoint = geom->vertex[val_marker][iVertex]->GetNode();
+    if (!geom->nodes->GetDomain(iPoint)) continue;
+
+    linked.clear();
+    for (auto jPoint : geom->nodes->GetPoints(iPoint))
+      if (geom->nodes->GetVertex(jPoint, val_marker) != -1) linked.push_back(jPoint);
+
+    for (int iRank = 0; iRank < size; iRank++) {
+
+      bool send = InBox(iPoint, iRank);
+      for (auto iLinked = 0ul; !send && iLinked < linked.size(); iLinked++)
+        send = InBox(linked[iLinked], iRank);
+      if (!send) continue;
+
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        sendCoord[iRank].push_back(geom->nodes->GetCoord(iPoint, iDim));
+
+      sendIdx[iRank].push_back(geom->nodes->GetGlobalIndex(iPoint));
+      sendIdx[iRank].push_back(linked.size());
+      for (auto jPoint : linked) sendIdx[iRank].push_back(geom->nodes->GetGlobalIndex(jPoint));
+    }
+  }
+
+  /*--- Exchange the sizes, then the data directly between the ranks that have something to send. ---*/
+
+  vector<unsigned long> sendSize(2*size), recvSize(2*size);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendSize[2*iRank] = sendCoord[iRank].size() / nDim;
+    sendSize[2*iRank+1] = sendIdx[iRank].size();
+  }
+  SU2_MPI::Alltoall(sendSize.data(), 2, MPI_UNSIGNED_LONG, recvSize.data(), 2, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  vector<vector<su2double> > recvCoord(size);
+  vector<vector<unsigned long> > recvIdx(size);
+
+  recvCoord[rank] = move(sendCoord[rank]);
+  recvIdx[rank] = move(sendIdx[rank]);
+
+#ifdef HAVE_MPI
+  vector<SU2_MPI::Request> requests;
+  requests.reserve(4*size);
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    if ((iRank == rank) || (recvSize[2*iRank] == 0)) continue;
+    recvCoord[iRank].resize(recvSize[2*iRank]*nDim);
+    recvIdx[iRank].resize(recvSize[2*iRank+1]);
+
+    requests.emplace_back();
+    SU2_MPI::Irecv(recvCoord[iRank].data(), recvCoord[iRank].size(), MPI_DOUBLE, iRank, 0,
+                   SU2_MPI::GetComm(), &requests.back());
+    requests.emplace_back();
+    SU2_MPI::Irecv(recvIdx[iRank].data(), recvIdx[iRank].size(), MPI_UNSIGNED_LONG, iRank, 1,
+                   SU2_MPI::GetComm(), &requests.back());
+  }
+  for (int iRank = 0; iRank < size; iRank++) {
+    if ((iRank == rank) || (sendSize[2*iRank] == 0)) continue;
+
+    requests.emplace_back();
+    SU2_MPI::Isend(sendCoord[iRank].data(), sendCoord[iRank].size(), MPI_DOUBLE, iRank, 0,
+                   SU2_MPI::GetComm(), &requests.back());
+    requests.emplace_back();
+    SU2_MPI::Isend(sendIdx[iRank].data(), sendIdx[iRank].size(), MPI_UNSIGNED_LONG, iRank, 1,
+                   SU2_MPI::GetComm(), &requests.back());
+  }
+  SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  /*--- Unpack, in order of the source rank, into the buffers used by the interpolators. ---*/
+
+  nGlobalVertex = 0;
+  unsigned long nLinkedNodes = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    nGlobalVertex += recvSize[2*iRank];
+    nLinkedNodes += recvSize[2*iRank+1] - 2*recvSize[2*iRank];
+  }
+
+  Buffer_Receive_Coord       = new su2double    [ nGlobalVertex * nDim ];
+  Buffer_Receive_GlobalPoint = new long[ nGlobalVertex ];
+  Buffer_Receive_Proc        = new unsigned long[ nGlobalVertex ];
+
+  Buffer_Receive_nLinkedNodes     = new unsigned long[ nGlobalVertex ];
+  Buffer_Receive_LinkedNodes      = new unsigned long[ nLinkedNodes ];
+  Buffer_Receive_StartLinkedNodes = new unsigned long[ nGlobalVertex ];
+
+  unsigned long iVertex = 0, iLinked = 0;
+
+  for (int iRank = 0; iRank < size; iRank++) {
+    const su2double* coord = recvCoord[iRank].data();
+    const unsigned long* idx = recvIdx[iRank].data();
+
+    for (auto iRecv = 0ul; iRecv < recvSize[2*iRank]; iRecv++, iVertex++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        Buffer_Receive_Coord[iVertex*nDim+iDim] = *(coord++);
+
+      Buffer_Receive_GlobalPoint[iVertex] = *(idx++);
+      Buffer_Receive_Proc[iVertex] = iRank;
+      Buffer_Receive_nLinkedNodes[iVertex] = *(idx++);
+      Buffer_Receive_StartLinkedNodes[iVertex] = iLinked;
+
+      for (auto jLinked = 0ul; jLinked < Buffer_Receive_nLinkedNodes[iVertex]; jLinked++)
+        Buffer_Receive_LinkedNodes[iLinked++] = *(idx++);
+    }
+  }
+
+  /*--- Renumber the linked nodes from global point index to position in the reconstructed subset
+   *    of the boundary, the linked nodes that are not part of it are removed. ---*/
+
+  unordered_map<long, unsigned long> globalToBoundary;
+  globalToBoundary.reserve(nGlobalVertex);
+  for (iVertex = 0; iVertex < nGlobalVertex; iVertex++)
+    globalToBoundary[Buffer_Receive_GlobalPoint[iVertex]] = iVertex;
+
+  for (iVertex = 0; iVertex < nGlobalVertex; iVertex++) {
+    unsigned long count = 0;
+    auto uptr = &Buffer_Receive_LinkedNodes[ Buffer_Receive_StartLinkedNodes[iVertex] ];
+
+    for (auto jVertex = 0ul; jVertex < Buffer_Receive_nLinkedNodes[iVertex]; jVertex++) {
+      const auto it = globalToBoundary.find(long(uptr[ jVertex ]));
+      if (it != globalToBoundary.end()) uptr[ count++ ] = it->second;
+    }
+    Buffer_Receive_nLinkedNodes[iVertex] = count;
+  }
+}
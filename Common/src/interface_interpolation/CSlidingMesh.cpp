@@ -29,6 +29,10 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
+
+#include <memory>
+#include <unordered_map>
 
 
 CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* const* config,
@@ -39,319 +43,178 @@ CSlidingMesh::CSlidingMesh(CGeometry ****geometry_container, const CConfig* cons
 
 void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
-  /* 0 - Variable declaration */
-
-  /* --- General variables --- */
-
-  bool check;
-
-  unsigned short iDim;
-
-  unsigned long ii, jj, *uptr;
-  unsigned long vPoint;
-  unsigned long iEdgeVisited, nEdgeVisited, iNodeVisited;
-  unsigned long nAlreadyVisited, nToVisit, StartVisited;
-
-  unsigned long *alreadyVisitedDonor, *ToVisit, *tmpVect;
-  unsigned long *storeProc, *tmp_storeProc;
-
-  su2double dTMP;
-  su2double *Coeff_Vect, *tmp_Coeff_Vect;
-
-  /* --- Geometrical variables --- */
-
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
-  su2double Area, Area_old, tmp_Area;
-  su2double LineIntersectionLength, *Direction, length;
-
-
-  /* --- Markers Variables --- */
-
-  unsigned short iMarkerInt, nMarkerInt;
-
-  unsigned long iVertex, nVertexTarget;
-
-  int markDonor, markTarget;
-
-  /* --- Target variables --- */
-
-  unsigned long target_iPoint, jVertexTarget;
-  unsigned long nEdges_target, nNode_target;
-
-  unsigned long *Target_nLinkedNodes, *Target_LinkedNodes, *Target_StartLinkedNodes, *target_segment;
-  unsigned long  *Target_Proc;
-  long *Target_GlobalPoint, *Donor_GlobalPoint;
-
-  su2double *TargetPoint_Coord, *target_iMidEdge_point, *target_jMidEdge_point, **target_element;
-
-  /* --- Donor variables --- */
-
-  unsigned long donor_StartIndex, donor_forward_point, donor_backward_point, donor_iPoint, donor_OldiPoint;
-  unsigned long nEdges_donor, nNode_donor, nGlobalVertex_Donor;
-
-  unsigned long nDonorPoints, iDonor;
-  unsigned long *Donor_Vect, *tmp_Donor_Vect;
-  unsigned long *Donor_nLinkedNodes, *Donor_LinkedNodes, *Donor_StartLinkedNodes;
-  unsigned long *Donor_Proc;
-
-  su2double *donor_iMidEdge_point, *donor_jMidEdge_point;
-  su2double **donor_element, *DonorPoint_Coord;
-
   targetVertices.resize(config[targetZone]->GetnMarker_All());
 
-  /* 1 - Variable pre-processing */
-
   const unsigned short nDim = donor_geometry->GetnDim();
 
-  /*--- Setting up auxiliary vectors ---*/
-
-  Donor_Vect = nullptr;
-  Coeff_Vect = nullptr;
-  storeProc  = nullptr;
-
-  tmp_Donor_Vect = nullptr;
-  tmp_Coeff_Vect = nullptr;
-  tmp_storeProc  = nullptr;
-
-  Normal    = new su2double[nDim];
-  Direction = new su2double[nDim];
-
-
-  /* 2 - Find boundary tag between touching grids */
-
-  /*--- Number of markers on the FSI interface ---*/
-  nMarkerInt = (int)( config[ donorZone ]->GetMarker_n_ZoneInterface() ) / 2;
+  /*--- Number of markers on the interface ---*/
+  const unsigned short nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
 
   /*--- For the number of markers on the interface... ---*/
-  for ( iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++ ){
+  for (unsigned short iMarkerInt = 0; iMarkerInt < nMarkerInt; iMarkerInt++) {
 
     /*--- On the donor side: find the tag of the boundary sharing the interface ---*/
-    markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
+    const int markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- On the target side: find the tag of the boundary sharing the interface ---*/
-    markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+    const int markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
 
     /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
     if(!CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    nVertexTarget = 0;
-    if(markTarget != -1) nVertexTarget = target_geometry->GetnVertex( markTarget );
+    const unsigned long nVertexTarget = (markTarget != -1)? target_geometry->GetnVertex(markTarget) : 0;
+
+    /*--- Reconstruct the boundaries from parallel partitioning, each rank only receives the
+     *    part of each boundary that is close to the target vertices it owns. ---*/
 
-    /*
-    3 -Reconstruct the boundaries from parallel partitioning
-    */
+    vector<passivedouble> targetBoxes, donorBoxes;
+    ComputeRankBoundingBoxes(markDonor, markTarget, targetBoxes, donorBoxes);
 
     /*--- Target boundary ---*/
-    ReconstructBoundary(targetZone, markTarget);
+    ReconstructBoundary(targetZone, markTarget, &targetBoxes);
 
-    nGlobalVertex_Target = nGlobalVertex;
+    const unsigned long nGlobalVertex_Target = nGlobalVertex;
 
-    TargetPoint_Coord       = Buffer_Receive_Coord;
-    Target_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Target_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Target_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Target_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Target_Proc             = Buffer_Receive_Proc;
+    const su2double* const TargetPoint_Coord           = Buffer_Receive_Coord;
+    const long* const Target_GlobalPoint               = Buffer_Receive_GlobalPoint;
+    const unsigned long* const Target_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
+    const unsigned long* const Target_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
+    const unsigned long* const Target_LinkedNodes      = Buffer_Receive_LinkedNodes;
+    const unsigned long* const Target_Proc             = Buffer_Receive_Proc;
 
     /*--- Donor boundary ---*/
-    ReconstructBoundary(donorZone, markDonor);
+    ReconstructBoundary(donorZone, markDonor, &donorBoxes);
+
+    const unsigned long nGlobalVertex_Donor = nGlobalVertex;
+
+    su2double* const DonorPoint_Coord                 = Buffer_Receive_Coord;
+    const long* const Donor_GlobalPoint               = Buffer_Receive_GlobalPoint;
+    const unsigned long* const Donor_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
+    const unsigned long* const Donor_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
+    const unsigned long* const Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
+    const unsigned long* const Donor_Proc             = Buffer_Receive_Proc;
+
+    /*--- Map from global index to position in the reconstructed target boundary. ---*/
+
+    unordered_map<long, unsigned long> targetGlobalToLocal;
+    targetGlobalToLocal.reserve(nGlobalVertex_Target);
+    for (auto iVertex = 0ul; iVertex < nGlobalVertex_Target; iVertex++)
+      targetGlobalToLocal[Target_GlobalPoint[iVertex]] = iVertex;
 
-    nGlobalVertex_Donor = nGlobalVertex;
+    /*--- ADT of the donor vertices, used to find the closest donor to each target vertex. ---*/
 
-    DonorPoint_Coord       = Buffer_Receive_Coord;
-    Donor_GlobalPoint      = Buffer_Receive_GlobalPoint;
-    Donor_nLinkedNodes     = Buffer_Receive_nLinkedNodes;
-    Donor_StartLinkedNodes = Buffer_Receive_StartLinkedNodes;
-    Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
-    Donor_Proc             = Buffer_Receive_Proc;
+    unsigned long nOwnedTarget = 0;
+    for (auto iVertex = 0ul; iVertex < nVertexTarget; iVertex++)
+      nOwnedTarget += target_geometry->nodes->GetDomain(target_geometry->vertex[markTarget][iVertex]->GetNode());
+
+    if (nOwnedTarget && !nGlobalVertex_Donor)
+      SU2_MPI::Error("No donor vertices were found close to the target boundary, check that the\n"
+                     "donor and target sides of the sliding interface are matching surfaces.", CURRENT_FUNCTION);
+
+    vector<unsigned long> donorIDs(nGlobalVertex_Donor);
+    for (auto iVertex = 0ul; iVertex < nGlobalVertex_Donor; iVertex++) donorIDs[iVertex] = iVertex;
+
+    unique_ptr<CADTPointsOnlyClass> donorADT;
+    if (nOwnedTarget)
+      donorADT.reset(new CADTPointsOnlyClass(nDim, nGlobalVertex_Donor, DonorPoint_Coord, donorIDs.data(), false));
 
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
      * - Starting from the closest donor node, it expands the supermesh by including
      * donor elements neighboring the initial one, until the overall target area is fully covered.
+     * - Each target node is independent, the loop is distributed over the threads.
      */
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
 
-    if(nDim == 2){
-
-      target_iMidEdge_point = new su2double[nDim];
-      target_jMidEdge_point = new su2double[nDim];
-
-      donor_iMidEdge_point = new su2double[nDim];
-      donor_jMidEdge_point = new su2double[nDim];
+    SU2_OMP_PARALLEL
+    {
+    /*--- Thread-local auxiliary structures, (donor index, coefficient) pairs
+     *    and the lists of visited donor nodes for the 3D contour search. ---*/
 
-      /*--- Starts with supermesh reconstruction ---*/
+    vector<unsigned long> Donor_Vect, alreadyVisitedDonor, ToVisit;
+    vector<su2double> Coeff_Vect;
 
-      target_segment = new unsigned long[2];
+    if(nDim == 2){
 
-      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      su2double target_iMidEdge_point[2], target_jMidEdge_point[2], Direction[2];
+      su2double donor_iMidEdge_point[2], donor_jMidEdge_point[2];
+      unsigned long target_segment[2];
 
-        nDonorPoints = 0;
+      SU2_OMP_FOR_DYN(16)
+      for (unsigned long iVertex = 0; iVertex < nVertexTarget; iVertex++) {
 
         /*--- Stores coordinates of the target node ---*/
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
-
-        if (target_geometry->nodes->GetDomain(target_iPoint)){
-
-          Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
-
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
-
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
+        const auto target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
-
-          donor_iPoint    = donor_StartIndex;
-          donor_OldiPoint = donor_iPoint;
-
-          /*--- Contruct information regarding the target cell ---*/
-
-          long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
-
-          if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
-            target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
-            target_segment[1] = jVertexTarget;
-          }
-          else{
-            target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
-            target_segment[1] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] + 1];
-          }
-
-          dTMP = 0;
-          for(iDim = 0; iDim < nDim; iDim++){
-            target_iMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[0] + iDim ] +
-                                            target_geometry->nodes->GetCoord( target_iPoint , iDim) ) / 2;
-            target_jMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[1] + iDim ] +
-                                            target_geometry->nodes->GetCoord( target_iPoint , iDim) ) / 2;
-
-            Direction[iDim] = target_jMidEdge_point[iDim] - target_iMidEdge_point[iDim];
-            dTMP += Direction[iDim] * Direction[iDim];
-          }
-
-          dTMP = sqrt(dTMP);
-          for(iDim = 0; iDim < nDim; iDim++)
-            Direction[iDim] /= dTMP;
-
-          length = GeometryToolbox::Distance(nDim, target_iMidEdge_point, target_jMidEdge_point);
-
-          check = false;
-
-          /*--- Proceeds along the forward direction (depending on which connected boundary node is found first) ---*/
-
-          while( !check ){
-
-            /*--- Proceeds until the value of the intersection area is null ---*/
-
-            if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
-              donor_forward_point  = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
-              donor_backward_point = donor_iPoint;
-            }
-            else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+        if (!target_geometry->nodes->GetDomain(target_iPoint)) continue;
 
-              if( donor_OldiPoint != uptr[0] ){
-                donor_forward_point  = uptr[0];
-                donor_backward_point = uptr[1];
-              }
-              else{
-                donor_forward_point  = uptr[1];
-                donor_backward_point = uptr[0];
-              }
-            }
+        const su2double* Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-            if(donor_iPoint >= nGlobalVertex_Donor){
-              check = true;
-              continue;
-            }
+        /*--- Find the closest donor node ---*/
 
-            for(iDim = 0; iDim < nDim; iDim++){
-              donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] +
-                                             DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-              donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] +
-                                             DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
-            }
+        su2double dist;
+        unsigned long donor_StartIndex;
+        int rankID;
+        donorADT->DetermineNearestNode(Coord_i, dist, donor_StartIndex, rankID);
 
-            LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
-                                                                   donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+        unsigned long donor_iPoint = donor_StartIndex;
+        unsigned long donor_OldiPoint = donor_iPoint;
+        unsigned long donor_forward_point, donor_backward_point;
 
-            if ( LineIntersectionLength == 0.0 ){
-              check = true;
-              continue;
-            }
+        /*--- Contruct information regarding the target cell ---*/
 
-            /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
+        const auto jVertexTarget = targetGlobalToLocal.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
+        if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
+          target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
+          target_segment[1] = jVertexTarget;
+        }
+        else{
+          target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
+          target_segment[1] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] + 1];
+        }
 
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
+        su2double dTMP = 0;
+        for(unsigned short iDim = 0; iDim < nDim; iDim++){
+          target_iMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[0] + iDim ] + Coord_i[iDim] ) / 2;
+          target_jMidEdge_point[iDim] = ( TargetPoint_Coord[ nDim * target_segment[1] + iDim ] + Coord_i[iDim] ) / 2;
 
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
+          Direction[iDim] = target_jMidEdge_point[iDim] - target_iMidEdge_point[iDim];
+          dTMP += Direction[iDim] * Direction[iDim];
+        }
 
-            delete [] Donor_Vect;
-            delete [] Coeff_Vect;
-            delete [] storeProc;
+        dTMP = sqrt(dTMP);
+        for(unsigned short iDim = 0; iDim < nDim; iDim++)
+          Direction[iDim] /= dTMP;
 
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+        const su2double length = GeometryToolbox::Distance(nDim, target_iMidEdge_point, target_jMidEdge_point);
 
-            donor_OldiPoint = donor_iPoint;
-            donor_iPoint    = donor_forward_point;
+        Donor_Vect.clear();
+        Coeff_Vect.clear();
 
-            nDonorPoints++;
-          }
+        /*--- Proceeds along the forward direction (depending on which connected boundary node is found first),
+         *    and then along the backward direction, until the value of the intersection length is null. ---*/
 
-          if ( Donor_nLinkedNodes[donor_StartIndex] == 2 ){
-            check = false;
+        for (int iDirection = 0; iDirection < 2; iDirection++) {
 
-            uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] ];
+          if (iDirection == 1) {
+            if ( Donor_nLinkedNodes[donor_StartIndex] != 2 ) break;
 
-            donor_iPoint = uptr[1];
+            donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_StartIndex] + 1 ];
             donor_OldiPoint = donor_StartIndex;
           }
-          else
-            check = true;
 
-          /*--- Proceeds along the backward direction (depending on which connected boundary node is found first) ---*/
+          while (donor_iPoint < nGlobalVertex_Donor) {
 
-          while( !check ){
-
-            /*--- Proceeds until the value of the intersection length is null ---*/
             if ( Donor_nLinkedNodes[donor_iPoint] == 1 ){
-              donor_forward_point  = donor_OldiPoint;
+              donor_forward_point  = (iDirection == 0)? Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ]
+                                                      : donor_OldiPoint;
               donor_backward_point = donor_iPoint;
             }
             else{
-              uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
+              const unsigned long* uptr = &Donor_LinkedNodes[ Donor_StartLinkedNodes[donor_iPoint] ];
 
               if( donor_OldiPoint != uptr[0] ){
                 donor_forward_point  = uptr[0];
@@ -363,185 +226,119 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
               }
             }
 
-            if(donor_iPoint >= nGlobalVertex_Donor){
-              check = true;
-              continue;
-            }
-
-            for(iDim = 0; iDim < nDim; iDim++){
+            for(unsigned short iDim = 0; iDim < nDim; iDim++){
               donor_iMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_forward_point  * nDim + iDim] +
                                              DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
               donor_jMidEdge_point[iDim] = ( DonorPoint_Coord[ donor_backward_point * nDim + iDim] +
                                              DonorPoint_Coord[ donor_iPoint * nDim + iDim] ) / 2;
             }
 
-            LineIntersectionLength = ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
-                                                                   donor_iMidEdge_point, donor_jMidEdge_point, Direction);
+            const su2double LineIntersectionLength =
+              ComputeLineIntersectionLength(nDim, target_iMidEdge_point, target_jMidEdge_point,
+                                            donor_iMidEdge_point, donor_jMidEdge_point, Direction);
 
-            if ( LineIntersectionLength == 0.0 ){
-              check = true;
-              continue;
-            }
+            if ( LineIntersectionLength == 0.0 ) break;
 
             /*--- In case the element intersects the target cell, update the auxiliary communication data structure ---*/
 
-            tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-            tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-            tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
-
-            for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-              tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-              tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-              tmp_storeProc[iDonor]  = storeProc[iDonor];
-            }
-
-            tmp_Coeff_Vect[ nDonorPoints ] = LineIntersectionLength / length;
-            tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-            tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-
-            delete [] Donor_Vect;
-            delete [] Coeff_Vect;
-            delete [] storeProc;
-
-            Donor_Vect = tmp_Donor_Vect;
-            Coeff_Vect = tmp_Coeff_Vect;
-            storeProc  = tmp_storeProc;
+            Donor_Vect.push_back(donor_iPoint);
+            Coeff_Vect.push_back(LineIntersectionLength / length);
 
             donor_OldiPoint = donor_iPoint;
             donor_iPoint    = donor_forward_point;
-
-            nDonorPoints++;
           }
+        }
 
-          /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
+        /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
-          targetVertices[markTarget][iVertex].resize(nDonorPoints);
+        auto& targetVertex = targetVertices[markTarget][iVertex];
+        targetVertex.resize(Donor_Vect.size());
 
-          for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){
-            targetVertices[markTarget][iVertex].coefficient[iDonor] = Coeff_Vect[iDonor];
-            targetVertices[markTarget][iVertex].globalPoint[iDonor] = Donor_GlobalPoint[Donor_Vect[iDonor]];
-            targetVertices[markTarget][iVertex].processor[iDonor] = storeProc[iDonor];
-          }
+        for (auto iDonor = 0ul; iDonor < Donor_Vect.size(); iDonor++) {
+          targetVertex.coefficient[iDonor] = Coeff_Vect[iDonor];
+          targetVertex.globalPoint[iDonor] = Donor_GlobalPoint[Donor_Vect[iDonor]];
+          targetVertex.processor[iDonor] = Donor_Proc[Donor_Vect[iDonor]];
         }
       }
-
-      delete [] target_segment;
-
-      delete [] target_iMidEdge_point;
-      delete [] target_jMidEdge_point;
-
-      delete [] donor_iMidEdge_point;
-      delete [] donor_jMidEdge_point;
     }
     else{
       /* --- 3D geometry, creates a superficial super-mesh --- */
 
-      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+      su2double Normal[3];
+
+      /*--- Element storage, sized for the largest number of boundary neighbours, see Build_3D_surface_element. ---*/
+
+      unsigned long maxNeighbors = 0;
+      for (auto iVertex = 0ul; iVertex < nGlobalVertex_Target; iVertex++)
+        maxNeighbors = max(maxNeighbors, Target_nLinkedNodes[iVertex]);
+      for (auto iVertex = 0ul; iVertex < nGlobalVertex_Donor; iVertex++)
+        maxNeighbors = max(maxNeighbors, Donor_nLinkedNodes[iVertex]);
+
+      su2activematrix target_element(2*maxNeighbors+2, nDim), donor_element(2*maxNeighbors+2, nDim);
+      vector<su2double*> target_ptr(target_element.rows()), donor_ptr(donor_element.rows());
+      for (auto ii = 0ul; ii < target_element.rows(); ii++) {
+        target_ptr[ii] = target_element[ii];
+        donor_ptr[ii] = donor_element[ii];
+      }
+
+      /*--- Intersection area between the target element and the dual element around a donor node. ---*/
 
-        nDonorPoints = 0;
+      auto IntersectionArea = [&](int nNode_target, unsigned long donor_iPoint) {
+        const auto nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
+                                                          DonorPoint_Coord, donor_iPoint, donor_ptr.data());
+        su2double Area = 0;
+        for (int ii = 1; ii < nNode_target-1; ii++)
+          for (int jj = 1; jj < nNode_donor-1; jj++)
+            Area += Compute_Triangle_Intersection(target_ptr[0], target_ptr[ii], target_ptr[ii+1],
+                                                  donor_ptr[0], donor_ptr[jj], donor_ptr[jj+1], Normal);
+        return Area;
+      };
+
+      SU2_OMP_FOR_DYN(16)
+      for (unsigned long iVertex = 0; iVertex < nVertexTarget; iVertex++) {
 
         /*--- Stores coordinates of the target node ---*/
 
-        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        const auto target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
 
         if (!target_geometry->nodes->GetDomain(target_iPoint)) continue;
 
-        Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
+        const su2double* Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
         target_geometry->vertex[markTarget][iVertex]->GetNormal(Normal);
 
         /*--- The value of Area computed here includes also portion of boundary belonging to different marker ---*/
-        Area = GeometryToolbox::Norm(nDim, Normal);
+        su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-        for (iDim = 0; iDim < nDim; iDim++)
+        for (unsigned short iDim = 0; iDim < nDim; iDim++)
           Normal[iDim] /= Area;
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
-
-        long dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-          if( dPoint == Target_GlobalPoint[target_iPoint] )
-            break;
-        }
-
         /*--- Build local surface dual mesh for target element ---*/
 
-        nEdges_target = Target_nLinkedNodes[target_iPoint];
-
-        nNode_target = 2*(nEdges_target + 1);
-
-        target_element = new su2double*[nNode_target];
-        for (ii = 0; ii < nNode_target; ii++)
-          target_element[ii] = new su2double[nDim];
-
-        nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
-                                                TargetPoint_Coord, target_iPoint, target_element);
-
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-
-          Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
+        const auto target_iVertex = targetGlobalToLocal.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
-
-          if (dist == 0.0){
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
-
-        donor_iPoint = donor_StartIndex;
-
-        nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
+        const auto nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes,
+                                                           Target_nLinkedNodes, TargetPoint_Coord,
+                                                           target_iVertex, target_ptr.data());
 
-        donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-          donor_element[ii] = new su2double[nDim];
+        /*--- Find the closest donor node ---*/
 
-        nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
-                                               DonorPoint_Coord, donor_iPoint, donor_element);
+        su2double dist;
+        unsigned long donor_iPoint;
+        int rankID;
+        donorADT->DetermineNearestNode(Coord_i, dist, donor_iPoint, rankID);
 
-        Area = 0;
-        for (ii = 1; ii < nNode_target-1; ii++){
-          for (jj = 1; jj < nNode_donor-1; jj++){
-            Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
-                                                  donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
-          }
-        }
-
-        for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-          delete [] donor_element[ii];
-        delete [] donor_element;
-
-        nDonorPoints = 1;
+        Area = IntersectionArea(nNode_target, donor_iPoint);
 
         /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-        Coeff_Vect = new     su2double[ nDonorPoints ];
-        Donor_Vect = new unsigned long[ nDonorPoints ];
-        storeProc  = new unsigned long[ nDonorPoints ];
-
-        Coeff_Vect[0] = Area;
-        Donor_Vect[0] = donor_iPoint;
-        storeProc[0]  = Donor_Proc[donor_iPoint];
-
-        alreadyVisitedDonor = new unsigned long[1];
+        Donor_Vect.assign(1, donor_iPoint);
+        Coeff_Vect.assign(1, Area);
 
-        alreadyVisitedDonor[0] = donor_iPoint;
-        nAlreadyVisited = 1;
-        StartVisited = 0;
+        alreadyVisitedDonor.assign(1, donor_iPoint);
+        unsigned long StartVisited = 0;
 
-        Area_old = -1;
+        su2double Area_old = -1;
 
         while( Area > Area_old ){
 
@@ -552,108 +349,37 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           Area_old = Area;
 
-          ToVisit = nullptr;
-          nToVisit = 0;
+          ToVisit.clear();
 
-          for( iNodeVisited = StartVisited; iNodeVisited < nAlreadyVisited; iNodeVisited++ ){
+          const auto nAlreadyVisited = alreadyVisitedDonor.size();
 
-            vPoint = alreadyVisitedDonor[ iNodeVisited ];
+          for (auto iNodeVisited = StartVisited; iNodeVisited < nAlreadyVisited; iNodeVisited++) {
 
-            nEdgeVisited = Donor_nLinkedNodes[vPoint];
+            const auto vPoint = alreadyVisitedDonor[ iNodeVisited ];
 
-            for (iEdgeVisited = 0; iEdgeVisited < nEdgeVisited; iEdgeVisited++){
+            for (auto iEdgeVisited = 0ul; iEdgeVisited < Donor_nLinkedNodes[vPoint]; iEdgeVisited++) {
 
               donor_iPoint = Donor_LinkedNodes[ Donor_StartLinkedNodes[vPoint] + iEdgeVisited];
 
               /*--- Check if the node to visit is already listed in the data structure to avoid double visits ---*/
 
-              check = 0;
+              if (find(alreadyVisitedDonor.begin(), alreadyVisitedDonor.end(), donor_iPoint) != alreadyVisitedDonor.end() ||
+                  find(ToVisit.begin(), ToVisit.end(), donor_iPoint) != ToVisit.end()) continue;
 
-              for( jj = 0; jj < nAlreadyVisited; jj++ ){
-                if( donor_iPoint == alreadyVisitedDonor[jj] ){
-                  check = 1;
-                  break;
-                }
-              }
-
-              if( check == 0 && ToVisit != nullptr){
-                for( jj = 0; jj < nToVisit; jj++ )
-                  if( donor_iPoint == ToVisit[jj] ){
-                    check = 1;
-                    break;
-                  }
-              }
-
-              if( check == 0 ){
-                /*--- If the node was not already visited, visit it and list it into data structure ---*/
-
-                tmpVect = new unsigned long[ nToVisit + 1 ];
-
-                for( jj = 0; jj < nToVisit; jj++ )
-                  tmpVect[jj] = ToVisit[jj];
-                tmpVect[nToVisit] = donor_iPoint;
-
-
-                  delete [] ToVisit;
-
-                ToVisit = tmpVect;
-                tmpVect = nullptr;
-
-                nToVisit++;
-
-                /*--- Find the value of the intersection area between the current donor element and the target element --- */
-
-                nEdges_donor = Donor_nLinkedNodes[donor_iPoint];
+              /*--- If the node was not already visited, visit it and list it into data structure ---*/
 
-                donor_element = new su2double*[ 2*nEdges_donor + 2 ];
-                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-                  donor_element[ii] = new su2double[nDim];
+              ToVisit.push_back(donor_iPoint);
 
-                nNode_donor = Build_3D_surface_element(Donor_LinkedNodes, Donor_StartLinkedNodes, Donor_nLinkedNodes,
-                                                       DonorPoint_Coord, donor_iPoint, donor_element);
+              /*--- Find the value of the intersection area between the current donor element and the target element --- */
 
-                tmp_Area = 0;
-                for (ii = 1; ii < nNode_target-1; ii++)
-                  for (jj = 1; jj < nNode_donor-1; jj++)
-                    tmp_Area += Compute_Triangle_Intersection(target_element[0], target_element[ii], target_element[ii+1],
-                                                              donor_element[0], donor_element[jj], donor_element[jj+1], Normal);
+              const su2double tmp_Area = IntersectionArea(nNode_target, donor_iPoint);
 
-                for (ii = 0; ii < 2*nEdges_donor + 2; ii++)
-                  delete [] donor_element[ii];
-                delete [] donor_element;
+              /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
 
-                /*--- In case the element intersect the target cell update the auxiliary communication data structure ---*/
+              Donor_Vect.push_back(donor_iPoint);
+              Coeff_Vect.push_back(tmp_Area);
 
-                tmp_Coeff_Vect = new     su2double[ nDonorPoints + 1 ];
-                tmp_Donor_Vect = new unsigned long[ nDonorPoints + 1 ];
-                tmp_storeProc  = new unsigned long[ nDonorPoints + 1 ];
-
-                for( iDonor = 0; iDonor < nDonorPoints; iDonor++){
-                  tmp_Donor_Vect[iDonor] = Donor_Vect[iDonor];
-                  tmp_Coeff_Vect[iDonor] = Coeff_Vect[iDonor];
-                  tmp_storeProc[iDonor]  = storeProc[iDonor];
-                }
-
-                tmp_Coeff_Vect[ nDonorPoints ] = tmp_Area;
-                tmp_Donor_Vect[ nDonorPoints ] = donor_iPoint;
-                tmp_storeProc[  nDonorPoints ] = Donor_Proc[donor_iPoint];
-
-                delete [] Donor_Vect;
-                delete [] Coeff_Vect;
-                delete [] storeProc;
-
-                Donor_Vect = tmp_Donor_Vect;
-                Coeff_Vect = tmp_Coeff_Vect;
-                storeProc  = tmp_storeProc;
-
-                tmp_Coeff_Vect = nullptr;
-                tmp_Donor_Vect = nullptr;
-                tmp_storeProc  = nullptr;
-
-                nDonorPoints++;
-
-                Area += tmp_Area;
-              }
+              Area += tmp_Area;
             }
           }
 
@@ -661,45 +387,22 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
           StartVisited = nAlreadyVisited;
 
-          tmpVect = new unsigned long[ nAlreadyVisited + nToVisit ];
-
-          for( jj = 0; jj < nAlreadyVisited; jj++ )
-            tmpVect[jj] = alreadyVisitedDonor[jj];
-
-          for( jj = 0; jj < nToVisit; jj++ )
-            tmpVect[ nAlreadyVisited + jj ] = ToVisit[jj];
-
-
-          delete [] alreadyVisitedDonor;
-
-          alreadyVisitedDonor = tmpVect;
-
-          nAlreadyVisited += nToVisit;
-
-          delete [] ToVisit;
+          alreadyVisitedDonor.insert(alreadyVisitedDonor.end(), ToVisit.begin(), ToVisit.end());
         }
 
-        delete [] alreadyVisitedDonor;
-
         /*--- Set the communication data structure and copy data from the auxiliary vectors ---*/
 
-        targetVertices[markTarget][iVertex].resize(nDonorPoints);
+        auto& targetVertex = targetVertices[markTarget][iVertex];
+        targetVertex.resize(Donor_Vect.size());
 
-        for ( iDonor = 0; iDonor < nDonorPoints; iDonor++ ){
-          targetVertices[markTarget][iVertex].coefficient[iDonor] = Coeff_Vect[iDonor] / Area;
-          targetVertices[markTarget][iVertex].globalPoint[iDonor] = Donor_GlobalPoint[Donor_Vect[iDonor]];
-          targetVertices[markTarget][iVertex].processor[iDonor] = storeProc[iDonor];
+        for (auto iDonor = 0ul; iDonor < Donor_Vect.size(); iDonor++) {
+          targetVertex.coefficient[iDonor] = Coeff_Vect[iDonor] / Area;
+          targetVertex.globalPoint[iDonor] = Donor_GlobalPoint[Donor_Vect[iDonor]];
+          targetVertex.processor[iDonor] = Donor_Proc[Donor_Vect[iDonor]];
         }
-
-        for (ii = 0; ii < 2*nEdges_target + 2; ii++)
-          delete [] target_element[ii];
-        delete [] target_element;
-
-        delete [] Donor_Vect; Donor_Vect = nullptr;
-        delete [] Coeff_Vect; Coeff_Vect = nullptr;
-        delete [] storeProc;  storeProc  = nullptr;
       }
     }
+    } // end SU2_OMP_PARALLEL
 
     delete [] TargetPoint_Coord;
     delete [] Target_GlobalPoint;
@@ -716,13 +419,80 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     delete [] Donor_LinkedNodes;
 
   }
+}
+
+void CSlidingMesh::ComputeRankBoundingBoxes(int markDonor, int markTarget, vector<passivedouble>& targetBoxes,
+                                            vector<passivedouble>& donorBoxes) const {
+
+  const unsigned short nDim = target_geometry->GetnDim();
+
+  /*--- Largest length of the edges connecting vertices of a boundary. ---*/
+
+  auto MaxEdgeLength = [nDim](const CGeometry* geom, int marker) {
+    passivedouble maxLength = 0.0;
+    if (marker == -1) return maxLength;
+
+    for (auto iVertex = 0ul; iVertex < geom->GetnVertex(marker); iVertex++) {
+      const auto iPoint = geom->vertex[marker][iVertex]->GetNode();
+      for (auto jPoint : geom->nodes->GetPoints(iPoint)) {
+        if (geom->nodes->GetVertex(jPoint, marker) == -1) continue;
+        const su2double length = GeometryToolbox::Distance(nDim, geom->nodes->GetCoord(iPoint),
+                                                           geom->nodes->GetCoord(jPoint));
+        maxLength = max(maxLength, SU2_TYPE::GetValue(length));
+      }
+    }
+    return maxLength;
+  };
+
+  passivedouble edgeLengths[2] = {MaxEdgeLength(target_geometry, markTarget),
+                                  MaxEdgeLength(donor_geometry, markDonor)};
+#ifdef HAVE_MPI
+  passivedouble tmp[2] = {edgeLengths[0], edgeLengths[1]};
+  MPI_Allreduce(tmp, edgeLengths, 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+#endif
+
+  /*--- Bounding box (min coordinates followed by max coordinates) of the target vertices owned by this rank,
+   *    ranks without such vertices have an empty box. ---*/
+
+  vector<passivedouble> localBox(2*nDim);
+  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    localBox[iDim] = numeric_limits<passivedouble>::max();
+    localBox[nDim+iDim] = numeric_limits<passivedouble>::lowest();
+  }
+
+  if (markTarget != -1) {
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        const passivedouble x = SU2_TYPE::GetValue(target_geometry->nodes->GetCoord(iPoint, iDim));
+        localBox[iDim] = min(localBox[iDim], x);
+        localBox[nDim+iDim] = max(localBox[nDim+iDim], x);
+      }
+    }
+  }
+
+  targetBoxes.resize(2*nDim*size);
+#ifdef HAVE_MPI
+  MPI_Allgather(localBox.data(), 2*nDim, MPI_DOUBLE, targetBoxes.data(), 2*nDim, MPI_DOUBLE, SU2_MPI::GetComm());
+#else
+  targetBoxes = localBox;
+#endif
 
-  delete [] Normal;
-  delete [] Direction;
+  /*--- The target vertices (and their neighbours) inside the box are sufficient to build the dual elements.
+   *    Donor dual elements intersecting those of the target are within half the sum of the largest edges,
+   *    a larger margin is used to account for gaps between the sides of the interface. ---*/
 
-  delete [] Donor_Vect;
-  delete [] Coeff_Vect;
-  delete [] storeProc;
+  const passivedouble margin = 2 * (edgeLengths[0] + edgeLengths[1]);
+
+  donorBoxes = targetBoxes;
+  for (int iRank = 0; iRank < size; iRank++) {
+    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+      donorBoxes[2*nDim*iRank + iDim] -= margin;
+      donorBoxes[2*nDim*iRank + nDim + iDim] += margin;
+    }
+  }
 }
 
 int CSlidingMesh::Build_3D_surface_element(const unsigned long *map, const unsigned long *startIndex,
@@ -29,6 +29,7 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
 #include <cmath>
 
@@ -88,7 +89,7 @@ template<class ScalarType>
 void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npointdomain,
                                         unsigned short nvar, unsigned short neqn,
                                         bool EdgeConnect, CGeometry *geometry,
-                                        const CConfig *config, bool needTranspPtr) {
+                                        const CConfig *config, bool needTranspPtr, bool mgSmoother) {
 
   assert(omp_get_thread_num()==0 && "Only the master thread is allowed to initialize the matrix.");
 
@@ -107,9 +108,15 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   /*--- Application of this matrix, FVM or FEM. ---*/
   const auto type = EdgeConnect? ConnectivityType::FiniteVolume : ConnectivityType::FiniteElement;
 
-  /*--- Type of preconditioner the matrix will be asked to build. ---*/
+  /*--- Type of preconditioner the matrix will be asked to build. The coarse MG levels of the flow solvers
+   *    are relaxed by the smoother, with full multigrid they are also solved as the finest level. ---*/
   auto prec = config->GetKind_Linear_Solver_Prec();
 
+  const bool smoothed = mgSmoother && EdgeConnect && (geometry->GetMGLevel() != MESH_0) &&
+                        (config->GetKind_MG_Coarse_Smoother() != MG_SMOOTHER_NONE);
+  if (smoothed && (config->GetMGCycle() != FULLMG_CYCLE))
+    prec = config->GetKind_Linear_Solver_Prec(geometry->GetMGLevel());
+
   if ((!EdgeConnect && !config->GetStructuralProblem()) ||
       (config->GetKind_SU2() == SU2_DEF) || (config->GetKind_SU2() == SU2_DOT)) {
     /*--- FEM-type connectivity in non-structural context implies mesh deformation. ---*/
@@ -120,7 +127,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     prec = config->GetKind_DiscAdj_Linear_Prec();
   }
   const bool ilu_needed = (prec==ILU);
-  const bool diag_needed = ilu_needed || (prec==JACOBI) || (prec==LINELET);
+  const bool diag_needed = ilu_needed || (prec==JACOBI) || (prec==LINELET) || smoothed;
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -357,6 +364,8 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry *geometry,
 
   if (geometry->nP2PRecv == 0) return;
 
+  SU2_PROFILE_SCOPE("MPI::CompleteComms");
+
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
@@ -34,6 +34,7 @@
 #include "../../include/linear_algebra/CSysMatrix.hpp"
 #include "../../include/linear_algebra/CMatrixVectorProduct.hpp"
 #include "../../include/linear_algebra/CPreconditioner.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 
 #include <limits>
 
@@ -779,6 +780,9 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
 template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                            CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
+
+  SU2_PROFILE_SCOPE("CSysSolve::Solve");
+
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -804,6 +808,16 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType> & Jacobian, co
     RestartIter  = config->GetLinear_Solver_Restart_Frequency();
     SolverTol    = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
     ScreenOutput = false;
+
+    /*--- Coarse levels of the multigrid cycle of the flow, a few point or line Jacobi sweeps instead of the
+     *    fine level solver. With full multigrid, the current finest level is solved with the latter. ---*/
+
+    if (mgSmoother && (geometry != nullptr) && (geometry->GetMGLevel() > config->GetFinestMesh()) &&
+        (config->GetKind_MG_Coarse_Smoother() != MG_SMOOTHER_NONE)) {
+      KindSolver  = SMOOTHER;
+      KindPrecond = config->GetKind_Linear_Solver_Prec(geometry->GetMGLevel());
+      MaxIter     = config->GetMG_Coarse_Smoother_Iter();
+    }
   }
 
   /*--- Mesh Deformation mode ---*/
@@ -963,6 +977,8 @@ template<class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType> & Jacobian, const CSysVector<su2double> & LinSysRes,
                                              CSysVector<su2double> & LinSysSol, CGeometry *geometry, const CConfig *config) {
 
+  SU2_PROFILE_SCOPE("CSysSolve::Solve_b");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, RestartIter, IterLinSol = 0;
   ScalarType SolverTol, Norm0 = 0.0;
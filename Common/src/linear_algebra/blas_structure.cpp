@@ -44,12 +44,113 @@ extern "C" void dgemv_(char*, const int*, const int*, const passivedouble*,
                        const int*, const passivedouble*, passivedouble*, const int*);
 #endif
 
+/* Native kernels for small matrix products, C = op(A)*B, with all matrices
+   in row major order. The number of columns N is a template parameter for the
+   values that occur frequently in the DG solver, i.e. the number of variables
+   and padded multiples thereof, such that the compiler can unroll and vectorize
+   the inner loop and keep a row of C in registers. */
+namespace {
+
+using KernelPointer = void (*)(const int M, const int N, const int K,
+                               const su2double *A, const su2double *B, su2double *C);
+
+template<int N, bool TransA>
+void FixedNGemmKernel(const int M, const int, const int K,
+                      const su2double *A, const su2double *B, su2double *C) {
+
+  /* Two rows of C are computed simultaneously, such that every row of B
+     that is loaded is used twice. */
+  int i = 0;
+  for(; (i+1)<M; i+=2) {
+    su2double c0[N], c1[N];
+    for(int j=0; j<N; ++j) c0[j] = c1[j] = 0.0;
+
+    for(int k=0; k<K; ++k) {
+      const su2double a0 = TransA ? A[k*M+i]   : A[i*K+k];
+      const su2double a1 = TransA ? A[k*M+i+1] : A[(i+1)*K+k];
+      const su2double *b = B + k*N;
+      SU2_OMP_SIMD_IF_NOT_AD
+      for(int j=0; j<N; ++j) {
+        c0[j] += a0*b[j];
+        c1[j] += a1*b[j];
+      }
+    }
+
+    su2double *cRow = C + i*N;
+    for(int j=0; j<N; ++j) {
+      cRow[j]   = c0[j];
+      cRow[j+N] = c1[j];
+    }
+  }
+
+  /* The remaining row, if M is odd. */
+  if(i < M) {
+    su2double c[N];
+    for(int j=0; j<N; ++j) c[j] = 0.0;
+
+    for(int k=0; k<K; ++k) {
+      const su2double a  = TransA ? A[k*M+i] : A[i*K+k];
+      const su2double *b = B + k*N;
+      SU2_OMP_SIMD_IF_NOT_AD
+      for(int j=0; j<N; ++j) c[j] += a*b[j];
+    }
+
+    su2double *cRow = C + i*N;
+    for(int j=0; j<N; ++j) cRow[j] = c[j];
+  }
+}
+
+template<bool TransA>
+void GenericGemmKernel(const int M, const int N, const int K,
+                       const su2double *A, const su2double *B, su2double *C) {
+
+  for(int i=0; i<M; ++i) {
+    su2double *c = C + i*N;
+    for(int j=0; j<N; ++j) c[j] = 0.0;
+
+    for(int k=0; k<K; ++k) {
+      const su2double a  = TransA ? A[k*M+i] : A[i*K+k];
+      const su2double *b = B + k*N;
+      SU2_OMP_SIMD_IF_NOT_AD
+      for(int j=0; j<N; ++j) c[j] += a*b[j];
+    }
+  }
+}
+
+template<bool TransA>
+KernelPointer FixedNKernel(const int N) {
+
+  switch( N ) {
+    case  1: return FixedNGemmKernel< 1,TransA>;
+    case  2: return FixedNGemmKernel< 2,TransA>;
+    case  3: return FixedNGemmKernel< 3,TransA>;
+    case  4: return FixedNGemmKernel< 4,TransA>;
+    case  5: return FixedNGemmKernel< 5,TransA>;
+    case  6: return FixedNGemmKernel< 6,TransA>;
+    case  7: return FixedNGemmKernel< 7,TransA>;
+    case  8: return FixedNGemmKernel< 8,TransA>;
+    case 16: return FixedNGemmKernel<16,TransA>;
+    case 24: return FixedNGemmKernel<24,TransA>;
+    case 32: return FixedNGemmKernel<32,TransA>;
+    case 40: return FixedNGemmKernel<40,TransA>;
+    case 48: return FixedNGemmKernel<48,TransA>;
+    case 56: return FixedNGemmKernel<56,TransA>;
+    case 64: return FixedNGemmKernel<64,TransA>;
+    default: return nullptr;
+  }
+}
+
+}
+
 /* Constructor. Initialize the const member variables, if needed. */
 CBlasStructure::CBlasStructure(void)
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
   : mc (256), kc (128), nc (128)
 #endif
-{}
+{
+  /* Every thread gets its own kernel cache. */
+  kernelCache.resize(omp_get_max_threads());
+}
 
 /* Destructor. Nothing to be done. */
 CBlasStructure::~CBlasStructure(void) {}
@@ -57,7 +158,7 @@ CBlasStructure::~CBlasStructure(void) {}
 /* Dense matrix multiplication, gemm functionality. */
 void CBlasStructure::gemm(const int M,        const int N,        const int K,
                           const su2double *A, const su2double *B, su2double *C,
-                          const CConfig *config) {
+                          const CConfig *config, const bool transA) {
 
   /* Initialize the variable for the timing, if profiling is active. */
 #ifdef PROFILE
@@ -65,42 +166,122 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
   if( config ) config->GEMM_Tick(&timeGemm);
 #endif
 
+  ExecuteGemmKernel(GetGemmKernel(M, N, K, transA), M, N, K, A, B, C, transA);
+
+  /* Store the profiling information, if needed. */
+#ifdef PROFILE
+  if( config ) config->GEMM_Tock(timeGemm, M, N, K);
+#endif
+}
+
+/* Retrieve the kernel for the given sizes from the cache of this thread. */
+CBlasStructure::GemmKernel CBlasStructure::GetGemmKernel(const int M, const int N, const int K,
+                                                         const bool transA) {
+
+  /* The sizes are packed in a single key, which requires them to be less than
+     2^21. Furthermore, the cache cannot be used in nested parallel regions,
+     because the thread numbers are then not unique. In these cases the
+     kernel is simply created for every product. */
+  const int maxSize = 1<<21;
+  const int thread  = omp_get_thread_num();
+
+  if((M >= maxSize) || (N >= maxSize) || (K >= maxSize) ||
+     (thread >= (int) kernelCache.size()) || (omp_get_level() > 1))
+    return CreateGemmKernel(M, N, K, transA);
+
+  const uint64_t key = (uint64_t(M) << 43) | (uint64_t(N) << 22) | (uint64_t(K) << 1) | uint64_t(transA);
+
+  auto &cache = kernelCache[thread];
+  auto it = cache.find(key);
+  if(it == cache.end())
+    it = cache.emplace(key, CreateGemmKernel(M, N, K, transA)).first;
+
+  return it->second;
+}
+
+/* Create the kernel for a matrix product of the given sizes. */
+CBlasStructure::GemmKernel CBlasStructure::CreateGemmKernel(const int M, const int N, const int K,
+                                                            const bool transA) const {
+  GemmKernel kernel;
+
+#if defined(HAVE_LIBXSMM) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+
+  /* Let LIBXSMM generate a kernel. As it works with column major order, the
+     product C^T = B^T A^T is computed, hence M and N and A and B are swapped.
+     LIBXSMM returns a nullptr if it cannot generate the kernel, in which case
+     the general gemm of LIBXSMM is used. */
+  if( !transA ) {
+    const libxsmm_blasint m = N, n = M, k = K;
+    const double alpha = 1.0, beta = 0.0;
+    kernel.xsmm = libxsmm_dmmdispatch(m, n, k, &m, &k, &m, &alpha, &beta, nullptr, nullptr);
+  }
+
+#elif (defined(HAVE_MKL) || defined(HAVE_BLAS)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+
+  /* The products are dispatched to the gemm of the library, no kernel is set. */
+
+#else
+
+  /* Use the template specialized kernel, if available. Otherwise the native
+     gemm is used, which does not support a transposed A, hence the generic
+     kernel is used in that case. */
+  kernel.native = transA ? FixedNKernel<true>(N) : FixedNKernel<false>(N);
+  if(!kernel.native && transA) kernel.native = GenericGemmKernel<true>;
+
+#endif
+
+  return kernel;
+}
+
+/* Carry out a matrix product with the given kernel. */
+void CBlasStructure::ExecuteGemmKernel(const GemmKernel &kernel,
+                                       const int M,        const int N,        const int K,
+                                       const su2double *A, const su2double *B, su2double *C,
+                                       const bool transA) {
+
+#if defined(HAVE_LIBXSMM) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  if( kernel.xsmm ) {
+    kernel.xsmm(B, A, C);
+    return;
+  }
+#endif
+
+  if( kernel.native ) {
+    kernel.native(M, N, K, A, B, C);
+    return;
+  }
+
 #if (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)) || !(defined(HAVE_LIBXSMM) || defined(HAVE_MKL) || defined(HAVE_BLAS))
   /* Native implementation of the matrix product. This optimized implementation
      assumes that the matrices are in column major order. This can be
      accomplished by swapping N and M and A and B. This implementation is based
-     on https://github.com/flame/how-to-optimize-gemm. */
+     on https://github.com/flame/how-to-optimize-gemm. A transposed A is always
+     handled by a native kernel. */
   gemm_imp(N, M, K, B, A, C);
 
 #else
-#ifdef HAVE_LIBXSMM
 
-  /* The gemm function of libxsmm is used to carry out the multiplication.
-     Note that libxsmm_gemm expects the matrices in column major order. That's
-     why the in the calling sequence A and B and M and N are reversed. */
+  /* Note that the library gemm expects the matrices in column major order.
+     That's why in the calling sequence A and B and M and N are reversed. The
+     row major K x M matrix A is a column major M x K matrix, hence op(A)
+     becomes a transpose in the column major setting. */
   su2double alpha = 1.0;
   su2double beta  = 0.0;
-  char trans = 'N';
+  char transNo = 'N';
+  char transOpA = transA ? 'T' : 'N';
+  const int ldA = transA ? M : K;
 
-  libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+#ifdef HAVE_LIBXSMM
 
-#else // MKL and BLAS
+  /* The gemm function of libxsmm is used to carry out the multiplication. */
+  libxsmm_dgemm(&transNo, &transOpA, &N, &M, &K, &alpha, B, &N, A, &ldA, &beta, C, &N);
 
-  /* The standard blas routine dgemm is used for the multiplication.
-     Call dgemm without transposing the matrices. In that case dgemm expects
-     the matrices in column major order, see the comments for libxsmm. */
-  su2double alpha = 1.0;
-  su2double beta  = 0.0;
-  char trans = 'N';
+#else // MKL and BLAS
 
-  dgemm_(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+  /* The standard blas routine dgemm is used for the multiplication. */
+  dgemm_(&transNo, &transOpA, &N, &M, &K, &alpha, B, &N, A, &ldA, &beta, C, &N);
 
 #endif
-#endif
-
-  /* Store the profiling information, if needed. */
-#ifdef PROFILE
-  if( config ) config->GEMM_Tock(timeGemm, M, N, K);
 #endif
 }
 
@@ -0,0 +1,448 @@
+/*!
+ * \file CProfiler.cpp
+ * \brief Implementation of the scoped-region profiler.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+#include "../../include/parallelization/mpi_structure.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+bool CProfiler::enabled = false;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/*--- Parent of a region that was never called, and of a region called outside any other. ---*/
+constexpr int NO_PARENT = -2;
+constexpr int ROOT = -1;
+
+struct CRegionStats {
+  double incl = 0.0;        /*!< \brief Inclusive time. */
+  double excl = 0.0;        /*!< \brief Exclusive time (without nested regions). */
+  unsigned long calls = 0;  /*!< \brief Number of calls. */
+  int parent = NO_PARENT;   /*!< \brief Region in which this region was first found. */
+};
+
+struct CFrame {
+  int id;
+  double start;
+  double child;  /*!< \brief Time spent in nested regions. */
+};
+
+struct CEvent {
+  int id;
+  double start, end;
+};
+
+struct CThreadData {
+  std::vector<CRegionStats> stats;
+  std::vector<CFrame> stack;
+  std::vector<CEvent> events;
+  unsigned long droppedEvents = 0;
+  char padding[64]; /*!< \brief Avoid false sharing of the vector headers. */
+};
+
+std::vector<std::string> regionNames;
+std::vector<CThreadData> threadData;
+Clock::time_point startTime;
+bool traceEvents = false;
+unsigned long maxTraceEvents = 0;
+
+inline double Now() {
+  return std::chrono::duration<double>(Clock::now() - startTime).count();
+}
+
+/*--- Reductions and gathers of passive data. ---*/
+#ifdef HAVE_MPI
+using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+#endif
+
+void ReduceSum(std::vector<double>& data) {
+#ifdef HAVE_MPI
+  auto tmp = data;
+  MPI_Wrapper::Allreduce(tmp.data(), data.data(), data.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+#endif
+}
+
+void ReduceMin(std::vector<double>& data) {
+#ifdef HAVE_MPI
+  auto tmp = data;
+  MPI_Wrapper::Allreduce(tmp.data(), data.data(), data.size(), MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+#endif
+}
+
+void ReduceMax(std::vector<double>& data) {
+#ifdef HAVE_MPI
+  auto tmp = data;
+  MPI_Wrapper::Allreduce(tmp.data(), data.data(), data.size(), MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+#endif
+}
+
+/*!
+ * \brief Gather a string from all ranks, in rank order, on all ranks.
+ */
+std::string AllGatherString(const std::string& local) {
+#ifdef HAVE_MPI
+  const int size = SU2_MPI::GetSize();
+  int localSize = local.size();
+  std::vector<int> counts(size), displs(size+1, 0);
+  MPI_Wrapper::Allgather(&localSize, 1, MPI_INT, counts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int i = 0; i < size; ++i) displs[i+1] = displs[i] + counts[i];
+
+  std::vector<char> global(displs[size]);
+  MPI_Wrapper::Allgatherv(local.data(), localSize, MPI_CHAR, global.data(), counts.data(),
+                          displs.data(), MPI_CHAR, SU2_MPI::GetComm());
+  return std::string(global.begin(), global.end());
+#else
+  return local;
+#endif
+}
+
+} // namespace
+
+void CProfiler::Enable(bool trace, unsigned long maxEvents) {
+
+  traceEvents = trace;
+  maxTraceEvents = maxEvents;
+  threadData.clear();
+  threadData.resize(omp_get_max_threads());
+
+  /*--- Common time origin for all ranks, to align the events of the trace. ---*/
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  startTime = Clock::now();
+
+  enabled = true;
+}
+
+int CProfiler::RegisterRegion(const char* name) {
+
+  int id = 0;
+  SU2_OMP_CRITICAL
+  {
+    const auto it = std::find(regionNames.begin(), regionNames.end(), name);
+    id = it - regionNames.begin();
+    if (it == regionNames.end()) regionNames.emplace_back(name);
+  }
+  return id;
+}
+
+void CProfiler::Begin(int id) {
+
+  const auto thread = omp_get_thread_num();
+  if (thread >= static_cast<int>(threadData.size())) return;
+
+  threadData[thread].stack.push_back({id, Now(), 0.0});
+}
+
+void CProfiler::End(int id) {
+
+  const auto thread = omp_get_thread_num();
+  if (thread >= static_cast<int>(threadData.size())) return;
+
+  const double end = Now();
+  auto& data = threadData[thread];
+
+  /*--- Regions opened before the profiler was (re)enabled are not on the stack. ---*/
+  if (data.stack.empty()) return;
+
+  const auto frame = data.stack.back();
+  data.stack.pop_back();
+
+  if (frame.id != id) {
+    SU2_MPI::Error("Mismatched profiler regions \"" + regionNames[frame.id] +
+                   "\" and \"" + regionNames[id] + "\".", CURRENT_FUNCTION);
+  }
+
+  /*--- Accumulate, sizing by the id avoids reading regionNames while other threads may register. ---*/
+
+  if (static_cast<int>(data.stats.size()) <= id) data.stats.resize(id+1);
+
+  const double elapsed = end - frame.start;
+  auto& stats = data.stats[id];
+  stats.incl += elapsed;
+  stats.excl += elapsed - frame.child;
+  stats.calls += 1;
+
+  if (data.stack.empty()) {
+    if (stats.parent == NO_PARENT) stats.parent = ROOT;
+  }
+  else {
+    if (stats.parent == NO_PARENT) stats.parent = data.stack.back().id;
+    data.stack.back().child += elapsed;
+  }
+
+  if (traceEvents) {
+    if (data.events.size() < maxTraceEvents) data.events.push_back({id, frame.start, end});
+    else data.droppedEvents += 1;
+  }
+}
+
+void CProfiler::Reset() {
+  for (auto& data : threadData) {
+    data.stats.clear();
+    data.events.clear();
+    data.droppedEvents = 0;
+  }
+}
+
+void CProfiler::WriteSummary(const std::string& fileName) {
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+
+  /*--- Combine the threads of this rank, threads run concurrently so the max time is
+   *    representative of wall time, the calls are summed. ---*/
+
+  const int nLocal = regionNames.size();
+  std::vector<CRegionStats> local(nLocal);
+
+  for (const auto& data : threadData) {
+    for (int id = 0; id < static_cast<int>(data.stats.size()); ++id) {
+      const auto& stats = data.stats[id];
+      if (stats.calls == 0) continue;
+      auto& comb = local[id];
+      comb.incl = std::max(comb.incl, stats.incl);
+      comb.excl = std::max(comb.excl, stats.excl);
+      comb.calls += stats.calls;
+      if (comb.parent == NO_PARENT || comb.parent == ROOT) comb.parent = stats.parent;
+    }
+  }
+
+  /*--- Regions are registered in the order they are first found, which may differ between
+   *    ranks, the global numbering follows the names (and parents) of the regions called
+   *    on each rank, in rank order. ---*/
+
+  std::string localNames;
+  for (int id = 0; id < nLocal; ++id) {
+    if (local[id].calls == 0) continue;
+    const auto parent = local[id].parent;
+    localNames += regionNames[id] + '\n' + (parent >= 0? regionNames[parent] : std::string()) + '\n';
+  }
+  std::stringstream allNames(AllGatherString(localNames));
+
+  std::vector<std::string> names, parents;
+  std::map<std::string, int> globalId;
+  std::string name, parent;
+  while (std::getline(allNames, name) && std::getline(allNames, parent)) {
+    if (globalId.count(name)) continue;
+    globalId[name] = names.size();
+    names.push_back(name);
+    parents.push_back(parent);
+  }
+  const int nGlobal = names.size();
+  if (nGlobal == 0) return;
+
+  /*--- Reduce [calls, inclusive, exclusive] over ranks, regions not called count as 0. ---*/
+
+  std::vector<double> minVals(3*nGlobal, 0.0);
+
+  for (int id = 0; id < nLocal; ++id) {
+    if (local[id].calls == 0) continue;
+    const int iGlobal = globalId[regionNames[id]];
+    minVals[3*iGlobal] = local[id].calls;
+    minVals[3*iGlobal+1] = local[id].incl;
+    minVals[3*iGlobal+2] = local[id].excl;
+  }
+  auto maxVals = minVals, sumVals = minVals;
+  ReduceMin(minVals);
+  ReduceMax(maxVals);
+  ReduceSum(sumVals);
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Order the regions depth-first, children in the order they were found. ---*/
+
+  std::vector<int> order, depth;
+  std::vector<int> stack;
+  std::vector<int> level(nGlobal, 0);
+  for (int i = nGlobal-1; i >= 0; --i) {
+    if (parents[i].empty() || !globalId.count(parents[i])) stack.push_back(i);
+  }
+  std::vector<bool> visited(nGlobal, false);
+  while (!stack.empty()) {
+    const int i = stack.back();
+    stack.pop_back();
+    if (visited[i]) continue;
+    visited[i] = true;
+    order.push_back(i);
+    depth.push_back(level[i]);
+    for (int j = nGlobal-1; j >= 0; --j) {
+      if (!visited[j] && parents[j] == names[i]) {
+        level[j] = level[i]+1;
+        stack.push_back(j);
+      }
+    }
+  }
+  /*--- Cycles (a region found in a region it contains) are reported at the top level. ---*/
+  for (int i = 0; i < nGlobal; ++i) {
+    if (!visited[i]) { order.push_back(i); depth.push_back(0); }
+  }
+
+  /*--- Screen output. ---*/
+
+  std::cout << "\n------------------------- Profiling Summary (s) -------------------------" << std::endl;
+  std::cout << "Min/avg/max over " << size << " rank(s), max over threads of each rank." << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Region", 36);
+  table.AddColumn("Calls", 10);
+  table.AddColumn("Incl. min", 11);
+  table.AddColumn("Incl. avg", 11);
+  table.AddColumn("Incl. max", 11);
+  table.AddColumn("Excl. avg", 11);
+  table.AddColumn("Excl. max", 11);
+  table.AddColumn("Imbalance", 10);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+
+  for (size_t k = 0; k < order.size(); ++k) {
+    const int i = order[k];
+    const double avgIncl = sumVals[3*i+1] / size;
+    const double imbalance = avgIncl > 0.0? maxVals[3*i+1] / avgIncl : 1.0;
+    table << std::string(2*depth[k], ' ') + names[i]
+          << static_cast<unsigned long>(sumVals[3*i])
+          << minVals[3*i+1] << avgIncl << maxVals[3*i+1]
+          << sumVals[3*i+2] / size << maxVals[3*i+2] << imbalance;
+  }
+  table.PrintFooter();
+
+  /*--- CSV output. ---*/
+
+  std::ofstream file(fileName + ".csv");
+  file << "\"Region\",\"Parent\",\"Depth\",\"Calls\",\"Incl_Min\",\"Incl_Avg\",\"Incl_Max\","
+          "\"Excl_Min\",\"Excl_Avg\",\"Excl_Max\"\n";
+  file << std::setprecision(8);
+  for (size_t k = 0; k < order.size(); ++k) {
+    const int i = order[k];
+    file << '"' << names[i] << "\",\"" << parents[i] << "\"," << depth[k] << ','
+         << static_cast<unsigned long>(sumVals[3*i]) << ','
+         << minVals[3*i+1] << ',' << sumVals[3*i+1] / size << ',' << maxVals[3*i+1] << ','
+         << minVals[3*i+2] << ',' << sumVals[3*i+2] / size << ',' << maxVals[3*i+2] << '\n';
+  }
+}
+
+void CProfiler::WriteChromeTrace(const std::string& fileName) {
+
+  if (!traceEvents) return;
+
+  const int rank = SU2_MPI::GetRank();
+  const int size = SU2_MPI::GetSize();
+  const auto traceFile = fileName + ".json";
+
+  /*--- Each rank appends its events in turn (pid is the rank, tid the thread), times in us. ---*/
+
+  unsigned long dropped = 0;
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (rank == iRank) {
+      std::ofstream file(traceFile, rank == MASTER_NODE? std::ios::out : std::ios::app);
+      file << std::fixed << std::setprecision(3);
+
+      if (rank == MASTER_NODE) file << "[\n";
+      else file << ",\n";
+      file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+           << ",\"args\":{\"name\":\"Rank " << rank << "\"}}";
+
+      for (size_t thread = 0; thread < threadData.size(); ++thread) {
+        const auto& data = threadData[thread];
+        dropped += data.droppedEvents;
+        for (const auto& event : data.events) {
+          file << ",\n{\"name\":\"" << regionNames[event.id] << "\",\"ph\":\"X\",\"pid\":" << rank
+               << ",\"tid\":" << thread << ",\"ts\":" << 1e6*event.start
+               << ",\"dur\":" << 1e6*(event.end-event.start) << '}';
+        }
+      }
+      if (rank == size-1) file << "\n]\n";
+    }
+    SU2_MPI::Barrier(SU2_MPI::GetComm());
+  }
+
+  if (dropped > 0) {
+    std::cout << "Rank " << rank << ": the profiler trace is missing " << dropped
+              << " events (per-thread limit reached)." << std::endl;
+  }
+}
+
+CStageTimer::CStageTimer() : start(SU2_MPI::Wtime()) {}
+
+void CStageTimer::Stage(const std::string& name) {
+
+  const double now = SU2_MPI::Wtime();
+  const auto it = std::find(names.begin(), names.end(), name);
+  if (it == names.end()) {
+    names.push_back(name);
+    times.push_back(now - start);
+  }
+  else {
+    times[it - names.begin()] += now - start;
+  }
+  start = now;
+}
+
+void CStageTimer::WriteSummary(const std::string& title) const {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const auto nStage = times.size();
+
+  /*--- All ranks go through the same stages. ---*/
+  std::vector<double> minTimes(nStage), maxTimes(nStage), sumTimes(nStage);
+  SU2_MPI::Allreduce(times.data(), minTimes.data(), nStage, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(times.data(), maxTimes.data(), nStage, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(times.data(), sumTimes.data(), nStage, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  double total = 0.0;
+  for (auto t : maxTimes) total += t;
+
+  std::cout << "\n" << title << " (wall time [s] over " << size << " rank(s)):" << std::endl;
+
+  PrintingToolbox::CTablePrinter table(&std::cout);
+  table.AddColumn("Stage", 36);
+  table.AddColumn("Min", 11);
+  table.AddColumn("Avg", 11);
+  table.AddColumn("Max", 11);
+  table.AddColumn("% of total", 11);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.SetPrecision(4);
+  table.PrintHeader();
+
+  for (size_t i = 0; i < nStage; ++i) {
+    table << names[i] << minTimes[i] << sumTimes[i] / size << maxTimes[i]
+          << (total > 0.0? 100.0 * maxTimes[i] / total : 0.0);
+  }
+  table.PrintFooter();
+}
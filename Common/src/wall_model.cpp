@@ -56,7 +56,7 @@ void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                             su2double       &tauWall,
                                             su2double       &qWall,
                                             su2double       &ViscosityWall,
-                                            su2double       &kOverCvWall) {}
+                                            su2double       &kOverCvWall) const {}
 
 CWallModel1DEQ::CWallModel1DEQ(CConfig      *config,
                                const string &Marker_Tag)
@@ -111,7 +111,7 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
                                                 su2double &tauWall,
                                                 su2double &qWall,
                                                 su2double &ViscosityWall,
-                                                su2double &kOverCvWall) {
+                                                su2double &kOverCvWall) const {
 
   
   /* Set tau wall to initial guess
@@ -214,8 +214,9 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
     */
 #if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
     int info, nrhs = 1;
+    int nPts = numPoints; /* Non-const copy for the LAPACK interface. */
 
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
+    dgtsv_(&nPts,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&nPts, &info);
     if (info != 0)
       SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
 #else
@@ -296,7 +297,7 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
     /* Solve the matrix problem to get the Enthalpy field
      */
 #if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
+    dgtsv_(&nPts,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&nPts, &info);
     if (info != 0)
       SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
 #else
@@ -362,7 +363,7 @@ void CWallModelLogLaw::WallShearStressAndHeatFlux(const su2double tExchange,
                                                   su2double       &tauWall,
                                                   su2double       &qWall,
                                                   su2double       &ViscosityWall,
-                                                  su2double       &kOverCvWall) {
+                                                  su2double       &kOverCvWall) const {
 
   /* Set the wall temperature, depending whether or not the temperature
      was prescribed and initialize the fluid model. */
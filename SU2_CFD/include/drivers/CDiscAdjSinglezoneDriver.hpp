@@ -36,6 +36,17 @@
  * \version 7.1.1 "Blackbird"
  */
 class CDiscAdjSinglezoneDriver : public CSinglezoneDriver {
+public:
+#ifdef CODI_FORWARD_TYPE
+  using Scalar = su2double;
+  using MixedScalar = su2double;
+#else
+  /*--- The Krylov solver for the residual-based adjoint is passive. ---*/
+  using Scalar = passivedouble;
+  /*--- The preconditioner may use single precision. ---*/
+  using MixedScalar = su2mixedfloat;
+#endif
+
 protected:
 
   unsigned long nAdjoint_Iter;                  /*!< \brief The number of adjoint iterations that are run on the fixed-point solver.*/
@@ -56,8 +67,79 @@ protected:
 
   COutputLegacy* output_legacy;
 
+  /*--- Residual-based (Krylov) adjoint mode, the tape holds R(U,X) instead of a full iteration. ---*/
+  bool KrylovAdjoint = false;                   /*!< \brief Record only the residual and solve the adjoint system with a Krylov method. */
+  vector<int> ResidualIndex;                    /*!< \brief AD indices of the recorded residuals, 0 if they are not on the tape. */
+  vector<bool> DirichletRow;                    /*!< \brief Rows imposed strongly (e.g. no-slip), identities in the adjoint system. */
+  vector<Scalar> PseudoTimeDiag;                /*!< \brief Pseudo-time term (Vol/dt) of the adjoint Newton-Krylov iterations. */
+  CSysVector<Scalar> AdjSolution;               /*!< \brief Adjoint solution (psi) used to seed the residuals. */
+  CSysVector<Scalar> AdjResidual;               /*!< \brief Adjoint residual, dR/dU^T psi + dJ/dU^T. */
+  CSysVector<Scalar> AdjUpdate;                 /*!< \brief Update of the adjoint solution. */
+  CSysSolve<Scalar> AdjLinSolver;               /*!< \brief Krylov solver for the adjoint system. */
+  CPreconditioner<MixedScalar>* AdjPreconditioner = nullptr; /*!< \brief Transposed primal Jacobian, used as preconditioner. */
+  mutable CSysVector<MixedScalar> PrecondIn, PrecondOut;     /*!< \brief To interface with a mixed-precision preconditioner. */
+
+  /*!
+   * \brief Check the problem is supported by the residual-based adjoint and allocate its data.
+   */
+  void SetupKrylovAdjoint();
+
+  /*!
+   * \brief Build the transposed primal Jacobian preconditioner after a passive evaluation of the residual.
+   */
+  void PrepareKrylovPreconditioner();
+
+  /*!
+   * \brief Evaluate the residual of the direct solver (instead of running one iteration).
+   * \param[in] kind_recording - Type of recording (full list in ENUM_RECORDING, option_structure.hpp)
+   */
+  void DirectResidual(unsigned short kind_recording);
+
+  /*!
+   * \brief Register the residuals of the flow solver as output of the tape.
+   */
+  void RegisterResidualOutput();
+
+  /*!
+   * \brief Set the adjoint of the recorded residuals.
+   * \param[in] seed - Adjoint values of the residuals.
+   */
+  void SetResidualAdjoint(const CSysVector<Scalar>& seed);
+
+  /*!
+   * \brief Evaluate the tape seeded by the adjoint of the residuals, i.e. compute dR/dU^T * seed.
+   * \param[in] seed - Adjoint values of the residuals.
+   * \param[out] adjoint - Adjoint values of the conservative variables.
+   * \param[in] objective - Also seed the objective function (and extract the adjoints of other variables).
+   */
+  void EvaluateResidualAdjoint(const CSysVector<Scalar>& seed, CSysVector<Scalar>& adjoint, bool objective);
+
+  /*!
+   * \brief Compute the adjoint residual and store it in the adjoint solver to monitor convergence.
+   */
+  void ComputeKrylovAdjointResidual();
+
+  /*!
+   * \brief Run the pseudo-time Newton-Krylov iterations of the residual-based adjoint.
+   */
+  void RunKrylov();
+
 public:
 
+  /*!
+   * \brief Matrix-free product with the transposed Jacobian of the residual (plus pseudo-time term).
+   * \param[in] u - Input vector.
+   * \param[out] v - Result of the product.
+   */
+  void KrylovAdjointProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v);
+
+  /*!
+   * \brief Apply the transposed primal Jacobian preconditioner.
+   * \param[in] u - Input vector.
+   * \param[out] v - Preconditioned vector.
+   */
+  void KrylovAdjointPreconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const;
+
   /*!
    * \brief Constructor of the class.
    * \param[in] confFile - Configuration file name.
@@ -29,12 +29,14 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 #include "../integration/CIntegration.hpp"
 #include "../solvers/CSolver.hpp"
 #include "../interfaces/CInterface.hpp"
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
 
 using namespace std;
 
@@ -98,6 +100,16 @@ protected:
   interpolator_container;                       /*!< \brief Definition of the interpolation method between non-matching discretizations of the interface. */
   CInterface ***interface_container;            /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                                 /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
+  bool concurrentZones = false;                 /*!< \brief Zones are iterated concurrently, each by its own group of ranks. */
+  unsigned short rankZone = 0;                  /*!< \brief Zone iterated by this rank when the zones are concurrent. */
+  vector<int> zoneRankOffset;                   /*!< \brief First (global) rank of the group of each zone, size nZone+1. */
+  SU2_Comm globalComm,                          /*!< \brief Communicator of all the ranks of the problem. */
+           zoneComm;                            /*!< \brief Communicator of the group of ranks of rankZone. */
+  su2passivematrix pyViewSolution[MAX_SOLS],    /*!< \brief Passive copies behind the Python views of the solutions (AD builds). */
+                   pyViewPrimitive,             /*!< \brief Passive copy behind the Python view of the primitives (AD builds). */
+                   pyViewCoord;                 /*!< \brief Passive copy behind the Python view of the coordinates (AD builds). */
+  vector<vector<unsigned long> > pyViewMarkerPoints; /*!< \brief Point of each vertex of each marker, for the Python views. */
+  vector<unique_ptr<CGeometryCache> > geometryCache; /*!< \brief Geometry cache of each zone (if enabled). */
 
 public:
 
@@ -122,6 +134,14 @@ public:
    */
   virtual void Run() { };
 
+  /*!
+   * \brief Distribute ranks over zones minimizing the maximum cost per rank, each zone gets at least one rank.
+   * \param[in] weights - Relative cost of each zone.
+   * \param[in] nRank - Number of ranks.
+   * \return First rank of each zone (the groups are contiguous), the last entry is nRank.
+   */
+  static vector<int> DistributeZoneRanks(const vector<passivedouble>& weights, int nRank);
+
 protected:
 
   /*!
@@ -134,6 +154,21 @@ protected:
    */
   void Input_Preprocessing(CConfig **&config, CConfig *&driver_config);
 
+  /*!
+   * \brief Distribute the ranks over the zones and create the communicator of each group,
+   *        when the zones are iterated concurrently (CONCURRENT_ZONES= YES).
+   * \note Each rank builds the zone of its group and dummy geometries and solvers for the others.
+   */
+  void ZoneRanks_Preprocessing();
+
+  /*!
+   * \brief Check if a zone is computed by this rank (always true unless the zones are concurrent).
+   * \param[in] val_iZone - Index of the zone.
+   */
+  inline bool ZoneOnRank(unsigned short val_iZone) const {
+    return !concurrentZones || (val_iZone == rankZone);
+  }
+
   /*!
    * \brief Construction of the edge-based data structure and the multigrid structure.
    */
@@ -679,6 +714,74 @@ public:
    */
   void SetInlet_Angle(unsigned short iMarker, passivedouble alpha);
 
+  /*!
+   * \brief Get a NumPy view of the solution of a solver (nPoint x nVar, row-major, halo points included).
+   * \note In primal builds the view is of the solver data (no copies are made). In AD builds it is of a
+   *       passive copy which is refreshed by each call. After modifying the view call SetSolutionView.
+   * \param[in] iSol - Position of the solver in the container (e.g. FLOW_SOL).
+   * \param[out] view - Pointer to the data.
+   * \param[out] nRow - Number of points.
+   * \param[out] nCol - Number of variables.
+   */
+  void GetSolutionView(unsigned short iSol, passivedouble** view, int* nRow, int* nCol);
+
+  /*!
+   * \brief Synchronization point after the solution view of a solver is modified, the values are copied
+   *        back (AD builds) and the halo points are updated with the values of their owners.
+   * \param[in] iSol - Position of the solver in the container (e.g. FLOW_SOL).
+   */
+  void SetSolutionView(unsigned short iSol);
+
+  /*!
+   * \brief Get a NumPy view (read only) of the primitive variables of the flow solver (nPoint x nPrimVar).
+   * \note See GetSolutionView, the primitives are recomputed from the solution by the solver.
+   */
+  void GetPrimitiveView(passivedouble** view, int* nRow, int* nCol);
+
+  /*!
+   * \brief Get a NumPy view (read only) of the coordinates of the points (nPoint x nDim).
+   * \note See GetSolutionView, to move the mesh use the (marker) mesh displacements.
+   */
+  void GetCoordinatesView(passivedouble** view, int* nRow, int* nCol);
+
+  /*!
+   * \brief Get a NumPy view of the point index of each vertex of a marker, to index the other views,
+   *        e.g. coords[points] gives the coordinates of the vertices of the marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] view - Pointer to the indices.
+   * \param[out] nRow - Number of vertices.
+   */
+  void GetMarkerPointsView(unsigned short iMarker, unsigned long** view, int* nRow);
+
+  /*!
+   * \brief Get the flow loads of all the vertices of a marker (bulk version of GetFlowLoad).
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Array (nVertex x nDim) where the loads are written.
+   */
+  void GetMarkerFlowLoads(unsigned short iMarker, passivedouble* values, int nRow, int nCol) const;
+
+  /*!
+   * \brief Set the mesh displacements of all the vertices of a marker (bulk version of SetMeshDisplacement).
+   * \note CommunicateMeshDisplacement must still be called afterwards.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Displacements (nVertex x nDim).
+   */
+  void SetMarkerMeshDisplacements(unsigned short iMarker, const passivedouble* values, int nRow, int nCol);
+
+  /*!
+   * \brief Set the loads of all the vertices of a marker of the FEA solver (bulk version of SetFEA_Loads).
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Loads (nVertex x nDim).
+   */
+  void SetMarkerFEA_Loads(unsigned short iMarker, const passivedouble* values, int nRow, int nCol);
+
+  /*!
+   * \brief Set the temperatures of all the vertices of a marker (bulk version of SetVertexTemperature).
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Temperatures (nVertex).
+   */
+  void SetMarkerTemperatures(unsigned short iMarker, const passivedouble* values, int nRow);
+
   /*!
    * \brief Sum the number of primal or adjoint variables for all solvers in a given zone.
    * \param[in] iZone - Index of the zone.
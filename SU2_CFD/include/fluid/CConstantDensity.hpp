@@ -57,4 +57,16 @@ class CConstantDensity final : public CFluidModel {
        Note Cp = Cv, (gamma = 1).*/
     Temperature = t;
   }
+
+  /*!
+   * \brief Compute the density and heat capacities of a batch of temperatures.
+   * \param[in] n - Size of the batch.
+   * \param[in] T - Temperatures.
+   * \param[out] state - Output arrays (Density, Cp, Cv), the null ones are not computed.
+   */
+  void ComputeTDState_T(unsigned long n, const su2double* T, const CFluidStateBatch& state) const override {
+    if (state.Density) fill(state.Density, state.Density + n, Density);
+    if (state.Cp) fill(state.Cp, state.Cp + n, Cp);
+    if (state.Cv) fill(state.Cv, state.Cv + n, Cv);
+  }
 };
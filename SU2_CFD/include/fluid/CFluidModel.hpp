@@ -32,11 +32,39 @@
 
 #include "../../../Common/include/CConfig.hpp"
 #include "../../../Common/include/basic_types/datatype_structure.hpp"
+#include "../../../Common/include/parallelization/vectorization.hpp"
 #include "CConductivityModel.hpp"
 #include "CViscosityModel.hpp"
 
 using namespace std;
 
+/*!
+ * \brief Thermodynamic state (and derivatives) of a density-energy pair.
+ * \note "T" is su2double, or a SIMD type to evaluate several states at once.
+ */
+template <class T>
+struct CFluidState {
+  T Pressure, Temperature, SoundSpeed2, Entropy, dPdrho_e, dPde_rho, dTdrho_e, dTde_rho;
+};
+
+/*!
+ * \brief Outputs of CFluidModel::ComputeTDState_rhoe and CFluidModel::ComputeTDState_T, arrays of the batch
+ *        size (null arrays are not computed).
+ */
+struct CFluidStateBatch {
+  su2double* Density = nullptr;
+  su2double* Pressure = nullptr;
+  su2double* Temperature = nullptr;
+  su2double* SoundSpeed2 = nullptr;
+  su2double* Entropy = nullptr;
+  su2double* dPdrho_e = nullptr;
+  su2double* dPde_rho = nullptr;
+  su2double* dTdrho_e = nullptr;
+  su2double* dTde_rho = nullptr;
+  su2double* Cp = nullptr;
+  su2double* Cv = nullptr;
+};
+
 /*!
  * \class CFluidModel
  * \brief Main class for defining the Thermo-Physical Model
@@ -71,6 +99,64 @@ class CFluidModel {
   unique_ptr<CViscosityModel> LaminarViscosity;       /*!< \brief Laminar Viscosity Model */
   unique_ptr<CConductivityModel> ThermalConductivity; /*!< \brief Thermal Conductivity Model */
 
+  /*!
+   * \brief Set the state of the object from the result of a (scalar) kernel.
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[in] state - Thermodynamic state.
+   * \param[in] entropy - Whether the entropy was computed.
+   */
+  void SetTDState(su2double rho, su2double e, const CFluidState<su2double>& state, bool entropy) {
+    Density = rho;
+    StaticEnergy = e;
+    Pressure = state.Pressure;
+    Temperature = state.Temperature;
+    SoundSpeed2 = state.SoundSpeed2;
+    if (entropy) Entropy = state.Entropy;
+    dPdrho_e = state.dPdrho_e;
+    dPde_rho = state.dPde_rho;
+    dTdrho_e = state.dTdrho_e;
+    dTde_rho = state.dTde_rho;
+  }
+
+  /*!
+   * \brief Evaluate the templated kernel "TDState_rhoe" of a model over a batch, in SIMD packs with a scalar remainder.
+   * \param[in] model - The fluid model.
+   * \param[in] n - Size of the batch.
+   * \param[in] rho - Densities.
+   * \param[in] e - Static energies.
+   * \param[out] state - Output arrays.
+   */
+  template <class Model>
+  static void BatchTDState_rhoe(const Model& model, unsigned long n, const su2double* rho, const su2double* e,
+                                const CFluidStateBatch& state) {
+    using Pack = simd::Array<su2double>;
+    unsigned long i = 0;
+    for (; i + Pack::Size <= n; i += Pack::Size) StoreTDState_rhoe<Pack>(model, i, rho, e, state);
+    for (; i < n; ++i) StoreTDState_rhoe<simd::Array<su2double, 1> >(model, i, rho, e, state);
+
+    /*--- The heat capacities of the closed-form models are constant. ---*/
+    if (state.Cp) fill(state.Cp, state.Cp + n, model.GetCp());
+    if (state.Cv) fill(state.Cv, state.Cv + n, model.GetCv());
+  }
+
+ private:
+  template <class Pack, class Model>
+  FORCEINLINE static void StoreTDState_rhoe(const Model& model, unsigned long i, const su2double* rho,
+                                            const su2double* e, const CFluidStateBatch& out) {
+    CFluidState<Pack> state;
+    model.TDState_rhoe(Pack(rho + i), Pack(e + i), state, out.Entropy != nullptr);
+
+    if (out.Pressure) state.Pressure.store(out.Pressure + i);
+    if (out.Temperature) state.Temperature.store(out.Temperature + i);
+    if (out.SoundSpeed2) state.SoundSpeed2.store(out.SoundSpeed2 + i);
+    if (out.Entropy) state.Entropy.store(out.Entropy + i);
+    if (out.dPdrho_e) state.dPdrho_e.store(out.dPdrho_e + i);
+    if (out.dPde_rho) state.dPde_rho.store(out.dPde_rho + i);
+    if (out.dTdrho_e) state.dTdrho_e.store(out.dTdrho_e + i);
+    if (out.dTde_rho) state.dTde_rho.store(out.dTde_rho + i);
+  }
+
  public:
   virtual ~CFluidModel() {}
 
@@ -227,6 +313,49 @@ class CFluidModel {
    */
   virtual void SetTDState_rhoe(su2double rho, su2double e) {}
 
+  /*!
+   * \brief Compute the thermodynamic state of a batch of density-energy pairs (compressible models).
+   * \note The result does not depend on, nor modify, the state of the object, the batch can be evaluated
+   *       concurrently with the same object. Models with a closed form in (rho, e) (ideal gas, Van der Waals,
+   *       Peng-Robinson) evaluate it with SIMD types. The transport properties are not included, they are
+   *       evaluated point by point (see SetTransportState).
+   * \param[in] n - Size of the batch.
+   * \param[in] rho - Densities.
+   * \param[in] e - Static energies.
+   * \param[out] state - Output arrays, the null ones are not computed (Density is not used).
+   * \return Number of states outside the range of the model (clamped), see CountOutOfRange.
+   */
+  virtual unsigned long ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                            const CFluidStateBatch& state) const;
+
+  /*!
+   * \brief Compute the thermodynamic state of a batch of temperatures (incompressible models).
+   * \note As ComputeTDState_rhoe, the result does not depend on, nor modify, the state of the object.
+   * \param[in] n - Size of the batch.
+   * \param[in] T - Temperatures.
+   * \param[out] state - Output arrays, only Density, Cp, and Cv are used (null ones are not computed).
+   */
+  virtual void ComputeTDState_T(unsigned long n, const su2double* T, const CFluidStateBatch& state) const;
+
+  /*!
+   * \brief Account for the states of a batch that were outside the range of the model.
+   * \param[in] n - Number of states (returned by ComputeTDState_rhoe).
+   */
+  virtual void CountOutOfRange(unsigned long n) {}
+
+  /*!
+   * \brief Set the state used by the transport properties (GetLaminarViscosity, GetThermalConductivity),
+   *        e.g. from the result of a batched evaluation, the rest of the state is not modified.
+   * \param[in] rho - Density.
+   * \param[in] T - Temperature.
+   * \param[in] cp - Specific heat at constant pressure.
+   */
+  void SetTransportState(su2double rho, su2double T, su2double cp) {
+    Density = rho;
+    Temperature = T;
+    Cp = cp;
+  }
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("PT").
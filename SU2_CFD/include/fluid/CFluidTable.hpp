@@ -0,0 +1,165 @@
+/*!
+ * \file CFluidTable.hpp
+ * \brief Defines a table of thermodynamic properties as functions of density and static energy.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "../../../Common/include/basic_types/datatype_structure.hpp"
+
+class CFluidModel;
+
+/*!
+ * \class CFluidTable
+ * \brief Structured table of thermodynamic properties, uniform in log(density) and in static energy,
+ *        with bicubic (Catmull-Rom) interpolation.
+ * \note The table is immutable after construction and can be shared by the fluid model objects of
+ *       all threads. The interpolation is differentiable w.r.t. density and energy (for AD), the
+ *       tabulated values are constants. Queries outside the table are clamped to its limits, the
+ *       interpolation of all the properties reports them to the caller.
+ * \author agent
+ */
+class CFluidTable {
+public:
+  /*!
+   * \brief Tabulated properties, stored contiguously for each node.
+   */
+  enum ENUM_VAR : unsigned short {
+    PRESSURE, TEMPERATURE, SOUND_SPEED2, ENTROPY, DPDRHO_E, DPDE_RHO, DTDRHO_E, DTDE_RHO, CP, CV, NVAR
+  };
+
+private:
+  unsigned long nDensity = 0;  /*!< \brief Number of density points. */
+  unsigned long nEnergy = 0;   /*!< \brief Number of energy points. */
+  passivedouble logRhoMin = 0, logRhoMax = 0, dLogRho = 0;  /*!< \brief Density axis (natural log). */
+  passivedouble energyMin = 0, energyMax = 0, dEnergy = 0;   /*!< \brief Energy axis. */
+  std::vector<passivedouble> values;  /*!< \brief Node-major values, NVAR per node, energy runs fastest. */
+
+  /*!
+   * \brief Set the axes from the number of points and the limits.
+   */
+  void SetAxes(unsigned long nRho, passivedouble rhoMin, passivedouble rhoMax,
+               unsigned long nE, passivedouble eMin, passivedouble eMax);
+
+  /*!
+   * \brief Check that the tabulated state is physical (positive P, T, c^2) and finite.
+   */
+  void CheckValues() const;
+
+  /*!
+   * \brief Indices and weights (and their derivatives w.r.t. the coordinate) of the 4 nodes
+   *        that interpolate along one axis.
+   * \param[in] coord - Coordinate of the query (clamped to the axis).
+   * \param[in] coordMin - Start of the axis.
+   * \param[in] delta - Spacing of the axis.
+   * \param[in] n - Number of points.
+   * \param[out] idx - Node indices.
+   * \param[out] w - Weights.
+   * \param[out] dw - Derivatives of the weights, not computed if null.
+   * \return False if the coordinate was outside the axis (and was clamped).
+   */
+  static bool Stencil(su2double coord, passivedouble coordMin, passivedouble delta, unsigned long n,
+                      unsigned long* idx, su2double* w, su2double* dw);
+
+public:
+  /*!
+   * \brief Sample a fluid model.
+   * \note The energy range is the one spanned by the temperature range over the density range.
+   * \param[in] model - Fluid model (must implement SetTDState_rhoe and SetTDState_rhoT).
+   * \param[in] rhoMin, rhoMax - Density range.
+   * \param[in] TMin, TMax - Temperature range.
+   * \param[in] nRho, nE - Number of density and energy points.
+   */
+  CFluidTable(CFluidModel& model, su2double rhoMin, su2double rhoMax, su2double TMin, su2double TMax,
+              unsigned long nRho, unsigned long nE);
+
+  /*!
+   * \brief Read the table from a CSV file (format of Write).
+   * \param[in] fileName - Name of the file.
+   */
+  explicit CFluidTable(const std::string& fileName);
+
+  /*!
+   * \brief Write the table to a CSV file, with one header line and one row per node (density, energy, NVAR values).
+   * \param[in] fileName - Name of the file.
+   */
+  void Write(const std::string& fileName) const;
+
+  /*!
+   * \brief Make the table non-dimensional (or change its units), energy is scaled by pressureRef/densityRef.
+   * \param[in] densityRef - Reference density.
+   * \param[in] pressureRef - Reference pressure.
+   * \param[in] temperatureRef - Reference temperature.
+   */
+  void Scale(passivedouble densityRef, passivedouble pressureRef, passivedouble temperatureRef);
+
+  /*!
+   * \brief Interpolate all the tabulated properties.
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[out] vals - NVAR values.
+   * \return False if the state is outside the table (the values are those of the closest state in it).
+   */
+  bool Interpolate(su2double rho, su2double e, su2double* vals) const;
+
+  /*!
+   * \brief Interpolate one property and its derivatives (of the interpolant) w.r.t. density and energy.
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[in] iVar - Property.
+   * \param[out] dvdrho - Derivative w.r.t. density at constant energy (at the minimum density if rho <= 0).
+   * \param[out] dvde - Derivative w.r.t. energy at constant density.
+   * \return Value of the property.
+   */
+  su2double Interpolate(su2double rho, su2double e, unsigned short iVar, su2double& dvdrho, su2double& dvde) const;
+
+  /*!
+   * \brief Density limits of the table.
+   */
+  inline passivedouble GetDensityMin() const { return exp(logRhoMin); }
+  inline passivedouble GetDensityMax() const { return exp(logRhoMax); }
+
+  /*!
+   * \brief Energy limits of the table.
+   */
+  inline passivedouble GetEnergyMin() const { return energyMin; }
+  inline passivedouble GetEnergyMax() const { return energyMax; }
+
+  /*!
+   * \brief Number of density and energy points.
+   */
+  inline unsigned long GetnDensity() const { return nDensity; }
+  inline unsigned long GetnEnergy() const { return nEnergy; }
+
+  /*!
+   * \brief Value of a property at a node.
+   */
+  inline passivedouble GetValue(unsigned long iRho, unsigned long iE, unsigned short iVar) const {
+    return values[(iRho*nEnergy + iE)*NVAR + iVar];
+  }
+};
@@ -54,6 +54,40 @@ class CIdealGas : public CFluidModel {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Compute the thermodynamic state of a batch of density-energy pairs.
+   * \param[in] n - Size of the batch.
+   * \param[in] rho - Densities.
+   * \param[in] e - Static energies.
+   * \param[out] state - Output arrays, the null ones are not computed.
+   * \return 0, the model is defined for all states.
+   */
+  unsigned long ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                    const CFluidStateBatch& state) const override {
+    BatchTDState_rhoe(*this, n, rho, e, state);
+    return 0;
+  }
+
+  /*!
+   * \brief Thermodynamic state from density and static energy (scalar or SIMD).
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[out] s - Thermodynamic state.
+   * \param[in] entropy - Whether to compute the entropy.
+   */
+  template <class T>
+  FORCEINLINE void TDState_rhoe(const T& rho, const T& e, CFluidState<T>& s, bool entropy) const {
+    s.Pressure = Gamma_Minus_One * rho * e;
+    s.Temperature = Gamma_Minus_One * e / Gas_Constant;
+    s.SoundSpeed2 = Gamma * s.Pressure / rho;
+    s.dPdrho_e = Gamma_Minus_One * e;
+    s.dPde_rho = Gamma_Minus_One * rho;
+    s.dTdrho_e = 0.0;
+    s.dTde_rho = Gamma_Minus_One / Gas_Constant;
+
+    if (entropy) s.Entropy = (1.0 / Gamma_Minus_One * log(s.Temperature) + log(1.0 / rho)) * Gas_Constant;
+  }
+
   /*!
    * \brief Set the Dimensionless State using Pressure  and Temperature
    * \param[in] P - first thermodynamic variable.
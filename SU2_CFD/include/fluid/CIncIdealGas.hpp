@@ -60,6 +60,19 @@ class CIncIdealGas final : public CFluidModel {
     Density = Pressure / (Temperature * Gas_Constant);
   }
 
+  /*!
+   * \brief Compute the density and heat capacities of a batch of temperatures.
+   * \param[in] n - Size of the batch.
+   * \param[in] T - Temperatures.
+   * \param[out] state - Output arrays (Density, Cp, Cv), the null ones are not computed.
+   */
+  void ComputeTDState_T(unsigned long n, const su2double* T, const CFluidStateBatch& state) const override {
+    if (state.Density)
+      for (unsigned long i = 0; i < n; ++i) state.Density[i] = Pressure / (T[i] * Gas_Constant);
+    if (state.Cp) fill(state.Cp, state.Cp + n, Cp);
+    if (state.Cv) fill(state.Cv, state.Cv + n, Cv);
+  }
+
  private:
   su2double Gas_Constant{0.0}; /*!< \brief Gas Constant. */
   su2double Gamma{0.0};        /*!< \brief Heat Capacity Ratio. */
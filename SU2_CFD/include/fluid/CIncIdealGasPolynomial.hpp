@@ -82,6 +82,26 @@ class CIncIdealGasPolynomial final : public CFluidModel {
     Cv = Cp / Gamma;
   }
 
+  /*!
+   * \brief Compute the density and heat capacities of a batch of temperatures.
+   * \param[in] n - Size of the batch.
+   * \param[in] T - Temperatures.
+   * \param[out] state - Output arrays (Density, Cp, Cv), the null ones are not computed.
+   */
+  void ComputeTDState_T(unsigned long n, const su2double* T, const CFluidStateBatch& state) const override {
+    for (unsigned long i = 0; i < n; ++i) {
+      if (state.Density) state.Density[i] = Pressure / (T[i] * Gas_Constant);
+
+      su2double cp = coeffs_[0], t_i = 1.0;
+      for (int j = 1; j < N; ++j) {
+        t_i *= T[i];
+        cp += coeffs_[j] * t_i;
+      }
+      if (state.Cp) state.Cp[i] = cp;
+      if (state.Cv) state.Cv[i] = cp / Gamma;
+    }
+  }
+
  private:
   su2double Gas_Constant{0.0}; /*!< \brief Specific Gas Constant. */
   su2double Gamma{0.0};        /*!< \brief Ratio of specific heats. */
@@ -0,0 +1,175 @@
+/*!
+ * \file CLookUpTableGas.hpp
+ * \brief Defines the look-up table fluid model.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CFluidModel.hpp"
+#include "CFluidTable.hpp"
+
+/*!
+ * \class CLookUpTableGas
+ * \brief Fluid model that interpolates a table of properties in (density, static energy).
+ * \note The other input pairs are inverted with Newton's method on the interpolant, starting
+ *       from the previous state. The table is shared, each thread should use its own object.
+ *       States outside the table are clamped to its limits, and the inversions that do not converge
+ *       keep the closest state found, both are counted and reported (like CPengRobinson does).
+ * \author agent
+ */
+class CLookUpTableGas final : public CFluidModel {
+ private:
+  shared_ptr<const CFluidTable> table; /*!< \brief Table of properties (shared by all threads). */
+  unsigned long nOutOfRange = 0;       /*!< \brief Number of states clamped to the limits of the table. */
+  unsigned long nNotConverged = 0;     /*!< \brief Number of inversions that did not converge. */
+
+  /*!
+   * \brief Increment a counter of failures, with a warning when it reaches a power of 10 (not to flood the output).
+   * \param[in,out] counter - The counter.
+   * \param[in] what - Description of the failure.
+   */
+  static void CountFailure(unsigned long& counter, const char* what);
+
+  /*!
+   * \brief Find the density (unless it is fixed) and energy where "func" vanishes, and set the state there.
+   * \param[in] func - Functor (rho, e, r, drdrho, drde) that evaluates 2 residuals (1 if the density is fixed)
+   *            and their derivatives w.r.t. density and energy.
+   * \param[in] rho - Density, initial guess if not fixed.
+   * \param[in] fixedRho - Whether the density is known.
+   */
+  template<class Residual>
+  void Invert(const Residual& func, su2double rho, bool fixedRho);
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] fluidTable - Table of properties, in the units of the solver.
+   */
+  explicit CLookUpTableGas(shared_ptr<const CFluidTable> fluidTable);
+
+  /*!
+   * \brief Create a dimensional table from the options LUT_* (sampling LUT_BASE_MODEL or reading LUT_FILENAME).
+   * \param[in] config - Definition of the particular problem.
+   */
+  static shared_ptr<CFluidTable> CreateTable(const CConfig* config);
+
+  /*!
+   * \brief Copy a dimensional table in the units of the solver (reference values of config).
+   * \param[in] dimensional - Table created by CreateTable.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static shared_ptr<const CFluidTable> ScaleTable(const CFluidTable& dimensional, const CConfig* config);
+
+  /*!
+   * \brief Get the table of properties (e.g. to share it with other objects).
+   */
+  inline const shared_ptr<const CFluidTable>& GetTable() const { return table; }
+
+  /*!
+   * \brief Number of states (of this object) that were outside the table.
+   */
+  inline unsigned long GetnOutOfRange() const { return nOutOfRange; }
+
+  /*!
+   * \brief Number of inversions (of this object) that did not converge.
+   */
+  inline unsigned long GetnNotConverged() const { return nNotConverged; }
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Internal Energy
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe(su2double rho, su2double e) override;
+
+  /*!
+   * \brief Compute the thermodynamic state of a batch of density-energy pairs (direct lookups).
+   * \param[in] n - Size of the batch.
+   * \param[in] rho - Densities.
+   * \param[in] e - Static energies.
+   * \param[out] state - Output arrays, the null ones are not computed.
+   * \return Number of states outside the table (clamped to its limits), they are not counted by the object.
+   */
+  unsigned long ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                    const CFluidStateBatch& state) const override;
+
+  /*!
+   * \brief Count the states of a batch that were outside the table (see GetnOutOfRange).
+   * \param[in] n - Number of states.
+   */
+  void CountOutOfRange(unsigned long n) override {
+    for (unsigned long i = 0; i < n; ++i)
+      CountFailure(nOutOfRange, "states outside the table were clamped to its limits");
+  }
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Temperature
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_PT(su2double P, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetTDState_Prho(su2double P, su2double rho) override;
+
+  /*!
+   * \brief Set the Dimensionless Energy (and State) using Pressure and Density
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void SetEnergy_Prho(su2double P, su2double rho) override { SetTDState_Prho(P, rho); }
+
+  /*!
+   * \brief Set the Dimensionless State using Enthalpy and Entropy
+   * \param[in] h - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_hs(su2double h, su2double s) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Density and Temperature
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   */
+  void SetTDState_rhoT(su2double rho, su2double T) override;
+
+  /*!
+   * \brief Set the Dimensionless State using Pressure and Entropy
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] s - second thermodynamic variable.
+   */
+  void SetTDState_Ps(su2double P, su2double s) override;
+
+  /*!
+   * \brief Compute the derivatives of enthalpy and entropy needed for subsonic inflow BC.
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] rho - second thermodynamic variable.
+   */
+  void ComputeDerivativeNRBC_Prho(su2double P, su2double rho) override;
+};
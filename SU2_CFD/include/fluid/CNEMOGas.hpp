@@ -125,12 +125,35 @@ public:
    * \brief Compute species net production rates.
    */
   virtual vector<su2double>& ComputeNetProductionRates() = 0;
+
+  /*!
+   * \brief Compute the species net production rates of a batch of points.
+   * \note The default implementation sets the state of each point (it is not reentrant), models
+   *       that can, override it with a kernel that leaves the object unchanged.
+   * \param[in] nPoint - Size of the batch.
+   * \param[in] val_rhos - Species densities, species-major (species iSpecies of point i at iSpecies*nPoint+i).
+   * \param[in] val_T - Translational/Rotational temperatures.
+   * \param[in] val_Tve - Vibrational/Electronic temperatures.
+   * \param[out] val_ws - Production rates, same layout as the densities.
+   */
+  virtual void ComputeNetProductionRates_Batch(unsigned long nPoint, const su2double* val_rhos, const su2double* val_T,
+                                               const su2double* val_Tve, su2double* val_ws);
   
   /*!
    * \brief Compute vibrational energy source term.
    */
   virtual su2double ComputeEveSourceTerm() { return 0; }
 
+  /*!
+   * \brief Compute the chemical and vibrational relaxation sources at the current state, and their
+   *        Jacobian w.r.t. the species densities and the vib.-el. energy (for point implicit integration).
+   * \note The derivatives w.r.t. the densities are taken at constant temperatures, the derivatives w.r.t.
+   *       the vib.-el. energy act through Tve on the relaxation term.
+   * \param[out] val_source - Net production rates (nSpecies) followed by the V-E energy source.
+   * \param[out] val_jacobian - Derivatives, (nSpecies+1)x(nSpecies+1), index nSpecies is the V-E energy.
+   */
+  virtual void ComputeSourceJacobian(su2double* val_source, su2activematrix& val_jacobian);
+
   /*!
    * \brief Compute vector of species V-E energy.
    */
@@ -55,6 +55,67 @@ class CPengRobinson final : public CIdealGas {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Compute the thermodynamic state of a batch of density-energy pairs.
+   * \param[in] n - Size of the batch.
+   * \param[in] rho - Densities.
+   * \param[in] e - Static energies.
+   * \param[out] state - Output arrays, the null ones are not computed.
+   * \return 0, the model is defined for all states.
+   */
+  unsigned long ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                    const CFluidStateBatch& state) const override {
+    BatchTDState_rhoe(*this, n, rho, e, state);
+    return 0;
+  }
+
+  /*!
+   * \brief Thermodynamic state from density and static energy (scalar or SIMD).
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[out] s - Thermodynamic state.
+   * \param[in] entropy - Whether to compute the entropy.
+   */
+  template <class T>
+  FORCEINLINE void TDState_rhoe(const T& rho, const T& e, CFluidState<T>& s, bool entropy) const {
+    const su2double sqrt2 = sqrt(2.0);
+    const T rho2 = rho * rho;
+    const T fv = (log(1.0 + (rho * b * sqrt2 / (1.0 + rho * b))) - log(1.0 - (rho * b * sqrt2 / (1.0 + rho * b)))) / 2.0;
+
+    /*--- Temperature, only the positive root is considered. ---*/
+
+    const su2double A = Gas_Constant / Gamma_Minus_One;
+    const T B = a * k * (k + 1) * fv / (b * sqrt2 * sqrt(TstarCrit));
+    const T C = a * (k + 1) * (k + 1) * fv / (b * sqrt2) + e;
+
+    s.Temperature = (-B + sqrt(B * B + 4 * A * C)) / (2 * A);
+    s.Temperature *= s.Temperature;
+
+    const T alpha = 1.0 + k * (1.0 - sqrt(s.Temperature / TstarCrit));
+    const T a2T = alpha * alpha;
+
+    const T vA = 1.0 / rho2 + 2 * b / rho - b * b;
+    const T vB = 1.0 / rho - b;
+
+    s.Pressure = s.Temperature * Gas_Constant / vB - a * a2T / vA;
+
+    if (entropy) {
+      s.Entropy = Gas_Constant / Gamma_Minus_One * log(s.Temperature) + Gas_Constant * log(vB) -
+                  a * sqrt(a2T) * k * fv / (b * sqrt2 * sqrt(s.Temperature * TstarCrit));
+    }
+
+    const T DpDd_T = (s.Temperature * Gas_Constant / (vB * vB) - 2 * a * a2T * (1.0 / rho + b) / (vA * vA)) / rho2;
+    const T DpDT_d = Gas_Constant / vB + a * k / vA * sqrt(a2T / (s.Temperature * TstarCrit));
+    const T Cv = Gas_Constant / Gamma_Minus_One + (a * k * (k + 1) * fv) / (2 * b * sqrt(2.0 * s.Temperature * TstarCrit));
+    const T DeDd_T = -a * (1 + k) * sqrt(a2T) / vA / rho2;
+
+    s.dPde_rho = DpDT_d / Cv;
+    s.dPdrho_e = DpDd_T - s.dPde_rho * DeDd_T;
+    s.SoundSpeed2 = s.dPdrho_e + s.Pressure / rho2 * s.dPde_rho;
+    s.dTde_rho = 1.0 / Cv;
+    s.dTdrho_e = 0.0; /*--- Not computed by this model. ---*/
+  }
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Temperature
    * \param[in] P - first thermodynamic variable.
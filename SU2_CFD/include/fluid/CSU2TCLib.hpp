@@ -61,16 +61,34 @@ private:
   Particle_Mass,                  /*!< \brief Mass of all particles present in the plasma */
   MolarFracWBE,                   /*!< \brief Molar fractions to be used in Wilke/Blottner/Eucken model */
   phis, mus,                      /*!< \brief Auxiliary vectors to be used in Wilke/Blottner/Eucken model */
-  A;                              /*!< \brief Auxiliary vector to be used in net production rate computation */
+  RelaxationTime;                 /*!< \brief Species V-T relaxation times (of the last call to ComputeEveSourceTerm). */
 
   su2activematrix CharElTemp,    /*!< \brief Characteristic temperature of electron states. */
   ElDegeneracy,                  /*!< \brief Degeneracy of electron states. */
-  RxnConstantTable,              /*!< \brief Table of chemical equiibrium reaction constants */
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
   
   C3DDoubleMatrix Omega00,       /*!< \brief Collision integrals (Omega(0,0)) */
-  Omega11;                       /*!< \brief Collision integrals (Omega(1,1)) */
+  Omega11,                       /*!< \brief Collision integrals (Omega(1,1)) */
+  EquilConstants;                /*!< \brief Chemical equilibrium constants of each reaction (6 number densities x 5 coefficients). */
+
+  /*!
+   * \brief Net production rates of a pack of points, the kernel of ComputeNetProductionRates.
+   * \note Only reads the reaction data, can be called concurrently on the same object.
+   * \param[in] val_rhos - Species densities, species-major (species iSpecies of point i at iSpecies*stride+i).
+   * \param[in] stride - Distance between species.
+   * \param[in] val_T - Translational/Rotational temperatures.
+   * \param[in] val_Tve - Vibrational/Electronic temperatures.
+   * \param[out] val_ws - Production rates, same layout as the densities.
+   * \param[out] val_kf - Forward rate coefficients, reaction-major, not computed if null.
+   * \param[out] val_kb - Backward rate coefficients, reaction-major, not computed if null.
+   * \param[out] val_dkbdN - Derivatives of kb w.r.t. the number density (via the equilibrium constants),
+   *             reaction-major, not computed if null.
+   */
+  template<class Pack>
+  void NetProductionRates(const su2double* val_rhos, unsigned long stride, const su2double* val_T,
+                          const su2double* val_Tve, su2double* val_ws, su2double* val_kf = nullptr,
+                          su2double* val_kb = nullptr, su2double* val_dkbdN = nullptr) const;
 
 public:
 
@@ -122,11 +140,30 @@ public:
    */
   vector<su2double>& ComputeNetProductionRates() final;
 
+  /*!
+   * \brief Compute the species net production rates of a batch of points (reentrant and vectorized).
+   * \param[in] nPoint - Size of the batch.
+   * \param[in] val_rhos - Species densities, species-major (species iSpecies of point i at iSpecies*nPoint+i).
+   * \param[in] val_T - Translational/Rotational temperatures.
+   * \param[in] val_Tve - Vibrational/Electronic temperatures.
+   * \param[out] val_ws - Production rates, same layout as the densities.
+   */
+  void ComputeNetProductionRates_Batch(unsigned long nPoint, const su2double* val_rhos, const su2double* val_T,
+                                       const su2double* val_Tve, su2double* val_ws) final;
+
   /*!
    * \brief Compute vibrational energy source term.
    */
   su2double ComputeEveSourceTerm() final;
 
+  /*!
+   * \brief Compute the chemical and vibrational relaxation sources and their Jacobian (law of mass action
+   *        and Landau-Teller, the dependence of the relaxation times on the state is neglected).
+   * \param[out] val_source - Net production rates (nSpecies) followed by the V-E energy source.
+   * \param[out] val_jacobian - Derivatives, (nSpecies+1)x(nSpecies+1), index nSpecies is the V-E energy.
+   */
+  void ComputeSourceJacobian(su2double* val_source, su2activematrix& val_jacobian) final;
+
   /*!
    * \brief Compute species enthalpies.
    */
@@ -152,19 +189,57 @@ public:
    */
   vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel) final;
 
-  private:
+  /*!
+   * \brief Species V-E energies, the kernel of ComputeSpeciesEve.
+   * \note The kernels below only read the gas data, they can be called concurrently on the same object.
+   * \param[in] val_T - Vibrational/Electronic temperature.
+   * \param[out] val_eves - Species V-E energies (nSpecies).
+   */
+  void SpeciesEve(su2double val_T, su2double* val_eves) const;
 
   /*!
-  * \brief Set equilibrium reaction constants for finite-rate chemistry
-  */
-  void GetChemistryEquilConstants(unsigned short iReaction);
+   * \brief Translational and vibrational temperatures, the kernel of ComputeTemperatures.
+   * \param[in] rhos - Species densities.
+   * \param[in] rhoE - Mixture total energy per unit volume.
+   * \param[in] rhoEve - Mixture V-E energy per unit volume.
+   * \param[in] rhoEvel - Mixture kinetic energy per unit volume.
+   * \param[out] val_eves - Scratch (nSpecies), species V-E energies at the final Tve.
+   * \param[out] T - Translational/Rotational temperature.
+   * \param[out] Tve - Vibrational/Electronic temperature.
+   */
+  void Temperatures(const su2double* rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel,
+                    su2double* val_eves, su2double& T, su2double& Tve) const;
+
+  /*!
+   * \brief Viscosity with the Gupta-Yos transport model, the kernel of ViscosityGY().
+   * \param[in] rhos - Species densities.
+   * \param[in] Density - Mixture density.
+   * \param[in] T - Translational/Rotational temperature.
+   * \param[in] Tve - Vibrational/Electronic temperature.
+   * \return Mixture viscosity.
+   */
+  su2double ViscosityGY(const su2double* rhos, su2double Density, su2double T, su2double Tve) const;
 
   /*!
-   * \brief Calculates constants used for Keq correlation.
-   * \param[out] A - Reference to coefficient array.
-   * \param[in] val_reaction - Reaction number indicator.
+   * \brief Species diffusion coefficients with the Gupta-Yos transport model, the kernel of DiffusionCoeffGY().
+   * \param[in] rhos - Species densities.
+   * \param[in] Density - Mixture density.
+   * \param[in] Pressure - Mixture pressure.
+   * \param[in] T - Translational/Rotational temperature.
+   * \param[in] Tve - Vibrational/Electronic temperature.
+   * \param[out] val_D - Diffusion coefficients (nSpecies).
    */
-  void ComputeKeqConstants(unsigned short val_Reaction);
+  void DiffusionCoeffGY(const su2double* rhos, su2double Density, su2double Pressure,
+                        su2double T, su2double Tve, su2double* val_D) const;
+
+  private:
+
+  /*!
+  * \brief Get the equilibrium reaction constants for finite-rate chemistry.
+  * \param[in] iReaction - Reaction number.
+  * \param[out] RxnConstantTable - Constants (6 number densities x 5 coefficients).
+  */
+  void GetChemistryEquilConstants(unsigned short iReaction, su2activematrix& RxnConstantTable) const;
 
   /*!
    * \brief Get species diffusion coefficients with Wilke/Blottner/Eucken transport model.
@@ -53,6 +53,43 @@ class CVanDerWaalsGas final : public CIdealGas {
    */
   void SetTDState_rhoe(su2double rho, su2double e) override;
 
+  /*!
+   * \brief Compute the thermodynamic state of a batch of density-energy pairs.
+   * \param[in] n - Size of the batch.
+   * \param[in] rho - Densities.
+   * \param[in] e - Static energies.
+   * \param[out] state - Output arrays, the null ones are not computed.
+   * \return 0, the model is defined for all states.
+   */
+  unsigned long ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                    const CFluidStateBatch& state) const override {
+    BatchTDState_rhoe(*this, n, rho, e, state);
+    return 0;
+  }
+
+  /*!
+   * \brief Thermodynamic state from density and static energy (scalar or SIMD).
+   * \param[in] rho - Density.
+   * \param[in] e - Static energy.
+   * \param[out] s - Thermodynamic state.
+   * \param[in] entropy - Whether to compute the entropy.
+   */
+  template <class T>
+  FORCEINLINE void TDState_rhoe(const T& rho, const T& e, CFluidState<T>& s, bool entropy) const {
+    s.Pressure = Gamma_Minus_One * rho / (1.0 - rho * b) * (e + rho * a) - a * rho * rho;
+    s.Temperature = (s.Pressure + rho * rho * a) * ((1.0 - rho * b) / (rho * Gas_Constant));
+
+    if (entropy) s.Entropy = Gas_Constant * (log(s.Temperature) / Gamma_Minus_One + log(1.0 / rho - b));
+
+    s.dPde_rho = rho * Gamma_Minus_One / (1.0 - rho * b);
+    s.dPdrho_e = Gamma_Minus_One / (1.0 - rho * b) *
+                     ((e + 2.0 * rho * a) + rho * b * (e + rho * a) / (1.0 - rho * b)) - 2.0 * rho * a;
+    s.dTdrho_e = Gamma_Minus_One / Gas_Constant * a;
+    s.dTde_rho = Gamma_Minus_One / Gas_Constant;
+
+    s.SoundSpeed2 = s.dPdrho_e + s.Pressure / (rho * rho) * s.dPde_rho;
+  }
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Temperature
    * \param[in] P - first thermodynamic variable.
@@ -0,0 +1,327 @@
+/*!
+ * \file computeGradientsAndLimiters.hpp
+ * \brief Generic computation of the gradients and limiters of a field in a single pass.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../limiters/CLimiterDetails.hpp"
+#include "computeGradientsLeastSquares.hpp"
+
+namespace detail {
+
+/*!
+ * \brief Compute the gradient (Green-Gauss or least-squares) and the limiter of a field
+ *        in one loop over the points, each point visits its neighbors twice, first for the
+ *        gradient and the min/max of the field, then for the min/max projections.
+ * \note Equivalent to computeGradientsGreenGauss or computeGradientsLeastSquares followed by
+ *       computeLimiters, for grids without periodic boundaries, and without AD (the least-squares
+ *       matrices of the geometry are used). The min/max of the field are not stored.
+ * \param[in] solver - Optional, solver associated with the field (used only for MPI).
+ * \param[in] kindMpiGradient - Type of MPI communication for the gradient.
+ * \param[in] kindMpiLimiter - Type of MPI communication for the limiter.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] config - Configuration of the problem.
+ * \param[in] kindGradient - GREEN_GAUSS, LEAST_SQUARES, or WEIGHTED_LEAST_SQUARES.
+ * \param[in] computeLimiter - Compute the limiter, otherwise it is only applied (e.g. frozen limiter).
+ * \param[in] applyLimiter - Multiply the gradient by the limiter in "limitedGradient".
+ * \param[in] varBegin - Index of first variable for which to compute the gradient.
+ * \param[in] varEnd - Index of last variable for which to compute the gradient.
+ * \param[in] field - Generic object implementing operator (iPoint, iVar).
+ * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
+ * \param[in,out] limiter - Generic object implementing operator (iPoint, iVar).
+ * \param[out] limitedGradient - Optional (may be null), single precision copy of the limited gradient,
+ *             nDim*(varEnd-varBegin) values per point, for all points (i.e. also the halos).
+ */
+template<size_t nDim, ENUM_LIMITER LimiterKind, class FieldType, class GradientType, class LimitedGradientType>
+void computeGradientsAndLimiters(CSolver* solver,
+                                 MPI_QUANTITIES kindMpiGradient,
+                                 MPI_QUANTITIES kindMpiLimiter,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 unsigned short kindGradient,
+                                 bool computeLimiter,
+                                 bool applyLimiter,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 FieldType& limiter,
+                                 LimitedGradientType* limitedGradient)
+{
+  constexpr size_t MAXNVAR = 32;
+
+  if (varEnd > MAXNVAR)
+    SU2_MPI::Error("Number of variables is too large, increase MAXNVAR.", CURRENT_FUNCTION);
+
+  const bool greenGauss = (kindGradient == GREEN_GAUSS);
+  const bool weighted = (kindGradient == WEIGHTED_LEAST_SQUARES);
+
+  const size_t nPointDomain = geometry.GetnPointDomain();
+  const size_t nPoint = geometry.GetnPoint();
+
+  constexpr size_t OMP_MAX_CHUNK = 512;
+
+  const auto chunkSize = computeStaticChunkSize(nPointDomain, omp_get_max_threads(), OMP_MAX_CHUNK);
+
+  /*--- Least-squares matrices of the geometry. ---*/
+
+  if (!greenGauss && !geometry.GetLeastSquaresMatricesValid(weighted))
+    computeLeastSquaresMatrices<nDim>(geometry, weighted, chunkSize);
+
+  const auto& Smatrices = geometry.GetLeastSquaresMatrices(weighted);
+
+  CLimiterDetails<LimiterKind> limiterDetails;
+
+  if (computeLimiter) limiterDetails.preprocess(geometry, config, varBegin, varEnd, field);
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < nPointDomain; ++iPoint)
+  {
+    const auto nodes = geometry.nodes;
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    su2double grad[MAXNVAR][nDim], fieldMin[MAXNVAR], fieldMax[MAXNVAR];
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+      fieldMin[iVar] = fieldMax[iVar] = field(iPoint,iVar);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) grad[iVar][iDim] = 0.0;
+    }
+
+    /*--- Gradient, and min/max of the field over the direct neighbors. ---*/
+
+    const su2double halfOnVol = greenGauss? 0.5 / nodes->GetVolume(iPoint) : 0.0;
+
+    for (size_t iNeigh = 0; iNeigh < nodes->GetnPoint(iPoint); ++iNeigh)
+    {
+      const size_t jPoint = nodes->GetPoint(iPoint,iNeigh);
+
+      su2double vec_ij[nDim] = {0.0}, weight = 1.0;
+
+      if (greenGauss) {
+        const auto area = geometry.edges->GetNormal(nodes->GetEdge(iPoint,iNeigh));
+        weight = (iPoint < jPoint)? halfOnVol : -halfOnVol;
+        for (size_t iDim = 0; iDim < nDim; ++iDim) vec_ij[iDim] = area[iDim];
+      }
+      else {
+        GeometryToolbox::Distance(nDim, nodes->GetCoord(jPoint), coord_i, vec_ij);
+        if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, vec_ij);
+        weight = (weight > 0.0)? 1.0 / weight : 0.0;
+      }
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        const su2double val_j = field(jPoint,iVar);
+
+        fieldMax[iVar] = max(fieldMax[iVar], val_j);
+        fieldMin[iVar] = min(fieldMin[iVar], val_j);
+
+        const su2double flux = weight * (greenGauss? field(iPoint,iVar) + val_j : val_j - field(iPoint,iVar));
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          grad[iVar][iDim] += flux * vec_ij[iDim];
+      }
+    }
+
+    if (greenGauss) {
+      /*--- Boundary faces of iPoint. ---*/
+
+      if (nodes->GetBoundary(iPoint)) {
+        for (size_t iMarker = 0; iMarker < geometry.GetnMarker(); ++iMarker)
+        {
+          const auto iVertex = nodes->GetVertex(iPoint, iMarker);
+
+          if ((iVertex < 0) ||
+              (config.GetMarker_All_KindBC(iMarker) == INTERNAL_BOUNDARY) ||
+              (config.GetMarker_All_KindBC(iMarker) == PERIODIC_BOUNDARY)) continue;
+
+          const auto area = geometry.vertex[iMarker][iVertex]->GetNormal();
+
+          for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+          {
+            const su2double flux = field(iPoint,iVar) / nodes->GetVolume(iPoint);
+
+            for (size_t iDim = 0; iDim < nDim; ++iDim)
+              grad[iVar][iDim] -= flux * area[iDim];
+          }
+        }
+      }
+    }
+    else {
+      /*--- S*c ---*/
+
+      su2double Smatrix[nDim][nDim];
+      size_t k = 0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          Smatrix[iDim][jDim] = Smatrices(iPoint, k++);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        su2double Cvector[nDim] = {0.0};
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = 0; jDim < nDim; ++jDim)
+            Cvector[iDim] += Smatrix[min(iDim,jDim)][max(iDim,jDim)] * grad[iVar][jDim];
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          grad[iVar][iDim] = Cvector[iDim];
+      }
+    }
+
+    for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        gradient(iPoint, iVar, iDim) = grad[iVar][iDim];
+
+    if (computeLimiter) {
+
+      /*--- Min/max projection out of iPoint, the coordinates of the neighbors are still cached. ---*/
+
+      su2double projMax[MAXNVAR], projMin[MAXNVAR];
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        projMax[iVar] = projMin[iVar] = 0.0;
+
+      for (auto jPoint : nodes->GetPoints(iPoint))
+      {
+        const auto coord_j = nodes->GetCoord(jPoint);
+
+        su2double dist_ij[nDim] = {0.0};
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          dist_ij[iDim] = 0.5 * (coord_j[iDim] - coord_i[iDim]);
+
+        for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+        {
+          const su2double proj = GeometryToolbox::DotProduct(nDim, dist_ij, grad[iVar]);
+
+          projMax[iVar] = max(projMax[iVar], proj);
+          projMin[iVar] = min(projMin[iVar], proj);
+        }
+      }
+
+      const su2double geoFactor = limiterDetails.geometricFactor(iPoint, geometry);
+
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
+      {
+        const su2double limMax = limiterDetails.limiterFunction(iVar, projMax[iVar], fieldMax[iVar] - field(iPoint,iVar));
+        const su2double limMin = limiterDetails.limiterFunction(iVar, projMin[iVar], fieldMin[iVar] - field(iPoint,iVar));
+
+        limiter(iPoint,iVar) = geoFactor * min(limMax, limMin);
+      }
+    }
+
+    /*--- Single precision copy of the limited gradient. ---*/
+
+    if (limitedGradient != nullptr) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        const su2double lim = applyLimiter? limiter(iPoint,iVar) : su2double(1.0);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          (*limitedGradient)(iPoint, (iVar-varBegin)*nDim+iDim) = SU2_TYPE::GetValue(lim * grad[iVar][iDim]);
+      }
+    }
+  }
+
+  /*--- Obtain the gradients and limiters at halo points from the MPI ranks that own them. ---*/
+
+  if (solver != nullptr)
+  {
+    solver->InitiateComms(&geometry, &config, kindMpiGradient);
+    solver->CompleteComms(&geometry, &config, kindMpiGradient);
+
+    if (computeLimiter) {
+      solver->InitiateComms(&geometry, &config, kindMpiLimiter);
+      solver->CompleteComms(&geometry, &config, kindMpiLimiter);
+    }
+  }
+
+  if (limitedGradient != nullptr) {
+    SU2_OMP_FOR_STAT(OMP_MAX_CHUNK)
+    for (size_t iPoint = nPointDomain; iPoint < nPoint; ++iPoint) {
+      for (size_t iVar = varBegin; iVar < varEnd; ++iVar) {
+        const su2double lim = applyLimiter? limiter(iPoint,iVar) : su2double(1.0);
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          (*limitedGradient)(iPoint, (iVar-varBegin)*nDim+iDim) = SU2_TYPE::GetValue(lim * gradient(iPoint,iVar,iDim));
+      }
+    }
+  }
+}
+} // end namespace
+
+/*!
+ * \brief Instantiations for 2D and 3D and for the kinds of limiter, see detail::computeGradientsAndLimiters.
+ * \note With kindLimiter = NO_LIMITER or VAN_ALBADA_EDGE only the gradient is computed.
+ */
+template<class FieldType, class GradientType, class LimitedGradientType>
+void computeGradientsAndLimiters(CSolver* solver,
+                                 MPI_QUANTITIES kindMpiGradient,
+                                 MPI_QUANTITIES kindMpiLimiter,
+                                 CGeometry& geometry,
+                                 const CConfig& config,
+                                 unsigned short kindGradient,
+                                 ENUM_LIMITER kindLimiter,
+                                 bool computeLimiter,
+                                 size_t varBegin,
+                                 size_t varEnd,
+                                 const FieldType& field,
+                                 GradientType& gradient,
+                                 FieldType& limiter,
+                                 LimitedGradientType* limitedGradient) {
+
+  SU2_PROFILE_SCOPE("GradientsAndLimiters");
+
+  if (config.GetnMarker_Periodic() > 0 || !CGeometry::SHARED_LEAST_SQUARES)
+    SU2_MPI::Error("The fused gradients and limiters do not support periodicity or AD.", CURRENT_FUNCTION);
+
+  /*--- Limiters that are computed per point. ---*/
+  const bool pointLimiter = (kindLimiter != NO_LIMITER) && (kindLimiter != VAN_ALBADA_EDGE);
+  computeLimiter &= pointLimiter;
+
+#define INSTANTIATE(NDIM, KIND)\
+  detail::computeGradientsAndLimiters<NDIM, KIND>(solver, kindMpiGradient, kindMpiLimiter, geometry, config,\
+    kindGradient, computeLimiter, pointLimiter, varBegin, varEnd, field, gradient, limiter, limitedGradient)
+
+#define INSTANTIATE_DIMS(KIND)\
+  if (geometry.GetnDim() == 2) { INSTANTIATE(2, KIND); } else { INSTANTIATE(3, KIND); }
+
+  if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
+    SU2_MPI::Error("Too many dimensions to compute gradients.", CURRENT_FUNCTION);
+
+  switch (computeLimiter? kindLimiter : BARTH_JESPERSEN) {
+    case BARTH_JESPERSEN: INSTANTIATE_DIMS(BARTH_JESPERSEN); break;
+    case VENKATAKRISHNAN: INSTANTIATE_DIMS(VENKATAKRISHNAN); break;
+    case VENKATAKRISHNAN_WANG: INSTANTIATE_DIMS(VENKATAKRISHNAN_WANG); break;
+    case WALL_DISTANCE: INSTANTIATE_DIMS(WALL_DISTANCE); break;
+    case SHARP_EDGES: INSTANTIATE_DIMS(SHARP_EDGES); break;
+    default:
+      SU2_MPI::Error("Unknown limiter type.", CURRENT_FUNCTION);
+      break;
+  }
+#undef INSTANTIATE_DIMS
+#undef INSTANTIATE
+}
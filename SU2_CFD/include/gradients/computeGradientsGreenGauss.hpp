@@ -27,7 +27,10 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 namespace detail {
 
@@ -196,6 +199,9 @@ void computeGradientsGreenGauss(CSolver* solver,
                                 size_t varBegin,
                                 size_t varEnd,
                                 GradientType& gradient) {
+
+  SU2_PROFILE_SCOPE("Gradient_GreenGauss");
+
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry,
@@ -26,7 +26,10 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
 namespace detail {
@@ -61,16 +64,12 @@ FORCEINLINE void computeSmatrix(su2double r11, su2double r12, su2double r13,
 }
 
 /*!
- * \brief Solve the least-squares problem for one point.
+ * \brief Compute the upper triangle of S = inv(R)*inv(R)^T for one point.
  * \note See detail::computeGradientsLeastSquares for the
  *       purpose of template "nDim" and "periodic".
  */
-template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
-FORCEINLINE void solveLeastSquares(size_t iPoint,
-                                   size_t varBegin,
-                                   size_t varEnd,
-                                   const RMatrixType& Rmatrix,
-                                   GradientType& gradient)
+template<size_t nDim, bool periodic, class RMatrixType>
+FORCEINLINE void computeSmatrix(size_t iPoint, const RMatrixType& Rmatrix, su2double Smatrix[][nDim])
 {
   const auto eps = pow(std::numeric_limits<passivedouble>::epsilon(),2);
 
@@ -116,7 +115,9 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
 
   /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
 
-  su2double Smatrix[nDim][nDim] = {{0.0}};
+  for (size_t iDim = 0; iDim < nDim; ++iDim)
+    for (size_t jDim = 0; jDim < nDim; ++jDim)
+      Smatrix[iDim][jDim] = 0.0;
 
   /*--- Detect singular matrix ---*/
 
@@ -131,7 +132,20 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
         AD::SetPreaccOut(Smatrix[iDim][jDim]);
     AD::EndPreacc();
   }
+}
 
+/*!
+ * \brief Solve the least-squares problem for one point, given S and c (stored in the gradient).
+ * \note See detail::computeGradientsLeastSquares for the
+ *       purpose of template "nDim" and "periodic".
+ */
+template<size_t nDim, bool periodic, class GradientType>
+FORCEINLINE void solveLeastSquaresWithS(size_t iPoint,
+                                        size_t varBegin,
+                                        size_t varEnd,
+                                        const su2double Smatrix[][nDim],
+                                        GradientType& gradient)
+{
   /*--- Computation of the gradient: S*c ---*/
 
   for (size_t iVar = varBegin; iVar < varEnd; ++iVar)
@@ -155,6 +169,82 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
   }
 }
 
+/*!
+ * \brief Solve the least-squares problem for one point from its R matrix.
+ */
+template<size_t nDim, bool periodic, class GradientType, class RMatrixType>
+FORCEINLINE void solveLeastSquares(size_t iPoint,
+                                   size_t varBegin,
+                                   size_t varEnd,
+                                   const RMatrixType& Rmatrix,
+                                   GradientType& gradient)
+{
+  su2double Smatrix[nDim][nDim];
+  computeSmatrix<nDim, periodic>(iPoint, Rmatrix, Smatrix);
+  solveLeastSquaresWithS<nDim, periodic>(iPoint, varBegin, varEnd, Smatrix, gradient);
+}
+
+/*!
+ * \brief Compute the least-squares matrices (S) of the geometry, i.e. the part of the
+ *        problem that does not depend on the field.
+ * \note Must be called by all threads, the matrices are only valid without periodicity.
+ * \param[in] geometry - Geometric grid properties.
+ * \param[in] weighted - Use inverse-distance weights.
+ * \param[in] chunkSize - Number of points per thread iteration.
+ */
+template<size_t nDim>
+void computeLeastSquaresMatrices(CGeometry& geometry, bool weighted, size_t chunkSize)
+{
+  auto& Smatrices = geometry.GetLeastSquaresMatrices(weighted);
+
+  SU2_OMP_MASTER
+  Smatrices.resize(geometry.GetnPoint(), nDim*(nDim+1)/2) = su2double(0.0);
+  SU2_OMP_BARRIER
+
+  SU2_OMP_FOR_DYN(chunkSize)
+  for (size_t iPoint = 0; iPoint < geometry.GetnPointDomain(); ++iPoint)
+  {
+    const auto nodes = geometry.nodes;
+    const auto coord_i = nodes->GetCoord(iPoint);
+
+    su2double Rmatrix[nDim][nDim] = {{0.0}};
+
+    for (auto jPoint : nodes->GetPoints(iPoint))
+    {
+      su2double dist_ij[nDim] = {0.0};
+      GeometryToolbox::Distance(nDim, nodes->GetCoord(jPoint), coord_i, dist_ij);
+
+      su2double weight = 1.0;
+      if (weighted) weight = GeometryToolbox::SquaredNorm(nDim, dist_ij);
+
+      if (weight > 0.0)
+      {
+        weight = 1.0 / weight;
+
+        for (size_t iDim = 0; iDim < nDim; ++iDim)
+          for (size_t jDim = iDim; jDim < nDim; ++jDim)
+            Rmatrix[iDim][jDim] += dist_ij[iDim]*dist_ij[jDim]*weight;
+
+        if (nDim == 3)
+          Rmatrix[2][1] += dist_ij[0]*dist_ij[nDim-1]*weight;
+      }
+    }
+
+    su2double Smatrix[nDim][nDim];
+    computeSmatrix<nDim, false>(0, [&](size_t, size_t iDim, size_t jDim) { return Rmatrix[iDim][jDim]; }, Smatrix);
+
+    size_t k = 0;
+    for (size_t iDim = 0; iDim < nDim; ++iDim)
+      for (size_t jDim = iDim; jDim < nDim; ++jDim)
+        Smatrices(iPoint, k++) = Smatrix[iDim][jDim];
+  }
+
+  /*--- All threads are past the validity check (implicit barrier of the loop). ---*/
+  SU2_OMP_MASTER
+  geometry.SetLeastSquaresMatricesValid(weighted);
+  SU2_OMP_BARRIER
+}
+
 /*!
  * \brief Compute the gradient of a field using inverse-distance-weighted or
  *        unweighted Least-Squares approximation.
@@ -169,7 +259,9 @@ FORCEINLINE void solveLeastSquares(size_t iPoint,
  * \param[in] varBegin - Index of first variable for which to compute the gradient.
  * \param[in] varEnd - Index of last variable for which to compute the gradient.
  * \param[out] gradient - Generic object implementing operator (iPoint, iVar, iDim).
- * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim).
+ * \param[out] Rmatrix - Generic object implementing operator (iPoint, iDim, iDim), only used with
+ *             periodic boundaries or AD (otherwise the matrices of the geometry are used, see
+ *             CGeometry::GetLeastSquaresMatrices) and may then be empty.
  */
 template<size_t nDim, class FieldType, class GradientType, class RMatrixType>
 void computeGradientsLeastSquares(CSolver* solver,
@@ -186,14 +278,23 @@ void computeGradientsLeastSquares(CSolver* solver,
 {
   const bool periodic = (solver != nullptr) && (config.GetnMarker_Periodic() > 0);
 
+  /*--- Without periodicity S does not depend on the field, it is computed once by the geometry for
+   *    all the solvers (until the grid moves). With periodicity each field has its R matrix, whose
+   *    contributions from the periodic neighbors are added by the periodic comms. ---*/
+
+  const bool shared = CGeometry::SHARED_LEAST_SQUARES && !periodic;
+
   const size_t nPointDomain = geometry.GetnPointDomain();
 
-#ifdef HAVE_OMP
   constexpr size_t OMP_MAX_CHUNK = 512;
 
-  size_t chunkSize = computeStaticChunkSize(nPointDomain,
-                     omp_get_max_threads(), OMP_MAX_CHUNK);
-#endif
+  const size_t chunkSize = computeStaticChunkSize(nPointDomain,
+                           omp_get_max_threads(), OMP_MAX_CHUNK);
+
+  if (shared && !geometry.GetLeastSquaresMatricesValid(weighted))
+    computeLeastSquaresMatrices<nDim>(geometry, weighted, chunkSize);
+
+  const auto& Smatrices = geometry.GetLeastSquaresMatrices(weighted);
 
   /*--- First loop over non-halo points of the grid. ---*/
 
@@ -215,10 +316,11 @@ void computeGradientsLeastSquares(CSolver* solver,
       for (size_t iDim = 0; iDim < nDim; ++iDim)
         gradient(iPoint, iVar, iDim) = 0.0;
 
-    for (size_t iDim = 0; iDim < nDim; ++iDim)
-      for (size_t jDim = 0; jDim < nDim; ++jDim)
-        Rmatrix(iPoint, iDim, jDim) = 0.0;
-
+    if (!shared) {
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = 0; jDim < nDim; ++jDim)
+          Rmatrix(iPoint, iDim, jDim) = 0.0;
+    }
 
     for (auto jPoint : nodes->GetPoints(iPoint))
     {
@@ -243,12 +345,14 @@ void computeGradientsLeastSquares(CSolver* solver,
       {
         weight = 1.0 / weight;
 
-        for (size_t iDim = 0; iDim < nDim; ++iDim)
-          for (size_t jDim = iDim; jDim < nDim; ++jDim)
-            Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
+        if (!shared) {
+          for (size_t iDim = 0; iDim < nDim; ++iDim)
+            for (size_t jDim = iDim; jDim < nDim; ++jDim)
+              Rmatrix(iPoint,iDim,jDim) += dist_ij[iDim]*dist_ij[jDim]*weight;
 
-        if (nDim == 3)
-          Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+          if (nDim == 3)
+            Rmatrix(iPoint,2,1) += dist_ij[0]*dist_ij[nDim-1]*weight;
+        }
 
         /*--- Entries of c:= transpose(A)*b ---*/
 
@@ -278,6 +382,17 @@ void computeGradientsLeastSquares(CSolver* solver,
 
       AD::EndPreacc();
     }
+    else if (shared) {
+      /*--- Solve the LS problem for iPoint with the S matrix of the geometry. ---*/
+
+      su2double Smatrix[nDim][nDim];
+      size_t k = 0;
+      for (size_t iDim = 0; iDim < nDim; ++iDim)
+        for (size_t jDim = iDim; jDim < nDim; ++jDim)
+          Smatrix[iDim][jDim] = Smatrices(iPoint, k++);
+
+      solveLeastSquaresWithS<nDim, false>(iPoint, varBegin, varEnd, Smatrix, gradient);
+    }
     else {
       /*--- Periodic comms are not needed, solve the LS problem for iPoint. ---*/
 
@@ -330,6 +445,9 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   size_t varEnd,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+
+  SU2_PROFILE_SCOPE("Gradient_LeastSquares");
+
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
@@ -122,6 +122,22 @@ public:
    */
   inline bool GetConvergence_FullMG(void) const { return Convergence_FullMG; }
 
+  /*!
+   * \brief Evaluate the spatial residual of a system of equations on the finest grid, without updating the solution.
+   * \note Used by the discrete adjoint driver to record only the residual, R(U,X), instead of a full iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  inline void ComputeResidual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                              CConfig *config, unsigned short RunTime_EqSystem) {
+    const auto iSol = config->GetContainerPosition(RunTime_EqSystem);
+    solver_container[iSol]->Preprocessing(geometry, solver_container, config, MESH_0, NO_RK_ITER, RunTime_EqSystem, false);
+    Space_Integration(geometry, solver_container, numerics, config, MESH_0, NO_RK_ITER, RunTime_EqSystem);
+  }
+
   /*!
    * \brief Save the geometry at different time steps.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -69,6 +69,19 @@ private:
                        unsigned short iMesh, unsigned short mu, unsigned short RunTime_EqSystem,
                        unsigned short iZone, unsigned short iInst);
 
+  /*!
+   * \brief Advance the finest grid by one global step of multirate explicit integration, each time level is
+   *        advanced with its own step, finer levels first (see CFVMFlowSolverBase::SetTimeLevels).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKLimit - Number of stages of the explicit scheme.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void Multirate_Step(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                      CConfig *config, unsigned short iRKLimit, unsigned short RunTime_EqSystem);
+
   /*!
    * \brief Compute the forcing term.
    * \param[in] sol_fine - Pointer to the solution on the fine grid.
@@ -26,6 +26,7 @@
  */
 
 #include "CIntegration.hpp"
+#include <fstream>
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 #include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
@@ -41,6 +42,93 @@
 #define CNEWTON_PARFOR SU2_OMP_SIMD
 #endif
 
+/*!
+ * \class CNewtonKrylovController
+ * \brief Adaptive controller of the Newton-Krylov integration. The preconditioner (and the Jacobian, whose
+ * assembly is skipped when it is reused) is rebuilt when the time lost to additional linear iterations exceeds
+ * the time to rebuild it, or when the nonlinear convergence degrades. The tolerance of the linear solves follows
+ * the Eisenstat-Walker forcing terms (choice 2), and the CFL adaptation is only allowed to increase the CFL if
+ * the step reduced the nonlinear residual.
+ */
+class CNewtonKrylovController {
+private:
+  passivedouble ewGamma = 0.9, ewAlpha = 2.0, etaMax = 0.5;
+  passivedouble rateRebuild = 1.0;  /*!< \brief Residual ratio above which the preconditioner is rebuilt. */
+  passivedouble rateUnstable = 2.0; /*!< \brief Residual ratio above which the CFL is reduced. */
+  unsigned long maxPrecondAge = 20;
+
+  bool rebuildNext = true;          /*!< \brief Decision for the next iteration. */
+  unsigned long precondAge = 0;     /*!< \brief Iterations since the preconditioner was rebuilt. */
+  unsigned long baseLinIters = 0;   /*!< \brief Linear iterations of the first solve after a rebuild. */
+  passivedouble resNorm = 0.0;      /*!< \brief Norm of the nonlinear residual at the previous iteration. */
+  passivedouble eta = 0.0;          /*!< \brief Forcing term of the previous iteration. */
+  passivedouble rebuildTime = 0.0;  /*!< \brief Time to assemble the Jacobian and build the preconditioner. */
+  passivedouble reuseTime = 0.0;    /*!< \brief Time lost to the additional linear iterations since the rebuild. */
+  passivedouble residualTime = 0.0; /*!< \brief Time of an explicit residual evaluation. */
+
+public:
+  /*!
+   * \brief Set the parameters {EW gamma, EW alpha, max tolerance, rebuild rate, unstable rate, max reuse}.
+   */
+  void SetParameters(const array<su2double,6>& param);
+
+  /*!
+   * \brief Eisenstat-Walker forcing term (tolerance of the linear solve) for the current residual norm.
+   * \param[in] norm - Norm of the nonlinear residual.
+   * \param[in] etaMin - Lower bound of the forcing term.
+   */
+  passivedouble ForcingTerm(passivedouble norm, passivedouble etaMin) const;
+
+  /*!
+   * \brief Ratio of the residual norm to that of the previous iteration (0 if there is no previous one).
+   */
+  inline passivedouble Rate(passivedouble norm) const { return (resNorm > 0.0)? norm / resNorm : 0.0; }
+
+  /*!
+   * \brief If the preconditioner should be rebuilt before the residual of the next iteration is evaluated.
+   */
+  inline bool RebuildNext() const { return rebuildNext || (precondAge >= maxPrecondAge); }
+
+  /*!
+   * \brief If the nonlinear convergence degraded enough for a reused preconditioner to be rebuilt.
+   */
+  inline bool Degraded(passivedouble rate) const { return rate > rateRebuild; }
+
+  /*!
+   * \brief Signal for the CFL adaptation, the CFL may increase if the solve met the forcing term and the
+   * residual did not increase, and it is reduced if the residual increased significantly or if the solve
+   * missed the forcing term by more than 20%.
+   * \param[in] rate - Ratio of the residual norms.
+   * \param[in] eps - Residual of the linear solve.
+   * \param[in] forcing - Tolerance of the linear solve.
+   */
+  CFL_ADAPT_SIGNAL CFLSignal(passivedouble rate, passivedouble eps, passivedouble forcing) const;
+
+  /*!
+   * \brief Update the controller after the linear solve of an iteration. The cost of a rebuild is what it adds to
+   * an explicit residual evaluation (estimated with the time of a linear iteration until one is measured), and the
+   * cost of reusing is the time of the linear iterations in excess of those that followed the rebuild.
+   * \param[in] rebuild - If the preconditioner was rebuilt in this iteration.
+   * \param[in] iters - Linear iterations.
+   * \param[in] eps - Residual of the linear solve.
+   * \param[in] forcing - Tolerance of the linear solve.
+   * \param[in] norm - Norm of the nonlinear residual.
+   * \param[in] evalTime - Time of the residual evaluation (and preconditioner build).
+   * \param[in] solveTime - Time of the linear solve.
+   */
+  void Update(bool rebuild, unsigned long iters, passivedouble eps, passivedouble forcing, passivedouble norm,
+              passivedouble evalTime, passivedouble solveTime);
+
+  /*!
+   * \brief Restart the forcing terms, e.g. at the end of the startup period.
+   */
+  inline void Restart() { resNorm = 0.0; }
+
+  inline unsigned long GetPrecondAge() const { return precondAge; }
+  inline passivedouble GetRebuildTime() const { return rebuildTime; }
+  inline passivedouble GetReuseTime() const { return reuseTime; }
+};
+
 /*!
  * \class CNewtonIntegration
  * \brief Class for time integration using a Newton-Krylov method, based
@@ -86,6 +174,12 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- Adaptive controller of the reuse of the preconditioner, of the tolerance, and of the CFL. ---*/
+  bool adaptive = false;
+  bool reusablePrecond = false;   /*!< \brief If the preconditioner does not use the matrix after being built. */
+  CNewtonKrylovController controller;
+  std::ofstream controllerLog;      /*!< \brief Record of the decisions, for tuning. */
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 #include <cmath>
 #include <string>
@@ -38,6 +39,7 @@
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
 
 class CConfig;
 class CGeometry;
@@ -58,6 +60,7 @@ protected:
 
   const int rank;   /*!< \brief MPI Rank. */
   const int size;   /*!< \brief MPI Size. */
+  const SU2_Comm comm; /*!< \brief Communicator of the transfers, the one current at construction (all the ranks of the problem). */
 
   su2double *Physical_Constants = nullptr;
   su2double *Donor_Variable = nullptr;
@@ -71,6 +74,83 @@ protected:
 
   unsigned short nVar = 0;
 
+public:
+  /*!
+   * \brief Sparse donor-to-target communication plan of one interface marker, built from the
+   *        interpolation coefficients, each transfer is then one neighbour-only exchange.
+   * \note Counts and displacements are in number of donor points, they are scaled by the number of
+   *       variables at each exchange since the same interface may transfer different solvers.
+   */
+  class CTransferPlan {
+  public:
+    int markDonor = -1;                 /*!< \brief Donor marker on this rank (-1 if not present). */
+    int markTarget = -1;                /*!< \brief Target marker on this rank (-1 if not present). */
+    vector<unsigned long> donorVertex;  /*!< \brief Local donor vertices needed by any rank (evaluated once). */
+    vector<unsigned long> targetStart;  /*!< \brief Start of the donors of each target vertex in targetSlot. */
+    vector<unsigned long> targetSlot;   /*!< \brief Row of the receive buffer of each donor of each target vertex. */
+
+  private:
+    bool built = false;                 /*!< \brief Whether the graph communicator was created. */
+    SU2_Comm graphComm;                 /*!< \brief Distributed graph communicator (neighbours only). */
+    vector<int> sendRanks;              /*!< \brief Ranks to which this rank sends donor values. */
+    vector<int> sendCounts, sendDispl;  /*!< \brief Number of donor points sent to each of sendRanks. */
+    vector<int> recvRanks;              /*!< \brief Ranks from which this rank receives donor values. */
+    vector<int> recvCounts, recvDispl;  /*!< \brief Number of donor points received from each of recvRanks. */
+    vector<unsigned long> sendSlot;     /*!< \brief Index into donorVertex of each sent point. */
+    mutable su2activematrix sendBuffer; /*!< \brief Work buffer for the packed donor values. */
+    mutable vector<int> valCounts[4];   /*!< \brief Work buffers for counts/displacements in number of values. */
+
+  public:
+    CTransferPlan() = default;
+    CTransferPlan(const CTransferPlan&) = delete;
+    CTransferPlan& operator=(const CTransferPlan&) = delete;
+    CTransferPlan(CTransferPlan&&) = default;
+
+    /*!
+     * \brief Build the plan (collective over comm).
+     * \param[in] localDonor - Global index and vertex of the donor points owned by this rank.
+     * \param[in] donorStart - Start of the donors of each target vertex in donorIndex (size nVertex+1).
+     * \param[in] donorIndex - Global indices of the donor points of each target vertex.
+     * \param[in] comm - Communicator of the transfer.
+     */
+    void Build(vector<pair<unsigned long, unsigned long> > localDonor,
+               const vector<unsigned long>& donorStart,
+               const vector<unsigned long>& donorIndex, SU2_Comm comm);
+
+    /*!
+     * \brief Send the values of the donor points to the ranks that need them (collective over the neighbours).
+     * \param[in] donorValues - Values of the points in donorVertex.
+     * \param[out] recvValues - Values of the donor points required by this rank, indexed by targetSlot.
+     */
+    void Exchange(const su2activematrix& donorValues, su2activematrix& recvValues) const;
+
+    /*!
+     * \brief Release the graph communicator (collective over the communicator of the transfer).
+     * \note Not done by the destructor (of the plan or of CInterface) as it must be called by all
+     *       ranks at the same time, the owner calls CInterface::ResetTransferPlan before deleting it.
+     */
+    void Free();
+  };
+
+protected:
+  vector<CTransferPlan> transferPlans;  /*!< \brief Plans of the interface markers that connect the zones. */
+  bool transferPlanBuilt = false;       /*!< \brief Whether the plans are up to date with the interpolator. */
+
+  su2activematrix donorValues;          /*!< \brief Work buffer for the values of the donor vertices. */
+  su2activematrix recvBuffer;           /*!< \brief Work buffer for the received donor values. */
+
+  /*!
+   * \brief Build the communication plans from the interpolation coefficients (collective over comm).
+   * \param[in] interpolator - Object defining the interpolation.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] donor_config - Definition of the problem at the donor mesh.
+   * \param[in] target_config - Definition of the problem at the target mesh.
+   */
+  void BuildTransferPlans(const CInterpolator& interpolator,
+                          const CGeometry *donor_geometry, const CGeometry *target_geometry,
+                          const CConfig *donor_config, const CConfig *target_config);
+
 public:
   /*!
    * \brief Constructor of the class.
@@ -90,7 +170,9 @@ public:
   virtual ~CInterface(void);
 
   /*!
-   * \brief Interpolate data and broadcast it into all processors, for nonmatching meshes.
+   * \brief Interpolate data and send it to the processors that need it, for nonmatching meshes.
+   * \note The donor values are only sent to the ranks whose target vertices use them, according
+   *       to a plan that is built on the first call after the interpolation coefficients change.
    * \param[in] interpolator - Object defining the interpolation.
    * \param[in] donor_solution - Solution from the donor mesh.
    * \param[in] target_solution - Solution from the target mesh.
@@ -104,6 +186,12 @@ public:
                      CGeometry *donor_geometry, CGeometry *target_geometry,
                      const CConfig *donor_config, const CConfig *target_config);
 
+  /*!
+   * \brief Discard the communication plans, must be called (by all ranks) when the interpolation
+   *        coefficients change, the plans are rebuilt on the next call to BroadcastData.
+   */
+  void ResetTransferPlan();
+
 protected:
   /*!
    * \brief A virtual member.
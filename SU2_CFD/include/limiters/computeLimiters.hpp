@@ -25,6 +25,9 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "CLimiterDetails.hpp"
 #include "computeLimiters_impl.hpp"
 
@@ -50,6 +53,8 @@ void computeLimiters(ENUM_LIMITER LimiterKind,
                      FieldType& fieldMax,
                      FieldType& limiter)
 {
+  SU2_PROFILE_SCOPE("Limiter");
+
   if (geometry.GetnDim() != 2 && geometry.GetnDim() != 3)
     SU2_MPI::Error("Too many dimensions to compute limiters.", CURRENT_FUNCTION);
 
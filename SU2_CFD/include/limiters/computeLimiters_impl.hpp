@@ -27,6 +27,7 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
 
 /*!
  * \brief Generic limiter computation for methods based on one limiter
@@ -406,6 +406,14 @@ public:
     return historyOutput_Map;
   }
 
+  /*!
+   * \brief Broadcast the values of the history output fields, e.g. from the ranks that computed a zone
+   *        to the ranks of the other zones when these are iterated concurrently.
+   * \param[in] root - Rank (in comm) that holds the values.
+   * \param[in] comm - Communicator of all the ranks that need the values.
+   */
+  void BroadcastHistoryOutput(int root, SU2_Comm comm);
+
   /*!
    * \brief Monitor the convergence of an output field
    * \param[in] config - Definition of the particular problem.
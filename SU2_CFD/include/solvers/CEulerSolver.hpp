@@ -30,6 +30,8 @@
 #include "CFVMFlowSolverBase.hpp"
 #include "../variables/CEulerVariable.hpp"
 
+class CFluidTable;
+
 /*!
  * \class CEulerSolver
  * \brief Class for compressible inviscid flow problems, serves as base for Navier-Stokes/RANS.
@@ -111,6 +113,8 @@ protected:
   unsigned short nMarkerTurboPerf;   /*!< \brief Number of turbo performance. */
 
   vector<CFluidModel*> FluidModel;   /*!< \brief fluid model used in the solver. */
+  shared_ptr<const CFluidTable> lutDimensional; /*!< \brief Table of LUT_GAS, created by the finest level. */
+  shared_ptr<const CFluidTable> lutScaled;      /*!< \brief Non-dimensional table of LUT_GAS, shared by all threads and levels. */
 
   /*--- Turbomachinery Solver Variables ---*/
 
@@ -258,6 +262,17 @@ protected:
   virtual unsigned long SetPrimitive_Variables(CSolver **solver_container,
                                                const CConfig *config);
 
+  /*!
+   * \brief Compute the gradient and the limiter of the primitive variables in a single pass
+   *        (FUSED_GRADIENT_LIMITER), and the single precision limited gradient if requested.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] reconstruction - The gradient is the one used for upwind reconstruction.
+   * \param[in] computeLimiter - Compute the limiter, otherwise the current one is applied (frozen limiter).
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry *geometry, const CConfig *config,
+                                     bool reconstruction, bool computeLimiter);
+
   /*!
    * \brief Set gradients of coefficients for fixed CL mode
    * \param[in] config - Definition of the particular problem.
@@ -290,8 +305,10 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iMesh - Grid level.
    * \param[in] navier_stokes - True when the constructor is called by the derived class CNSSolver.
+   * \param[in] fineSolver - Solver of the finest grid level (for coarse levels), it shares the look-up table of LUT_GAS.
    */
-  CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh, const bool navier_stokes = false);
+  CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh, const bool navier_stokes = false,
+               const CEulerSolver* fineSolver = nullptr);
 
   /*!
    * \brief Destructor of the class.
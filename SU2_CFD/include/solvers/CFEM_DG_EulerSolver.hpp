@@ -44,6 +44,9 @@ protected:
   su2double Gamma_Minus_One; /*!< \brief Fluids's Gamma - 1.0  . */
 
   CFluidModel  *FluidModel; /*!< \brief fluid model used in the solver */
+  vector<CFluidModel*> FluidModelThreads; /*!< \brief Fluid models of the OpenMP threads. A fluid model stores its
+                                                       last computed state, hence every thread that processes the
+                                                       task list needs its own copy. Entry 0 is FluidModel. */
 
   su2double
   Mach_Inf,         /*!< \brief Mach number at infinity. */
@@ -270,6 +273,45 @@ private:
 
   CVariable* GetBaseClassPointerToNodes() final {return nullptr;}
 
+  /*!
+   * \brief Function, which creates the non-dimensional fluid model for the given configuration.
+   * \param[in] config - Definition of the particular problem.
+   * \return Pointer to the newly allocated fluid model.
+   */
+  CFluidModel* CreateFluidModelND(CConfig *config) const;
+
+  /*!
+   * \brief Function, which determines the range of volume elements a task works on,
+            if that task can be split into chunks of elements.
+   * \param[in]  task    - Task for which the element range must be determined.
+   * \param[out] elemBeg - Begin of the element range.
+   * \param[out] elemEnd - End of the element range.
+   * \return Whether or not the task can be split into chunks of elements.
+   */
+  bool TaskElementRange_DG(const CTaskDefinition &task,
+                           unsigned long         &elemBeg,
+                           unsigned long         &elemEnd) const;
+
+  /*!
+   * \brief Function, which carries out a single task of the task list.
+   * \param[in] task        - Task to be carried out.
+   * \param[in] elemBeg     - Begin of the element range for tasks that can be split.
+   * \param[in] elemEnd     - End of the element range for tasks that can be split.
+   * \param[in] waitForComm - Whether or not to wait for the completion of MPI communication.
+   * \param[in] numerics    - Description of the numerical method of the calling thread.
+   * \param[in] config      - Definition of the particular problem.
+   * \param[in] workArray   - Work array of the calling thread.
+   * \return False if the completion of a communication could not be carried out
+             yet, true otherwise.
+   */
+  bool ExecuteTask_DG(const CTaskDefinition &task,
+                      const unsigned long   elemBeg,
+                      const unsigned long   elemEnd,
+                      const bool            waitForComm,
+                      CNumerics             **numerics,
+                      CConfig               *config,
+                      su2double             *workArray);
+
 public:
 
   /*!
@@ -1249,6 +1291,14 @@ public:
 
 protected:
 
+  /*!
+   * \brief Get the fluid model to be used by the calling OpenMP thread.
+   * \return Pointer to the fluid model of the calling thread.
+   */
+  inline CFluidModel* GetFluidModelThread(void) const {
+    return FluidModelThreads.empty() ? FluidModel : FluidModelThreads[omp_get_thread_num()];
+  }
+
   /*!
    * \brief Routine that initiates the non-blocking communication between ranks
             for the givem time level.
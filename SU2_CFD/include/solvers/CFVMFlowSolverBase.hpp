@@ -190,6 +190,61 @@ class CFVMFlowSolverBase : public CSolver {
 
   CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for edge flux computation. */
 
+  /*--- Multirate explicit time integration, the points are grouped in levels whose time steps
+   * are powers of 2 of the smallest, and each level is advanced with its own step. The fluxes
+   * through the interfaces between levels are accumulated (integrated in time) on the finer
+   * side and applied to the coarser side when it is advanced, which keeps the scheme conservative. ---*/
+
+  unsigned short nTimeLevel = 1;         /*!< \brief Number of time levels (1 is the usual global time step). */
+  unsigned short ActiveTimeLevel = 0;    /*!< \brief Level currently being advanced. */
+  bool LastStageTimeLevel = true;        /*!< \brief If the current stage is the last of the active level step. */
+  vector<unsigned short> TimeLevel;      /*!< \brief Time level of each point. */
+  CSysVector<su2double> InterfaceResidual; /*!< \brief Time integral of the interface fluxes of coarser points. */
+  bool MultirateUpdated = false;         /*!< \brief If a stage advanced a level since the start of the global step. */
+  unsigned short UpdatedTimeLevel = 0;   /*!< \brief Level advanced by the last stage, its primitives are outdated. */
+  vector<unsigned long> MarkerTimeLevels; /*!< \brief Time levels of the points of each marker (bit flags). */
+
+  /*!
+   * \brief Whether the fluxes of an edge are computed, with multirate integration these are the edges
+   *        whose finest point belongs to the active time level, with active set iterations the edges
+   *        between two frozen points are skipped.
+   */
+  inline bool ActiveEdge(unsigned long iPoint, unsigned long jPoint) const {
+    return ((nTimeLevel == 1) || (min(TimeLevel[iPoint], TimeLevel[jPoint]) == ActiveTimeLevel)) &&
+           !(SkipFrozen && nodes->GetFrozen(iPoint) && nodes->GetFrozen(jPoint));
+  }
+
+  /*!
+   * \brief Whether the primitive variables of a point need to be recomputed, with multirate integration
+   *        only the solution of the level advanced by the previous stage has changed.
+   */
+  inline bool OutdatedPoint(unsigned long iPoint) const {
+    return !MultirateUpdated || (TimeLevel[iPoint] == UpdatedTimeLevel);
+  }
+
+  /*!
+   * \brief Whether the source terms of a point are needed, with multirate integration only the residual of
+   *        the active level is used, coarser points only keep the fluxes through the interface edges.
+   */
+  inline bool ActivePoint(unsigned long iPoint) const {
+    return (nTimeLevel == 1) || (TimeLevel[iPoint] == ActiveTimeLevel);
+  }
+
+  /*!
+   * \brief Group the points in time levels based on their local time step, such that neighbors differ by
+   *        at most one level, and set the time step of each point to that of its level.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetTimeLevels(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief At the last stage of a step, add the time integral of the edge fluxes of the coarser points
+   *        (the fluxes through the interface with the active level) to the interface residual.
+   * \note Must be called after the edge loops and before the other contributions to the residual.
+   */
+  void AccumulateInterfaceResidual();
+
   /*!
    * \brief The highest level in the variable hierarchy the DERIVED solver can safely use.
    */
@@ -243,8 +298,10 @@ class CFVMFlowSolverBase : public CSolver {
 
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] accumulate - Add to the residual instead of overwriting it (solvers with several edge loops).
    */
-  void SumEdgeFluxes(const CGeometry* geometry);
+  void SumEdgeFluxes(const CGeometry* geometry, bool accumulate = false);
 
   /*!
    * \brief Instantiate a SIMD numerics object.
@@ -484,7 +541,8 @@ class CFVMFlowSolverBase : public CSolver {
           Global_Delta_Time = config->GetDelta_UnstTime();
         }
         else {
-          Global_Delta_Time = Min_Delta_Time;
+          /*--- With multirate integration the global step is that of the coarsest level. ---*/
+          Global_Delta_Time = Min_Delta_Time * su2double(1ul << (nTimeLevel-1));
         }
         Max_Delta_Time = Global_Delta_Time;
 
@@ -497,9 +555,10 @@ class CFVMFlowSolverBase : public CSolver {
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
         nodes->SetLocalCFL(iPoint, config->GetUnst_CFL());
-        nodes->SetDelta_Time(iPoint, Global_Delta_Time);
+        if (nTimeLevel == 1) nodes->SetDelta_Time(iPoint, Global_Delta_Time);
       }
 
+      if (nTimeLevel > 1) SetTimeLevels(geometry, config);
     }
 
     /*--- Recompute the unsteady time step for the dual time strategy if the unsteady CFL is diferent from 0. ---*/
@@ -747,12 +806,24 @@ class CFVMFlowSolverBase : public CSolver {
       SU2_OMP(for schedule(static,omp_chunk_size) nowait)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
+        /*--- With multirate integration only the points of the active level are updated. ---*/
+        if ((nTimeLevel > 1) && (TimeLevel[iPoint] != ActiveTimeLevel)) continue;
+
         su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
         su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
         const su2double* Res_TruncError = nodes->GetResTruncError(iPoint);
         const su2double* Residual = LinSysRes.GetBlock(iPoint);
 
+        /*--- Add the fluxes through the interfaces with finer levels, integrated over the step. ---*/
+        su2double ResMultirate[MAXNVAR] = {0.0};
+        if (nTimeLevel > 1) {
+          for (unsigned short iVar = 0; iVar < nVar; iVar++)
+            ResMultirate[iVar] = Residual[iVar] + InterfaceResidual(iPoint,iVar) / nodes->GetDelta_Time(iPoint);
+          if (LastStageTimeLevel) InterfaceResidual.SetBlock_Zero(iPoint);
+          Residual = ResMultirate;
+        }
+
         preconditioner.compute(config, iPoint);
 
         for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -806,6 +877,16 @@ class CFVMFlowSolverBase : public CSolver {
       SU2_OMP_BARRIER
     }
 
+    /*--- With multirate integration the primitives of the advanced level are now outdated. ---*/
+
+    if (nTimeLevel > 1) {
+      SU2_OMP_MASTER
+      {
+        MultirateUpdated = true;
+        UpdatedTimeLevel = ActiveTimeLevel;
+      }
+    }
+
     /*--- MPI solution ---*/
 
     InitiateComms(geometry, config, SOLUTION);
@@ -851,13 +932,13 @@ class CFVMFlowSolverBase : public CSolver {
   template<class DiagonalPrecond>
   void PrepareImplicitIteration_impl(DiagonalPrecond& preconditioner, CGeometry *geometry, CConfig *config) {
 
-    const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
     /*--- Set shared residual variables to 0 and declare local ones for current thread to work on. ---*/
 
     SU2_OMP_MASTER
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-      SetRes_RMS(iVar, 0.0);
+      SetRes_RMS(iVar, SkipFrozen? ResFrozen_RMS[iVar] : 0.0);
       SetRes_Max(iVar, 0.0, 0);
     }
     SU2_OMP_BARRIER
@@ -896,6 +977,14 @@ class CFVMFlowSolverBase : public CSolver {
     SU2_OMP(for schedule(static,omp_chunk_size) nowait)
     for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
+      /*--- Frozen points (active set) are not updated, same schedule as above
+       *    so the diagonal of the point was modified by this thread. ---*/
+
+      if (SkipFrozen && nodes->GetFrozen(iPoint)) {
+        FreezePoint(iPoint);
+        continue;
+      }
+
       /*--- Multigrid contribution to residual. ---*/
 
       su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
@@ -932,6 +1021,9 @@ class CFVMFlowSolverBase : public CSolver {
     SU2_OMP_MASTER
     SetResidual_RMS(geometry, config);
     SU2_OMP_BARRIER
+
+    /*--- Full sweep, update the active set. ---*/
+    if (config->GetActiveSet() && !SkipFrozen) UpdateActiveSet(geometry, config, this);
   }
 
   /*!
@@ -1116,6 +1208,43 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void SetPrimitive_Limiter(CGeometry* geometry, const CConfig* config) final;
 
+  /*!
+   * \brief Get the number of time levels of multirate explicit integration.
+   */
+  inline unsigned short GetnTimeLevel() const final { return nTimeLevel; }
+
+  /*!
+   * \brief Set the time level advanced by the next stage of multirate explicit integration.
+   * \param[in] iLevel - Time level (0 is the finest).
+   * \param[in] lastStage - Whether the next stage is the last of the step.
+   */
+  inline void SetActiveTimeLevel(unsigned short iLevel, bool lastStage) final {
+    SU2_OMP_MASTER
+    {
+      ActiveTimeLevel = iLevel;
+      LastStageTimeLevel = lastStage;
+    }
+    SU2_OMP_BARRIER
+  }
+
+  /*!
+   * \brief Start a global step of multirate explicit integration, the next preprocessing covers all points.
+   */
+  inline void StartMultirateStep() final {
+    SU2_OMP_MASTER
+    MultirateUpdated = false;
+    SU2_OMP_BARRIER
+  }
+
+  /*!
+   * \brief Whether the boundary conditions of a marker are needed in the current stage of multirate integration.
+   * \param[in] iMarker - Marker index.
+   * \return True if the marker has points in the active time level (always for other time integrations).
+   */
+  inline bool ActiveMarker(unsigned short iMarker) const final {
+    return (nTimeLevel == 1) || ((MarkerTimeLevels[iMarker] >> ActiveTimeLevel) & 1ul);
+  }
+
   /*!
    * \brief Implementation of implicit Euler iteration.
    */
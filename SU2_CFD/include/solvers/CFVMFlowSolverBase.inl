@@ -114,6 +114,14 @@ void CFVMFlowSolverBase<V, R>::Allocate(const CConfig& config) {
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- Multirate explicit time integration. ---*/
+
+  if ((MGLevel == MESH_0) && (config.GetnLevels_Multirate() > 1)) {
+    nTimeLevel = config.GetnLevels_Multirate();
+    TimeLevel.resize(nPoint, 0);
+    InterfaceResidual.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+
   /*--- LinSysSol will always be init to 0. ---*/
   System.SetxIsZero(true);
 
@@ -1548,8 +1556,8 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
       Double mask;
       for (auto j = 0ul; j < Double::Size; ++j) {
         bool in = (k+j < color.size);
-        mask[j] = in;
         iEdge[j] = color.indices[k+j*in];
+        mask[j] = in && ActiveEdge(geometry->edges->GetNode(iEdge[j],0), geometry->edges->GetNode(iEdge[j],1));
       }
 
       if (ReducerStrategy) {
@@ -1566,18 +1574,26 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
       Jacobian.SetDiagonalAsColumnSum();
     }
   }
+
+  AccumulateInterfaceResidual();
 }
 
 template <class V, ENUM_REGIME R>
-void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
+void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry, bool accumulate) {
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
 
-    LinSysRes.SetBlock_Zero(iPoint);
+    if (!accumulate) LinSysRes.SetBlock_Zero(iPoint);
 
     for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
-      if (iPoint == geometry->edges->GetNode(iEdge,0))
+      const auto iNode = geometry->edges->GetNode(iEdge,0);
+      const auto jNode = geometry->edges->GetNode(iEdge,1);
+
+      /*--- The fluxes of inactive edges were not computed. ---*/
+      if (!ActiveEdge(iNode, jNode)) continue;
+
+      if (iPoint == iNode)
         LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
       else
         LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
@@ -1585,6 +1601,77 @@ void CFVMFlowSolverBase<V, R>::SumEdgeFluxes(const CGeometry* geometry) {
   }
 }
 
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetTimeLevels(CGeometry *geometry, const CConfig *config) {
+
+  /*--- Finest level whose step (2^level times the smallest) does not exceed the given step. ---*/
+  auto levelOf = [&](su2double dt) {
+    unsigned short level = 0;
+    while ((level+1 < nTimeLevel) && (dt >= Min_Delta_Time * su2double(2ul << level))) ++level;
+    return level;
+  };
+
+  /*--- Limit the level of each point by those of its neighbors plus one, each pass propagates
+   *    the limit one layer further, the time step is communicated to know the level of halos. ---*/
+
+  for (unsigned short iPass = 0; iPass < nTimeLevel; ++iPass) {
+
+    InitiateComms(geometry, config, DELTA_TIME);
+    CompleteComms(geometry, config, DELTA_TIME);
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+      auto level = levelOf(nodes->GetDelta_Time(iPoint));
+      for (auto jPoint : geometry->nodes->GetPoints(iPoint))
+        level = min<unsigned short>(level, levelOf(nodes->GetDelta_Time(jPoint))+1);
+      TimeLevel[iPoint] = level;
+    }
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint)
+      nodes->SetDelta_Time(iPoint, Min_Delta_Time * su2double(1ul << TimeLevel[iPoint]));
+  }
+
+  InitiateComms(geometry, config, DELTA_TIME);
+  CompleteComms(geometry, config, DELTA_TIME);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; ++iPoint)
+    TimeLevel[iPoint] = levelOf(nodes->GetDelta_Time(iPoint));
+
+  /*--- Levels present on each marker, to skip the boundary conditions of the other levels. ---*/
+
+  SU2_OMP_MASTER
+  {
+    MarkerTimeLevels.assign(config->GetnMarker_All(), 0);
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_All(); ++iMarker) {
+      for (unsigned long iVertex = 0; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        MarkerTimeLevels[iMarker] |= 1ul << TimeLevel[iPoint];
+      }
+    }
+  }
+  SU2_OMP_BARRIER
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::AccumulateInterfaceResidual() {
+
+  if ((nTimeLevel == 1) || !LastStageTimeLevel) return;
+
+  /*--- The final stage of the (low storage) RK schemes uses the full step, therefore the time integral
+   *    of the fluxes seen by the active level is its step times the residual of this stage. At this
+   *    point the residual of coarser points only contains fluxes of edges with the active level. ---*/
+
+  const su2double dt = Min_Delta_Time * su2double(1ul << ActiveTimeLevel);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; ++iPoint) {
+    if (TimeLevel[iPoint] > ActiveTimeLevel)
+      InterfaceResidual.AddBlock(iPoint, LinSysRes.GetBlock(iPoint), dt);
+  }
+}
+
 template <class V, ENUM_REGIME FlowRegime>
 void CFVMFlowSolverBase<V, FlowRegime>::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container,
                                                              CConfig *config, unsigned short iRKStep, unsigned short iMesh,
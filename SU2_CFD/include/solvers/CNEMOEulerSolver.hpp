@@ -59,7 +59,7 @@ protected:
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
-  CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> FluidModel;   /*!< \brief Fluid model used in the solver (one per thread). */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -85,6 +85,18 @@ protected:
    */
   inline void SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) { }
 
+  /*!
+   * \brief Integrate the chemical and vibrational relaxation sources in each point over its time step,
+   *        after the flow update (operator splitting, CHEMISTRY_INTEGRATION= POINT_IMPLICIT).
+   * \note Linearized implicit (point implicit) substeps, a step is rejected and reduced when the species
+   *       densities or the temperatures change too much, and doubled after each accepted step.
+   *       Only for time-accurate explicit simulations (checked by CConfig), steady and implicit simulations
+   *       use the coupled sources. The species densities are kept non-negative without changing the mixture density.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void IntegrateChemistry(CGeometry *geometry, CConfig *config);
+
 public:
 
   /*!
@@ -216,7 +228,7 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel;}
+  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel[omp_get_thread_num()]; }
 
   /*!
    * \brief Impose the far-field boundary condition using characteristics.
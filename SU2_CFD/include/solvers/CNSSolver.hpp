@@ -125,8 +125,10 @@ public:
    * \overload
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Grid level.
+   * \param[in] fineSolver - Solver of the finest grid level (for coarse levels).
    */
-  CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh);
+  CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh, const CEulerSolver* fineSolver = nullptr);
 
   /*!
    * \brief Destructor of the class.
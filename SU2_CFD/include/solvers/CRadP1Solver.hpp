@@ -256,4 +256,9 @@ public:
    */
   inline su2double GetTemperature_Inf(void) const { return Temperature_Inf; }
 
+  /*!
+   * \brief The P1 radiation solver supports OpenMP+MPI.
+   */
+  inline bool GetHasHybridParallel() const override { return true; }
+
 };
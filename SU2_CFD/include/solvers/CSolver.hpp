@@ -59,6 +59,16 @@
 
 using namespace std;
 
+/*!
+ * \brief Decision of the nonlinear solver about the stability of its last step, passed to the CFL adaptation.
+ */
+enum class CFL_ADAPT_SIGNAL {
+  NONE,      /*!< \brief No decision, the CFL adaptation uses the linear solver residual. */
+  INCREASE,  /*!< \brief The step was successful, the CFL may increase. */
+  HOLD,      /*!< \brief The step did not reduce the residual, the CFL is not increased. */
+  REDUCE     /*!< \brief The step was unstable, the CFL is reduced. */
+};
+
 class CSolver {
 protected:
   enum : size_t {OMP_MIN_SIZE = 32}; /*!< \brief Chunk size for small loops. */
@@ -69,6 +79,7 @@ protected:
   unsigned short MGLevel;        /*!< \brief Multigrid level of this solver object. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
   su2double ResLinSolver;        /*!< \brief Final linear solver residual. */
+  CFL_ADAPT_SIGNAL CFLSignal = CFL_ADAPT_SIGNAL::NONE; /*!< \brief Decision of the nonlinear solver for the CFL adaptation. */
   unsigned short NonLinRes_Counter;   /*!< \brief Number of elements of the nonlinear residual indicator series. */
   vector<su2double> NonLinRes_Series; /*!< \brief Vector holding the nonlinear residual indicator series. */
   su2double Old_Func,  /*!< \brief Old value of the nonlinear residual indicator. */
@@ -133,6 +144,37 @@ protected:
 
   bool dynamic_grid;       /*!< \brief Flag that determines whether the grid is dynamic (moving or deforming + grid velocities). */
 
+  bool SkipFrozen = false;         /*!< \brief If the frozen points (outside the active set) are skipped in this iteration. */
+  vector<su2double> ResFrozen_RMS; /*!< \brief Squared residuals of the frozen points, from the last full sweep. */
+
+  /*!
+   * \brief Freeze the equations of a point, identity rows in the Jacobian, zero residual and update.
+   * \param[in] iPoint - Point index.
+   */
+  inline void FreezePoint(unsigned long iPoint) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Jacobian.DeleteValsRowi(iPoint*nVar+iVar);
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
+  }
+
+  /*!
+   * \brief Update the active set after a full sweep, and store the residuals of the frozen points.
+   * \note Call after SetResidual_RMS, the points whose residuals are ACTIVE_SET_THRESHOLD orders of magnitude
+   *       below the RMS (for all variables) are frozen until the next full sweep. The flow solver sets the
+   *       active set, the turbulence solver (called after it) reactivates the points where it is not converged.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] flowSolver - Flow solver, whose nodes store the active set (may be this solver).
+   */
+  void UpdateActiveSet(const CGeometry *geometry, const CConfig *config, CSolver* flowSolver);
+
+  /*!
+   * \brief Store the squared residuals of the points that are frozen, from the current residual vector.
+   * \param[in] flowNodes - Nodes of the flow solver, where the active set is stored.
+   */
+  void SetFrozenResidual(const CVariable* flowNodes);
+
   vector<su2activematrix> VertexTraction;          /*- Temporary, this will be moved to a new postprocessing structure once in place -*/
   vector<su2activematrix> VertexTractionAdjoint;   /*- Also temporary -*/
 
@@ -291,12 +333,30 @@ public:
    */
   inline void SetResLinSolver(su2double val_reslinsolver) { ResLinSolver = val_reslinsolver; }
 
+  /*!
+   * \brief Set the decision of the nonlinear solver for the CFL adaptation, which then ignores the linear residual.
+   * \param[in] signal - Stability of the last nonlinear step.
+   */
+  inline void SetCFLAdaptSignal(CFL_ADAPT_SIGNAL signal) { CFLSignal = signal; }
+
   /*!
    * \brief Set the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
    */
   void SetResidual_RMS(CGeometry *geometry, CConfig *config);
 
+  /*!
+   * \brief Decide if the frozen points are skipped in the current iteration, all points are
+   *        computed every ACTIVE_SET_FREQUENCY iterations (full sweeps), and until the first sweep.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline void SetSkipFrozen(const CConfig *config) {
+    SU2_OMP_MASTER
+    SkipFrozen = config->GetActiveSet() && !ResFrozen_RMS.empty() &&
+                 (config->GetInnerIter() % config->GetActiveSet_Frequency() != 0);
+    SU2_OMP_BARRIER
+  }
+
   /*!
    * \brief Communicate the value of the max residual and RMS residual.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -338,6 +398,12 @@ public:
    */
   inline su2double GetResLinSolver(void) const { return ResLinSolver; }
 
+  /*!
+   * \brief Get the decision of the nonlinear solver for the CFL adaptation.
+   * \return Stability of the last nonlinear step.
+   */
+  inline CFL_ADAPT_SIGNAL GetCFLAdaptSignal(void) const { return CFLSignal; }
+
   /*!
    * \brief Get the value of the maximum delta time.
    * \return Value of the maximum delta time.
@@ -350,6 +416,31 @@ public:
    */
   inline su2double GetMin_Delta_Time(void) const { return Min_Delta_Time; }
 
+  /*!
+   * \brief Get the number of time levels of multirate explicit integration.
+   * \return 1 if the solver uses a global (or local) time step.
+   */
+  inline virtual unsigned short GetnTimeLevel() const { return 1; }
+
+  /*!
+   * \brief Set the time level advanced by the next stage of multirate explicit integration.
+   * \param[in] iLevel - Time level (0 is the finest).
+   * \param[in] lastStage - Whether the next stage is the last of the step.
+   */
+  inline virtual void SetActiveTimeLevel(unsigned short iLevel, bool lastStage) {}
+
+  /*!
+   * \brief Start a global step of multirate explicit integration, the next preprocessing covers all points.
+   */
+  inline virtual void StartMultirateStep() {}
+
+  /*!
+   * \brief Whether the boundary conditions of a marker are needed in the current stage of multirate integration.
+   * \param[in] iMarker - Marker index.
+   * \return True if the marker has points in the active time level (always for other time integrations).
+   */
+  inline virtual bool ActiveMarker(unsigned short iMarker) const { return true; }
+
   /*!
    * \brief Get the value of the maximum local CFL number.
    * \return Value of the maximum local CFL number.
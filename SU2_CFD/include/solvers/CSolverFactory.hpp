@@ -140,9 +140,11 @@ private:
    * \param[in] geometry       - The geometry definition
    * \param[in] config         - The configuration
    * \param[in] iMGLevel       - The multigrid level
+   * \param[in] fineFlowSolver - The flow solver of the finest level (for coarse levels)
    * \return                   - A pointer to the allocated flow solver
    */
-  static CSolver* CreateFlowSolver(SUB_SOLVER_TYPE kindFlowSolver, CSolver **solver, CGeometry *geometry, CConfig *config, int iMGLevel);
+  static CSolver* CreateFlowSolver(SUB_SOLVER_TYPE kindFlowSolver, CSolver **solver, CGeometry *geometry, CConfig *config, int iMGLevel,
+                                   const CSolver* fineFlowSolver = nullptr);
 
   /*!
    * \brief Generic routine to create a solver
@@ -151,9 +153,11 @@ private:
    * \param[in] geometry      - The geometry definition
    * \param[in] config        - The configuration
    * \param[in] iMGLevel      - The multigrid level
+   * \param[in] fineFlowSolver - The flow solver of the finest level (for coarse levels)
    * \return                  - A pointer to the allocated solver
    */
-  static CSolver* CreateSubSolver(SUB_SOLVER_TYPE kindSolver, CSolver **solver, CGeometry *geometry, CConfig *config, int iMGLevel);
+  static CSolver* CreateSubSolver(SUB_SOLVER_TYPE kindSolver, CSolver **solver, CGeometry *geometry, CConfig *config, int iMGLevel,
+                                  const CSolver* fineFlowSolver = nullptr);
 
 public:
 
@@ -169,9 +173,11 @@ public:
    * \param[in] config        - The configuration
    * \param[in] geometry      - The geometry definition
    * \param[in] iMGLevel      - The multigrid level
+   * \param[in] fineFlowSolver - The flow solver of the finest level, coarse levels share some of its data (e.g. tables)
    * \return                  - Pointer to the allocated solver array
    */
-  static CSolver** CreateSolverContainer(ENUM_MAIN_SOLVER kindSolver, CConfig *config, CGeometry *geometry, int iMGLevel);
+  static CSolver** CreateSolverContainer(ENUM_MAIN_SOLVER kindSolver, CConfig *config, CGeometry *geometry, int iMGLevel,
+                                         const CSolver* fineFlowSolver = nullptr);
 
 
   /*!
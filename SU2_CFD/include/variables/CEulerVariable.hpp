@@ -51,6 +51,7 @@ protected:
   CVectorOfMatrix& Gradient_Reconstruction; /*!< \brief Reference to the gradient of the primitive variables for MUSCL reconstruction for the convective term */
   CVectorOfMatrix Gradient_Aux;             /*!< \brief Auxiliary structure to store a second gradient for reconstruction, if required. */
   MatrixType Limiter_Primitive;            /*!< \brief Limiter of the primitive variables (T, vx, vy, vz, P, rho). */
+  su2matrix<float> Limited_Gradient_SP;    /*!< \brief Limited reconstruction gradient in single precision (MUSCL_SINGLE_PRECISION, fine grid only). */
 
   /*--- Secondary variable definition ---*/
   MatrixType Secondary;        /*!< \brief Secondary variables (dPdrho_e, dPde_rho, dTdrho_e, dTde_rho, dmudrho_T, dmudT_rho, dktdrho_T, dktdT_rho) in compressible (Euler: 2, NS: 8) flows. */
@@ -209,6 +210,17 @@ public:
    */
   inline su2double **GetGradient_Reconstruction(unsigned long iPoint) final { return Gradient_Reconstruction[iPoint]; }
 
+  /*!
+   * \brief Get the single precision limited reconstruction gradients (nPrimVarGrad x nDim per point).
+   */
+  inline su2matrix<float>& GetLimited_Gradient_SP() { return Limited_Gradient_SP; }
+
+  /*!
+   * \brief Get the single precision limited reconstruction gradient at a node, variable-major.
+   * \param[in] iPoint - Index of the current node.
+   */
+  inline const float *GetLimited_Gradient_SP(unsigned long iPoint) const { return Limited_Gradient_SP[iPoint]; }
+
   /*!
    * \brief A virtual member.
    */
@@ -251,6 +263,19 @@ public:
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set all the primitive variables from a thermodynamic state computed beforehand (e.g. in batches).
+   * \note The velocity must be up to date (SetVelocity), it is used to compute the static energy of the state.
+   * \param[in] iPoint - Point index.
+   * \param[in] pressure - Pressure.
+   * \param[in] soundSpeed2 - Square of the speed of sound.
+   * \param[in] temperature - Temperature.
+   * \param[in] FluidModel - Fluid model, used to recompute the state if the given one is not physical.
+   * \return False if the state is not physical, in which case the old solution is restored.
+   */
+  bool SetPrimVar(unsigned long iPoint, su2double pressure, su2double soundSpeed2,
+                  su2double temperature, CFluidModel *FluidModel);
+
   /*!
    * \brief A virtual member.
    */
@@ -342,6 +342,17 @@ public:
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) final;
 
+  /*!
+   * \brief Set all the primitive variables from a thermodynamic state computed beforehand (e.g. in batches).
+   * \param[in] iPoint - Point index.
+   * \param[in] density - Density at the temperature of the solution.
+   * \param[in] cp - Specific heat at constant pressure.
+   * \param[in] cv - Specific heat at constant volume.
+   * \param[in] FluidModel - Fluid model, used to recompute the state if the given one is not physical.
+   * \return False if the state is not physical, in which case the old solution is restored.
+   */
+  bool SetPrimVar(unsigned long iPoint, su2double density, su2double cp, su2double cv, CFluidModel *FluidModel);
+
   /*!
    * \brief Set the specific heat Cp.
    */
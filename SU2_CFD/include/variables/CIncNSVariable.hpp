@@ -105,6 +105,21 @@ public:
   bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) override;
   using CVariable::SetPrimVar;
 
+  /*!
+   * \brief Set all the primitive variables from a thermodynamic state computed beforehand (e.g. in batches).
+   * \note The transport properties are evaluated by the fluid model for the density, temperature,
+   *       and Cp of the point (see CFluidModel::SetTransportState).
+   * \param[in] iPoint - Point index.
+   * \param[in] eddy_visc - Eddy viscosity.
+   * \param[in] density - Density at the temperature of the solution.
+   * \param[in] cp - Specific heat at constant pressure.
+   * \param[in] cv - Specific heat at constant volume.
+   * \param[in] FluidModel - Fluid model, used to recompute the state if the given one is not physical.
+   * \return False if the state is not physical, in which case the old solution is restored.
+   */
+  bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double density, su2double cp, su2double cv,
+                  CFluidModel *FluidModel);
+
   /*!
    * \brief Set the DES Length Scale.
    */
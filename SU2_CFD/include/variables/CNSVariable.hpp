@@ -155,6 +155,23 @@ public:
   bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) override;
   using CVariable::SetPrimVar;
 
+  /*!
+   * \brief Set all the primitive variables from a thermodynamic state computed beforehand (e.g. in batches).
+   * \note The velocity must be up to date (SetVelocity). The transport properties are evaluated by the
+   *       fluid model for the density, temperature, and Cp of the point (see CFluidModel::SetTransportState).
+   * \param[in] iPoint - Point index.
+   * \param[in] eddy_visc - Eddy viscosity.
+   * \param[in] turb_ke - Turbulent kinetic energy.
+   * \param[in] pressure - Pressure.
+   * \param[in] soundSpeed2 - Square of the speed of sound.
+   * \param[in] temperature - Temperature.
+   * \param[in] cp - Specific heat at constant pressure.
+   * \param[in] FluidModel - Fluid model, used to recompute the state if the given one is not physical.
+   * \return False if the state is not physical, in which case the old solution is restored.
+   */
+  bool SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, su2double pressure,
+                  su2double soundSpeed2, su2double temperature, su2double cp, CFluidModel *FluidModel);
+
   /*!
    * \brief Set all the secondary variables (partial derivatives) for compressible flows
    */
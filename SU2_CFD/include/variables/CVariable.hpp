@@ -63,6 +63,8 @@ protected:
   Non_Physical_Counter;          /*!< \brief Number of consecutive iterations that a point has been treated first-order.
                                   After a specified number of successful reconstructions, the point can be returned to second-order. */
 
+  su2vector<bool> Frozen;        /*!< \brief Points outside the active set (converged), only allocated if used. */
+
   VectorType UnderRelaxation;  /*!< \brief Value of the under-relxation parameter local to the control volume. */
   VectorType LocalCFL;         /*!< \brief Value of the CFL number local to the control volume. */
 
@@ -109,6 +111,14 @@ protected:
 
   /*--- Only allow default construction by derived classes. ---*/
   CVariable() = default;
+
+  /*!
+   * \brief Allocate the R matrices of the least-squares gradients, they are only needed with
+   *        periodic boundaries or AD, otherwise the matrices of the geometry are used.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void AllocateRmatrix(const CConfig *config);
+
 public:
   /*--- Disable copy and assignment. ---*/
   CVariable(const CVariable&) = delete;
@@ -192,6 +202,20 @@ public:
    */
   inline bool GetNon_Physical(unsigned long iPoint) { return Non_Physical(iPoint); }
 
+  /*!
+   * \brief Set whether a point is frozen, i.e. outside the active set.
+   * \param[in] iPoint - Point index.
+   * \param[in] value - True if frozen.
+   */
+  inline void SetFrozen(unsigned long iPoint, bool value) { Frozen(iPoint) = value; }
+
+  /*!
+   * \brief Get whether a point is frozen, i.e. outside the active set.
+   * \param[in] iPoint - Point index.
+   * \return True if frozen.
+   */
+  inline bool GetFrozen(unsigned long iPoint) const { return Frozen(iPoint); }
+
   /*!
    * \brief Get the solution.
    * \param[in] iPoint - Point index.
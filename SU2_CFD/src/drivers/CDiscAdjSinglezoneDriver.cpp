@@ -33,6 +33,39 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 #include "../../include/iteration/CTurboIteration.hpp"
 #include "../../../Common/include/toolboxes/CQuasiNewtonInvLeastSquares.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+
+using Scalar = CDiscAdjSinglezoneDriver::Scalar;
+
+namespace {
+
+class CKrylovAdjointProduct final : public CMatrixVectorProduct<Scalar> {
+  CDiscAdjSinglezoneDriver* driver;
+public:
+  CKrylovAdjointProduct(CDiscAdjSinglezoneDriver* d) : driver(d) {}
+
+  /*!
+   * \brief Operator for the product operation.
+   */
+  inline void operator()(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const override {
+    driver->KrylovAdjointProduct(u, v);
+  }
+};
+
+class CKrylovAdjointPreconditioner final : public CPreconditioner<Scalar> {
+  const CDiscAdjSinglezoneDriver* driver;
+public:
+  CKrylovAdjointPreconditioner(const CDiscAdjSinglezoneDriver* d) : driver(d) {}
+
+  /*!
+   * \brief Operator for the preconditioning operation.
+   */
+  inline void operator()(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const override {
+    driver->KrylovAdjointPreconditioner(u, v);
+  }
+};
+}
 
 CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
                                                    unsigned short val_nZone,
@@ -119,17 +152,25 @@ CDiscAdjSinglezoneDriver::CDiscAdjSinglezoneDriver(char* confFile,
 
  direct_output->PreprocessHistoryOutput(config, false);
 
+  /*--- Residual-based adjoint, the tape holds only R(U,X) and the adjoint is solved with a Krylov method. ---*/
+
+  KrylovAdjoint = config->GetDiscAdj_Residual_Krylov();
+  if (KrylovAdjoint) SetupKrylovAdjoint();
+
 }
 
 CDiscAdjSinglezoneDriver::~CDiscAdjSinglezoneDriver(void) {
 
   delete direct_iteration;
   delete direct_output;
+  delete AdjPreconditioner;
 
 }
 
 void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Driver::Preprocess");
+
   config_container[ZONE_0]->SetTimeIter(TimeIter);
 
   /*--- NOTE: Inv Design Routines moved to CDiscAdjFluidIteration::Preprocess ---*/
@@ -154,6 +195,13 @@ void CDiscAdjSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CDiscAdjSinglezoneDriver::Run() {
 
+  SU2_PROFILE_SCOPE("Driver::Run");
+
+  if (KrylovAdjoint) {
+    RunKrylov();
+    return;
+  }
+
   const bool steady = !config->GetTime_Domain();
 
   CQuasiNewtonInvLeastSquares<passivedouble> fixPtCorrector;
@@ -222,6 +270,8 @@ void CDiscAdjSinglezoneDriver::Run() {
 
 void CDiscAdjSinglezoneDriver::Postprocess() {
 
+  SU2_PROFILE_SCOPE("Driver::Postprocess");
+
   switch(config->GetKind_Solver())
   {
     case DISC_ADJ_EULER :     case DISC_ADJ_NAVIER_STOKES :     case DISC_ADJ_RANS :
@@ -273,9 +323,10 @@ void CDiscAdjSinglezoneDriver::SetRecording(unsigned short kind_recording){
   iteration->SetDependencies(solver_container, geometry_container, numerics_container, config_container, ZONE_0,
                              INST_0, kind_recording);
 
-  /*--- Do one iteration of the direct solver ---*/
+  /*--- Do one iteration of the direct solver, or only evaluate its residual ---*/
 
-  DirectRun(kind_recording);
+  if (KrylovAdjoint) DirectResidual(kind_recording);
+  else DirectRun(kind_recording);
 
   // NOTE: The inverse design calls were moved to DirectRun() - postprocess
 
@@ -285,7 +336,12 @@ void CDiscAdjSinglezoneDriver::SetRecording(unsigned short kind_recording){
 
   /*--- Register Output of the iteration ---*/
 
-  iteration->RegisterOutput(solver_container, geometry_container, config_container, output_container[ZONE_0], ZONE_0, INST_0);
+  if (KrylovAdjoint) {
+    if (kind_recording != NONE) RegisterResidualOutput();
+  }
+  else {
+    iteration->RegisterOutput(solver_container, geometry_container, config_container, output_container[ZONE_0], ZONE_0, INST_0);
+  }
 
   /*--- Extract the objective function and store it --- */
 
@@ -532,11 +588,17 @@ void CDiscAdjSinglezoneDriver::Print_DirectResidual(unsigned short kind_recordin
 
 void CDiscAdjSinglezoneDriver::MainRecording(){
 
+  SU2_PROFILE_SCOPE("Driver::MainRecording");
+
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
    *    as argument ensures that all information from a previous recording is removed. ---*/
 
   SetRecording(NONE);
 
+  /*--- The passive evaluation above also computed the primal Jacobian, which preconditions the Krylov adjoint. ---*/
+
+  if (KrylovAdjoint) PrepareKrylovPreconditioner();
+
   /*--- Store the computational graph of one direct iteration with the conservative variables as input. ---*/
 
   SetRecording(MainVariables);
@@ -545,6 +607,8 @@ void CDiscAdjSinglezoneDriver::MainRecording(){
 
 void CDiscAdjSinglezoneDriver::SecondaryRecording(){
 
+  SU2_PROFILE_SCOPE("Driver::SecondaryRecording");
+
   /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
    *    as argument ensures that all information from a previous recording is removed. ---*/
 
@@ -555,9 +619,20 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   SetRecording(SecondaryVariables);
 
   /*--- Initialize the adjoint of the output variables of the iteration with the adjoint solution
-   *    of the current iteration. The values are passed to the AD tool. ---*/
+   *    of the current iteration. The values are passed to the AD tool. In the residual-based mode
+   *    the residuals are seeded instead, i.e. dJ/dX = J_X + psi^T R_X. ---*/
+
+  if (KrylovAdjoint) {
+    auto adjNodes = solver[MainSolver]->GetNodes();
+    for (auto iPoint = 0ul; iPoint < AdjSolution.GetNBlk(); ++iPoint)
+      for (auto iVar = 0ul; iVar < AdjSolution.GetNVar(); ++iVar)
+        AdjSolution(iPoint,iVar) = SU2_TYPE::GetValue(adjNodes->GetSolution(iPoint,iVar));
 
-  iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+    SetResidualAdjoint(AdjSolution);
+  }
+  else {
+    iteration->InitializeAdjoint(solver_container, geometry_container, config_container, ZONE_0, INST_0);
+  }
 
   /*--- Initialize the adjoint of the objective function with 1.0. ---*/
 
@@ -581,3 +656,330 @@ void CDiscAdjSinglezoneDriver::SecondaryRecording(){
   AD::ClearAdjoints();
 
 }
+
+void CDiscAdjSinglezoneDriver::SetupKrylovAdjoint() {
+
+  /*--- Only the residual of the flow solver is recorded, other coupled equations (or unsteady
+   *    terms) would have to be added to the adjoint system explicitly. ---*/
+
+  switch (config->GetKind_Solver()) {
+    case DISC_ADJ_EULER: case DISC_ADJ_NAVIER_STOKES: case DISC_ADJ_RANS:
+    case DISC_ADJ_INC_EULER: case DISC_ADJ_INC_NAVIER_STOKES: case DISC_ADJ_INC_RANS:
+      break;
+    default:
+      SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV is only available for the finite volume flow solvers.", CURRENT_FUNCTION);
+      break;
+  }
+
+  if (config->GetTime_Domain())
+    SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV is only available for steady problems.", CURRENT_FUNCTION);
+
+  if ((config->GetKind_Turb_Model() != NONE) && !config->GetFrozen_Visc_Disc())
+    SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV requires FROZEN_VISC_DISC= YES for RANS problems.", CURRENT_FUNCTION);
+
+  if (config->GetWeakly_Coupled_Heat() || config->AddRadiation() || config->GetBoolTurbomachinery())
+    SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV does not support coupled heat, radiation, or turbomachinery.", CURRENT_FUNCTION);
+
+  if (config->GetDeform_Mesh() || (config->GetnMarker_Periodic() > 0))
+    SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV does not support mesh deformation or periodic boundaries.", CURRENT_FUNCTION);
+
+  if (config->GetKind_TimeIntScheme_Flow() != EULER_IMPLICIT)
+    SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV requires TIME_DISCRE_FLOW= EULER_IMPLICIT (for the preconditioner).", CURRENT_FUNCTION);
+
+  switch (config->GetKind_DiscAdj_Linear_Solver()) {
+    case FGMRES: case RESTARTED_FGMRES: case BCGSTAB:
+      break;
+    default:
+      SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV requires DISCADJ_LIN_SOLVER= FGMRES or BCGSTAB.", CURRENT_FUNCTION);
+      break;
+  }
+
+  const auto nVar = solver[FLOW_SOL]->GetnVar();
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  AdjSolution.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  AdjResidual.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  AdjUpdate.Initialize(nPoint, nPointDomain, nVar, 0.0);
+
+  ResidualIndex.resize(nPointDomain*nVar, 0);
+  DirichletRow.resize(nPointDomain*nVar, false);
+  PseudoTimeDiag.resize(nPointDomain, 0.0);
+
+  AdjLinSolver.SetxIsZero(true);
+
+  /*--- The transpose of the primal Jacobian approximates the adjoint system. ---*/
+
+  auto& Jacobian = solver[FLOW_SOL]->Jacobian;
+
+  switch (config->GetKind_DiscAdj_Linear_Prec()) {
+    case JACOBI:
+      AdjPreconditioner = new CJacobiPreconditioner<MixedScalar>(Jacobian, geometry, config, true);
+      break;
+    case ILU:
+      AdjPreconditioner = new CILUPreconditioner<MixedScalar>(Jacobian, geometry, config, true);
+      break;
+    case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
+      AdjPreconditioner = new CPastixPreconditioner<MixedScalar>(Jacobian, geometry, config,
+                                                                 config->GetKind_DiscAdj_Linear_Prec(), true);
+      break;
+    default:
+      SU2_MPI::Error("DISCADJ_RESIDUAL_KRYLOV requires DISCADJ_LIN_PREC= JACOBI, ILU, or PASTIX_*.", CURRENT_FUNCTION);
+      break;
+  }
+
+  PrecondIn.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  PrecondOut.Initialize(nPoint, nPointDomain, nVar, nullptr);
+
+}
+
+void CDiscAdjSinglezoneDriver::PrepareKrylovPreconditioner() {
+
+  auto flowSolver = solver[FLOW_SOL];
+  auto flowNodes = flowSolver->GetNodes();
+
+  /*--- Add the pseudo-time term to the Jacobian, the same term is added to the matrix-free
+   *    products to make the adjoint iterations a pseudo-transient continuation. ---*/
+
+  flowSolver->SetTime_Step(geometry, solver, config, MESH_0, config->GetTimeIter());
+
+  flowSolver->PrepareImplicitIteration(geometry, solver, config);
+
+  for (auto iPoint = 0ul; iPoint < PseudoTimeDiag.size(); ++iPoint) {
+    const su2double dt = flowNodes->GetDelta_Time(iPoint);
+    const su2double vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
+    PseudoTimeDiag[iPoint] = (dt > 0.0)? SU2_TYPE::GetValue(vol / dt) : 0.0;
+  }
+
+  AdjPreconditioner->Build();
+
+}
+
+void CDiscAdjSinglezoneDriver::DirectResidual(unsigned short kind_recording) {
+
+  switch (config->GetKind_Solver()) {
+    case DISC_ADJ_EULER: case DISC_ADJ_INC_EULER:
+      config->SetGlobalParam(EULER, RUNTIME_FLOW_SYS);
+      break;
+    case DISC_ADJ_NAVIER_STOKES: case DISC_ADJ_INC_NAVIER_STOKES:
+      config->SetGlobalParam(NAVIER_STOKES, RUNTIME_FLOW_SYS);
+      break;
+    default:
+      config->SetGlobalParam(RANS, RUNTIME_FLOW_SYS);
+      break;
+  }
+
+  /*--- The Jacobian is not needed on the tape (it is computed in the passive evaluation),
+   *    forcing an explicit evaluation avoids recording its computation. ---*/
+
+  if (kind_recording != NONE) config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+
+  integration[FLOW_SOL]->ComputeResidual(geometry, solver, numerics[FLOW_SOL], config, RUNTIME_FLOW_SYS);
+
+  config->SetKind_TimeIntScheme(config->GetKind_TimeIntScheme_Flow());
+
+  /*--- Forces consistent with the current solution, for the objective function. ---*/
+
+  solver[FLOW_SOL]->Pressure_Forces(geometry, config);
+  solver[FLOW_SOL]->Momentum_Forces(geometry, config);
+  solver[FLOW_SOL]->Friction_Forces(geometry, config);
+
+  /*--- The solver only computes the residual norms when it updates the solution, compute them
+   *    from the residual just evaluated, otherwise those of the last primal iteration are printed. ---*/
+
+  if (kind_recording == MainVariables) {
+    auto flowSolver = solver[FLOW_SOL];
+    const auto nVar = flowSolver->GetnVar();
+
+    for (auto iVar = 0u; iVar < nVar; iVar++) {
+      flowSolver->SetRes_RMS(iVar, 0.0);
+      flowSolver->SetRes_Max(iVar, 0.0, 0);
+    }
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        const su2double residual = fabs(SU2_TYPE::GetValue(flowSolver->LinSysRes(iPoint,iVar)));
+        flowSolver->AddRes_RMS(iVar, residual*residual);
+        flowSolver->AddRes_Max(iVar, residual, geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+      }
+    }
+    flowSolver->SetResidual_RMS(geometry, config);
+  }
+
+  /*--- Print the direct residual (of the evaluation just recorded) to screen ---*/
+
+  Print_DirectResidual(kind_recording);
+
+}
+
+void CDiscAdjSinglezoneDriver::RegisterResidualOutput() {
+
+  auto& residual = solver[FLOW_SOL]->LinSysRes;
+
+  for (auto i = 0ul; i < ResidualIndex.size(); ++i) {
+
+    /*--- Rows imposed strongly were set to a constant, they are not on the tape. ---*/
+
+    int index = 0;
+    AD::SetIndex(index, residual[i]);
+    if (index != 0) {
+      AD::RegisterOutput(residual[i]);
+      AD::SetIndex(index, residual[i]);
+    }
+    ResidualIndex[i] = index;
+
+    if (RecordingState == MainVariables) DirichletRow[i] = (index == 0);
+  }
+
+}
+
+void CDiscAdjSinglezoneDriver::SetResidualAdjoint(const CSysVector<Scalar>& seed) {
+
+  for (auto i = 0ul; i < ResidualIndex.size(); ++i)
+    if (ResidualIndex[i] != 0) AD::SetDerivative(ResidualIndex[i], SU2_TYPE::GetValue(seed[i]));
+
+}
+
+void CDiscAdjSinglezoneDriver::EvaluateResidualAdjoint(const CSysVector<Scalar>& seed,
+                                                       CSysVector<Scalar>& adjoint, bool objective) {
+
+  SetResidualAdjoint(seed);
+
+  if (objective) SetAdj_ObjFunction();
+
+  AD::ComputeAdjoint();
+
+  /*--- The solution of the halo points is registered as input, i.e. their adjoints are contributions
+   *    to the adjoints of the owners, which are added to them by the transposed halo communication. ---*/
+
+  auto flowNodes = solver[FLOW_SOL]->GetNodes();
+  vector<su2double> adjSolution(adjoint.GetNVar());
+
+  for (auto iPoint = 0ul; iPoint < adjoint.GetNBlk(); ++iPoint) {
+    flowNodes->GetAdjointSolution(iPoint, adjSolution.data());
+    for (auto iVar = 0ul; iVar < adjoint.GetNVar(); ++iVar)
+      adjoint(iPoint,iVar) = SU2_TYPE::GetValue(adjSolution[iVar]);
+  }
+
+  CSysMatrixComms::Initiate(adjoint, geometry, config, SOLUTION_MATRIXTRANS);
+  CSysMatrixComms::Complete(adjoint, geometry, config, SOLUTION_MATRIXTRANS);
+
+  if (objective) solver[MainSolver]->ExtractAdjoint_Variables(geometry, config);
+
+  AD::ClearAdjoints();
+
+}
+
+void CDiscAdjSinglezoneDriver::KrylovAdjointProduct(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) {
+
+  EvaluateResidualAdjoint(u, v, false);
+
+  const auto nVar = v.GetNVar();
+
+  for (auto iPoint = 0ul; iPoint < v.GetNBlkDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      const auto i = iPoint*nVar + iVar;
+      v[i] += (DirichletRow[i]? Scalar(1.0) : PseudoTimeDiag[iPoint]) * u[i];
+    }
+  }
+
+}
+
+void CDiscAdjSinglezoneDriver::KrylovAdjointPreconditioner(const CSysVector<Scalar>& u, CSysVector<Scalar>& v) const {
+
+  for (auto i = 0ul; i < u.GetLocSize(); ++i) PrecondIn[i] = u[i];
+
+  (*AdjPreconditioner)(PrecondIn, PrecondOut);
+
+  for (auto i = 0ul; i < u.GetLocSize(); ++i) v[i] = PrecondOut[i];
+
+}
+
+void CDiscAdjSinglezoneDriver::ComputeKrylovAdjointResidual() {
+
+  auto adjSolver = solver[MainSolver];
+  auto adjNodes = adjSolver->GetNodes();
+  const auto nVar = AdjSolution.GetNVar();
+
+  for (auto iPoint = 0ul; iPoint < AdjSolution.GetNBlk(); ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      AdjSolution(iPoint,iVar) = SU2_TYPE::GetValue(adjNodes->GetSolution(iPoint,iVar));
+
+  /*--- r = dR/dU^T psi + dJ/dU^T, this also gives the sensitivities to the other registered variables. ---*/
+
+  EvaluateResidualAdjoint(AdjSolution, AdjResidual, true);
+
+  for (auto iVar = 0u; iVar < nVar; iVar++) {
+    adjSolver->SetRes_RMS(iVar, 0.0);
+    adjSolver->SetRes_Max(iVar, 0.0, 0);
+  }
+
+  for (auto iPoint = 0ul; iPoint < AdjResidual.GetNBlkDomain(); ++iPoint) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      const auto i = iPoint*nVar + iVar;
+      if (DirichletRow[i]) AdjResidual[i] += AdjSolution[i];
+
+      const su2double residual = fabs(AdjResidual[i]);
+      adjSolver->AddRes_RMS(iVar, residual*residual);
+      adjSolver->AddRes_Max(iVar, residual, geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+    }
+  }
+
+  adjSolver->SetResidual_RMS(geometry, config);
+
+}
+
+void CDiscAdjSinglezoneDriver::RunKrylov() {
+
+  const bool bcgstab = (config->GetKind_DiscAdj_Linear_Solver() == BCGSTAB);
+  const auto maxIter = config->GetLinear_Solver_Iter();
+  auto adjSolver = solver[MainSolver];
+  auto adjNodes = adjSolver->GetNodes();
+  const auto nVar = AdjUpdate.GetNVar();
+
+  for (auto Adjoint_Iter = 0ul; Adjoint_Iter < nAdjoint_Iter; Adjoint_Iter++) {
+
+    config->SetInnerIter(Adjoint_Iter);
+
+    /*--- Evaluate the adjoint residual for the current adjoint solution. ---*/
+
+    ComputeKrylovAdjointResidual();
+
+    /*--- Monitor the pseudo-time ---*/
+
+    StopCalc = iteration->Monitor(output_container[ZONE_0], integration_container, geometry_container,
+                                  solver_container, numerics_container, config_container,
+                                  surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+    iteration->Output(output_container[ZONE_0], geometry_container, solver_container,
+                      config_container, Adjoint_Iter, false, ZONE_0, INST_0);
+
+    if (StopCalc) break;
+
+    /*--- Pseudo-time Newton step, (dR/dU + V/dt)^T dPsi = -r. ---*/
+
+    for (auto i = 0ul; i < AdjResidual.GetNElmDomain(); ++i) AdjResidual[i] = -AdjResidual[i];
+
+    Scalar eps = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
+    unsigned long iter = 0;
+
+    if (bcgstab) {
+      iter = AdjLinSolver.BCGSTAB_LinSolver(AdjResidual, AdjUpdate, CKrylovAdjointProduct(this),
+                                            CKrylovAdjointPreconditioner(this), eps, maxIter, eps, false, config);
+    }
+    else {
+      iter = AdjLinSolver.FGMRES_LinSolver(AdjResidual, AdjUpdate, CKrylovAdjointProduct(this),
+                                           CKrylovAdjointPreconditioner(this), eps, maxIter, eps, false, config);
+    }
+
+    for (auto iPoint = 0ul; iPoint < AdjUpdate.GetNBlkDomain(); ++iPoint)
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        adjNodes->AddSolution(iPoint, iVar, AdjUpdate(iPoint,iVar));
+
+    adjSolver->InitiateComms(geometry, config, SOLUTION);
+    adjSolver->CompleteComms(geometry, config, SOLUTION);
+
+    adjSolver->SetIterLinSolver(iter);
+    adjSolver->SetResLinSolver(eps);
+  }
+
+}
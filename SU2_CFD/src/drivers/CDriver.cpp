@@ -88,6 +88,7 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 #include <cassert>
 
@@ -125,6 +126,15 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Input_Preprocessing(config_container, driver_config);
 
+  /*--- Start the profiler (if requested) as soon as the options are known. ---*/
+
+  if (config_container[ZONE_0]->GetWrt_Profiling())
+    CProfiler::Enable(config_container[ZONE_0]->GetWrt_Profiling_Trace());
+
+  /*--- Distribute the ranks over the zones if these are iterated concurrently. ---*/
+
+  ZoneRanks_Preprocessing();
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -134,6 +144,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
 
   Output_Preprocessing(config_container, driver_config, output_container, driver_output);
 
+  /*--- With concurrent zones, the zones are preprocessed by the group of ranks of this rank,
+   *    which builds its own zone and dummy geometries and solvers for the other zones. ---*/
+
+  if (concurrentZones) SU2_MPI::SetComm(zoneComm);
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -168,17 +182,32 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
        identified and linked, face areas and volumes of the dual mesh cells are
        computed, and the multigrid levels are created using an agglomeration procedure. ---*/
 
-      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run);
+      Geometrical_Preprocessing(config_container[iZone], geometry_container[iZone][iInst], dry_run || !ZoneOnRank(iZone));
 
     }
   }
 
   /*--- Before we proceed with the zone loop we have to compute the wall distances.
-     * This computation depends on all zones at once. ---*/
-  if (rank == MASTER_NODE)
-    cout << "Computing wall distances." << endl;
+     * This computation depends on all zones at once (with concurrent zones, only on
+     * the zone of each group of ranks). Hence, it is only cached for single zone problems,
+     * and only if the solver uses it (otherwise the distances are not computed). ---*/
 
-  CGeometry::ComputeWallDistance(config_container, geometry_container);
+  const bool cacheWallDistance = (nZone == 1) && geometryCache[ZONE_0] &&
+                                 CGeometry::WallDistanceNeeded(config_container[ZONE_0]);
+  bool wallDistanceLoaded = cacheWallDistance;
+
+  for (iInst = 0; wallDistanceLoaded && (iInst < nInst[ZONE_0]); iInst++)
+    wallDistanceLoaded = geometryCache[ZONE_0]->LoadWallDistance(geometry_container[ZONE_0][iInst][MESH_0]);
+
+  if (!wallDistanceLoaded) {
+    if (rank == MASTER_NODE)
+      cout << "Computing wall distances." << endl;
+
+    CGeometry::ComputeWallDistance(config_container, geometry_container);
+
+    if (cacheWallDistance)
+      geometryCache[ZONE_0]->SaveWallDistance(geometry_container[ZONE_0][INST_0][MESH_0]);
+  }
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -236,6 +265,10 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
     CGeometry::ComputeWallDistance(config_container, geometry_container);
   }
 
+  /*--- The interfaces connect different groups of ranks, they are defined over all the ranks. ---*/
+
+  if (concurrentZones) SU2_MPI::SetComm(globalComm);
+
 
   /*--- Definition of the interface and transfer conditions between different zones.
    *--- The transfer container is defined for zones paired one to one.
@@ -288,10 +321,16 @@ CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunica
   Mpoints            = 0.0;
   MpointsDomain      = 0.0;
   for (iZone = 0; iZone < nZone; iZone++) {
-    Mpoints       +=(su2double)geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint()/(1.0e6);
-    MpointsDomain +=(su2double)geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
-    MDOFs         += (su2double)DOFsPerPoint*(su2double)geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint()/(1.0e6);
-    MDOFsDomain   += (su2double)DOFsPerPoint*(su2double)geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()/(1.0e6);
+    unsigned long nPointZone[] = {geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPoint(),
+                                  geometry_container[iZone][INST_0][MESH_0]->GetGlobal_nPointDomain()};
+    /*--- With concurrent zones the sizes are only known by the ranks of the zone. ---*/
+    if (concurrentZones)
+      SU2_MPI::Bcast(nPointZone, 2, MPI_UNSIGNED_LONG, zoneRankOffset[iZone], globalComm);
+
+    Mpoints       +=(su2double)nPointZone[0]/(1.0e6);
+    MpointsDomain +=(su2double)nPointZone[1]/(1.0e6);
+    MDOFs         += (su2double)DOFsPerPoint*(su2double)nPointZone[0]/(1.0e6);
+    MDOFsDomain   += (su2double)DOFsPerPoint*(su2double)nPointZone[1]/(1.0e6);
   }
 
   /*--- Reset timer for compute/output performance benchmarking. ---*/
@@ -344,6 +383,7 @@ void CDriver::SetContainers_Null(){
   grid_movement                  = new CVolumetricMovement**[nZone];
   FFDBox                         = new CFreeFormDefBox**[nZone];
   interpolator_container.resize(nZone);
+  geometryCache.resize(nZone);
   interface_container            = new CInterface**[nZone];
   interface_types                = new unsigned short*[nZone];
   output_container               = new COutput*[nZone];
@@ -436,9 +476,13 @@ void CDriver::Postprocessing() {
   if (interface_container != nullptr) {
     for (iZone = 0; iZone < nZone; iZone++) {
       if (interface_container[iZone] != nullptr) {
-        for (unsigned short jZone = 0; jZone < nZone; jZone++)
-          if (interface_container[iZone][jZone] != nullptr)
+        for (unsigned short jZone = 0; jZone < nZone; jZone++) {
+          if (interface_container[iZone][jZone] != nullptr) {
+            /*--- Releasing the plans is collective, all ranks visit the interfaces in the same order. ---*/
+            interface_container[iZone][jZone]->ResetTransferPlan();
             delete interface_container[iZone][jZone];
+          }
+        }
         delete [] interface_container[iZone];
       }
     }
@@ -496,6 +540,14 @@ void CDriver::Postprocessing() {
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
 
+  if (CProfiler::IsEnabled()) {
+    CProfiler::Disable();
+    CProfiler::WriteSummary(config_container[ZONE_0]->GetProfiling_FileName());
+    CProfiler::WriteChromeTrace(config_container[ZONE_0]->GetProfiling_FileName());
+  }
+
+  if (concurrentZones) SU2_MPI::Comm_free(&zoneComm);
+
   /*--- Deallocate config container ---*/
   if (config_container!= nullptr) {
     for (iZone = 0; iZone < nZone; iZone++) {
@@ -636,8 +688,114 @@ void CDriver::Input_Preprocessing(CConfig **&config, CConfig *&driver_config) {
   fsi = config_container[ZONE_0]->GetFSI_Simulation();
 }
 
+vector<int> CDriver::DistributeZoneRanks(const vector<passivedouble>& weights, int nRank) {
+
+  const int nZone = weights.size();
+  vector<int> nRankZone(nZone, 1);
+
+  /*--- Greedy assignment, each additional rank goes to the zone with the highest cost per rank,
+   *    which minimizes the cost of the slowest zone (ties go to the lower zone index). ---*/
+
+  for (int iRank = nZone; iRank < nRank; ++iRank) {
+    int maxZone = 0;
+    for (int iZone = 1; iZone < nZone; ++iZone) {
+      if (weights[iZone]*nRankZone[maxZone] > weights[maxZone]*nRankZone[iZone]) maxZone = iZone;
+    }
+    ++nRankZone[maxZone];
+  }
+
+  vector<int> offset(nZone+1, 0);
+  for (int iZone = 0; iZone < nZone; ++iZone) offset[iZone+1] = offset[iZone] + nRankZone[iZone];
+
+  return offset;
+}
+
+void CDriver::ZoneRanks_Preprocessing() {
+
+  globalComm = zoneComm = SU2_MPI::GetComm();
+  concurrentZones = driver_config->GetConcurrent_Zones();
+
+  if (!concurrentZones) return;
+
+  /*--- Check that the problem can be iterated concurrently. The zones must only exchange
+   *    data through the interfaces (block Jacobi) and the meshes cannot move, as the mesh
+   *    deformation and the wall distance are computed per group of ranks. ---*/
+
+  if (!driver_config->GetMultizone_Problem() || (nZone < 2))
+    SU2_MPI::Error("CONCURRENT_ZONES requires a multizone problem.", CURRENT_FUNCTION);
+
+  if (driver_config->GetKind_MZSolver() != MZ_BLOCK_JACOBI)
+    SU2_MPI::Error("CONCURRENT_ZONES requires MULTIZONE_SOLVER= BLOCK_JACOBI.", CURRENT_FUNCTION);
+
+  if (size < nZone)
+    SU2_MPI::Error("CONCURRENT_ZONES requires at least one rank per zone.", CURRENT_FUNCTION);
+
+  if (fem_solver || fsi || driver_config->GetDiscrete_Adjoint())
+    SU2_MPI::Error("CONCURRENT_ZONES is not available for FEM, FSI, or discrete adjoint problems.", CURRENT_FUNCTION);
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    const auto config = config_container[iZone];
+    if (config->GetGrid_Movement() || config->GetDeform_Mesh() ||
+        config->GetSurface_Movement(AEROELASTIC) || config->GetSurface_Movement(AEROELASTIC_RIGID_MOTION) ||
+        config->GetSurface_Movement(DEFORMING) || config->GetSurface_Movement(EXTERNAL) ||
+        config->GetSurface_Movement(EXTERNAL_ROTATION))
+      SU2_MPI::Error("CONCURRENT_ZONES is not available with mesh motion or deformation.", CURRENT_FUNCTION);
+
+    if (config->GetBoolTurbomachinery() || (config->GetnTimeInstances() > 1))
+      SU2_MPI::Error("CONCURRENT_ZONES is not available for turbomachinery or harmonic balance problems.", CURRENT_FUNCTION);
+  }
+
+  /*--- The cost of each zone is given by the user or estimated by its number of elements. ---*/
+
+  vector<passivedouble> weights(nZone, 1.0);
+
+  if (driver_config->GetnZone_Rank_Weights() > 0) {
+    if (driver_config->GetnZone_Rank_Weights() != nZone)
+      SU2_MPI::Error("ZONE_RANK_WEIGHTS must have one value per zone.", CURRENT_FUNCTION);
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      weights[iZone] = SU2_TYPE::GetValue(driver_config->GetZone_Rank_Weight(iZone));
+      if (weights[iZone] <= 0.0)
+        SU2_MPI::Error("ZONE_RANK_WEIGHTS must be positive.", CURRENT_FUNCTION);
+    }
+  }
+  else {
+    vector<unsigned long> nElem(nZone, 0);
+
+    if (rank == MASTER_NODE) {
+      for (iZone = 0; iZone < nZone; iZone++)
+        nElem[iZone] = CConfig::GetnElem(config_container[iZone]->GetMesh_FileName(),
+                                         config_container[iZone]->GetMesh_FileFormat(), iZone);
+    }
+    SU2_MPI::Bcast(nElem.data(), nZone, MPI_UNSIGNED_LONG, MASTER_NODE, globalComm);
+
+    /*--- Equal weights if the size of some zone is not known (e.g. analytic meshes). ---*/
+
+    if (find(nElem.begin(), nElem.end(), 0ul) == nElem.end()) {
+      for (iZone = 0; iZone < nZone; iZone++) weights[iZone] = nElem[iZone];
+    }
+  }
+
+  zoneRankOffset = DistributeZoneRanks(weights, size);
+
+  rankZone = upper_bound(zoneRankOffset.begin(), zoneRankOffset.end(), rank) - zoneRankOffset.begin() - 1;
+
+  SU2_MPI::Comm_split(globalComm, rankZone, rank, &zoneComm);
+
+  if (rank == MASTER_NODE) {
+    cout << endl << "Concurrent zones, distribution of the ranks:" << endl;
+    for (iZone = 0; iZone < nZone; iZone++) {
+      cout << "  Zone " << iZone << ": ranks " << zoneRankOffset[iZone] << " to "
+           << zoneRankOffset[iZone+1]-1 << " (weight " << weights[iZone] << ")." << endl;
+    }
+  }
+
+}
+
 void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry, bool dummy){
 
+  SU2_PROFILE_SCOPE("Driver::Geometrical_Preprocessing");
+
   if (!dummy){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Geometry Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
@@ -691,16 +849,25 @@ void CDriver::Geometrical_Preprocessing(CConfig* config, CGeometry **&geometry,
        or rotation is taken into account. ---*/
 
   if ((config->GetnMarker_Periodic() != 0) && !fem_solver) {
+    auto& cache = geometryCache[config->GetiZone()];
+
     for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
 
+      /*--- The matching of the fine grid points (all pairs of vertices) can be stored
+           in the geometry cache, the coarse grids are matched from the fine grid. ---*/
+
+      const bool cached = (iMesh == MESH_0) && cache && cache->LoadPeriodic(geometry[MESH_0], config);
+
       /*--- Note that we loop over pairs of periodic markers individually
            so that repeated nodes on adjacent periodic faces are properly
            accounted for in multiple places. ---*/
 
-      for (unsigned short iPeriodic = 1; iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
+      for (unsigned short iPeriodic = 1; !cached && iPeriodic <= config->GetnMarker_Periodic()/2; iPeriodic++) {
         geometry[iMesh]->MatchPeriodic(config, iPeriodic);
       }
 
+      if (!cached && (iMesh == MESH_0) && cache) cache->SavePeriodic(geometry[MESH_0], config);
+
       /*--- For Streamwise Periodic flow, find a unique reference node on the dedicated inlet marker. ---*/
       if (config->GetKind_Streamwise_Periodic() != NONE)
         geometry[iMesh]->FindUniqueNode_PeriodicBound(config);
@@ -741,6 +908,10 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   unsigned short requestedMGlevels = config->GetnMGLevels();
   const bool fea = config->GetStructuralProblem();
 
+  /*--- Wall time breakdown of the preprocessing. ---*/
+
+  CStageTimer timer;
+
   /*--- Definition of the geometry class to store the primal grid in the partitioning process.
    *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
@@ -750,9 +921,17 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   nDim = geometry_aux->GetnDim();
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  /*--- Color the initial grid and set the send-receive domains (ParMETIS),
+   *    unless the partitioning of this mesh is in the geometry cache. ---*/
 
-  geometry_aux->SetColorGrid_Parallel(config);
+  auto& cache = geometryCache[iZone];
+  if (config->GetGeometry_Cache() && !cache)
+    cache.reset(new CGeometryCache(config, geometry_aux));
+
+  if (!cache || !cache->LoadPartition(geometry_aux)) {
+    geometry_aux->SetColorGrid_Parallel(config);
+    if (cache) cache->SavePartition(geometry_aux);
+  }
 
   /*--- Allocate the memory of the current domain, and divide the grid
      between the ranks. ---*/
@@ -766,32 +945,38 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
   /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
 
   delete geometry_aux;
+  timer.Stage("Reading and partitioning");
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetSendReceive(config);
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetBoundaries(config);
+  timer.Stage("Send/receive markers");
 
   /*--- Compute elements surrounding points, points surrounding points ---*/
 
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
+  timer.Stage("Point connectivity");
 
   /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
 
   if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
   geometry[MESH_0]->SetRCM_Ordering(config);
+  timer.Stage("RCM ordering");
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
   if (rank == MASTER_NODE) cout << "Recomputing point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
+  timer.Stage("Point connectivity");
 
   /*--- Compute elements surrounding elements ---*/
 
   if (rank == MASTER_NODE) cout << "Setting element connectivity." << endl;
   geometry[MESH_0]->SetElement_Connectivity();
+  timer.Stage("Element connectivity");
 
   /*--- Check the orientation before computing geometrical quantities ---*/
 
@@ -801,12 +986,15 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[MESH_0]->Check_IntElem_Orientation(config);
     geometry[MESH_0]->Check_BoundElem_Orientation(config);
   }
+  timer.Stage("Orientation checks");
 
   /*--- Create the edge structure ---*/
 
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
+  timer.Stage("Edges");
   geometry[MESH_0]->SetVertex(config);
+  timer.Stage("Vertices");
 
   /*--- Create the control volume structures ---*/
 
@@ -815,6 +1003,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[MESH_0]->SetControlVolume(config, ALLOCATE);
     geometry[MESH_0]->SetBoundControlVolume(config, ALLOCATE);
   }
+  timer.Stage("Control volumes");
 
   /*--- Visualize a dual control volume if requested ---*/
 
@@ -841,6 +1030,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
   if (rank == MASTER_NODE) cout << "Checking for periodicity." << endl;
   geometry[MESH_0]->Check_Periodicity(config);
+  timer.Stage("Neighbors, curvature and periodicity");
 
   /*--- Compute mesh quality statistics on the fine grid. ---*/
 
@@ -849,6 +1039,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
       cout << "Computing mesh quality statistics for the dual control volumes." << endl;
     geometry[MESH_0]->ComputeMeshQualityStatistics(config);
   }
+  timer.Stage("Mesh quality");
 
   geometry[MESH_0]->SetMGLevel(MESH_0);
   if ((config->GetnMGLevels() != 0) && (rank == MASTER_NODE))
@@ -861,6 +1052,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     /*--- Create main agglomeration structure ---*/
 
     geometry[iMGlevel] = new CMultiGridGeometry(geometry, config, iMGlevel);
+    timer.Stage("Multigrid agglomeration");
 
     /*--- Compute points surrounding points. ---*/
 
@@ -873,9 +1065,11 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
 
     /*--- Create the control volume structures ---*/
 
-    geometry[iMGlevel]->SetControlVolume(config, geometry[iMGlevel-1], ALLOCATE);
-    geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGlevel-1], ALLOCATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGlevel-1]);
+    SU2_OMP_PARALLEL {
+      geometry[iMGlevel]->SetControlVolume(config, geometry[iMGlevel-1], ALLOCATE);
+      geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGlevel-1], ALLOCATE);
+      geometry[iMGlevel]->SetCoord(geometry[iMGlevel-1]);
+    }
 
     /*--- Find closest neighbor to a surface point ---*/
 
@@ -884,6 +1078,7 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     /*--- Store our multigrid index. ---*/
 
     geometry[iMGlevel]->SetMGLevel(iMGlevel);
+    timer.Stage("Multigrid dual grid");
 
     /*--- Protect against the situation that we were not able to complete
        the agglomeration for this level, i.e., there weren't enough points.
@@ -936,6 +1131,9 @@ void CDriver::Geometrical_Preprocessing_FVM(CConfig *config, CGeometry **&geomet
     geometry[iMGlevel]->InitiateComms(geometry[iMGlevel], config, NEIGHBORS);
     geometry[iMGlevel]->CompleteComms(geometry[iMGlevel], config, NEIGHBORS);
   }
+  timer.Stage("Communication structures");
+
+  timer.WriteSummary("Geometry preprocessing");
 
 }
 
@@ -1033,6 +1231,8 @@ void CDriver::Geometrical_Preprocessing_DGFEM(CConfig* config, CGeometry **&geom
 
 void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolver ***&solver) {
 
+  SU2_PROFILE_SCOPE("Driver::Solver_Preprocessing");
+
   ENUM_MAIN_SOLVER kindSolver = static_cast<ENUM_MAIN_SOLVER>(config->GetKind_Solver());
 
   if (rank == MASTER_NODE)
@@ -1040,8 +1240,11 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
 
   solver = new CSolver**[config->GetnMGLevels()+1];
 
+  /*--- The coarse levels share some data of the finest one (e.g. the look-up table of LUT_GAS). ---*/
+
   for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++){
-    solver[iMesh] = CSolverFactory::CreateSolverContainer(kindSolver, config, geometry[iMesh], iMesh);
+    const CSolver* fineFlowSolver = (iMesh != MESH_0)? solver[MESH_0][FLOW_SOL] : nullptr;
+    solver[iMesh] = CSolverFactory::CreateSolverContainer(kindSolver, config, geometry[iMesh], iMesh, fineFlowSolver);
   }
 
   /*--- Count the number of DOFs per solution point. ---*/
@@ -1057,11 +1260,16 @@ void CDriver::Solver_Preprocessing(CConfig* config, CGeometry** geometry, CSolve
   bool update_geo = true;
   if (config->GetFSI_Simulation()) update_geo = false;
 
-  Solver_Restart(solver, geometry, config, update_geo);
+  /*--- The solutions of zones computed by other ranks (concurrent zones) are not loaded. ---*/
 
-  /*--- Set up any necessary inlet profiles ---*/
+  if (ZoneOnRank(config->GetiZone())) {
 
-  Inlet_Preprocessing(solver, geometry, config);
+    Solver_Restart(solver, geometry, config, update_geo);
+
+    /*--- Set up any necessary inlet profiles ---*/
+
+    Inlet_Preprocessing(solver, geometry, config);
+  }
 
 }
 
@@ -2168,13 +2376,13 @@ void CDriver::Numerics_Preprocessing(CConfig *config, CGeometry **geometry, CSol
 
   if (config->AddRadiation()) {
     /*--- Definition of the viscous scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][VISC_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
 
     /*--- Definition of the source term integration scheme for each equation and mesh level ---*/
-    numerics[MESH_0][RAD_SOL][SOURCE_FIRST_TERM] = new CSourceP1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][source_first_term] = new CSourceP1(nDim, nVar_Rad, config);
 
     /*--- Definition of the boundary condition method ---*/
-    numerics[MESH_0][RAD_SOL][VISC_BOUND_TERM] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
+    numerics[MESH_0][RAD_SOL][visc_bound_term] = new CAvgGradCorrected_P1(nDim, nVar_Rad, config);
   }
 
   /*--- Solver definition for the flow adjoint problem ---*/
@@ -2726,6 +2934,10 @@ void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COu
    surface comma-separated value, and convergence history files (both in serial
    and in parallel). ---*/
 
+  /*--- With concurrent zones, the output of each zone belongs to the group of ranks of the zone. ---*/
+
+  if (concurrentZones) SU2_MPI::SetComm(zoneComm);
+
   for (iZone = 0; iZone < nZone; iZone++){
 
     if (rank == MASTER_NODE)
@@ -2736,12 +2948,14 @@ void CDriver::Output_Preprocessing(CConfig **config, CConfig *driver_config, COu
     output[iZone] = COutputFactory::CreateOutput(kindSolver, config[iZone], nDim);
 
     /*--- If dry-run is used, do not open/overwrite history file. ---*/
-    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run);
+    output[iZone]->PreprocessHistoryOutput(config[iZone], !dry_run && ZoneOnRank(iZone));
 
     output[iZone]->PreprocessVolumeOutput(config[iZone]);
 
   }
 
+  if (concurrentZones) SU2_MPI::SetComm(globalComm);
+
   if (driver_config->GetMultizone_Problem()){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Output Preprocessing ( Multizone ) ------------------" << endl;
@@ -3017,8 +3231,11 @@ void CFluidDriver::Run() {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr)
-        interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr) {
+          interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != nullptr)
+            interface_container[iZone][jZone]->ResetTransferPlan();
+        }
     }
   }
 
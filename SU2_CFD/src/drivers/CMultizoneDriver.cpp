@@ -180,6 +180,11 @@ void CMultizoneDriver::StartSolver() {
   if (driver_config->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = driver_config->GetRestart_Iter();
 
+  /*--- With concurrent zones each group of ranks runs its zone, the data of the other zones
+   *    is only exchanged through the interfaces and the history output (over all ranks). ---*/
+
+  if (concurrentZones) SU2_MPI::SetComm(zoneComm);
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < driver_config->GetnTime_Iter() ) {
 
@@ -215,10 +220,14 @@ void CMultizoneDriver::StartSolver() {
 
   }
 
+  if (concurrentZones) SU2_MPI::SetComm(globalComm);
+
 }
 
 void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Driver::Preprocess");
+
   bool unsteady = driver_config->GetTime_Domain();
 
 
@@ -256,7 +265,7 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
     /*--- Set the initial condition for EULER/N-S/RANS ---------------------------------------------*/
     /*--- For FSI, this is set after the mesh has been moved. --------------------------------------*/
-    if (!fsi && !config_container[iZone]->GetDiscrete_Adjoint() && config_container[iZone]->GetFluidProblem()) {
+    if (!fsi && !config_container[iZone]->GetDiscrete_Adjoint() && config_container[iZone]->GetFluidProblem() && ZoneOnRank(iZone)) {
       solver_container[iZone][INST_0][MESH_0][FLOW_SOL]->SetInitialCondition(geometry_container[iZone][INST_0],
                                                                              solver_container[iZone][INST_0],
                                                                              config_container[iZone], TimeIter);
@@ -267,7 +276,7 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
   /*--- Run a predictor step ---*/
   for (iZone = 0; iZone < nZone; iZone++) {
-    if (config_container[iZone]->GetPredictor())
+    if (config_container[iZone]->GetPredictor() && ZoneOnRank(iZone))
       iteration_container[iZone][INST_0]->Predictor(output_container[iZone], integration_container, geometry_container,
                                                     solver_container, numerics_container, config_container, surface_movement,
                                                     grid_movement, FFDBox, iZone, INST_0);
@@ -281,8 +290,11 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (unsigned short jZone = 0; jZone < nZone; jZone++){
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone])
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone]) {
           interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          if (interface_container[iZone][jZone] != nullptr)
+            interface_container[iZone][jZone]->ResetTransferPlan();
+        }
       }
     }
   }
@@ -291,6 +303,8 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CMultizoneDriver::Run_GaussSeidel() {
 
+  SU2_PROFILE_SCOPE("Driver::Run");
+
   unsigned long iOuter_Iter;
   unsigned short jZone, UpdateMesh;
   bool DeformMesh = false;
@@ -343,6 +357,8 @@ void CMultizoneDriver::Run_GaussSeidel() {
 
 void CMultizoneDriver::Run_Jacobi() {
 
+  SU2_PROFILE_SCOPE("Driver::Run");
+
   unsigned long iOuter_Iter;
   unsigned short jZone, UpdateMesh;
   bool DeformMesh = false;
@@ -376,9 +392,11 @@ void CMultizoneDriver::Run_Jacobi() {
 
     }
 
-      /*--- Loop over the number of zones (IZONE) ---*/
+      /*--- Loop over the number of zones (IZONE), with concurrent zones only the zone of this rank ---*/
     for (iZone = 0; iZone < nZone; iZone++){
 
+      if (!ZoneOnRank(iZone)) continue;
+
       /*--- Set the OuterIter ---*/
       config_container[iZone]->SetOuterIter(iOuter_Iter);
       config_container[iZone]->Set_StartTime(SU2_MPI::Wtime());
@@ -416,6 +434,8 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
+    if (!ZoneOnRank(iZone)) continue;
+
     /*--- Account for all the solvers in this zone. ---*/
 
     auto solvers = solver_container[iZone][INST_0][MESH_0];
@@ -431,6 +451,14 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
   }
 
+  /*--- With concurrent zones, the first rank of each group shares the history of its zone,
+   *    the convergence of the multizone problem is then evaluated identically by all ranks. ---*/
+
+  if (concurrentZones) {
+    for (iZone = 0; iZone < nZone; iZone++)
+      output_container[iZone]->BroadcastHistoryOutput(zoneRankOffset[iZone], globalComm);
+  }
+
   /*--- Print out the convergence data to screen and history file. ---*/
 
   driver_output->SetMultizoneHistory_Output(output_container, config_container, driver_config,
@@ -442,6 +470,8 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
 
 void CMultizoneDriver::Update() {
 
+  SU2_PROFILE_SCOPE("Driver::Update");
+
   /*--- For enabling a consistent restart, we need to update the mesh with the interface information that introduces displacements --*/
   /*--- Loop over the number of zones (IZONE) ---*/
   for (iZone = 0; iZone < nZone; iZone++){
@@ -458,6 +488,8 @@ void CMultizoneDriver::Update() {
     /*--- If a mesh update is required due to the transfer of data ---*/
     if (UpdateMesh > 0) DynamicMeshUpdate(iZone, TimeIter);
 
+    if (!ZoneOnRank(iZone)) continue;
+
     iteration_container[iZone][INST_0]->Update(output_container[iZone], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, iZone, INST_0);
@@ -474,6 +506,8 @@ void CMultizoneDriver::Update() {
 
 void CMultizoneDriver::Output(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Driver::Output");
+
   /*--- Time the output for performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
@@ -485,6 +519,7 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
   bool wrote_files = false;
 
   for (iZone = 0; iZone < nZone; iZone++){
+    if (!ZoneOnRank(iZone)) continue;
     wrote_files = output_container[iZone]->SetResult_Files(geometry_container[iZone][INST_0][MESH_0],
                                                             config_container[iZone],
                                                             solver_container[iZone][INST_0][MESH_0], TimeIter, StopCalc);
@@ -107,6 +107,8 @@ void CSinglezoneDriver::StartSolver() {
 
 void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Driver::Preprocess");
+
   /*--- Set runtime option ---*/
 
   Runtime_Options();
@@ -148,6 +150,8 @@ void CSinglezoneDriver::Preprocess(unsigned long TimeIter) {
 
 void CSinglezoneDriver::Run() {
 
+  SU2_PROFILE_SCOPE("Driver::Run");
+
   unsigned long OuterIter = 0;
   config_container[ZONE_0]->SetOuterIter(OuterIter);
 
@@ -159,6 +163,8 @@ void CSinglezoneDriver::Run() {
 
 void CSinglezoneDriver::Postprocess() {
 
+  SU2_PROFILE_SCOPE("Driver::Postprocess");
+
     iteration_container[ZONE_0][INST_0]->Postprocess(output_container[ZONE_0], integration_container, geometry_container, solver_container,
         numerics_container, config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
 
@@ -172,6 +178,8 @@ void CSinglezoneDriver::Postprocess() {
 
 void CSinglezoneDriver::Update() {
 
+  SU2_PROFILE_SCOPE("Driver::Update");
+
   iteration_container[ZONE_0][INST_0]->Update(output_container[ZONE_0], integration_container, geometry_container,
         solver_container, numerics_container, config_container,
         surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
@@ -180,6 +188,8 @@ void CSinglezoneDriver::Update() {
 
 void CSinglezoneDriver::Output(unsigned long TimeIter) {
 
+  SU2_PROFILE_SCOPE("Driver::Output");
+
   /*--- Time the output for performance benchmarking. ---*/
 
   StopTime = SU2_MPI::Wtime();
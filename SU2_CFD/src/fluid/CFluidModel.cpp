@@ -89,3 +89,13 @@ void CFluidModel::SetThermalConductivityModel(const CConfig* config) {
       break;
   }
 }
+
+unsigned long CFluidModel::ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                               const CFluidStateBatch& state) const {
+  SU2_MPI::Error("The fluid model does not have a batched (rho, e) evaluation.", CURRENT_FUNCTION);
+  return 0;
+}
+
+void CFluidModel::ComputeTDState_T(unsigned long n, const su2double* T, const CFluidStateBatch& state) const {
+  SU2_MPI::Error("The fluid model does not have a batched temperature evaluation.", CURRENT_FUNCTION);
+}
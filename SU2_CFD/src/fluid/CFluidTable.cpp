@@ -0,0 +1,318 @@
+/*!
+ * \file CFluidTable.cpp
+ * \brief Source of the table of thermodynamic properties.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/fluid/CFluidTable.hpp"
+#include "../../include/fluid/CFluidModel.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+CFluidTable::CFluidTable(CFluidModel& model, su2double rhoMin, su2double rhoMax, su2double TMin, su2double TMax,
+                         unsigned long nRho, unsigned long nE) {
+
+  if (!(rhoMin > 0.0 && rhoMax > rhoMin && TMin > 0.0 && TMax > TMin))
+    SU2_MPI::Error("Invalid density or temperature range for the look-up table.", CURRENT_FUNCTION);
+
+  /*--- Energy range spanned by the temperature range over the density range. ---*/
+
+  passivedouble eMin = numeric_limits<passivedouble>::max();
+  passivedouble eMax = numeric_limits<passivedouble>::lowest();
+
+  for (auto iRho = 0ul; iRho < nRho; ++iRho) {
+    const su2double rho = rhoMin * pow(rhoMax/rhoMin, passivedouble(iRho) / max(nRho-1, 1ul));
+    model.SetTDState_rhoT(rho, TMin);
+    eMin = min(eMin, SU2_TYPE::GetValue(model.GetStaticEnergy()));
+    model.SetTDState_rhoT(rho, TMax);
+    eMax = max(eMax, SU2_TYPE::GetValue(model.GetStaticEnergy()));
+  }
+
+  SetAxes(nRho, SU2_TYPE::GetValue(rhoMin), SU2_TYPE::GetValue(rhoMax), nE, eMin, eMax);
+  values.resize(nDensity*nEnergy*NVAR);
+
+  /*--- Sample the model. ---*/
+
+  for (auto iRho = 0ul; iRho < nDensity; ++iRho) {
+    const su2double rho = exp(logRhoMin + iRho*dLogRho);
+
+    for (auto iE = 0ul; iE < nEnergy; ++iE) {
+      model.SetTDState_rhoe(rho, energyMin + iE*dEnergy);
+
+      auto node = &values[(iRho*nEnergy + iE)*NVAR];
+      node[PRESSURE] = SU2_TYPE::GetValue(model.GetPressure());
+      node[TEMPERATURE] = SU2_TYPE::GetValue(model.GetTemperature());
+      node[SOUND_SPEED2] = SU2_TYPE::GetValue(model.GetSoundSpeed2());
+      node[ENTROPY] = SU2_TYPE::GetValue(model.GetEntropy());
+      node[DPDRHO_E] = SU2_TYPE::GetValue(model.GetdPdrho_e());
+      node[DPDE_RHO] = SU2_TYPE::GetValue(model.GetdPde_rho());
+      node[DTDRHO_E] = SU2_TYPE::GetValue(model.GetdTdrho_e());
+      node[DTDE_RHO] = SU2_TYPE::GetValue(model.GetdTde_rho());
+      node[CP] = SU2_TYPE::GetValue(model.GetCp());
+      node[CV] = SU2_TYPE::GetValue(model.GetCv());
+    }
+  }
+
+  CheckValues();
+}
+
+CFluidTable::CFluidTable(const string& fileName) {
+
+  ifstream file(fileName);
+  if (!file.is_open())
+    SU2_MPI::Error("Could not open the look-up table file " + fileName, CURRENT_FUNCTION);
+
+  /*--- Skip the header and read the rows (density, energy, NVAR values). ---*/
+
+  string line;
+  getline(file, line);
+
+  vector<passivedouble> rho, e;
+
+  while (getline(file, line)) {
+    if (line.find_first_not_of(" \t\r") == string::npos) continue;
+    replace(line.begin(), line.end(), ',', ' ');
+    istringstream row(line);
+
+    passivedouble val[NVAR+2];
+    for (auto& v : val) row >> v;
+    if (row.fail())
+      SU2_MPI::Error("Wrong number of columns in the look-up table file " + fileName, CURRENT_FUNCTION);
+
+    rho.push_back(val[0]);
+    e.push_back(val[1]);
+    values.insert(values.end(), val+2, val+2+NVAR);
+  }
+
+  /*--- Infer the size of the table, the energy runs fastest. ---*/
+
+  const auto nRows = rho.size();
+  unsigned long nE = 0;
+  while (nE < nRows && rho[nE] == rho[0]) ++nE;
+
+  if (nRows == 0 || nRows % nE != 0)
+    SU2_MPI::Error("The look-up table file " + fileName + " is not a structured table.", CURRENT_FUNCTION);
+
+  SetAxes(nRows / nE, rho[0], rho[nRows-1], nE, e[0], e[nE-1]);
+
+  for (auto iRho = 0ul; iRho < nDensity; ++iRho) {
+    for (auto iE = 0ul; iE < nEnergy; ++iE) {
+      const auto iRow = iRho*nEnergy + iE;
+      if (fabs(log(rho[iRow]) - (logRhoMin + iRho*dLogRho)) > 1e-4*dLogRho ||
+          fabs(e[iRow] - (energyMin + iE*dEnergy)) > 1e-4*dEnergy)
+        SU2_MPI::Error("The look-up table file " + fileName + " is not uniform in log(density) and energy.",
+                       CURRENT_FUNCTION);
+    }
+  }
+
+  CheckValues();
+}
+
+void CFluidTable::SetAxes(unsigned long nRho, passivedouble rhoMin, passivedouble rhoMax,
+                          unsigned long nE, passivedouble eMin, passivedouble eMax) {
+
+  if (nRho < 4 || nE < 4 || !(rhoMin > 0.0 && rhoMax > rhoMin && eMax > eMin))
+    SU2_MPI::Error("The look-up table needs at least 4 points in each direction, and increasing density and energy.",
+                   CURRENT_FUNCTION);
+
+  nDensity = nRho;
+  logRhoMin = log(rhoMin);
+  logRhoMax = log(rhoMax);
+  dLogRho = (logRhoMax - logRhoMin) / (nDensity - 1);
+
+  nEnergy = nE;
+  energyMin = eMin;
+  energyMax = eMax;
+  dEnergy = (energyMax - energyMin) / (nEnergy - 1);
+}
+
+void CFluidTable::CheckValues() const {
+
+  for (auto iNode = 0ul; iNode < nDensity*nEnergy; ++iNode) {
+    const auto node = &values[iNode*NVAR];
+
+    bool physical = (node[PRESSURE] > 0.0) && (node[TEMPERATURE] > 0.0) && (node[SOUND_SPEED2] > 0.0);
+    for (unsigned short iVar = 0; iVar < NVAR; ++iVar) physical &= std::isfinite(node[iVar]);
+
+    if (!physical)
+      SU2_MPI::Error("The look-up table contains non-physical states, reduce its density or temperature range.",
+                     CURRENT_FUNCTION);
+  }
+}
+
+void CFluidTable::Write(const string& fileName) const {
+
+  ofstream file(fileName);
+  if (!file.is_open())
+    SU2_MPI::Error("Could not create the look-up table file " + fileName, CURRENT_FUNCTION);
+
+  file << "\"Density\",\"Energy\",\"Pressure\",\"Temperature\",\"SoundSpeed2\",\"Entropy\","
+          "\"dPdrho_e\",\"dPde_rho\",\"dTdrho_e\",\"dTde_rho\",\"Cp\",\"Cv\"\n";
+  file << setprecision(numeric_limits<passivedouble>::max_digits10);
+
+  for (auto iRho = 0ul; iRho < nDensity; ++iRho) {
+    const passivedouble rho = exp(logRhoMin + iRho*dLogRho);
+
+    for (auto iE = 0ul; iE < nEnergy; ++iE) {
+      file << rho << ", " << energyMin + iE*dEnergy;
+      for (unsigned short iVar = 0; iVar < NVAR; ++iVar) file << ", " << GetValue(iRho, iE, iVar);
+      file << "\n";
+    }
+  }
+}
+
+void CFluidTable::Scale(passivedouble densityRef, passivedouble pressureRef, passivedouble temperatureRef) {
+
+  const passivedouble energyRef = pressureRef / densityRef;
+  const passivedouble entropyRef = energyRef / temperatureRef;
+
+  logRhoMin -= log(densityRef);
+  logRhoMax -= log(densityRef);
+
+  energyMin /= energyRef;
+  energyMax /= energyRef;
+  dEnergy /= energyRef;
+
+  passivedouble ref[NVAR];
+  ref[PRESSURE] = pressureRef;
+  ref[TEMPERATURE] = temperatureRef;
+  ref[SOUND_SPEED2] = energyRef;
+  ref[ENTROPY] = entropyRef;
+  ref[DPDRHO_E] = energyRef;
+  ref[DPDE_RHO] = densityRef;
+  ref[DTDRHO_E] = temperatureRef / densityRef;
+  ref[DTDE_RHO] = temperatureRef / energyRef;
+  ref[CP] = entropyRef;
+  ref[CV] = entropyRef;
+
+  for (auto iNode = 0ul; iNode < nDensity*nEnergy; ++iNode)
+    for (unsigned short iVar = 0; iVar < NVAR; ++iVar)
+      values[iNode*NVAR + iVar] /= ref[iVar];
+}
+
+bool CFluidTable::Stencil(su2double coord, passivedouble coordMin, passivedouble delta, unsigned long n,
+                          unsigned long* idx, su2double* w, su2double* dw) {
+
+  /*--- Local coordinate in the interval [i, i+1], clamped to the axis (with a tolerance
+   *    for the round-off of the limits, e.g. after scaling the table). ---*/
+
+  const passivedouble tol = 1e-8;
+
+  su2double u = (coord - coordMin) / delta;
+  const bool inside = (u > -tol) && (u < passivedouble(n-1) + tol);
+  if (!(u > 0.0)) u = 0.0;
+  if (u > passivedouble(n-1)) u = passivedouble(n-1);
+
+  const auto i = min<unsigned long>(SU2_TYPE::GetValue(u), n-2);
+  const su2double t = u - passivedouble(i), t2 = t*t, t3 = t2*t;
+
+  /*--- Catmull-Rom cubic (C1, interpolates the nodes). ---*/
+
+  idx[0] = i-1; idx[1] = i; idx[2] = i+1; idx[3] = i+2;
+
+  w[0] = 0.5*(-t3 + 2*t2 - t);
+  w[1] = 0.5*(3*t3 - 5*t2 + 2);
+  w[2] = 0.5*(-3*t3 + 4*t2 + t);
+  w[3] = 0.5*(t3 - t2);
+
+  if (dw) {
+    dw[0] = 0.5*(-3*t2 + 4*t - 1) / delta;
+    dw[1] = 0.5*(9*t2 - 10*t) / delta;
+    dw[2] = 0.5*(-9*t2 + 8*t + 1) / delta;
+    dw[3] = 0.5*(3*t2 - 2*t) / delta;
+  }
+
+  /*--- At the ends, the missing node is extrapolated linearly, e.g. f(-1) = 2f(0) - f(1). ---*/
+
+  auto fold = [&](int missing, int end, int inner) {
+    w[end] += 2*w[missing]; w[inner] -= w[missing]; w[missing] = 0.0;
+    if (dw) { dw[end] += 2*dw[missing]; dw[inner] -= dw[missing]; dw[missing] = 0.0; }
+    idx[missing] = idx[end];
+  };
+  if (i == 0) fold(0, 1, 2);
+  if (i+2 == n) fold(3, 2, 1);
+
+  return inside;
+}
+
+bool CFluidTable::Interpolate(su2double rho, su2double e, su2double* vals) const {
+
+  AD::StartPreacc();
+  AD::SetPreaccIn(rho);
+  AD::SetPreaccIn(e);
+
+  const su2double logRho = (rho > 0.0)? su2double(log(rho)) : su2double(logRhoMin);
+
+  unsigned long iRho[4], iE[4];
+  su2double wRho[4], wE[4];
+  bool inside = (rho > 0.0);
+  inside &= Stencil(logRho, logRhoMin, dLogRho, nDensity, iRho, wRho, nullptr);
+  inside &= Stencil(e, energyMin, dEnergy, nEnergy, iE, wE, nullptr);
+
+  for (unsigned short iVar = 0; iVar < NVAR; ++iVar) vals[iVar] = 0.0;
+
+  for (int a = 0; a < 4; ++a) {
+    for (int b = 0; b < 4; ++b) {
+      const su2double w = wRho[a] * wE[b];
+      const auto node = &values[(iRho[a]*nEnergy + iE[b])*NVAR];
+      for (unsigned short iVar = 0; iVar < NVAR; ++iVar) vals[iVar] += w * node[iVar];
+    }
+  }
+
+  AD::SetPreaccOut(vals, NVAR);
+  AD::EndPreacc();
+
+  return inside;
+}
+
+su2double CFluidTable::Interpolate(su2double rho, su2double e, unsigned short iVar,
+                                   su2double& dvdrho, su2double& dvde) const {
+
+  /*--- Non-positive densities (e.g. during the inversions) are clamped to the first row, also for the derivative. ---*/
+  const su2double rhoSafe = (rho > 0.0)? rho : su2double(GetDensityMin());
+  const su2double logRho = (rho > 0.0)? su2double(log(rho)) : su2double(logRhoMin);
+
+  unsigned long iRho[4], iE[4];
+  su2double wRho[4], wE[4], dwRho[4], dwE[4];
+  Stencil(logRho, logRhoMin, dLogRho, nDensity, iRho, wRho, dwRho);
+  Stencil(e, energyMin, dEnergy, nEnergy, iE, wE, dwE);
+
+  su2double val = 0.0, dvdlogRho = 0.0;
+  dvde = 0.0;
+
+  for (int a = 0; a < 4; ++a) {
+    for (int b = 0; b < 4; ++b) {
+      const auto node = values[(iRho[a]*nEnergy + iE[b])*NVAR + iVar];
+      val += wRho[a] * wE[b] * node;
+      dvdlogRho += dwRho[a] * wE[b] * node;
+      dvde += wRho[a] * dwE[b] * node;
+    }
+  }
+  dvdrho = dvdlogRho / rhoSafe;
+
+  return val;
+}
@@ -38,17 +38,9 @@ CIdealGas::CIdealGas(su2double gamma, su2double R, bool CompEntropy) : CFluidMod
 }
 
 void CIdealGas::SetTDState_rhoe(su2double rho, su2double e) {
-  Density = rho;
-  StaticEnergy = e;
-  Pressure = Gamma_Minus_One * Density * StaticEnergy;
-  Temperature = Gamma_Minus_One * StaticEnergy / Gas_Constant;
-  SoundSpeed2 = Gamma * Pressure / Density;
-  dPdrho_e = Gamma_Minus_One * StaticEnergy;
-  dPde_rho = Gamma_Minus_One * Density;
-  dTdrho_e = 0.0;
-  dTde_rho = Gamma_Minus_One / Gas_Constant;
-
-  if (ComputeEntropy) Entropy = (1.0 / Gamma_Minus_One * log(Temperature) + log(1.0 / Density)) * Gas_Constant;
+  CFluidState<su2double> state;
+  TDState_rhoe(rho, e, state, ComputeEntropy);
+  SetTDState(rho, e, state, ComputeEntropy);
 }
 
 void CIdealGas::SetTDState_PT(su2double P, su2double T) {
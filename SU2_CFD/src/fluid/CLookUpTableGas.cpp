@@ -0,0 +1,255 @@
+/*!
+ * \file CLookUpTableGas.cpp
+ * \brief Source of the look-up table fluid model.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/fluid/CLookUpTableGas.hpp"
+#include "../../include/fluid/CIdealGas.hpp"
+#include "../../include/fluid/CVanDerWaalsGas.hpp"
+#include "../../include/fluid/CPengRobinson.hpp"
+
+CLookUpTableGas::CLookUpTableGas(shared_ptr<const CFluidTable> fluidTable) : CFluidModel(), table(move(fluidTable)) {
+
+  /*--- Start the first inversion from the middle of the table. ---*/
+
+  SetTDState_rhoe(sqrt(table->GetDensityMin() * table->GetDensityMax()),
+                  0.5 * (table->GetEnergyMin() + table->GetEnergyMax()));
+}
+
+shared_ptr<CFluidTable> CLookUpTableGas::CreateTable(const CConfig* config) {
+
+  if (config->GetLUT_FileName() != "NONE")
+    return make_shared<CFluidTable>(config->GetLUT_FileName());
+
+  unique_ptr<CFluidModel> model;
+
+  switch (config->GetKind_LUT_BaseModel()) {
+    case IDEAL_GAS:
+      model.reset(new CIdealGas(config->GetGamma(), config->GetGas_Constant()));
+      break;
+
+    case VW_GAS:
+      model.reset(new CVanDerWaalsGas(config->GetGamma(), config->GetGas_Constant(),
+                                      config->GetPressure_Critical(), config->GetTemperature_Critical()));
+      break;
+
+    case PR_GAS:
+      model.reset(new CPengRobinson(config->GetGamma(), config->GetGas_Constant(), config->GetPressure_Critical(),
+                                    config->GetTemperature_Critical(), config->GetAcentric_Factor()));
+      break;
+
+    default:
+      SU2_MPI::Error("LUT_BASE_MODEL must be IDEAL_GAS, VW_GAS, or PR_GAS.", CURRENT_FUNCTION);
+      break;
+  }
+
+  const auto& rho = config->GetLUT_DensityRange();
+  const auto& T = config->GetLUT_TemperatureRange();
+  const auto& size = config->GetLUT_Size();
+
+  return make_shared<CFluidTable>(*model, rho[0], rho[1], T[0], T[1], size[0], size[1]);
+}
+
+shared_ptr<const CFluidTable> CLookUpTableGas::ScaleTable(const CFluidTable& dimensional, const CConfig* config) {
+
+  auto table = make_shared<CFluidTable>(dimensional);
+  table->Scale(SU2_TYPE::GetValue(config->GetDensity_Ref()), SU2_TYPE::GetValue(config->GetPressure_Ref()),
+               SU2_TYPE::GetValue(config->GetTemperature_Ref()));
+  return table;
+}
+
+void CLookUpTableGas::CountFailure(unsigned long& counter, const char* what) {
+
+  ++counter;
+  unsigned long power = 1;
+  while (power < counter) power *= 10;
+
+  if (power == counter)
+    cout << "Warning look-up table: " << counter << " " << what << "." << endl;
+}
+
+void CLookUpTableGas::SetTDState_rhoe(su2double rho, su2double e) {
+
+  su2double vals[CFluidTable::NVAR];
+  if (!table->Interpolate(rho, e, vals))
+    CountFailure(nOutOfRange, "states outside the table were clamped to its limits");
+
+  Density = rho;
+  StaticEnergy = e;
+  Pressure = vals[CFluidTable::PRESSURE];
+  Temperature = vals[CFluidTable::TEMPERATURE];
+  SoundSpeed2 = vals[CFluidTable::SOUND_SPEED2];
+  Entropy = vals[CFluidTable::ENTROPY];
+  dPdrho_e = vals[CFluidTable::DPDRHO_E];
+  dPde_rho = vals[CFluidTable::DPDE_RHO];
+  dTdrho_e = vals[CFluidTable::DTDRHO_E];
+  dTde_rho = vals[CFluidTable::DTDE_RHO];
+  Cp = vals[CFluidTable::CP];
+  Cv = vals[CFluidTable::CV];
+}
+
+unsigned long CLookUpTableGas::ComputeTDState_rhoe(unsigned long n, const su2double* rho, const su2double* e,
+                                                   const CFluidStateBatch& state) const {
+  unsigned long nClamped = 0;
+
+  for (unsigned long i = 0; i < n; ++i) {
+    su2double vals[CFluidTable::NVAR];
+    nClamped += !table->Interpolate(rho[i], e[i], vals);
+
+    if (state.Pressure) state.Pressure[i] = vals[CFluidTable::PRESSURE];
+    if (state.Temperature) state.Temperature[i] = vals[CFluidTable::TEMPERATURE];
+    if (state.SoundSpeed2) state.SoundSpeed2[i] = vals[CFluidTable::SOUND_SPEED2];
+    if (state.Entropy) state.Entropy[i] = vals[CFluidTable::ENTROPY];
+    if (state.dPdrho_e) state.dPdrho_e[i] = vals[CFluidTable::DPDRHO_E];
+    if (state.dPde_rho) state.dPde_rho[i] = vals[CFluidTable::DPDE_RHO];
+    if (state.dTdrho_e) state.dTdrho_e[i] = vals[CFluidTable::DTDRHO_E];
+    if (state.dTde_rho) state.dTde_rho[i] = vals[CFluidTable::DTDE_RHO];
+    if (state.Cp) state.Cp[i] = vals[CFluidTable::CP];
+    if (state.Cv) state.Cv[i] = vals[CFluidTable::CV];
+  }
+  return nClamped;
+}
+
+template<class Residual>
+void CLookUpTableGas::Invert(const Residual& func, su2double rho, bool fixedRho) {
+
+  const unsigned short maxIter = 50;
+  const passivedouble tol = 1e-10;
+
+  const passivedouble rhoMin = table->GetDensityMin(), rhoMax = table->GetDensityMax();
+  const passivedouble eMin = table->GetEnergyMin(), eMax = table->GetEnergyMax();
+
+  /*--- Newton's method in (log(rho), e) starting from the previous state, if it does not
+   *    converge (e.g. the previous state is far) restart from the middle of the table. ---*/
+
+  su2double e = StaticEnergy;
+  if (!fixedRho) rho = Density;
+
+  bool converged = false;
+
+  for (int attempt = 0; attempt < 2; ++attempt) {
+    converged = false;
+
+    for (unsigned short iter = 0; iter < maxIter && !converged; ++iter) {
+      su2double r[2] = {0.0}, drdrho[2] = {0.0}, drde[2] = {0.0};
+      func(rho, e, r, drdrho, drde);
+
+      su2double dLogRho = 0.0, dE = 0.0;
+
+      if (fixedRho) {
+        if (drde[0] == 0.0) break;
+        dE = -r[0] / drde[0];
+      }
+      else {
+        const su2double drdx[2] = {drdrho[0]*rho, drdrho[1]*rho};
+        const su2double det = drdx[0]*drde[1] - drde[0]*drdx[1];
+        if (det == 0.0) break;
+        dLogRho = (drde[0]*r[1] - r[0]*drde[1]) / det;
+        dE = (r[0]*drdx[1] - drdx[0]*r[1]) / det;
+
+        /*--- Limit the density change to a factor of e per iteration. ---*/
+        dLogRho = max(su2double(-1.0), min(su2double(1.0), dLogRho));
+        rho = max(su2double(rhoMin), min(su2double(rhoMax), su2double(rho*exp(dLogRho))));
+      }
+      e = max(su2double(eMin), min(su2double(eMax), su2double(e + dE)));
+
+      converged = (fabs(dLogRho) < tol) && (fabs(dE) < tol*(eMax-eMin));
+    }
+    if (converged || attempt == 1) break;
+
+    e = 0.5*(eMin + eMax);
+    if (!fixedRho) rho = sqrt(rhoMin*rhoMax);
+  }
+
+  /*--- Keep the last state, e.g. the closest one in the table if the target is outside of it. ---*/
+
+  if (!converged)
+    CountFailure(nNotConverged, "inversions did not converge, the last state was used");
+
+  SetTDState_rhoe(rho, e);
+}
+
+void CLookUpTableGas::SetTDState_PT(su2double P, su2double T) {
+
+  const auto& tab = *table;
+  Invert([&](su2double rho, su2double e, su2double* r, su2double* drdrho, su2double* drde) {
+    r[0] = tab.Interpolate(rho, e, CFluidTable::PRESSURE, drdrho[0], drde[0]) - P;
+    r[1] = tab.Interpolate(rho, e, CFluidTable::TEMPERATURE, drdrho[1], drde[1]) - T;
+  }, Density, false);
+}
+
+void CLookUpTableGas::SetTDState_Prho(su2double P, su2double rho) {
+
+  const auto& tab = *table;
+  Invert([&](su2double density, su2double e, su2double* r, su2double* drdrho, su2double* drde) {
+    r[0] = tab.Interpolate(density, e, CFluidTable::PRESSURE, drdrho[0], drde[0]) - P;
+  }, rho, true);
+}
+
+void CLookUpTableGas::SetTDState_rhoT(su2double rho, su2double T) {
+
+  const auto& tab = *table;
+  Invert([&](su2double density, su2double e, su2double* r, su2double* drdrho, su2double* drde) {
+    r[0] = tab.Interpolate(density, e, CFluidTable::TEMPERATURE, drdrho[0], drde[0]) - T;
+  }, rho, true);
+}
+
+void CLookUpTableGas::SetTDState_hs(su2double h, su2double s) {
+
+  const auto& tab = *table;
+  Invert([&](su2double rho, su2double e, su2double* r, su2double* drdrho, su2double* drde) {
+    /*--- h = e + P/rho ---*/
+    su2double dPdrho, dPde;
+    const su2double P = tab.Interpolate(rho, e, CFluidTable::PRESSURE, dPdrho, dPde);
+    r[0] = e + P/rho - h;
+    drdrho[0] = dPdrho/rho - P/(rho*rho);
+    drde[0] = 1.0 + dPde/rho;
+    r[1] = tab.Interpolate(rho, e, CFluidTable::ENTROPY, drdrho[1], drde[1]) - s;
+  }, Density, false);
+}
+
+void CLookUpTableGas::SetTDState_Ps(su2double P, su2double s) {
+
+  const auto& tab = *table;
+  Invert([&](su2double rho, su2double e, su2double* r, su2double* drdrho, su2double* drde) {
+    r[0] = tab.Interpolate(rho, e, CFluidTable::PRESSURE, drdrho[0], drde[0]) - P;
+    r[1] = tab.Interpolate(rho, e, CFluidTable::ENTROPY, drdrho[1], drde[1]) - s;
+  }, Density, false);
+}
+
+void CLookUpTableGas::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
+
+  SetTDState_Prho(P, rho);
+
+  /*--- From h = e + P/rho, T ds = de - P/rho^2 drho, and the derivatives of P(rho, e). ---*/
+
+  const su2double dedrho_P = -dPdrho_e / dPde_rho;
+  const su2double dedP_rho = 1.0 / dPde_rho;
+
+  dhdrho_P = dedrho_P - Pressure / (Density*Density);
+  dhdP_rho = dedP_rho + 1.0 / Density;
+  dsdrho_P = dhdrho_P / Temperature;
+  dsdP_rho = dedP_rho / Temperature;
+}
@@ -82,6 +82,28 @@ void CNEMOGas::SetTDStatePTTv(su2double val_pressure, const su2double *val_massf
   }
 }
 
+void CNEMOGas::ComputeNetProductionRates_Batch(unsigned long nPoint, const su2double* val_rhos, const su2double* val_T,
+                                               const su2double* val_Tve, su2double* val_ws) {
+
+  vector<su2double> val_rhos_i(nSpecies);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      val_rhos_i[iSpecies] = val_rhos[iSpecies*nPoint + iPoint];
+
+    SetTDStateRhosTTv(val_rhos_i, val_T[iPoint], val_Tve[iPoint]);
+    const auto& val_ws_i = ComputeNetProductionRates();
+
+    for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+      val_ws[iSpecies*nPoint + iPoint] = val_ws_i[iSpecies];
+  }
+}
+
+void CNEMOGas::ComputeSourceJacobian(su2double* val_source, su2activematrix& val_jacobian) {
+
+  SU2_MPI::Error("The Jacobian of the chemical sources is not available for this gas model.", CURRENT_FUNCTION);
+}
+
 su2double CNEMOGas::ComputeSoundSpeed(){
 
   su2double conc, rhoCvtr;
@@ -80,55 +80,13 @@ su2double CPengRobinson::T_P_rho(su2double P, su2double rho) {
 }
 
 void CPengRobinson::SetTDState_rhoe(su2double rho, su2double e) {
-  su2double DpDd_T, DpDT_d, DeDd_T, Cv;
-  su2double A, B, C, sqrt2, fv, a2T, rho2, atanh;
-
-  Density = rho;
-  StaticEnergy = e;
-
   AD::StartPreacc();
   AD::SetPreaccIn(rho);
   AD::SetPreaccIn(e);
 
-  rho2 = rho * rho;
-  sqrt2 = sqrt(2.0);
-
-  atanh = (log(1.0 + (rho * b * sqrt2 / (1 + rho * b))) - log(1.0 - (rho * b * sqrt2 / (1 + rho * b)))) / 2.0;
-
-  fv = atanh;
-
-  A = Gas_Constant / Gamma_Minus_One;
-  B = a * k * (k + 1) * fv / (b * sqrt2 * sqrt(TstarCrit));
-  C = a * (k + 1) * (k + 1) * fv / (b * sqrt2) + e;
-
-  Temperature = (-B + sqrt(B * B + 4 * A * C)) / (2 * A);  /// Only positive root considered
-  Temperature *= Temperature;
-
-  a2T = alpha2(Temperature);
-
-  A = (1 / rho2 + 2 * b / rho - b * b);
-  B = 1 / rho - b;
-
-  Pressure = Temperature * Gas_Constant / B - a * a2T / A;
-
-  Entropy = Gas_Constant / Gamma_Minus_One * log(Temperature) + Gas_Constant * log(B) -
-            a * sqrt(a2T) * k * fv / (b * sqrt2 * sqrt(Temperature * TstarCrit));
-
-  DpDd_T = (Temperature * Gas_Constant / (B * B) - 2 * a * a2T * (1 / rho + b) / (A * A)) / (rho2);
-
-  DpDT_d = Gas_Constant / B + a * k / A * sqrt(a2T / (Temperature * TstarCrit));
-
-  Cv = Gas_Constant / Gamma_Minus_One + (a * k * (k + 1) * fv) / (2 * b * sqrt(2 * Temperature * TstarCrit));
-
-  dPde_rho = DpDT_d / Cv;
-
-  DeDd_T = -a * (1 + k) * sqrt(a2T) / A / (rho2);
-
-  dPdrho_e = DpDd_T - dPde_rho * DeDd_T;
-
-  SoundSpeed2 = dPdrho_e + Pressure / (rho2)*dPde_rho;
-
-  dTde_rho = 1 / Cv;
+  CFluidState<su2double> state;
+  TDState_rhoe(rho, e, state, true);
+  SetTDState(rho, e, state, true);
 
   Zed = Pressure / (Gas_Constant * Temperature * Density);
 
@@ -44,11 +44,10 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
   CharVibTemp.resize(nSpecies,0.0);
   RotationModes.resize(nSpecies,0.0);
   Diss.resize(nSpecies,0.0);
-  A.resize(5,0.0);
   Omega00.resize(nSpecies,nSpecies,4,0.0);
   Omega11.resize(nSpecies,nSpecies,4,0.0);
-  RxnConstantTable.resize(6,5) = su2double(0.0);
   Blottner.resize(nSpecies,3)  = su2double(0.0);
+  RelaxationTime.resize(nSpecies,0.0);
 
   if(viscous){
     MolarFracWBE.resize(nSpecies,0.0);
@@ -611,6 +610,22 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- Tabulate the equilibrium constants of all reactions once, they do not depend on the state. ---*/
+  EquilConstants.resize(nReactions, 6, 5);
+  su2activematrix RxnConstantTable(6,5);
+
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    RxnConstantTable = su2double(0.0);
+    GetChemistryEquilConstants(iReaction, RxnConstantTable);
+    for (unsigned short iRow = 0; iRow < 6; iRow++)
+      for (unsigned short iCoeff = 0; iCoeff < 5; iCoeff++)
+        EquilConstants(iReaction, iRow, iCoeff) = RxnConstantTable(iRow, iCoeff);
+  }
+
+  /*--- The T-R specific heats are constant, set them before any state is computed (ComputeTemperatures
+   *    uses them, and with one object per thread some objects are never asked for the speed of sound). ---*/
+  GetSpeciesCvTraRot();
 }
 
 CSU2TCLib::~CSU2TCLib(){}
@@ -744,10 +759,16 @@ vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
 
 vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T){
 
+  SpeciesEve(val_T, eves.data());
+  return eves;
+}
+
+void CSU2TCLib::SpeciesEve(su2double val_T, su2double* val_eves) const {
+
   su2double Ev, Eel, Ef, num, denom;
-  unsigned short iElectron = nSpecies-1;
+  const unsigned short iElectron = nSpecies-1;
 
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++){
 
     /*--- Electron species energy ---*/
     if ( ionization && (iSpecies == iElectron)) {
@@ -768,147 +789,167 @@ vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T){
       /*--- Calculate electronic energy ---*/
       num = 0.0;
       denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-      for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
+      for (unsigned short iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
         num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
         denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
       }
       Eel = Ru/MolarMass[iSpecies] * (num/denom);
     }
 
-    eves[iSpecies] = Ev + Eel;
+    val_eves[iSpecies] = Ev + Eel;
   }
-
-  return eves;
 }
 
-vector<su2double>& CSU2TCLib::ComputeNetProductionRates(){
+template<class Pack>
+void CSU2TCLib::NetProductionRates(const su2double* val_rhos, unsigned long stride, const su2double* val_T,
+                                   const su2double* val_Tve, su2double* val_ws, su2double* val_kf,
+                                   su2double* val_kb, su2double* val_dkbdN) const {
 
   /*--- Nonequilibrium chemistry ---*/
-  unsigned short ii, iReaction;
-  su2double T_min, epsilon, Thf, Thb, Trxnf, Trxnb, Keq, kf, kb, kfb, fwdRxn, bkwRxn, af, bf, ab, bb;
+  constexpr size_t nLane = Pack::Size;
 
   /*--- Define artificial chemistry parameters ---*/
   // Note: These parameters artificially increase the rate-controlling reaction
   //       temperature.  This relaxes some of the stiffness in the chemistry
   //       source term.
-  T_min   = 800.0;
-  epsilon = 80;
-  /*--- Define preferential dissociation coefficient ---*/
-  //alpha = 0.3;
+  const su2double T_min = 800.0, epsilon = 80.0;
 
-  for( iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    ws[iSpecies] = 0.0;
+  /*--- The powers of the temperatures are computed from their logarithms. ---*/
+  const Pack logT = log(Pack(val_T)), logTve = log(Pack(val_Tve));
 
-  for (iReaction = 0; iReaction < nReactions; iReaction++) {
+  /*--- Calculate mixture number density (1/cm^3) ---*/
+  Pack N = 0.0;
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    N += Pack(val_rhos + iSpecies*stride) / MolarMass[iSpecies] * AVOGAD_CONSTANT;
+    Pack(0.0).store(val_ws + iSpecies*stride);
+  }
+  N *= 1E-6;
+
+  /*--- The equilibrium constants are interpolated in N between table rows (n = 1E14 ... 1E19),
+   *    bounded to the table limits. The rows and weights are the same for all reactions.
+   *    Note: Below 1E14 this uses the first row, previously the unsigned index wrapped around
+   *          and the last row (1E19) was used instead. ---*/
+  unsigned short row[nLane];
+  su2double weight[nLane], dweightdN[nLane];
+
+  for (size_t k = 0; k < nLane; ++k) {
+    const int pwr = SU2_TYPE::Int(floor(log10(N[k])));
+    const int iIndex = pwr - 14;
+
+    row[k] = min(max(iIndex, 0), 5);
+    weight[k] = 0.0;
+    dweightdN[k] = 0.0;
+
+    if (iIndex > 0 && iIndex < 5) {
+      /*--- Calculate interpolation denominator terms avoiding pow() ---*/
+      su2double tmp1 = 1.0;
+      for (int ii = 0; ii < pwr; ii++) tmp1 *= 10.0;
+      weight[k] = (N[k] - tmp1) / (10.0*tmp1 - tmp1);
+      dweightdN[k] = 1.0 / (10.0*tmp1 - tmp1);
+    }
+  }
+
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
 
     /*--- Determine the rate-controlling temperature ---*/
-    af = Tcf_a[iReaction];
-    bf = Tcf_b[iReaction];
-    ab = Tcb_a[iReaction];
-    bb = Tcb_b[iReaction];
-    Trxnf = pow(T, af)*pow(Tve, bf);
-    Trxnb = pow(T, ab)*pow(Tve, bb);
+    const Pack Trxnf = exp(Tcf_a[iReaction]*logT + Tcf_b[iReaction]*logTve);
+    const Pack Trxnb = exp(Tcb_a[iReaction]*logT + Tcb_b[iReaction]*logTve);
 
     /*--- Calculate the modified temperature ---*/
-    Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
-    Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
+    const Pack Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
+    const Pack Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
+    const Pack logThb = log(Thb);
+
+    /*--- Get the Keq coefficients ---*/
+    Pack A[5];
+    for (unsigned short ii = 0; ii < 5; ii++) {
+      for (size_t k = 0; k < nLane; ++k) {
+        const su2double A0 = EquilConstants(iReaction, row[k], ii);
+        A[ii][k] = (weight[k] != 0.0)? A0 + (EquilConstants(iReaction, row[k]+1, ii) - A0) * weight[k] : A0;
+      }
+    }
 
-    /*--- Get the Keq & Arrhenius coefficients ---*/
-    ComputeKeqConstants(iReaction);
+    /*--- Calculate log(Keq) ---*/
+    const Pack logKeq =  A[0]*(Thb/1E4) + A[1] + A[2]*(log(1E4)-logThb)
+                       + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb);
 
-    /*--- Calculate Keq ---*/
-    Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
-        + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb) );
+    /*--- Calculate rate coefficients, kb = kf(Thb) / Keq ---*/
+    const Pack kf = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf) - ArrheniusTheta[iReaction]/Thf);
+    const Pack kb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*logThb - ArrheniusTheta[iReaction]/Thb - logKeq);
 
-    /*--- Calculate rate coefficients ---*/
-    kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf)) * exp(-ArrheniusTheta[iReaction]/Thf);
-    kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb)) * exp(-ArrheniusTheta[iReaction]/Thb);
-    kb  = kfb / Keq;
+    if (val_kf) kf.store(val_kf + iReaction*stride);
+    if (val_kb) kb.store(val_kb + iReaction*stride);
+
+    if (val_dkbdN) {
+      /*--- kb depends on N through the interpolation weight of log(Keq). ---*/
+      Pack dA[5];
+      for (unsigned short ii = 0; ii < 5; ii++) {
+        for (size_t k = 0; k < nLane; ++k) {
+          const auto iRow = row[k];
+          dA[ii][k] = (weight[k] != 0.0)? (EquilConstants(iReaction, iRow+1, ii) - EquilConstants(iReaction, iRow, ii)) * dweightdN[k] : 0.0;
+        }
+      }
+      const Pack dlogKeqdN =  dA[0]*(Thb/1E4) + dA[1] + dA[2]*(log(1E4)-logThb)
+                            + dA[3]*(1E4/Thb) + dA[4]*(1E4/Thb)*(1E4/Thb);
+      const Pack dkbdN = -kb * dlogKeqdN;
+      dkbdN.store(val_dkbdN + iReaction*stride);
+    }
 
     /*--- Determine production & destruction of each species ---*/
-    fwdRxn = 1.0;
-    bkwRxn = 1.0;
-    for (ii = 0; ii < 3; ii++) {
+    Pack fwdRxn = 1.0, bkwRxn = 1.0;
+    for (unsigned short ii = 0; ii < 3; ii++) {
 
       /*--- Reactants ---*/
-      iSpecies = Reactions(iReaction,0,ii);
-      if ( iSpecies != nSpecies)
-        fwdRxn *= 0.001*rhos[iSpecies]/MolarMass[iSpecies];
+      const auto iSpecies = Reactions(iReaction,0,ii);
+      if (iSpecies != nSpecies)
+        fwdRxn *= 0.001*Pack(val_rhos + iSpecies*stride)/MolarMass[iSpecies];
 
       /*--- Products ---*/
-      jSpecies = Reactions(iReaction,1,ii);
-      if (jSpecies != nSpecies) {
-        bkwRxn *= 0.001*rhos[jSpecies]/MolarMass[jSpecies];
-      }
+      const auto jSpecies = Reactions(iReaction,1,ii);
+      if (jSpecies != nSpecies)
+        bkwRxn *= 0.001*Pack(val_rhos + jSpecies*stride)/MolarMass[jSpecies];
     }
 
-    fwdRxn = 1000.0 * kf * fwdRxn;
-    bkwRxn = 1000.0 * kb * bkwRxn;
+    const Pack netRxn = 1000.0 * kf * fwdRxn - 1000.0 * kb * bkwRxn;
 
-    for (ii = 0; ii < 3; ii++) {
+    for (unsigned short ii = 0; ii < 3; ii++) {
 
       /*--- Products ---*/
-      iSpecies = Reactions(iReaction,1,ii);
-      if (iSpecies != nSpecies)
-        ws[iSpecies] += MolarMass[iSpecies] * (fwdRxn-bkwRxn);
+      auto iSpecies = Reactions(iReaction,1,ii);
+      if (iSpecies != nSpecies) {
+        const Pack ws_s = Pack(val_ws + iSpecies*stride) + MolarMass[iSpecies] * netRxn;
+        ws_s.store(val_ws + iSpecies*stride);
+      }
 
       /*--- Reactants ---*/
       iSpecies = Reactions(iReaction,0,ii);
-      if (iSpecies != nSpecies)
-        ws[iSpecies] -= MolarMass[iSpecies] * (fwdRxn-bkwRxn);
+      if (iSpecies != nSpecies) {
+        const Pack ws_s = Pack(val_ws + iSpecies*stride) - MolarMass[iSpecies] * netRxn;
+        ws_s.store(val_ws + iSpecies*stride);
+      }
     }
   }
-  return ws;
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+vector<su2double>& CSU2TCLib::ComputeNetProductionRates(){
 
-  unsigned short ii, iIndex, tbl_offset, pwr;
-  su2double N, tmp1, tmp2;
+  NetProductionRates<simd::Array<su2double,1> >(rhos.data(), 1, &T, &Tve, ws.data());
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
+  return ws;
+}
 
-  /*--- Calculate mixture number density ---*/
-  N = 0.0;
-  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
-    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
-  }
+void CSU2TCLib::ComputeNetProductionRates_Batch(unsigned long nPoint, const su2double* val_rhos, const su2double* val_T,
+                                                const su2double* val_Tve, su2double* val_ws) {
 
-  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
-  N = N*(1E-6);
-
-  /*--- Determine table index based on mixture N ---*/
-  tbl_offset = 14;
-  pwr        = floor(log10(N));
-
-  /*--- Bound the interpolation to table limit values ---*/
-  iIndex = int(pwr) - tbl_offset;
-  if (iIndex <= 0) {
-    for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(0,ii);
-    return;
-  } else if (iIndex >= 5) {
-    for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(5,ii);
-    return;
-  }
+  using Pack = simd::Array<su2double>;
 
-  /*--- Calculate interpolation denominator terms avoiding pow() ---*/
-  tmp1 = 1.0;
-  tmp2 = 1.0;
-  for (ii = 0; ii < pwr; ii++) {
-    tmp1 *= 10.0;
-    tmp2 *= 10.0;
-  }
-  tmp2 *= 10.0;
+  /*--- Full packs of points, the remainder one point at a time. ---*/
+  unsigned long iPoint = 0;
+  for (; iPoint + Pack::Size <= nPoint; iPoint += Pack::Size)
+    NetProductionRates<Pack>(val_rhos+iPoint, nPoint, val_T+iPoint, val_Tve+iPoint, val_ws+iPoint);
 
-  /*--- Interpolate ---*/
-  for (ii = 0; ii < 5; ii++) {
-    A[ii] =  (RxnConstantTable(iIndex+1,ii) - RxnConstantTable(iIndex,ii))
-        / (tmp2 - tmp1) * (N - tmp1)
-        + RxnConstantTable(iIndex,ii);
-  }
+  for (; iPoint < nPoint; ++iPoint)
+    NetProductionRates<simd::Array<su2double,1> >(val_rhos+iPoint, nPoint, val_T+iPoint, val_Tve+iPoint, val_ws+iPoint);
 }
 
 su2double CSU2TCLib::ComputeEveSourceTerm(){
@@ -967,6 +1008,7 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
 
     /*--- Species relaxation time ---*/
     taus = tauMW + tauP;
+    RelaxationTime[iSpecies] = taus;
 
     /*--- Add species contribution to residual ---*/
     omegaVT += rhos[iSpecies] * (eve_eq[iSpecies] -
@@ -985,6 +1027,90 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
 
 }
 
+void CSU2TCLib::ComputeSourceJacobian(su2double* val_source, su2activematrix& val_jacobian) {
+
+  val_jacobian.resize(nSpecies+1, nSpecies+1) = su2double(0.0);
+
+  /*--- Chemistry, derivatives of the law of mass action at constant temperatures. ---*/
+  if (!frozen) {
+    vector<su2double> kf(nReactions), kb(nReactions), dkbdN(nReactions), dnet(nSpecies);
+
+    NetProductionRates<simd::Array<su2double,1> >(rhos.data(), 1, &T, &Tve, ws.data(), kf.data(), kb.data(), dkbdN.data());
+
+    for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+
+      /*--- Derivatives of the net rate of the reaction w.r.t. the species densities, each reactant
+       *    (product) contributes the product of the concentrations of the other reactants (products). ---*/
+      for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) dnet[iSpecies] = 0.0;
+
+      for (unsigned short iSide = 0; iSide < 2; iSide++) {
+        const su2double coeff = (iSide == 0)? 1000.0*kf[iReaction] : -1000.0*kb[iReaction];
+
+        for (unsigned short ii = 0; ii < 3; ii++) {
+          const auto kSpecies = Reactions(iReaction,iSide,ii);
+          if (kSpecies == nSpecies) continue;
+
+          su2double prod = 0.001/MolarMass[kSpecies];
+          for (unsigned short jj = 0; jj < 3; jj++) {
+            const auto lSpecies = Reactions(iReaction,iSide,jj);
+            if (jj != ii && lSpecies != nSpecies) prod *= 0.001*rhos[lSpecies]/MolarMass[lSpecies];
+          }
+          dnet[kSpecies] += coeff*prod;
+        }
+      }
+
+      /*--- The backward rate coefficient depends on the number density (1/cm^3) via Keq. ---*/
+      su2double bkwRxn = 1.0;
+      for (unsigned short ii = 0; ii < 3; ii++) {
+        const auto kSpecies = Reactions(iReaction,1,ii);
+        if (kSpecies != nSpecies) bkwRxn *= 0.001*rhos[kSpecies]/MolarMass[kSpecies];
+      }
+      for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+        dnet[iSpecies] -= 1000.0*dkbdN[iReaction]*bkwRxn * AVOGAD_CONSTANT/MolarMass[iSpecies]*1E-6;
+
+      for (unsigned short ii = 0; ii < 3; ii++) {
+        const auto iProduct = Reactions(iReaction,1,ii);
+        const auto iReactant = Reactions(iReaction,0,ii);
+
+        for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+          if (iProduct != nSpecies) val_jacobian(iProduct,jSpecies) += MolarMass[iProduct]*dnet[jSpecies];
+          if (iReactant != nSpecies) val_jacobian(iReactant,jSpecies) -= MolarMass[iReactant]*dnet[jSpecies];
+        }
+      }
+    }
+  }
+
+  /*--- Vibrational energy source, this also updates the relaxation times. ---*/
+  val_source[nSpecies] = ComputeEveSourceTerm();
+
+  const vector<su2double> eve_eq = ComputeSpeciesEve(T);
+  const vector<su2double> eve = ComputeSpeciesEve(Tve);
+  const auto& cvve = ComputeSpeciesCvVibEle();
+
+  /*--- Landau-Teller, w.r.t. the species densities at constant temperatures, and w.r.t. the V-E energy
+   *    through Tve (d(rhoEve)/dTve = rhoCvve). Plus the V-E energy carried by the chemical sources. ---*/
+  su2double rhoCvve = 0.0, domegadTve = 0.0;
+
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    rhoCvve += rhos[iSpecies]*cvve[iSpecies];
+    domegadTve -= rhos[iSpecies]*cvve[iSpecies] / RelaxationTime[iSpecies];
+    val_jacobian(nSpecies,iSpecies) = (eve_eq[iSpecies] - eve[iSpecies]) / RelaxationTime[iSpecies];
+  }
+
+  if (!frozen) {
+    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+      domegadTve += ws[iSpecies]*cvve[iSpecies];
+      for (jSpecies = 0; jSpecies < nSpecies; jSpecies++)
+        val_jacobian(nSpecies,jSpecies) += val_jacobian(iSpecies,jSpecies)*eve[iSpecies];
+    }
+  }
+
+  if (rhoCvve > 0.0) val_jacobian(nSpecies,nSpecies) = domegadTve / rhoCvve;
+
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    val_source[iSpecies] = frozen? su2double(0.0) : ws[iSpecies];
+}
+
 vector<su2double>& CSU2TCLib::ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves){
 
   vector<su2double> cvtrs;
@@ -1151,6 +1277,13 @@ void CSU2TCLib::ThermalConductivitiesWBE(){
 
 void CSU2TCLib::DiffusionCoeffGY(){
 
+  DiffusionCoeffGY(rhos.data(), Density, Pressure, T, Tve, DiffusionCoeff.data());
+}
+
+void CSU2TCLib::DiffusionCoeffGY(const su2double* rhos, su2double Density, su2double Pressure,
+                                 su2double T, su2double Tve, su2double* val_D) const {
+
+  unsigned short iSpecies, jSpecies;
   su2double Mi, Mj, pi, kb, gam_i, gam_j, gam_t, denom, d1_ij, D_ij, Omega_ij;
 
   pi   = PI_NUMBER;
@@ -1164,7 +1297,7 @@ void CSU2TCLib::DiffusionCoeffGY(){
   /*--- Mixture thermal conductivity via Gupta-Yos approximation ---*/
   for (iSpecies = 0; iSpecies < nHeavy; iSpecies++) {
     /*--- Initialize the species diffusion coefficient ---*/
-    DiffusionCoeff[iSpecies] = 0.0;
+    val_D[iSpecies] = 0.0;
     /*--- Calculate molar concentration ---*/
     Mi      = MolarMass[iSpecies];
     gam_i   = rhos[iSpecies] / (Density*Mi);
@@ -1201,13 +1334,13 @@ void CSU2TCLib::DiffusionCoeffGY(){
     }
 
     /*--- Assign species diffusion coefficient ---*/
-    DiffusionCoeff[iSpecies] = gam_t*gam_t*Mi*(1-Mi*gam_i) / denom;
+    val_D[iSpecies] = gam_t*gam_t*Mi*(1-Mi*gam_i) / denom;
   }
   if (ionization) {
     iSpecies = nSpecies-1;
 
     /*--- Initialize the species diffusion coefficient ---*/
-    DiffusionCoeff[iSpecies] = 0.0;
+    val_D[iSpecies] = 0.0;
 
     /*--- Calculate molar concentration ---*/
     Mi      = MolarMass[iSpecies];
@@ -1232,13 +1365,19 @@ void CSU2TCLib::DiffusionCoeffGY(){
         denom += gam_j/D_ij;
       }
     }
-    DiffusionCoeff[iSpecies] = gam_t*gam_t*MolarMass[iSpecies]*(1-MolarMass[iSpecies]*gam_i) / denom;
+    val_D[iSpecies] = gam_t*gam_t*MolarMass[iSpecies]*(1-MolarMass[iSpecies]*gam_i) / denom;
   }
 }
 
 void CSU2TCLib::ViscosityGY(){
 
-  su2double Mi, Mj, pi, Na, gam_i, gam_j, denom, Omega_ij, d2_ij;
+  Mu = ViscosityGY(rhos.data(), Density, T, Tve);
+}
+
+su2double CSU2TCLib::ViscosityGY(const su2double* rhos, su2double Density, su2double T, su2double Tve) const {
+
+  unsigned short iSpecies, jSpecies;
+  su2double Mu, Mi, Mj, pi, Na, gam_i, gam_j, denom, Omega_ij, d2_ij;
 
   pi   = PI_NUMBER;
   Na   = AVOGAD_CONSTANT;
@@ -1296,6 +1435,8 @@ void CSU2TCLib::ViscosityGY(){
     }
     Mu += (Mi/Na * gam_i) / denom;
   }
+
+  return Mu;
 }
 
 void CSU2TCLib::ThermalConductivitiesGY(){
@@ -1370,13 +1511,26 @@ void CSU2TCLib::ThermalConductivitiesGY(){
 
 vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel){
 
-  vector<su2double> val_eves;
+  rhos = val_rhos;
+
+  /*--- The species energies of the last bisection step are left in eves, as before. ---*/
+  Temperatures(rhos.data(), rhoE, rhoEve, rhoEvel, eves.data(), T, Tve);
+
+  temperatures[0] = T;
+  temperatures[1] = Tve;
+
+  return temperatures;
+
+}
+
+void CSU2TCLib::Temperatures(const su2double* rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel,
+                             su2double* val_eves, su2double& T, su2double& Tve) const {
+
+  unsigned short iSpecies;
   su2double rhoCvtr, rhoE_f, rhoE_ref, rhoEve_t, Tve2, Tve_o, Btol, Tmin, Tmax;
   bool Bconvg;
   unsigned short iIter, maxBIter;
 
-  rhos = val_rhos;
-
   /*----------Translational temperature----------*/
 
   rhoE_f   = 0.0;
@@ -1410,7 +1564,7 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
 
   for (iIter = 0; iIter < maxBIter; iIter++) {
     Tve      = (Tve_o+Tve2)/2.0;
-    val_eves = ComputeSpeciesEve(Tve);
+    SpeciesEve(Tve, val_eves);
     rhoEve_t = 0.0;
     for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
     if (fabs(rhoEve_t - rhoEve) < Btol) {
@@ -1424,14 +1578,9 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
   // If absolutely no convergence, then assign to the TR temperature
   if (!Bconvg) Tve = T;
 
-  temperatures[0] = T;
-  temperatures[1] = Tve;
-
-  return temperatures;
-
 }
 
-void CSU2TCLib::GetChemistryEquilConstants(unsigned short iReaction){
+void CSU2TCLib::GetChemistryEquilConstants(unsigned short iReaction, su2activematrix& RxnConstantTable) const {
 
   if (gas_model == "O2"){
 
@@ -34,21 +34,9 @@ CVanDerWaalsGas::CVanDerWaalsGas(su2double gamma, su2double R, su2double Pstar,
 }
 
 void CVanDerWaalsGas::SetTDState_rhoe(su2double rho, su2double e) {
-  Density = rho;
-  StaticEnergy = e;
-
-  Pressure = Gamma_Minus_One * Density / (1.0 - Density * b) * (StaticEnergy + Density * a) - a * Density * Density;
-  Temperature = (Pressure + Density * Density * a) * ((1 - Density * b) / (Density * Gas_Constant));
-  Entropy = Gas_Constant * (log(Temperature) / Gamma_Minus_One + log(1 / Density - b));
-
-  dPde_rho = Density * Gamma_Minus_One / (1.0 - Density * b);
-  dPdrho_e = Gamma_Minus_One / (1.0 - Density * b) *
-                 ((StaticEnergy + 2 * Density * a) + Density * b * (StaticEnergy + Density * a) / (1.0 - Density * b)) -
-             2 * Density * a;
-  dTdrho_e = Gamma_Minus_One / Gas_Constant * a;
-  dTde_rho = Gamma_Minus_One / Gas_Constant;
-
-  SoundSpeed2 = dPdrho_e + Pressure / (Density * Density) * dPde_rho;
+  CFluidState<su2double> state;
+  TDState_rhoe(rho, e, state, true);
+  SetTDState(rho, e, state, true);
 
   Zed = Pressure / (Gas_Constant * Temperature * Density);
 }
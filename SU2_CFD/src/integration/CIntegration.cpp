@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -49,25 +50,42 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
                     (config->GetTime_Marching() == DT_STEPPING_2ND));
 
+  /*--- Active set iterations, skip the frozen points except on full sweeps. ---*/
+
+  if (config->GetActiveSet()) solver_container[MainSolver]->SetSkipFrozen(config);
+
   /*--- Compute inviscid residuals ---*/
 
   switch (config->GetKind_ConvNumScheme()) {
-    case SPACE_CENTERED:
+    case SPACE_CENTERED: {
+      SU2_PROFILE_SCOPE("Centered_Residual");
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
       break;
-    case SPACE_UPWIND:
+    }
+    case SPACE_UPWIND: {
+      SU2_PROFILE_SCOPE("Upwind_Residual");
       solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
       break;
-    case FINITE_ELEMENT:
+    }
+    case FINITE_ELEMENT: {
+      SU2_PROFILE_SCOPE("Convective_Residual");
       solver_container[MainSolver]->Convective_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
       break;
+    }
   }
 
-  /*--- Compute viscous residuals ---*/
-  solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  /*--- Compute viscous residuals (the flow and turbulence solvers compute them
+   *    edge by edge in the convective loop, their cost is part of that region). ---*/
+  {
+    SU2_PROFILE_SCOPE("Viscous_Residual");
+    solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
-  solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  {
+    SU2_PROFILE_SCOPE("Source_Residual");
+    solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -79,6 +97,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   CNumerics* conv_bound_numerics = numerics[CONV_BOUND_TERM + omp_get_thread_num()*MAX_TERMS];
   CNumerics* visc_bound_numerics = numerics[VISC_BOUND_TERM + omp_get_thread_num()*MAX_TERMS];
 
+  SU2_PROFILE_SCOPE("Boundary_Conditions");
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
@@ -91,9 +111,10 @@ void CIntegration::Space_Integration(CGeometry *geometry,
     solver_container[MainSolver]->PreprocessBC_Giles(geometry, config, conv_bound_numerics, OUTFLOW);
   }
 
-  /*--- Weak boundary conditions ---*/
+  /*--- Weak boundary conditions (multirate integration skips the markers without points in the active level) ---*/
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!solver_container[MainSolver]->ActiveMarker(iMarker)) continue;
     KindBC = config->GetMarker_All_KindBC(iMarker);
     switch (KindBC) {
       case EULER_WALL:
@@ -151,7 +172,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Strong boundary conditions (Navier-Stokes and Dirichlet type BCs) ---*/
 
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if (!solver_container[MainSolver]->ActiveMarker(iMarker)) continue;
     switch (config->GetMarker_All_KindBC(iMarker)) {
       case ISOTHERMAL:
         solver_container[MainSolver]->BC_Isothermal_Wall(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
@@ -174,6 +196,7 @@ void CIntegration::Space_Integration(CGeometry *geometry,
         solver_container[MainSolver]->BC_Smoluchowski_Maxwell(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config, iMarker);
         break;
     }
+  }
 
   /*--- Complete residuals for periodic boundary conditions. We loop over
    the periodic BCs in matching pairs so that, in the event that there are
@@ -189,6 +212,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                     unsigned short iRKStep, unsigned short RunTime_EqSystem) {
 
+  SU2_PROFILE_SCOPE("Time_Integration");
+
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
   switch (config->GetKind_TimeIntScheme()) {
@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CMultiGridIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CMultiGridIntegration::CMultiGridIntegration() : CIntegration() { }
@@ -136,6 +137,11 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
   CConfig* config = config_container[iZone];
 
+  /*--- Time of each level, inclusive of the coarser ones (their regions are nested in this one). ---*/
+
+  const CProfilerScope levelScope(CProfiler::IsEnabled()?
+                                  CProfiler::RegisterRegion(("MG_Level_" + to_string(iMesh)).c_str()) : 0);
+
   const unsigned short Solver_Position = config->GetContainerPosition(RunTime_EqSystem);
   const bool classical_rk4 = (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT);
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -168,6 +174,11 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
   for (unsigned short iPreSmooth = 0; iPreSmooth < config->GetMG_PreSmooth(iMesh); iPreSmooth++) {
 
+    if (solver_fine->GetnTimeLevel() > 1) {
+      Multirate_Step(geometry_fine, solver_container_fine, numerics_fine, config, iRKLimit, RunTime_EqSystem);
+      continue;
+    }
+
     /*--- Time and space integration ---*/
 
     for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
@@ -251,13 +262,18 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
     if (implicit) config->SetKind_TimeIntScheme(EULER_IMPLICIT);
 
-    /*--- Recursive call to MultiGrid_Cycle (this routine). ---*/
+    /*--- Recursive call to MultiGrid_Cycle (this routine), once for V cycles and twice for W and F
+     *    cycles, the second visit of the coarse level in an F cycle is a V cycle. ---*/
 
-    for (unsigned short imu = 0; imu <= RecursiveParam; imu++) {
+    const unsigned short nVisit = (RecursiveParam == V_CYCLE)? 1 : 2;
+
+    for (unsigned short iVisit = 0; iVisit < nVisit; iVisit++) {
 
       unsigned short nextRecurseParam = RecursiveParam;
+      if ((RecursiveParam == F_CYCLE) && (iVisit > 0))
+        nextRecurseParam = V_CYCLE;
       if (iMesh == config->GetnMGLevels()-2)
-        nextRecurseParam = 0;
+        nextRecurseParam = V_CYCLE;
 
       MultiGrid_Cycle(geometry, solver_container, numerics_container, config_container,
                       iMesh+1, nextRecurseParam, RunTime_EqSystem, iZone, iInst);
@@ -300,6 +316,53 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
 }
 
+void CMultiGridIntegration::Multirate_Step(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                                           CConfig *config, unsigned short iRKLimit, unsigned short RunTime_EqSystem) {
+
+  CSolver* solver = solver_container[config->GetContainerPosition(RunTime_EqSystem)];
+  const unsigned short nTimeLevel = solver->GetnTimeLevel();
+
+  /*--- Time step, and time levels, from the state at the beginning of the global step. The stages
+   *    only recompute the primitives of the level advanced by the previous stage, and the sources
+   *    and boundary conditions of the active level. ---*/
+
+  solver->StartMultirateStep();
+
+  solver->Preprocessing(geometry, solver_container, config, MESH_0, 0, RunTime_EqSystem, false);
+
+  solver->SetTime_Step(geometry, solver_container, config, MESH_0, config->GetTimeIter());
+
+  /*--- The global step is made of 2^(nTimeLevel-1) steps of the finest level, at the end of
+   *    each of these the levels whose step also ends there are advanced, finer ones first. ---*/
+
+  const unsigned long nSubStep = 1ul << (nTimeLevel-1);
+
+  for (unsigned long iSubStep = 0; iSubStep < nSubStep; ++iSubStep) {
+    for (unsigned short iLevel = 0; iLevel < nTimeLevel; ++iLevel) {
+
+      if ((iSubStep+1) % (1ul << iLevel) != 0) continue;
+
+      for (unsigned short iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
+
+        solver->SetActiveTimeLevel(iLevel, iRKStep == iRKLimit-1);
+
+        /*--- The very first stage uses the preprocessing done for the time step. ---*/
+
+        if ((iSubStep > 0) || (iLevel > 0) || (iRKStep > 0))
+          solver->Preprocessing(geometry, solver_container, config, MESH_0, iRKStep, RunTime_EqSystem, false);
+
+        if (iRKStep == 0) solver->Set_OldSolution();
+
+        Space_Integration(geometry, solver_container, numerics, config, MESH_0, iRKStep, RunTime_EqSystem);
+
+        Time_Integration(geometry, solver_container, config, iRKStep, RunTime_EqSystem);
+
+        solver->Postprocessing(geometry, solver_container, config, MESH_0);
+      }
+    }
+  }
+}
+
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse,
                                                       CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   unsigned long Point_Fine, Point_Coarse, iVertex;
@@ -59,6 +59,56 @@ public:
 };
 }
 
+void CNewtonKrylovController::SetParameters(const array<su2double,6>& param) {
+  ewGamma = SU2_TYPE::GetValue(param[0]);
+  ewAlpha = SU2_TYPE::GetValue(param[1]);
+  etaMax = SU2_TYPE::GetValue(param[2]);
+  rateRebuild = SU2_TYPE::GetValue(param[3]);
+  rateUnstable = SU2_TYPE::GetValue(param[4]);
+  maxPrecondAge = static_cast<unsigned long>(SU2_TYPE::GetValue(param[5]));
+}
+
+passivedouble CNewtonKrylovController::ForcingTerm(passivedouble norm, passivedouble etaMin) const {
+
+  if (resNorm <= 0.0) return etaMax;
+
+  passivedouble etaNew = ewGamma * pow(norm / resNorm, ewAlpha);
+
+  /*--- Safeguard against a sudden decrease of the tolerance (if the previous one was large). ---*/
+  const passivedouble etaSafe = ewGamma * pow(eta, ewAlpha);
+  if (etaSafe > 0.1) etaNew = max(etaNew, etaSafe);
+
+  return min(etaMax, max(etaMin, etaNew));
+}
+
+CFL_ADAPT_SIGNAL CNewtonKrylovController::CFLSignal(passivedouble rate, passivedouble eps,
+                                                    passivedouble forcing) const {
+  if ((rate > rateUnstable) || (eps > 1.2*forcing)) return CFL_ADAPT_SIGNAL::REDUCE;
+  if ((rate > 1.0) || (eps > forcing)) return CFL_ADAPT_SIGNAL::HOLD;
+  return CFL_ADAPT_SIGNAL::INCREASE;
+}
+
+void CNewtonKrylovController::Update(bool rebuild, unsigned long iters, passivedouble eps, passivedouble forcing,
+                                     passivedouble norm, passivedouble evalTime, passivedouble solveTime) {
+
+  const passivedouble iterTime = solveTime / max(iters, 1ul);
+
+  if (rebuild) {
+    rebuildTime = max(0.0, evalTime - ((residualTime > 0.0)? residualTime : iterTime));
+    reuseTime = 0.0;
+    precondAge = 0;
+    baseLinIters = iters;
+  }
+  else {
+    residualTime = evalTime;
+    reuseTime += (iters - min(iters, baseLinIters)) * iterTime;
+    ++precondAge;
+  }
+  rebuildNext = (reuseTime > rebuildTime) || (eps > forcing);
+  resNorm = norm;
+  eta = forcing;
+}
+
 CNewtonIntegration::~CNewtonIntegration() { delete preconditioner; }
 
 void CNewtonIntegration::Setup() {
@@ -74,6 +124,19 @@ void CNewtonIntegration::Setup() {
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
 
+  adaptive = config->GetNewtonKrylovAdapt();
+  controller.SetParameters(config->GetNewtonKrylovAdaptParam());
+
+  if (adaptive && (SU2_MPI::GetRank() == MASTER_NODE)) {
+    /*--- Named after the history file (and zone), as the other convergence records. ---*/
+    auto fileName = config->GetConv_FileName();
+    fileName = fileName.substr(0, fileName.find_last_of('.')) + "_newton_krylov";
+    fileName = config->GetMultizone_HistoryFileName(fileName, config->GetiZone(), ".csv");
+    controllerLog.open(fileName);
+    controllerLog << "\"Inner_Iter\",\"Residual\",\"Rate\",\"Forcing\",\"Lin_Iters\",\"Lin_Residual\","
+                     "\"Precond\",\"Age\",\"Rebuild_Time\",\"Reuse_Time\",\"CFL\"\n";
+  }
+
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
   const auto nPointDomain = geometry->GetnPointDomain();
@@ -118,6 +181,16 @@ void CNewtonIntegration::Setup() {
     precondOut.Initialize(nPoint, nPointDomain, nVar, nullptr);
   }
 
+  /*--- These preconditioners keep their own factorization, the others use the matrix when applied. ---*/
+  switch (config->GetKind_Linear_Solver_Prec()) {
+    case JACOBI: case ILU: case PASTIX_ILU: case PASTIX_LU_P: case PASTIX_LDLT_P:
+      reusablePrecond = (precondIters == 0);
+      break;
+    default:
+      reusablePrecond = false;
+      break;
+  }
+
   /*--- Only possible with a preconditioner. ---*/
   startupPeriod = (startupIters > 0) || (startupResidual < 0.0);
 
@@ -197,21 +270,56 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   solvers[FLOW_SOL]->Set_OldSolution();
 
-  /*--- Current residual. ---*/
+  /*--- Current residual, and approximate Jacobian for preconditioning. When the preconditioner is reused
+   *    the Jacobian is not needed, evaluating the residual explicitly saves its assembly, and the
+   *    pseudo-time term is not added to its diagonal either. ---*/
 
-  ComputeResiduals(DEFAULT);
+  auto evaluateResidual = [&](ResEvalType type) {
+    const auto TimeIntScheme = config->GetKind_TimeIntScheme();
 
-  /*--- Compute the approximate Jacobian for preconditioning. ---*/
+    ComputeResiduals(type);
 
-  solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+    solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
 
-  solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
+    if (type == EXPLICIT) {
+      SU2_OMP_MASTER
+      config->SetKind_TimeIntScheme(EULER_EXPLICIT);
+      SU2_OMP_BARRIER
+    }
 
-  if (preconditioner) preconditioner->Build();
+    solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
-    LinSysRes[i] = SU2_TYPE::GetValue(solvers[FLOW_SOL]->LinSysRes[i]);
+    if (type == EXPLICIT) {
+      SU2_OMP_MASTER
+      config->SetKind_TimeIntScheme(TimeIntScheme);
+      SU2_OMP_BARRIER
+    }
+
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
+      LinSysRes[i] = SU2_TYPE::GetValue(solvers[FLOW_SOL]->LinSysRes[i]);
+  };
+
+  bool rebuild = !adaptive || !reusablePrecond || startupPeriod || controller.RebuildNext();
+
+  auto startTime = SU2_MPI::Wtime();
+
+  evaluateResidual(rebuild? DEFAULT : EXPLICIT);
+
+  const passivedouble resNormNew = adaptive? SU2_TYPE::GetValue(LinSysRes.norm()) : 0.0;
+  const passivedouble rate = controller.Rate(resNormNew);
+
+  /*--- The nonlinear convergence degraded, rebuild with the current state. ---*/
+
+  if (!rebuild && controller.Degraded(rate)) {
+    rebuild = true;
+    startTime = SU2_MPI::Wtime();
+    evaluateResidual(DEFAULT);
+  }
+
+  if (rebuild && preconditioner) preconditioner->Build();
+
+  const passivedouble evalTime = SU2_MPI::Wtime() - startTime;
 
   su2double residual = 0.0;
   for (auto iVar = 0ul; iVar < LinSysRes.GetNVar(); ++iVar)
@@ -234,7 +342,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   Scalar toleranceFactor = 1.0;
 
-  if (!startupPeriod && tolRelaxFactor > 1 && fullTolResidual < 0.0) {
+  if (!adaptive && !startupPeriod && tolRelaxFactor > 1 && fullTolResidual < 0.0) {
     SU2_OMP_MASTER
     firstResidual = max(firstResidual, residual);
     SU2_OMP_BARRIER
@@ -247,8 +355,16 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   auto iter = config->GetLinear_Solver_Iter();
   Scalar eps = SU2_TYPE::GetValue(config->GetLinear_Solver_Error());
 
+  /*--- Adaptive tolerance, only for the NK solves. ---*/
+
+  if (adaptive && !startupPeriod)
+    eps = controller.ForcingTerm(resNormNew, SU2_TYPE::GetValue(config->GetLinear_Solver_Error()));
+  const passivedouble forcing = SU2_TYPE::GetValue(eps);
+
   auto& linSysSol = GetSolutionVec(solvers[FLOW_SOL]->LinSysSol);
 
+  startTime = SU2_MPI::Wtime();
+
   if (startupPeriod) {
     iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
   }
@@ -263,12 +379,39 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   }
   SetSolutionResult(solvers[FLOW_SOL]->LinSysSol);
 
+  const passivedouble solveTime = SU2_MPI::Wtime() - startTime;
+
+  /*--- The CFL adaptation compares the linear residual with its tolerance, with the
+   *    adaptive controller it is told directly if the step was stable instead. ---*/
+
+  auto cflSignal = CFL_ADAPT_SIGNAL::NONE;
+
+  if (adaptive && !startupPeriod) cflSignal = controller.CFLSignal(rate, SU2_TYPE::GetValue(eps), forcing);
+
   SU2_OMP_MASTER {
     solvers[FLOW_SOL]->SetIterLinSolver(iter);
     solvers[FLOW_SOL]->SetResLinSolver(eps);
+    solvers[FLOW_SOL]->SetCFLAdaptSignal(cflSignal);
   }
   SU2_OMP_BARRIER
 
+  if (adaptive) {
+    SU2_OMP_MASTER {
+      controller.Update(rebuild, iter, SU2_TYPE::GetValue(eps), forcing, resNormNew, evalTime, solveTime);
+
+      if (controllerLog.is_open()) {
+        const char* cflName = (cflSignal == CFL_ADAPT_SIGNAL::INCREASE)? "increase" :
+                              (cflSignal == CFL_ADAPT_SIGNAL::REDUCE)? "reduce" :
+                              (cflSignal == CFL_ADAPT_SIGNAL::HOLD)? "hold" : "linear";
+        controllerLog << config->GetInnerIter() << ", " << resNormNew << ", " << rate << ", " << forcing << ", "
+                      << iter << ", " << eps << ", " << (rebuild? "rebuild" : "reuse") << ", "
+                      << controller.GetPrecondAge() << ", " << controller.GetRebuildTime() << ", "
+                      << controller.GetReuseTime() << ", " << cflName << '\n';
+      }
+    }
+    SU2_OMP_BARRIER
+  }
+
   /// TODO: Clever back-tracking and CFL adaptation based on residual reduction.
 
   /*--- Update solution. ---*/
@@ -293,6 +436,8 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
     SU2_OMP_MASTER {
       startupPeriod = false;
       firstResidual = residual;
+      /*--- Restart the forcing terms. ---*/
+      controller.Restart();
     }
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
@@ -30,15 +30,18 @@
 #include "../../../Common/include/CConfig.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
 #include "../../include/solvers/CSolver.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 CInterface::CInterface(void) :
   rank(SU2_MPI::GetRank()),
-  size(SU2_MPI::GetSize()) {
+  size(SU2_MPI::GetSize()),
+  comm(SU2_MPI::GetComm()) {
 }
 
 CInterface::CInterface(unsigned short val_nVar, unsigned short val_nConst) :
   rank(SU2_MPI::GetRank()),
   size(SU2_MPI::GetSize()),
+  comm(SU2_MPI::GetComm()),
   nVar(val_nVar) {
 
   Physical_Constants = new su2double[val_nConst] ();
@@ -59,101 +62,260 @@ CInterface::~CInterface(void) {
   delete[] SpanLevelDonor;
 }
 
-void CInterface::BroadcastData(const CInterpolator& interpolator,
-                               CSolver *donor_solution, CSolver *target_solution,
-                               CGeometry *donor_geometry, CGeometry *target_geometry,
-                               const CConfig *donor_config, const CConfig *target_config) {
+void CInterface::CTransferPlan::Build(vector<pair<unsigned long, unsigned long> > localDonor,
+                                      const vector<unsigned long>& donorStart,
+                                      const vector<unsigned long>& donorIndex, SU2_Comm comm) {
+  Free();
+
+  int rank = 0, size = 1;
+  SU2_MPI::Comm_rank(comm, &rank);
+  SU2_MPI::Comm_size(comm, &size);
+
+  sort(localDonor.begin(), localDonor.end());
+
+  /*--- Gather the donor indices to find the owner of each donor point, this (the only
+   *    global operation) is done once per update of the interpolation coefficients. ---*/
+
+  int nLocalDonor = localDonor.size();
+  vector<int> nAllDonor(size), displDonor(size+1,0);
+  SU2_MPI::Allgather(&nLocalDonor, 1, MPI_INT, nAllDonor.data(), 1, MPI_INT, comm);
+  for (int i = 0; i < size; ++i) displDonor[i+1] = displDonor[i] + nAllDonor[i];
+
+  vector<unsigned long> sendIdx(nLocalDonor), allDonorIdx(displDonor[size]);
+  for (int i = 0; i < nLocalDonor; ++i) sendIdx[i] = localDonor[i].first;
+
+  SU2_MPI::Allgatherv(sendIdx.data(), nLocalDonor, MPI_UNSIGNED_LONG, allDonorIdx.data(),
+                      nAllDonor.data(), displDonor.data(), MPI_UNSIGNED_LONG, comm);
+
+  vector<pair<unsigned long, int> > donorOwner(allDonorIdx.size());
+  for (int iRank = 0; iRank < size; ++iRank)
+    for (int i = displDonor[iRank]; i < displDonor[iRank+1]; ++i)
+      donorOwner[i] = make_pair(allDonorIdx[i], iRank);
+  sort(donorOwner.begin(), donorOwner.end());
+
+  vector<int> owner(donorIndex.size());
+  for (auto i = 0ul; i < donorIndex.size(); ++i) {
+    const auto it = lower_bound(donorOwner.begin(), donorOwner.end(), make_pair(donorIndex[i], 0));
+    if (it == donorOwner.end() || it->first != donorIndex[i])
+      SU2_MPI::Error("A donor point of the interpolation is not owned by any rank.", CURRENT_FUNCTION);
+    owner[i] = it->second;
+  }
+
+  /*--- Donor points required by this rank, unique per owner. ---*/
+
+  vector<vector<unsigned long> > request(size);
+  for (auto i = 0ul; i < donorIndex.size(); ++i) request[owner[i]].push_back(donorIndex[i]);
+
+  for (auto& req : request) {
+    sort(req.begin(), req.end());
+    req.erase(unique(req.begin(), req.end()), req.end());
+  }
+
+  /*--- Exchange the number of requests and the requested indices. ---*/
+
+  vector<int> nRequest(size), nRequested(size), displRequest(size+1,0), displRequested(size+1,0);
+  for (int i = 0; i < size; ++i) nRequest[i] = request[i].size();
+
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequested.data(), 1, MPI_INT, comm);
+
+  for (int i = 0; i < size; ++i) {
+    displRequest[i+1] = displRequest[i] + nRequest[i];
+    displRequested[i+1] = displRequested[i] + nRequested[i];
+  }
+
+  vector<unsigned long> requestIdx(displRequest[size]), requestedIdx(displRequested[size]);
+  for (int i = 0; i < size; ++i)
+    copy(request[i].begin(), request[i].end(), requestIdx.begin()+displRequest[i]);
+
+  SU2_MPI::Alltoallv(requestIdx.data(), nRequest.data(), displRequest.data(), MPI_UNSIGNED_LONG,
+                     requestedIdx.data(), nRequested.data(), displRequested.data(), MPI_UNSIGNED_LONG, comm);
+
+  /*--- Neighbours of the exchange, this rank is always one of them (possibly without data)
+   *    to keep the count buffers non-empty. ---*/
+
+  sendRanks.clear(); sendCounts.clear(); sendDispl.clear();
+  recvRanks.clear(); recvCounts.clear(); recvDispl.clear();
+
+  for (int i = 0; i < size; ++i) {
+    if (nRequested[i] || i == rank) {
+      sendRanks.push_back(i);
+      sendCounts.push_back(nRequested[i]);
+      sendDispl.push_back(displRequested[i]);
+    }
+    if (nRequest[i] || i == rank) {
+      recvRanks.push_back(i);
+      recvCounts.push_back(nRequest[i]);
+      recvDispl.push_back(displRequest[i]);
+    }
+  }
+
+  /*--- Map the requested indices to the local donor vertices, each is evaluated once per exchange. ---*/
+
+  vector<long> slotOfDonor(localDonor.size(), -1);
+  donorVertex.clear();
+  sendSlot.resize(requestedIdx.size());
+
+  for (auto i = 0ul; i < requestedIdx.size(); ++i) {
+    const auto it = lower_bound(localDonor.begin(), localDonor.end(), make_pair(requestedIdx[i], 0ul));
+    assert(it != localDonor.end() && it->first == requestedIdx[i]);
+    const auto iDonor = it - localDonor.begin();
+
+    if (slotOfDonor[iDonor] < 0) {
+      slotOfDonor[iDonor] = donorVertex.size();
+      donorVertex.push_back(it->second);
+    }
+    sendSlot[i] = slotOfDonor[iDonor];
+  }
+
+  /*--- Row of the receive buffer of each donor of each target vertex. ---*/
+
+  targetStart = donorStart;
+  targetSlot.resize(donorIndex.size());
+
+  for (auto i = 0ul; i < donorIndex.size(); ++i) {
+    const auto& req = request[owner[i]];
+    const auto pos = lower_bound(req.begin(), req.end(), donorIndex[i]) - req.begin();
+    targetSlot[i] = displRequest[owner[i]] + pos;
+  }
+
+  SU2_MPI::Dist_graph_create_adjacent(comm, recvRanks.size(), recvRanks.data(),
+                                      sendRanks.size(), sendRanks.data(), &graphComm);
+  built = true;
+}
+
+void CInterface::CTransferPlan::Exchange(const su2activematrix& donorValues, su2activematrix& recvValues) const {
   static_assert(su2activematrix::Storage == StorageType::RowMajor,"");
 
-  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
-                        donor_config, target_config);
+  const auto nVar = donorValues.cols();
+
+  /*--- Pack the send buffer in the order requested by each neighbour. ---*/
+
+  sendBuffer.resize(sendSlot.size(), nVar);
+
+  for (auto iSend = 0ul; iSend < sendSlot.size(); iSend++)
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      sendBuffer(iSend, iVar) = donorValues(sendSlot[iSend], iVar);
+
+  recvValues.resize(recvDispl.back() + recvCounts.back(), nVar);
+
+  /*--- Counts and displacements in number of values. ---*/
+
+  auto scale = [nVar](const vector<int>& points, vector<int>& values) {
+    values.resize(points.size());
+    for (auto i = 0ul; i < points.size(); ++i) values[i] = points[i] * nVar;
+  };
+  scale(sendCounts, valCounts[0]);
+  scale(sendDispl, valCounts[1]);
+  scale(recvCounts, valCounts[2]);
+  scale(recvDispl, valCounts[3]);
+
+  SU2_MPI::Neighbor_alltoallv(sendBuffer.data(), valCounts[0].data(), valCounts[1].data(), MPI_DOUBLE,
+                              recvValues.data(), valCounts[2].data(), valCounts[3].data(), MPI_DOUBLE, graphComm);
+}
+
+void CInterface::CTransferPlan::Free() {
+  if (built) SU2_MPI::Comm_free(&graphComm);
+  built = false;
+}
+
+void CInterface::ResetTransferPlan() {
+
+  for (auto& plan : transferPlans) plan.Free();
+  transferPlans.clear();
+  transferPlanBuilt = false;
+}
+
+void CInterface::BuildTransferPlans(const CInterpolator& interpolator,
+                                    const CGeometry *donor_geometry, const CGeometry *target_geometry,
+                                    const CConfig *donor_config, const CConfig *target_config) {
+
+  ResetTransferPlan();
 
   /*--- Loop over interface markers. ---*/
 
   for (auto iMarkerInt = 0u; iMarkerInt < donor_config->GetMarker_n_ZoneInterface()/2; iMarkerInt++) {
 
-    /*--- Check if this interface connects the two zones, if not continue. ---*/
+    /*--- Check if this interface connects the two zones (over the ranks of the transfer), if not continue. ---*/
 
-    const auto markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
-    const auto markTarget = target_config->FindInterfaceMarker(iMarkerInt);
+    const int markDonor = donor_config->FindInterfaceMarker(iMarkerInt);
+    const int markTarget = target_config->FindInterfaceMarker(iMarkerInt);
 
-    if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
+    int markCheck[2] = {markDonor, markTarget}, markCheckAll[2] = {-1, -1};
+    SU2_MPI::Allreduce(markCheck, markCheckAll, 2, MPI_INT, MPI_MAX, comm);
+    if ((markCheckAll[0] == -1) || (markCheckAll[1] == -1)) continue;
 
-    /*--- Count donor vertices on this rank. ---*/
+    /*--- Global indices of the donor vertices owned by this rank. ---*/
 
-    int nLocalVertexDonor = 0;
+    vector<pair<unsigned long, unsigned long> > localDonor;
     if (markDonor >= 0) {
       for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
         /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+        if (donor_geometry->nodes->GetDomain(iPoint))
+          localDonor.emplace_back(donor_geometry->nodes->GetGlobalIndex(iPoint), iVertex);
       }
     }
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
-
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    /*--- Donors of the target vertices of this rank, non-domain vertices have none. ---*/
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+    vector<unsigned long> donorStart(1, 0), donorIndex;
+    if (markTarget >= 0) {
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (target_geometry->nodes->GetDomain(iPoint)) {
+          const auto& globalPoint = interpolator.targetVertices[markTarget][iVertex].globalPoint;
+          donorIndex.insert(donorIndex.end(), globalPoint.begin(), globalPoint.end());
+        }
+        donorStart.push_back(donorIndex.size());
+      }
     }
 
-    /*--- Fill send buffers. ---*/
+    transferPlans.emplace_back();
+    auto& plan = transferPlans.back();
+    plan.markDonor = markDonor;
+    plan.markTarget = markTarget;
+    plan.Build(move(localDonor), donorStart, donorIndex, comm);
+  }
 
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+  transferPlanBuilt = true;
+}
 
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+void CInterface::BroadcastData(const CInterpolator& interpolator,
+                               CSolver *donor_solution, CSolver *target_solution,
+                               CGeometry *donor_geometry, CGeometry *target_geometry,
+                               const CConfig *donor_config, const CConfig *target_config) {
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
+  SU2_PROFILE_SCOPE("Interface::BroadcastData");
 
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+  GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
+                        donor_config, target_config);
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
-        }
-      }
-    }
+  if (!transferPlanBuilt)
+    BuildTransferPlans(interpolator, donor_geometry, target_geometry, donor_config, target_config);
 
-    /*--- Gather data. ---*/
+  /*--- Loop over the interface markers that connect the two zones. ---*/
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+  for (const auto& plan : transferPlans) {
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+    const auto markDonor = plan.markDonor;
+    const auto markTarget = plan.markTarget;
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+    /*--- Evaluate the donor variables required by any rank, and send them where needed. ---*/
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+    donorValues.resize(plan.donorVertex.size(), nVar);
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+    for (auto iDonor = 0ul; iDonor < plan.donorVertex.size(); iDonor++) {
+      const auto iVertex = plan.donorVertex[iDonor];
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+      for (auto iVar = 0u; iVar < nVar; iVar++) donorValues(iDonor, iVar) = Donor_Variable[iVar];
+    }
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+    plan.Exchange(donorValues, recvBuffer);
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
-    }
+    /*--- This rank does not need to do more work. ---*/
+    if (markTarget < 0) continue;
 
     /*--- Loop over target vertices. ---*/
 
@@ -162,26 +324,17 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
 
       if (!target_geometry->nodes->GetDomain(iPoint)) continue;
 
-      auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
+      const auto& targetVertex = interpolator.targetVertices[markTarget][iVertex];
       const auto nDonorPoints = targetVertex.nDonor();
+      const auto* slot = plan.targetSlot.data() + plan.targetStart[iVertex];
 
       InitializeTarget_Variable(target_solution, markTarget, iVertex, nDonorPoints);
 
       /*--- For the number of donor points. ---*/
       for (auto iDonorPoint = 0ul; iDonorPoint < nDonorPoints; iDonorPoint++) {
 
-        /*--- Get the global index of the donor and the interpolation coefficient. ---*/
-
-        const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
-        const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
-
-        /*--- Find the index of the global donor point in the donor data. ---*/
-
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
-
         /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+        RecoverTarget_Variable(recvBuffer[slot[iDonorPoint]], targetVertex.coefficient[iDonorPoint]);
 
         /*--- If the value is not directly aggregated in the previous function. ---*/
         if (!valAggregated)
@@ -242,8 +395,8 @@ void CInterface::PreprocessAverage(CGeometry *donor_geometry, CGeometry *target_
     BuffDonorFlag[iSize] = -1;
   }
 
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(&Donor_Flag, 1 , MPI_INT, BuffDonorFlag, 1, MPI_INT, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, comm);
+  SU2_MPI::Allgather(&Donor_Flag, 1 , MPI_INT, BuffDonorFlag, 1, MPI_INT, comm);
 
   Marker_Donor= -1;
   Donor_Flag= -1;
@@ -468,22 +621,22 @@ void CInterface::AllgatherAverage(CSolver *donor_solution, CSolver *target_solut
   }
 
   SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
   SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor,
-                     nSpanDonor, MPI_DOUBLE, SU2_MPI::GetComm());
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, SU2_MPI::GetComm());
+                     nSpanDonor, MPI_DOUBLE, comm);
+  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, comm);
 
   for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
     avgDensityDonor[iSpan]            = -1.0;
@@ -1422,6 +1422,15 @@ void CFlowOutput::WriteForcesBreakdown(CConfig *config, CGeometry *geometry, CSo
           Breakdown_file << "Critical Pressure (non-dim):   " << config->GetPressure_Critical() /config->GetPressure_Ref() << "\n";
           Breakdown_file << "Critical Temperature (non-dim) :  " << config->GetTemperature_Critical() /config->GetTemperature_Ref() << "\n";
           break;
+
+        case LUT_GAS:
+          Breakdown_file << "Fluid Model: Look-up table "<< "\n";
+          if (config->GetLUT_FileName() != "NONE")
+            Breakdown_file << "Table file: " << config->GetLUT_FileName() << "\n";
+          else
+            Breakdown_file << "Table generated from: " << (config->GetKind_LUT_BaseModel() == PR_GAS? "PR_GAS" :
+                                                           config->GetKind_LUT_BaseModel() == VW_GAS? "VW_GAS" : "IDEAL_GAS") << "\n";
+          break;
       }
 
       if (viscous) {
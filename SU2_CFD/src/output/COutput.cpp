@@ -44,6 +44,7 @@
 
 
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "../../include/solvers/CSolver.hpp"
 
 COutput::COutput(CConfig *config, unsigned short nDim, bool fem_output): femOutput(fem_output) {
@@ -195,6 +196,8 @@ void COutput::SetHistory_Output(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  SU2_PROFILE_SCOPE("Output::SetHistory_Output");
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -289,6 +292,23 @@ void COutput::SetMultizoneHistory_Output(COutput **output, CConfig **config, CCo
 
 }
 
+void COutput::BroadcastHistoryOutput(int root, SU2_Comm comm) {
+
+  /*--- The fields are the same on all ranks, the values are packed in the order of their insertion. ---*/
+
+  const auto nField = historyOutput_List.size();
+  vector<passivedouble> values(nField);
+
+  for (auto iField = 0ul; iField < nField; iField++)
+    values[iField] = SU2_TYPE::GetValue(historyOutput_Map[historyOutput_List[iField]].value);
+
+  SelectMPIWrapper<passivedouble>::W::Bcast(values.data(), nField, MPI_DOUBLE, root, comm);
+
+  for (auto iField = 0ul; iField < nField; iField++)
+    historyOutput_Map[historyOutput_List[iField]].value = values[iField];
+
+}
+
 void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
   /*---- Construct a data sorter object to partition and distribute
@@ -742,6 +762,8 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, unsigned short f
 bool COutput::SetResult_Files(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing){
 
+  SU2_PROFILE_SCOPE("Output::SetResult_Files");
+
   bool writeFiles = WriteVolume_Output(config, iter, force_writing);
 
   /*--- Check if the data sorters are allocated, if not, allocate them. --- */
@@ -30,6 +30,23 @@
 #include "../include/drivers/CSinglezoneDriver.hpp"
 #include "../../Common/include/toolboxes/geometry_toolbox.hpp"
 
+namespace {
+/*!
+ * \brief Expose nRow x nCol contiguous (row-major) values to Python. The data itself is returned in
+ *        primal builds, in AD builds the values are copied to a passive buffer that backs the view.
+ */
+passivedouble* PythonView(su2double* data, unsigned long nRow, unsigned long nCol, su2passivematrix& mirror) {
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  /*--- Only resize when needed, to keep previous views valid. ---*/
+  if ((mirror.rows() != nRow) || (mirror.cols() != nCol)) mirror.resize(nRow, nCol);
+  for (auto i = 0ul; i < nRow*nCol; ++i) mirror.data()[i] = SU2_TYPE::GetValue(data[i]);
+  return mirror.data();
+#else
+  return data;
+#endif
+}
+}
+
 void CDriver::PythonInterface_Preprocessing(CConfig **config, CGeometry ****geometry, CSolver *****solver){
 
   int rank = MASTER_NODE;
@@ -860,3 +877,138 @@ vector<passivedouble> CDriver::GetFlowLoad(unsigned short iMarker, unsigned long
   return FlowLoad_passive;
 
 }
+
+void CDriver::GetMarkerFlowLoads(unsigned short iMarker, passivedouble* values, int nRow, int nCol) const {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  const auto nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->nVertex[iMarker];
+
+  if ((static_cast<unsigned long>(nRow) != nVertex) || (nCol < nDim))
+    SU2_MPI::Error("The array for the loads must have one row per vertex and one column per dimension.", CURRENT_FUNCTION);
+
+  const bool wall = config_container[ZONE_0]->GetSolid_Wall(iMarker);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; iVertex++) {
+    for (int iDim = 0; iDim < nCol; iDim++) {
+      values[iVertex*nCol+iDim] = (wall && iDim < nDim)? SU2_TYPE::GetValue(solver->GetVertexTractions(iMarker, iVertex, iDim)) : 0.0;
+    }
+  }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/* Bulk access (NumPy views and arrays) to the data of the solvers and markers */
+////////////////////////////////////////////////////////////////////////////////
+
+void CDriver::GetSolutionView(unsigned short iSol, passivedouble** view, int* nRow, int* nCol) {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+
+  if (solver == nullptr) SU2_MPI::Error("The requested solver does not exist.", CURRENT_FUNCTION);
+
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  *nRow = nPoint;
+  *nCol = solver->GetnVar();
+  *view = nPoint? PythonView(solver->GetNodes()->GetSolution(0), *nRow, *nCol, pyViewSolution[iSol]) : nullptr;
+
+}
+
+void CDriver::SetSolutionView(unsigned short iSol) {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][iSol];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  if (solver == nullptr) SU2_MPI::Error("The requested solver does not exist.", CURRENT_FUNCTION);
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  const auto& mirror = pyViewSolution[iSol];
+  for (auto iPoint = 0ul; iPoint < mirror.rows(); iPoint++)
+    for (auto iVar = 0ul; iVar < mirror.cols(); iVar++)
+      solver->GetNodes()->SetSolution(iPoint, iVar, mirror(iPoint,iVar));
+#endif
+
+  solver->InitiateComms(geometry, config_container[ZONE_0], SOLUTION);
+  solver->CompleteComms(geometry, config_container[ZONE_0], SOLUTION);
+
+}
+
+void CDriver::GetPrimitiveView(passivedouble** view, int* nRow, int* nCol) {
+
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+
+  const auto nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  su2double* data = nPoint? solver->GetNodes()->GetPrimitive(0) : nullptr;
+
+  if (nPoint && (data == nullptr)) SU2_MPI::Error("The flow solver does not store primitive variables.", CURRENT_FUNCTION);
+
+  *nRow = nPoint;
+  *nCol = solver->GetnPrimVar();
+  *view = nPoint? PythonView(data, *nRow, *nCol, pyViewPrimitive) : nullptr;
+
+}
+
+void CDriver::GetCoordinatesView(passivedouble** view, int* nRow, int* nCol) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  const auto nPoint = geometry->GetnPoint();
+  *nRow = nPoint;
+  *nCol = nDim;
+  *view = nPoint? PythonView(geometry->nodes->GetCoord(0), *nRow, *nCol, pyViewCoord) : nullptr;
+
+}
+
+void CDriver::GetMarkerPointsView(unsigned short iMarker, unsigned long** view, int* nRow) {
+
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  /*--- The lists are built on first use and kept, the vertices of a marker do not change. ---*/
+
+  if (pyViewMarkerPoints.empty()) pyViewMarkerPoints.resize(config_container[ZONE_0]->GetnMarker_All());
+
+  auto& points = pyViewMarkerPoints[iMarker];
+
+  if (points.size() != geometry->nVertex[iMarker]) {
+    points.resize(geometry->nVertex[iMarker]);
+    for (auto iVertex = 0ul; iVertex < points.size(); iVertex++)
+      points[iVertex] = geometry->vertex[iMarker][iVertex]->GetNode();
+  }
+
+  *nRow = points.size();
+  *view = points.data();
+
+}
+
+void CDriver::SetMarkerMeshDisplacements(unsigned short iMarker, const passivedouble* values, int nRow, int nCol) {
+
+  if ((static_cast<unsigned long>(nRow) != GetNumberVertices(iMarker)) || (nCol < nDim))
+    SU2_MPI::Error("The displacements must have one row per vertex and one column per dimension.", CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < GetNumberVertices(iMarker); iVertex++) {
+    const auto row = values + iVertex*nCol;
+    SetMeshDisplacement(iMarker, iVertex, row[0], row[1], (nDim == 3)? row[2] : 0.0);
+  }
+
+}
+
+void CDriver::SetMarkerFEA_Loads(unsigned short iMarker, const passivedouble* values, int nRow, int nCol) {
+
+  if ((static_cast<unsigned long>(nRow) != GetNumberVertices(iMarker)) || (nCol < nDim))
+    SU2_MPI::Error("The loads must have one row per vertex and one column per dimension.", CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < GetNumberVertices(iMarker); iVertex++) {
+    const auto row = values + iVertex*nCol;
+    SetFEA_Loads(iMarker, iVertex, row[0], row[1], (nDim == 3)? row[2] : 0.0);
+  }
+
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, const passivedouble* values, int nRow) {
+
+  if (static_cast<unsigned long>(nRow) != GetNumberVertices(iMarker))
+    SU2_MPI::Error("The temperatures must have one value per vertex.", CURRENT_FUNCTION);
+
+  for (auto iVertex = 0ul; iVertex < GetNumberVertices(iMarker); iVertex++)
+    SetVertexTemperature(iMarker, iVertex, values[iVertex]);
+
+}
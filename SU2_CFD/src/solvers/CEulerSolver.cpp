@@ -32,11 +32,13 @@
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
+#include "../../include/fluid/CLookUpTableGas.hpp"
 #include "../../include/numerics_simd/CNumericsSIMD.hpp"
+#include "../../include/gradients/computeGradientsAndLimiters.hpp"
 
 
-CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
-                           unsigned short iMesh, const bool navier_stokes) :
+CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh,
+                           const bool navier_stokes, const CEulerSolver* fineSolver) :
   CFVMFlowSolverBase<CEulerVariable, COMPRESSIBLE>() {
 
   /*--- Based on the navier_stokes boolean, determine if this constructor is
@@ -132,6 +134,13 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   for (iMarker = 0; iMarker < nMarker; iMarker++)
     nVertex[iMarker] = geometry->nVertex[iMarker];
 
+  /*--- The coarse levels use the look-up table of the finest level (LUT_GAS). ---*/
+
+  if (fineSolver != nullptr) {
+    lutDimensional = fineSolver->lutDimensional;
+    lutScaled = fineSolver->lutScaled;
+  }
+
   /*--- Perform the non-dimensionalization for the flow equations using the
    specified reference values. ---*/
 
@@ -160,9 +169,10 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy, true);
+    System.SetMGCoarseSmoother(true);
 
-    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+    if ((config->GetKind_Linear_Solver_Prec() == LINELET) || (config->GetKind_Linear_Solver_Prec(iMesh) == LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE)
         cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
@@ -293,6 +303,13 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
   }
   SetBaseClassPointerToNodes();
 
+  /*--- The single precision MUSCL gradients are only needed on the fine grid (no reconstruction on the
+   *    coarse multigrid levels). They are stored in addition to the double precision gradients, which
+   *    the viscous fluxes, source terms, and outputs still use. ---*/
+
+  if (config->GetMUSCL_Single_Precision() && config->GetMUSCL_Flow() && (iMesh == MESH_0))
+    nodes->GetLimited_Gradient_SP().resize(nPoint, nPrimVarGrad*nDim) = 0.0f;
+
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
   counter_local = 0;
@@ -1451,6 +1468,13 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
                                         config->GetTemperature_Critical(), config->GetAcentric_Factor());
       break;
 
+    case LUT_GAS:
+
+      /*--- The table is created by the finest level, and shared by the coarse levels. ---*/
+      if (!lutDimensional) lutDimensional = CLookUpTableGas::CreateTable(config);
+      auxFluidModel = new CLookUpTableGas(lutDimensional);
+      break;
+
     default:
       SU2_MPI::Error("Unknown fluid model.", CURRENT_FUNCTION);
       break;
@@ -1655,6 +1679,11 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
   assert(FluidModel.empty() && "Potential memory leak!");
   FluidModel.resize(omp_get_max_threads());
 
+  /*--- The non-dimensional table of LUT_GAS is shared by all threads and multigrid levels. ---*/
+
+  if ((config->GetKind_FluidModel() == LUT_GAS) && !lutScaled)
+    lutScaled = CLookUpTableGas::ScaleTable(*lutDimensional, config);
+
   SU2_OMP_PARALLEL
   {
     const int thread = omp_get_thread_num();
@@ -1681,6 +1710,10 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
                                                config->GetTemperature_Critical() / config->GetTemperature_Ref(),
                                                config->GetAcentric_Factor());
         break;
+
+      case LUT_GAS:
+        FluidModel[thread] = new CLookUpTableGas(lutScaled);
+        break;
     }
 
     GetFluidModel()->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
@@ -1820,6 +1853,9 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
     case PR_GAS:
       ModelTable << "PR_GAS";
       break;
+    case LUT_GAS:
+      ModelTable << "LUT_GAS";
+      break;
     }
 
     if (config->GetKind_FluidModel() == VW_GAS || config->GetKind_FluidModel() == PR_GAS){
@@ -2157,6 +2193,11 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
+    if (config->GetFused_Gradient_Limiter()) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true, limiter);
+      return;
+    }
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
     switch (config->GetKind_Gradient_Method_Recon()) {
@@ -2174,23 +2215,92 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   }
 }
 
+void CEulerSolver::SetPrimitive_Gradient_Limiter(CGeometry *geometry, const CConfig *config,
+                                                 bool reconstruction, bool computeLimiter) {
+
+  const auto kindGradient = reconstruction? config->GetKind_Gradient_Method_Recon() : config->GetKind_Gradient_Method();
+  const auto kindLimiter = static_cast<ENUM_LIMITER>(config->GetKind_SlopeLimit_Flow());
+
+  const auto& primitives = nodes->GetPrimitive();
+  auto& gradient = reconstruction? nodes->GetGradient_Reconstruction() : nodes->GetGradient_Primitive();
+  auto& limiter = nodes->GetLimiter_Primitive();
+
+  /*--- Limited gradient used by the MUSCL reconstruction, stored in single precision. ---*/
+  su2matrix<float>* limitedGradient = nullptr;
+  if (config->GetMUSCL_Single_Precision()) limitedGradient = &nodes->GetLimited_Gradient_SP();
+
+  computeGradientsAndLimiters(this, PRIMITIVE_GRADIENT, PRIMITIVE_LIMITER, *geometry, *config, kindGradient,
+                              kindLimiter, computeLimiter, 0, nPrimVarGrad, primitives, gradient, limiter,
+                              limitedGradient);
+}
+
 unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
   /*--- Number of non-physical points, local to the thread, needs
    *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The thermodynamic state is computed for batches of points, which the closed-form
+   *    fluid models vectorize, then the primitives are set point by point. ---*/
 
-    /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+  constexpr unsigned long batchSize = 64;
+  const unsigned long nBatch = roundUpDiv(nPoint, batchSize);
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+  CFluidModel* fluidModel = GetFluidModel();
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
+
+    const unsigned long begin = iBatch * batchSize;
+    const unsigned long end = min(begin + batchSize, nPoint);
+
+    /*--- Gather the points that need updating, within a multirate step only those
+     *    of the time level advanced by the previous stage. ---*/
 
-    /* Check for non-realizable states for reporting. */
+    unsigned long index[batchSize], size = 0;
+    for (auto iPoint = begin; iPoint < end; ++iPoint)
+      if (OutdatedPoint(iPoint)) index[size++] = iPoint;
 
-    if (!physical) nonPhysicalPoints++;
+    if (size == 0) continue;
+
+    su2double density[batchSize], staticEnergy[batchSize], pressure[batchSize], temperature[batchSize];
+    su2double soundSpeed2[batchSize], dPdrho_e[batchSize], dPde_rho[batchSize];
+
+    for (unsigned long i = 0; i < size; ++i) {
+      const auto iPoint = index[i];
+      nodes->SetVelocity(iPoint);
+      density[i] = nodes->GetDensity(iPoint);
+      staticEnergy[i] = nodes->GetEnergy(iPoint) - 0.5*nodes->GetVelocity2(iPoint);
+    }
+
+    CFluidStateBatch state;
+    state.Pressure = pressure;
+    state.Temperature = temperature;
+    state.SoundSpeed2 = soundSpeed2;
+    state.dPdrho_e = dPdrho_e;
+    state.dPde_rho = dPde_rho;
+
+    const auto nClamped = fluidModel->ComputeTDState_rhoe(size, density, staticEnergy, state);
+    if (nClamped) fluidModel->CountOutOfRange(nClamped);
+
+    for (unsigned long i = 0; i < size; ++i) {
+      const auto iPoint = index[i];
+
+      /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+
+      bool physical = nodes->SetPrimVar(iPoint, pressure[i], soundSpeed2[i], temperature[i], fluidModel);
+
+      /*--- Non-physical points are recomputed by the fluid model from the old solution. ---*/
+
+      if (physical) {
+        nodes->SetdPdrho_e(iPoint, dPdrho_e[i]);
+        nodes->SetdPde_rho(iPoint, dPde_rho[i]);
+      }
+      else {
+        nodes->SetSecondaryVar(iPoint, fluidModel);
+        nonPhysicalPoints++;
+      }
+    }
   }
 
   return nonPhysicalPoints;
@@ -2271,6 +2381,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   const bool muscl            = (config->GetMUSCL_Flow() && (iMesh == MESH_0));
   const bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER);
   const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
+  const bool muscl_sp         = muscl && config->GetMUSCL_Single_Precision();
 
   /*--- Non-physical counter. ---*/
   unsigned long counter_local = 0;
@@ -2300,6 +2411,10 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     auto iPoint = geometry->edges->GetNode(iEdge,0);
     auto jPoint = geometry->edges->GetNode(iEdge,1);
 
+    /*--- Multirate integration or active set, this also skips the viscous contribution. ---*/
+
+    if (!ActiveEdge(iPoint, jPoint)) continue;
+
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     auto Coord_i = geometry->nodes->GetCoord(iPoint);
@@ -2347,9 +2462,21 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
         su2double Project_Grad_i = 0.0;
         su2double Project_Grad_j = 0.0;
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
-          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
+        if (muscl_sp) {
+          /*--- The point limiters are already applied to the single precision gradients. ---*/
+          const auto LimGradient_i = nodes->GetLimited_Gradient_SP(iPoint) + iVar*nDim;
+          const auto LimGradient_j = nodes->GetLimited_Gradient_SP(jPoint) + iVar*nDim;
+
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Project_Grad_i += Vector_ij[iDim]*LimGradient_i[iDim];
+            Project_Grad_j -= Vector_ij[iDim]*LimGradient_j[iDim];
+          }
+        }
+        else {
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+            Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
+          }
         }
 
         su2double lim_i = 1.0;
@@ -2360,7 +2487,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
           lim_i = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
           lim_j = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
         }
-        else if (limiter) {
+        else if (limiter && !muscl_sp) {
           lim_i = nodes->GetLimiter_Primitive(iPoint, iVar);
           lim_j = nodes->GetLimiter_Primitive(jPoint, iVar);
         }
@@ -2473,6 +2600,8 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
       Jacobian.SetDiagonalAsColumnSum();
   }
 
+  AccumulateInterfaceResidual();
+
   /*--- Warning message about non-physical reconstructions. ---*/
 
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
@@ -2576,6 +2705,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Loop over all points ---*/
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!ActivePoint(iPoint)) continue;
 
       /*--- Load the conservative variables ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint),
@@ -2603,6 +2733,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Loop over all points ---*/
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!ActivePoint(iPoint)) continue;
 
       /*--- Load the conservative variables ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint),
@@ -2656,6 +2787,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- loop over points ---*/
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!ActivePoint(iPoint)) continue;
 
       /*--- Set solution  ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
@@ -2704,6 +2836,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- loop over points ---*/
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!ActivePoint(iPoint)) continue;
 
       /*--- Set solution  ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
@@ -2726,6 +2859,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- loop over points ---*/
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!ActivePoint(iPoint)) continue;
 
       /*--- Get control volume ---*/
       su2double Volume = geometry->nodes->GetVolume(iPoint);
@@ -2742,6 +2876,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Loop over all points ---*/
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!ActivePoint(iPoint)) continue;
 
       /*--- Load the wind gust ---*/
       numerics->SetWindGust(nodes->GetWindGust(iPoint), nodes->GetWindGust(iPoint));
@@ -2779,6 +2914,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       /*--- Loop over points ---*/
       SU2_OMP_FOR_DYN(omp_chunk_size)
       for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        if (!ActivePoint(iPoint)) continue;
 
         /*--- Get control volume size. ---*/
         su2double Volume = geometry->nodes->GetVolume(iPoint);
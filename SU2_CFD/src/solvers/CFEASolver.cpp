@@ -372,7 +372,7 @@ void CFEASolver::Set_ElementProperties(CGeometry *geometry, CConfig *config) {
     unordered_map<unsigned long, unsigned long> Global2Local;
 
     for (auto iElem = 0ul; iElem < nElement; iElem++)
-      Global2Local[geometry->elem[iElem]->GetGlobalIndex()] = iElem;
+      Global2Local[geometry->GetElemStore().GetGlobalIndex(iElem)] = iElem;
 
     /*--- Read all lines in the restart file ---*/
 
@@ -736,7 +736,7 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
         /*--- Convert VTK type to index in the element container. ---*/
         int EL_KIND;
         unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+        GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
         /*--- Each thread needs a dedicated element. ---*/
         CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -746,7 +746,7 @@ void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics,
 
         for (iNode = 0; iNode < nNodes; iNode++) {
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+          indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
 
           for (iDim = 0; iDim < nDim; iDim++) {
             su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
@@ -828,7 +828,7 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
         /*--- Convert VTK type to index in the element container. ---*/
         int EL_KIND;
         unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+        GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
         /*--- Each thread needs a dedicated element. ---*/
         CElement* fea_elem = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -839,7 +839,7 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
 
         for (iNode = 0; iNode < nNodes; iNode++) {
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+          indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
 
           for (iDim = 0; iDim < nDim; iDim++) {
             /*--- Compute current coordinate. ---*/
@@ -966,7 +966,7 @@ void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numer
         /*--- Convert VTK type to index in the element container. ---*/
         int EL_KIND;
         unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+        GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
         /*--- Each thread needs a dedicated element. ---*/
         CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -975,7 +975,7 @@ void CFEASolver::Compute_MassMatrix(const CGeometry *geometry, CNumerics **numer
         unsigned long indexNode[MAXNNODE_3D];
 
         for (iNode = 0; iNode < nNodes; iNode++) {
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+          indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
           for (iDim = 0; iDim < nDim; iDim++) {
             su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
             element->SetRef_Coord(iNode, iDim, val_Coord);
@@ -1045,7 +1045,7 @@ void CFEASolver::Compute_MassRes(const CGeometry *geometry, CNumerics **numerics
       /*--- Convert VTK type to index in the element container. ---*/
       int EL_KIND;
       unsigned short nNodes;
-      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+      GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
       /*--- Each thread needs a dedicated element. ---*/
       CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -1054,7 +1054,7 @@ void CFEASolver::Compute_MassRes(const CGeometry *geometry, CNumerics **numerics
       unsigned long indexNode[MAXNNODE_3D];
 
       for (iNode = 0; iNode < nNodes; iNode++) {
-        indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+        indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
         for (iDim = 0; iDim < nDim; iDim++) {
           su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
           element->SetRef_Coord(iNode, iDim, val_Coord);
@@ -1127,7 +1127,7 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numeric
         /*--- Convert VTK type to index in the element container. ---*/
         int EL_KIND;
         unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+        GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
         /*--- Each thread needs a dedicated element. ---*/
         CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -1137,7 +1137,7 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numeric
 
         for (iNode = 0; iNode < nNodes; iNode++) {
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+          indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
 
           for (iDim = 0; iDim < nDim; iDim++) {
             /*--- Compute current coordinate. ---*/
@@ -1240,7 +1240,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CNumerics **numerics,
         /*--- Convert VTK type to index in the element container. ---*/
         int EL_KIND;
         unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+        GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
         /*--- Each thread needs a dedicated element. ---*/
         CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -1250,7 +1250,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CNumerics **numerics,
 
         for (iNode = 0; iNode < nNodes; iNode++) {
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+          indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
 
           for (iDim = 0; iDim < nDim; iDim++) {
             /*--- Compute current coordinate. ---*/
@@ -1489,7 +1489,7 @@ void CFEASolver::Compute_DeadLoad(CGeometry *geometry, CNumerics **numerics, con
         /*--- Convert VTK type to index in the element container. ---*/
         int EL_KIND;
         unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+        GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
         /*--- Each thread needs a dedicated element. ---*/
         CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
@@ -1498,7 +1498,7 @@ void CFEASolver::Compute_DeadLoad(CGeometry *geometry, CNumerics **numerics, con
         unsigned long indexNode[MAXNNODE_3D];
 
         for (iNode = 0; iNode < nNodes; iNode++) {
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+          indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
           for (iDim = 0; iDim < nDim; iDim++) {
             su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
             element->SetRef_Coord(iNode, iDim, val_Coord);
@@ -2932,7 +2932,7 @@ void CFEASolver::Compute_OFVolFrac(CGeometry *geometry, const CConfig *config)
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iElem = 0; iElem < nElement; ++iElem) {
     /*--- count only elements that belong to the partition ---*/
-    if (geometry->nodes->GetDomain(geometry->elem[iElem]->GetNode(0))) {
+    if (geometry->nodes->GetDomain(geometry->GetElemStore().GetNode(iElem, 0))) {
       su2double volume = geometry->elem[iElem]->GetVolume();
       su2double rho = element_properties[iElem]->GetPhysicalDensity();
       tot_vol_loc += volume;
@@ -3037,13 +3037,13 @@ void CFEASolver::Stiffness_Penalty(CGeometry *geometry, CNumerics **numerics, CC
     unsigned short iNode, nNodes, iDim;
     unsigned long indexNode[MAXNNODE_3D];
 
-    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
     CElement* element = element_container[FEA_TERM][EL_KIND + thread*MAX_FE_KINDS];
 
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
     for (iNode = 0; iNode < nNodes; iNode++) {
-      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+      indexNode[iNode] = geometry->GetElemStore().GetNode(iElem, iNode);
       for (iDim = 0; iDim < nDim; iDim++) {
         su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
         element->SetRef_Coord(iNode, iDim, val_Coord);
@@ -3210,7 +3210,7 @@ void CFEASolver::ExtractAdjoint_Variables(CGeometry *geometry, CConfig *config)
   for(iElem=0; iElem<nElemDomain; ++iElem) send_buf[iElem] = 0.0;
 
   for(iElem=0; iElem<nElem; ++iElem) {
-    unsigned long iElem_global = geometry->elem[iElem]->GetGlobalIndex();
+    unsigned long iElem_global = geometry->GetElemStore().GetGlobalIndex(iElem);
     send_buf[iElem_global] = SU2_TYPE::GetValue(element_properties[iElem]->GetAdjointDensity());
   }
 
@@ -31,6 +31,7 @@
 #include "../../include/fluid/CIdealGas.hpp"
 #include "../../include/fluid/CVanDerWaalsGas.hpp"
 #include "../../include/fluid/CPengRobinson.hpp"
+#include <thread>
 
 #define SIZE_ARR_NORM 8
 
@@ -733,6 +734,9 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
+  for(unsigned long i=1; i<FluidModelThreads.size(); ++i)
+    delete FluidModelThreads[i];
+
   delete FluidModel;
   delete blasFunctions;
 
@@ -1045,31 +1049,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   delete FluidModel;
 
-  switch (config->GetKind_FluidModel()) {
-
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
-
-  }
+  FluidModel = CreateFluidModelND(config);
 
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
 
@@ -1092,6 +1072,22 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
   }
 
+  /*--- The threads that process the task list each get their own copy of the
+        dimensionless fluid model, because the fluid model stores its state. ---*/
+
+  for(unsigned long i=1; i<FluidModelThreads.size(); ++i)
+    delete FluidModelThreads[i];
+
+  FluidModelThreads.assign(omp_get_max_threads(), FluidModel);
+
+  for(unsigned long i=1; i<FluidModelThreads.size(); ++i) {
+    FluidModelThreads[i] = CreateFluidModelND(config);
+    if( viscous ) {
+      FluidModelThreads[i]->SetLaminarViscosityModel(config);
+      FluidModelThreads[i]->SetThermalConductivityModel(config);
+    }
+  }
+
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
 
   Energy_Ref = Energy_FreeStream/Energy_FreeStreamND; config->SetEnergy_Ref(Energy_Ref);
@@ -1304,6 +1300,44 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   }
 }
 
+CFluidModel* CFEM_DG_EulerSolver::CreateFluidModelND(CConfig *config) const {
+
+  const su2double Gas_ConstantND        = config->GetGas_ConstantND();
+  const su2double Pressure_FreeStreamND = config->GetPressure_FreeStreamND();
+  const su2double Density_FreeStreamND  = config->GetDensity_FreeStreamND();
+
+  CFluidModel *fluidModel = nullptr;
+
+  switch (config->GetKind_FluidModel()) {
+
+    case STANDARD_AIR:
+      fluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+      break;
+
+    case IDEAL_GAS:
+      fluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+      break;
+
+    case VW_GAS:
+      fluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
+      break;
+
+    case PR_GAS:
+      fluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+      break;
+
+    default:
+      SU2_MPI::Error("Fluid model not implemented for the DG solver.", CURRENT_FUNCTION);
+      break;
+  }
+
+  fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+
+  return fluidModel;
+}
+
 void CFEM_DG_EulerSolver::DetermineGraphDOFs(const CMeshFEM *FEMGeometry,
                                              CConfig        *config) {
 
@@ -2309,7 +2343,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             /* Create the dependencies for this task. */
             prevInd[0] = indexInList[CTaskDefinition::VOLUME_RESIDUAL][level];
             prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED][level];
-            prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
+            prevInd[2] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
             prevInd[3] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS][level];
             prevInd[4] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
 
@@ -3785,313 +3819,435 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-  /* Define and initialize the bool vector, that indicates whether or
-     not the tasks from the list have been completed. */
-  vector<bool> taskCompleted(tasksList.size(), false);
+  /*--- The tasks of tasksList are carried out by a team of OpenMP threads. A task
+        can be started when all the tasks it depends on are completed. Tasks that
+        work on a range of volume elements are split into chunks, such that several
+        threads can work on the same task. The MPI communication is only carried out
+        by the master thread, because only MPI_THREAD_FUNNELED is guaranteed. The
+        bookkeeping is protected by a lock, the actual work is done outside of it. ---*/
+
+  const unsigned long nTasks = tasksList.size();
+
+  /* Possible states of a task. */
+  enum : unsigned short {TASK_WAITING = 0, TASK_ACTIVE = 1, TASK_COMPLETED = 2};
+
+  /* Lambdas, which determine whether or not a task is the completion of
+     a communication and whether or not a task accumulates residuals. The
+     latter tasks may update the residuals of elements of other time levels,
+     hence only one of them may be active at the same time. */
+  auto commCompletionTask = [](const CTaskDefinition::SOLVER_TASK task) {
+    return (task == CTaskDefinition::COMPLETE_MPI_COMMUNICATION) ||
+           (task == CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION);
+  };
+
+  auto commTask = [&commCompletionTask](const CTaskDefinition::SOLVER_TASK task) {
+    return commCompletionTask(task) ||
+           (task == CTaskDefinition::INITIATE_MPI_COMMUNICATION) ||
+           (task == CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION);
+  };
+
+  auto accumulationTask = [](const CTaskDefinition::SOLVER_TASK task) {
+    return (task == CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS) ||
+           (task == CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS)  ||
+           (task == CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS) ||
+           (task == CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS);
+  };
+
+  /* Shared data of the scheduler. For tasks that are split into chunks,
+     nextElem and endElem define the range of elements that still has to be
+     handed out, while nElemToDo is the number of elements not completed yet. */
+  vector<unsigned short> taskState(nTasks, TASK_WAITING);
+  vector<unsigned long>  nextElem(nTasks, 0), endElem(nTasks, 0);
+  vector<unsigned long>  nElemToDo(nTasks, 0), chunkSize(nTasks, 0);
+
+  unsigned long nTasksCompleted = 0, lowestIndexInList = 0;
+  bool accumulationActive = false;
+
+  omp_lock_t taskLock;
+  omp_init_lock(&taskLock);
+
+  SU2_OMP_PARALLEL
+  {
+    const int  thread   = omp_get_thread_num();
+    const int  nThreads = omp_get_num_threads();
+    const bool master   = (thread == 0);
+
+    /* The numerics of this thread. */
+    CNumerics **numericsThread = numerics + thread*MAX_TERMS;
+
+    /* Allocate the memory for the work array of this thread and initialize it to zero
+       to avoid warnings in debug mode about uninitialized memory when padding is applied. */
+    vector<su2double> workArrayVec(sizeWorkArray, 0.0);
+    su2double *workArray = workArrayVec.data();
+
+    /* Completions of communication, which have been attempted by the master
+       thread without success since it carried out its last task. */
+    vector<unsigned long> failedComm;
+
+    while( true ) {
+
+      /* Variables to store the task, or chunk of a task, to be carried out. */
+      unsigned long iTask = nTasks, elemBeg = 0, elemEnd = 0;
+      bool chunkOfTask = false, waitForComm = false;
+
+      omp_set_lock(&taskLock);
+
+      /* Check if all tasks have been completed. */
+      if(nTasksCompleted == nTasks) {
+        omp_unset_lock(&taskLock);
+        break;
+      }
 
-  /* Allocate the memory for the work array and initialize it to zero to avoid
-     warnings in debug mode  about uninitialized memory when padding is applied. */
-  vector<su2double> workArrayVec(sizeWorkArray, 0.0);
-  su2double *workArray = workArrayVec.data();
+      /* First try to continue a task, which is already split into chunks. */
+      for(unsigned long i=lowestIndexInList; i<nTasks; ++i) {
+        if((taskState[i] == TASK_ACTIVE) && (nextElem[i] < endElem[i])) {
+          iTask = i;
+          break;
+        }
+      }
+
+      /* Otherwise find the first task on the list, which can be started. */
+      if(iTask == nTasks) {
+        for(unsigned long i=lowestIndexInList; i<nTasks; ++i) {
+
+          if(taskState[i] != TASK_WAITING) continue;
 
-  /* While loop to carry out all the tasks in tasksList. */
-  unsigned long lowestIndexInList = 0;
-  while(lowestIndexInList < tasksList.size()) {
-
-    /* Find the next task that can be carried out. The outer loop is there
-       to make sure that a communication is completed in case there are no
-       other tasks */
-    for(unsigned short j=0; j<2; ++j) {
-      bool taskCarriedOut = false;
-      for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
-
-        /* Determine whether or not it can be attempted to carry out
-           this task. */
-        bool taskCanBeCarriedOut = !taskCompleted[i];
-        for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
-          if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
-            taskCanBeCarriedOut = false;
+          const CTaskDefinition::SOLVER_TASK task = tasksList[i].task;
+          if(commTask(task) && !master) continue;
+          if(accumulationTask(task) && accumulationActive) continue;
+          if(find(failedComm.begin(), failedComm.end(), i) != failedComm.end()) continue;
+
+          bool taskCanBeCarriedOut = true;
+          for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+            if(taskState[tasksList[i].indMustBeCompleted[ind]] != TASK_COMPLETED)
+              taskCanBeCarriedOut = false;
+          }
+          if( !taskCanBeCarriedOut ) continue;
+
+          /* The task can be started. Split it into chunks, if possible. */
+          iTask = i;
+          taskState[i] = TASK_ACTIVE;
+          if( accumulationTask(task) ) accumulationActive = true;
+
+          unsigned long elemBegTask, elemEndTask;
+          if(TaskElementRange_DG(tasksList[i], elemBegTask, elemEndTask) &&
+             (elemEndTask > elemBegTask)) {
+            nextElem[i]  = elemBegTask;
+            endElem[i]   = elemEndTask;
+            nElemToDo[i] = elemEndTask - elemBegTask;
+            chunkSize[i] = (nThreads == 1) ? nElemToDo[i] : roundUpDiv(nElemToDo[i], 2*nThreads);
+          }
+          break;
         }
+      }
 
-        if( taskCanBeCarriedOut ) {
+      /* If the master thread cannot do anything else, it waits for the
+         first communication it could not complete before. */
+      if((iTask == nTasks) && !failedComm.empty()) {
+        iTask = failedComm.front();
+        taskState[iTask] = TASK_ACTIVE;
+        waitForComm = true;
+      }
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+      /* Determine the chunk of elements, if the task is split. */
+      if((iTask < nTasks) && (nextElem[iTask] < endElem[iTask])) {
+        chunkOfTask = true;
+        elemBeg = nextElem[iTask];
+        elemEnd = min(elemBeg + chunkSize[iTask], endElem[iTask]);
+        nextElem[iTask] = elemEnd;
+      }
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+      omp_unset_lock(&taskLock);
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+      /* Nothing to be done at the moment. Give up the time slice, such that idle
+         threads do not keep the lock busy (and the cores, if oversubscribed),
+         and try again. */
+      if(iTask == nTasks) {
+        std::this_thread::yield();
+        continue;
+      }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the task or the chunk of the task. */
+      const bool taskCarriedOut = ExecuteTask_DG(tasksList[iTask], elemBeg, elemEnd, waitForComm,
+                                                 numericsThread, config, workArray);
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+      /* Update the administration of the tasks. */
+      omp_set_lock(&taskLock);
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      if( taskCarriedOut ) {
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+        bool taskCompleted = true;
+        if( chunkOfTask ) {
+          nElemToDo[iTask] -= elemEnd - elemBeg;
+          taskCompleted = (nElemToDo[iTask] == 0);
+        }
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+        if( taskCompleted ) {
+          taskState[iTask] = TASK_COMPLETED;
+          ++nTasksCompleted;
+          if( accumulationTask(tasksList[iTask].task) ) accumulationActive = false;
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+          for(; lowestIndexInList < nTasks; ++lowestIndexInList)
+            if(taskState[lowestIndexInList] != TASK_COMPLETED) break;
+        }
+      }
+      else {
+        taskState[iTask] = TASK_WAITING;
+      }
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+      omp_unset_lock(&taskLock);
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Keep track of the communications that could not be completed. After
+         every task that has been carried out they are attempted again. */
+      if( master ) {
+        if( taskCarriedOut ) failedComm.clear();
+        else                 failedComm.push_back(iTask);
+      }
+    }
+  } // end SU2_OMP_PARALLEL
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  omp_destroy_lock(&taskLock);
+}
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+bool CFEM_DG_EulerSolver::TaskElementRange_DG(const CTaskDefinition &task,
+                                              unsigned long         &elemBeg,
+                                              unsigned long         &elemEnd) const {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+  /* Only the tasks that carry out the same operations independently
+     for every volume element can be split into chunks of elements. */
+  const unsigned short level = task.timeLevel;
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  switch( task.task ) {
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+      elemBeg = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+      elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+      return true;
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = nullptr;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS:
+      elemBeg = nVolElemOwnedPerTimeLevel[level];
+      elemEnd = nVolElemOwnedPerTimeLevel[level] + nVolElemInternalPerTimeLevel[level];
+      return true;
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+    case CTaskDefinition::VOLUME_RESIDUAL:
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX:
+    case CTaskDefinition::ADER_UPDATE_SOLUTION:
+      elemBeg = nVolElemOwnedPerTimeLevel[level];
+      elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+      return true;
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS:
+      elemBeg = nVolElemHaloPerTimeLevel[level];
+      elemEnd = nVolElemHaloPerTimeLevel[level+1];
+      return true;
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    default:
+      elemBeg = elemEnd = 0;
+      return false;
+  }
+}
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+bool CFEM_DG_EulerSolver::ExecuteTask_DG(const CTaskDefinition &task,
+                                         const unsigned long   elemBeg,
+                                         const unsigned long   elemEnd,
+                                         const bool            waitForComm,
+                                         CNumerics             **numerics,
+                                         CConfig               *config,
+                                         su2double             *workArray) {
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Easier storage of the number of time levels. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+  const unsigned short level       = task.timeLevel;
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+  /*--- Determine the actual task to be carried out and do so. The only tasks
+        that may fail are the completion of the non-blocking communication.
+        For tasks that can be split, elemBeg and elemEnd define the chunk of
+        elements to be treated. ---*/
+  switch( task.task ) {
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+      /* Carry out the ADER predictor step for the given chunk of elements. */
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, level);
+      return true;
+    }
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+      /* Attempt to complete the MPI communication of the solution data.
+         If waitForComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. Otherwise the next tasks
+         are waiting for this communication to be completed and hence
+         MPI_Waitall is used. */
+      return Complete_MPI_Communication(config, level, waitForComm);
+    }
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, level);
+      return true;
+    }
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+      /* Attempt to complete the MPI communication of the residual data,
+         see COMPLETE_MPI_COMMUNICATION for the meaning of waitForComm. */
+      return Complete_MPI_ReverseCommunication(config, level, waitForComm);
+    }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      unsigned long nAdjElem = 0, *adjElem = nullptr;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+      }
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+      ADER_DG_TimeInterpolatePredictorSol(config, task.intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          task.secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      return true;
+    }
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS:
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      Shock_Capturing_DG(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::VOLUME_RESIDUAL: {
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      /*--- Compute the volume portion of the residual. ---*/
+      Volume_Residual(config, elemBeg, elemEnd, workArray);
+      return true;
+    }
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
 
-            default: {
+      /* Compute the residual of the faces that only involve owned elements. */
+      unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+      ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                    nMatchingInternalFacesLocalElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
-        }
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
 
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
-      }
+      /* Compute the residual of the faces that involve a halo element. */
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      return true;
+    }
+
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(level, config, numerics, false, workArray);
+      return true;
+    }
+
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(level, config, numerics, true, workArray);
+      return true;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(level, true);
+      return true;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(level, false);
+      return true;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, level, task.intPointADER);
+      return true;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, level, task.intPointADER);
+      return true;
+    }
+
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER, elemBeg, elemEnd, workArray);
+      return true;
+    }
+
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
 
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
+      /*--- Perform the update step for ADER-DG. ---*/
+      ADER_DG_Iteration(elemBeg, elemEnd);
+      return true;
     }
 
-    /* Update the value of lowestIndexInList. */
-    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
-      if( !taskCompleted[lowestIndexInList] ) break;
+    default: {
+
+      SU2_MPI::Error("Task not defined. This should not happen.", CURRENT_FUNCTION);
+      return false;
+    }
   }
 }
 
@@ -4694,6 +4850,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
@@ -4749,8 +4907,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -4939,6 +5097,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
@@ -4998,8 +5158,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5220,6 +5380,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                                  su2double            *res,
                                                                  su2double            *work) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -5288,8 +5450,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5429,6 +5591,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                                  su2double            *res,
                                                                  su2double            *work) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -5503,8 +5667,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5763,6 +5927,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                                           const unsigned long elemEnd,
                                           su2double           *workArray) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : nullptr;
@@ -5886,8 +6052,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5981,8 +6147,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -7511,6 +7677,8 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
                                                const su2double          *solIntL,
                                                su2double                *solIntR) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /*--- Retrieve the specified total conditions for this inlet. ---*/
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
@@ -7555,9 +7723,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Inlet(CConfig                  *config,
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = fluidModel->GetSoundSpeed2();
+      su2double Pressure    = fluidModel->GetPressure();
 
       /*--- Compute the Riemann invariant to be extrapolated. ---*/
       const su2double Riemann = 2.0*sqrt(SoundSpeed2)/Gamma_Minus_One + VelocityNormal;
@@ -7626,6 +7794,8 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
                                                 const su2double          *solIntL,
                                                 su2double                *solIntR) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /*--- Retrieve the specified back pressure for this outlet.
         Nondimensionalize, if necessary. ---*/
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
@@ -7663,9 +7833,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Outlet(CConfig                  *config
 
       su2double StaticEnergy = UL[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
-      su2double SoundSpeed2 = FluidModel->GetSoundSpeed2();
-      su2double Pressure    = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(UL[0], StaticEnergy);
+      su2double SoundSpeed2 = fluidModel->GetSoundSpeed2();
+      su2double Pressure    = fluidModel->GetPressure();
 
       /*--- Subsonic exit flow: there is one incoming characteristic,
             therefore one variable can be specified (back pressure) and is used
@@ -7703,6 +7873,8 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
                                                  const su2double          *solIntL,
                                                  su2double                *solIntR) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Retrieve the corresponding string for this marker. */
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
@@ -7727,10 +7899,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
       T_Total /= config->GetTemperature_Ref();
 
       /* Compute the total enthalpy and entropy from these values. */
-      FluidModel->SetTDState_PT(P_Total, T_Total);
-      const su2double Enthalpy_e = FluidModel->GetStaticEnergy()
-                                 + FluidModel->GetPressure()/FluidModel->GetDensity();
-      const su2double Entropy_e  = FluidModel->GetEntropy();
+      fluidModel->SetTDState_PT(P_Total, T_Total);
+      const su2double Enthalpy_e = fluidModel->GetStaticEnergy()
+                                 + fluidModel->GetPressure()/fluidModel->GetDensity();
+      const su2double Entropy_e  = fluidModel->GetEntropy();
 
       /* Loop over the faces that are treated simultaneously. */
       for(unsigned short l=0; l<nFaceSimul; ++l) {
@@ -7757,9 +7929,9 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
              and total energy per unit mass for the right state. */
           const su2double StaticEnthalpy_e = Enthalpy_e - 0.5*Velocity2_e;
 
-          FluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
-          const su2double Density_e = FluidModel->GetDensity();
-          const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
+          fluidModel->SetTDState_hs(StaticEnthalpy_e, Entropy_e);
+          const su2double Density_e = fluidModel->GetDensity();
+          const su2double StaticEnergy_e = fluidModel->GetStaticEnergy();
           const su2double Energy_e       = StaticEnergy_e + 0.5*Velocity2_e;
 
           /* Set the conservative variables of the right state. */
@@ -7789,10 +7961,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed density, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_PT(P_static, T_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      fluidModel->SetTDState_PT(P_static, T_static);
+      const su2double Density_e      = fluidModel->GetDensity();
+      const su2double StaticEnergy_e = fluidModel->GetStaticEnergy();
+      const su2double SoundSpeed     = fluidModel->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7840,10 +8012,10 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
       /* Compute the prescribed pressure, static energy per unit mass
          and speed of sound. */
-      FluidModel->SetTDState_Prho(P_static, Rho_static);
-      const su2double Density_e      = FluidModel->GetDensity();
-      const su2double StaticEnergy_e = FluidModel->GetStaticEnergy();
-      const su2double SoundSpeed     = FluidModel->GetSoundSpeed();
+      fluidModel->SetTDState_Prho(P_static, Rho_static);
+      const su2double Density_e      = fluidModel->GetDensity();
+      const su2double StaticEnergy_e = fluidModel->GetStaticEnergy();
+      const su2double SoundSpeed     = fluidModel->GetSoundSpeed();
 
       /* Determine the magnitude of the Mach number. */
       su2double MachMag = 0.0;
@@ -7937,7 +8109,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
 
           /* Extrapolate the density and set the thermodynamic state. */
           UR[0] = UL[0];
-          FluidModel->SetTDState_Prho(Pressure_e, UR[0]);
+          fluidModel->SetTDState_Prho(Pressure_e, UR[0]);
 
           /* Extrapolate the velocity. As the density is also extrapolated,
              this means that the momentum variables are identical for UL and UR.
@@ -7952,7 +8124,7 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           }
 
           /* Compute the total energy per unit volume. */
-          UR[nDim+1] = UR[0]*(FluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
+          UR[nDim+1] = UR[0]*(fluidModel->GetStaticEnergy() + 0.5*Velocity2_e);
         }
       }
 
@@ -8003,11 +8175,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double ny  = normals[1];
           const su2double vnL = vxL*nx + vyL*ny;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          fluidModel->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = fluidModel->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = fluidModel->GetPressure();
           const su2double HL  = (UL[3] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -8082,11 +8254,11 @@ void CFEM_DG_EulerSolver::BoundaryStates_Riemann(CConfig                  *confi
           const su2double nz  = normals[2];
           const su2double vnL = vxL*nx + vyL*ny + vzL*nz;
 
-          FluidModel->SetTDState_rhoe(UL[0], eL);
+          fluidModel->SetTDState_rhoe(UL[0], eL);
 
-          const su2double aL  = FluidModel->GetSoundSpeed();
+          const su2double aL  = fluidModel->GetSoundSpeed();
           const su2double a2L = aL*aL;
-          const su2double pL  = FluidModel->GetPressure();
+          const su2double pL  = fluidModel->GetPressure();
           const su2double HL  = (UL[4] + pL)*tmp;
 
           const su2double ovaL  = 1.0/aL;
@@ -1308,6 +1308,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -1411,9 +1414,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -1632,6 +1635,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -1754,9 +1760,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -2021,6 +2027,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
   const su2double factHeatFlux_Lam  =  Gamma/Prandtl_Lam;
@@ -2127,13 +2135,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2413,6 +2421,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
   const su2double factHeatFlux_Lam  =  Gamma/Prandtl_Lam;
@@ -2526,13 +2536,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -2987,6 +2997,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
                                                   const unsigned long elemEnd,
                                                   su2double           *workArray) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /*--- Dummy variable for storing shock sensor value temporarily ---*/
   su2double sensorVal, sensorLowerBound, machNorm, machMax;
   su2double DensityInv, Velocity2, StaticEnergy, SoundSpeed2, Velocity2Rel;
@@ -3068,8 +3080,8 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
 
       StaticEnergy = sol[nDim+1]*DensityInv - 0.5*Velocity2;
 
-      FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-      SoundSpeed2 = FluidModel->GetSoundSpeed2();
+      fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+      SoundSpeed2 = fluidModel->GetSoundSpeed2();
       machSolDOFs[iInd] = sqrt( Velocity2Rel/SoundSpeed2 );
       machMax = max(machSolDOFs[iInd],machMax);
     }
@@ -3149,6 +3161,8 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
                                        const unsigned long elemEnd,
                                        su2double           *workArray) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : nullptr;
@@ -3324,9 +3338,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -3517,9 +3531,9 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
@@ -4311,6 +4325,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
                                                                   su2double &kOverCv,
                                                                   su2double *normalFlux) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Constant factor present in the heat flux vector, namely the ratio of
      thermal conductivity and viscosity. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
@@ -4342,8 +4358,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -4397,6 +4413,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
                                                                   su2double &kOverCv,
                                                                   su2double *normalFlux) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Constant factor present in the heat flux vector, namely the ratio of
      thermal conductivity and viscosity. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
@@ -4438,8 +4456,8 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
@@ -6273,6 +6291,8 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
                                         su2double          *kOverCvInt,
                                         CWallModel         *wallModel) {
 
+  CFluidModel *fluidModel = GetFluidModelThread();
+
   /* Loop over the simultaneously treated faces. */
   for(unsigned short l=0; l<nFaceSimul; ++l) {
     const unsigned short llNVar = l*nVar;
@@ -6320,10 +6340,10 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double vel2Mag = vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2];
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
-        FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
+        fluidModel->SetTDState_rhoe(solInt[0], eInt);
+        const su2double Pressure = fluidModel->GetPressure();
+        const su2double Temperature = fluidModel->GetTemperature();
+        const su2double LaminarViscosity= fluidModel->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -6350,7 +6370,7 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
                                               Wall_HeatFlux, HeatFlux_Prescribed,
                                               Wall_Temperature, Temperature_Prescribed,
-                                              FluidModel, tauWall, qWall, ViscosityWall,
+                                              fluidModel, tauWall, qWall, ViscosityWall,
                                               kOverCvWall);
 
         /* Compute the wall velocity in tangential direction. */
@@ -100,11 +100,6 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   Vector_i = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) Vector_i[iDim] = 0.0;
   Vector_j = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) Vector_j[iDim] = 0.0;
 
-  /*--- Define some auxiliary vectors related to the primitive flow solution ---*/
-
-  Primitive_Flow_i = new su2double[nDim+1]; for (iVar = 0; iVar < nDim+1; iVar++) Primitive_Flow_i[iVar] = 0.0;
-  Primitive_Flow_j = new su2double[nDim+1]; for (iVar = 0; iVar < nDim+1; iVar++) Primitive_Flow_j[iVar] = 0.0;
-
   /*--- Jacobians and vector structures for implicit computations ---*/
 
   Jacobian_i = new su2double* [nVar];
@@ -114,10 +109,34 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
     Jacobian_j[iVar] = new su2double [nVar];
   }
 
+#ifdef HAVE_OMP
+  /*--- Get the edge coloring, see notes in CEulerSolver's constructor. ---*/
+  su2double parallelEff = 1.0;
+  const auto& coloring = geometry->GetEdgeColoring(&parallelEff);
+
+  ReducerStrategy = parallelEff < COLORING_EFF_THRESH;
+
+  if (ReducerStrategy && (coloring.getOuterSize()>1))
+    geometry->SetNaturalEdgeColoring();
+
+  if (!coloring.empty()) {
+    auto groupSize = ReducerStrategy? 1ul : geometry->GetEdgeColorGroupSize();
+    auto nColor = coloring.getOuterSize();
+    EdgeColoring.reserve(nColor);
+
+    for(auto iColor = 0ul; iColor < nColor; ++iColor)
+      EdgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor), groupSize);
+  }
+
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+#else
+  EdgeColoring[0] = DummyGridColor<>(geometry->GetnEdge());
+#endif
+
   /*--- Initialization of the structure of the whole Jacobian ---*/
 
   if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (heat equation) MG level: " << iMesh << "." << endl;
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
   if (config->GetKind_Linear_Solver_Prec() == LINELET) {
     nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
@@ -127,6 +146,9 @@ CHeatSolver::CHeatSolver(CGeometry *geometry, CConfig *config, unsigned short iM
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  if (ReducerStrategy)
+    EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
   if (config->GetExtraOutput()) {
     if (nDim == 2) { nOutputVariables = 13; }
     else if (nDim == 3) { nOutputVariables = 19; }
@@ -257,17 +279,16 @@ CHeatSolver::~CHeatSolver(void) {
 
 void CHeatSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
   bool center = (config->GetKind_ConvNumScheme_Heat() == SPACE_CENTERED);
 
   if (center) {
     SetUndivided_Laplacian(geometry, config);
   }
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
-
-    /*--- Initialize the residual vector ---*/
+  /*--- Initialize the residual vector ---*/
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
     LinSysRes.SetBlock_Zero(iPoint);
   }
 
@@ -419,157 +440,180 @@ void CHeatSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig *
 void CHeatSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container,  CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
-
-  su2double *V_i, *V_j, Temp_i, Temp_j;
-  unsigned long iEdge, iPoint, jPoint;
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
 
-  if(flow) {
+  if (!flow) return;
 
-    nVarFlow = solver_container[FLOW_SOL]->GetnVar();
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-      /*--- Points in edge ---*/
-      iPoint = geometry->edges->GetNode(iEdge,0);
-      jPoint = geometry->edges->GetNode(iEdge,1);
-      numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+  /*--- Thread-local residual and Jacobians, the heat equation has a single variable. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i}, *Jacobian_j[1] = {Jac_j};
 
-      /*--- Primitive variables w/o reconstruction ---*/
-      V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-      V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-      Temp_i = nodes->GetSolution(iPoint,0);
-      Temp_j = nodes->GetSolution(jPoint,0);
+    auto iEdge = color.indices[k];
 
-      numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
-      numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint), geometry->nodes->GetnNeighbor(jPoint));
+    /*--- Points in edge ---*/
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
+    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-      numerics->SetPrimitive(V_i, V_j);
-      numerics->SetTemperature(Temp_i, Temp_j);
+    /*--- Primitive variables w/o reconstruction ---*/
+    numerics->SetPrimitive(flowNodes->GetPrimitive(iPoint), flowNodes->GetPrimitive(jPoint));
 
-      numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    numerics->SetUndivided_Laplacian(nodes->GetUndivided_Laplacian(iPoint), nodes->GetUndivided_Laplacian(jPoint));
+    numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint), geometry->nodes->GetnNeighbor(jPoint));
 
-      LinSysRes.AddBlock(iPoint, Residual);
-      LinSysRes.SubtractBlock(jPoint, Residual);
+    numerics->SetTemperature(nodes->GetSolution(iPoint,0), nodes->GetSolution(jPoint,0));
 
-      /*--- Implicit part ---*/
+    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
 
+    if (ReducerStrategy) {
+      EdgeFluxes.SetBlock(iEdge, Residual);
+      Jacobian.UpdateBlocks(iEdge, Jacobian_i, Jacobian_j);
+    }
+    else {
+      LinSysRes.AddBlock(iPoint, Residual);
+      LinSysRes.SubtractBlock(jPoint, Residual);
       Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     }
   }
+  } // end color loop
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
+  }
 }
 
 void CHeatSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                   CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[CONV_TERM];
-
-  su2double *V_i, *V_j, Temp_i, Temp_i_Corrected, Temp_j, Temp_j_Corrected, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j,
-            **Temp_i_Grad, **Temp_j_Grad, Project_Temp_i_Grad, Project_Temp_j_Grad;
-  unsigned short iDim, iVar;
-  unsigned long iEdge, iPoint, jPoint;
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
   bool muscl = (config->GetMUSCL_Heat());
 
-  if(flow) {
+  if (!flow) return;
 
-    nVarFlow = solver_container[FLOW_SOL]->GetnVar();
+  CVariable* flowNodes = solver_container[FLOW_SOL]->GetNodes();
 
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  SU2_OMP_MASTER
+  nVarFlow = solver_container[FLOW_SOL]->GetnVar();
+  SU2_OMP_BARRIER
 
-      /*--- Points in edge ---*/
-      iPoint = geometry->edges->GetNode(iEdge,0);
-      jPoint = geometry->edges->GetNode(iEdge,1);
-      numerics->SetNormal(geometry->edges->GetNormal(iEdge));
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-      /*--- Primitive variables w/o reconstruction ---*/
-      V_i = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
-      V_j = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(jPoint);
+  /*--- Thread-local residual and Jacobians, the heat equation has a single variable. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i}, *Jacobian_j[1] = {Jac_j};
 
-      Temp_i_Grad = nodes->GetGradient(iPoint);
-      Temp_j_Grad = nodes->GetGradient(jPoint);
-      numerics->SetConsVarGradient(Temp_i_Grad, Temp_j_Grad);
+  /*--- Static arrays of MUSCL-reconstructed flow primitives (thread safety). ---*/
+  su2double Primitive_Flow_i[MAXNVARFLOW] = {0.0}, Primitive_Flow_j[MAXNVARFLOW] = {0.0};
 
-      Temp_i = nodes->GetSolution(iPoint,0);
-      Temp_j = nodes->GetSolution(jPoint,0);
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-      /* Second order reconstruction */
-      if (muscl) {
+    auto iEdge = color.indices[k];
 
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Vector_i[iDim] = 0.5*(geometry->nodes->GetCoord(jPoint, iDim) - geometry->nodes->GetCoord(iPoint, iDim));
-          Vector_j[iDim] = 0.5*(geometry->nodes->GetCoord(iPoint, iDim) - geometry->nodes->GetCoord(jPoint, iDim));
-        }
+    /*--- Points in edge ---*/
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
+    numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-        Gradient_i = solver_container[FLOW_SOL]->GetNodes()->GetGradient_Reconstruction(iPoint);
-        Gradient_j = solver_container[FLOW_SOL]->GetNodes()->GetGradient_Reconstruction(jPoint);
-        Temp_i_Grad = nodes->GetGradient_Reconstruction(iPoint);
-        Temp_j_Grad = nodes->GetGradient_Reconstruction(jPoint);
+    /*--- Primitive variables w/o reconstruction ---*/
+    const auto V_i = flowNodes->GetPrimitive(iPoint);
+    const auto V_j = flowNodes->GetPrimitive(jPoint);
 
-        /*Loop to correct the flow variables*/
-        for (iVar = 0; iVar < nVarFlow; iVar++) {
+    numerics->SetConsVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
 
-          /*Apply the Gradient to get the right temperature value on the edge */
-          Project_Grad_i = 0.0; Project_Grad_j = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++) {
-              Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
-              Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
-          }
+    const su2double Temp_i = nodes->GetSolution(iPoint,0);
+    const su2double Temp_j = nodes->GetSolution(jPoint,0);
 
-          Primitive_Flow_i[iVar] = V_i[iVar] + Project_Grad_i;
-          Primitive_Flow_j[iVar] = V_j[iVar] + Project_Grad_j;
-        }
+    /* Second order reconstruction */
+    if (muscl) {
+
+      su2double Vector_ij[MAXNDIM] = {0.0};
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        Vector_ij[iDim] = 0.5*(geometry->nodes->GetCoord(jPoint, iDim) - geometry->nodes->GetCoord(iPoint, iDim));
+      }
+
+      auto Gradient_i = flowNodes->GetGradient_Reconstruction(iPoint);
+      auto Gradient_j = flowNodes->GetGradient_Reconstruction(jPoint);
+      auto Temp_i_Grad = nodes->GetGradient_Reconstruction(iPoint);
+      auto Temp_j_Grad = nodes->GetGradient_Reconstruction(jPoint);
 
-        /* Correct the temperature variables */
-        Project_Temp_i_Grad = 0.0; Project_Temp_j_Grad = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-            Project_Temp_i_Grad += Vector_i[iDim]*Temp_i_Grad[0][iDim];
-            Project_Temp_j_Grad += Vector_j[iDim]*Temp_j_Grad[0][iDim];
+      /*Loop to correct the flow variables*/
+      for (unsigned short iVar = 0; iVar < nVarFlow; iVar++) {
+
+        /*Apply the Gradient to get the right temperature value on the edge */
+        su2double Project_Grad_i = 0.0, Project_Grad_j = 0.0;
+        for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+          Project_Grad_i += Vector_ij[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j -= Vector_ij[iDim]*Gradient_j[iVar][iDim];
         }
 
-        Temp_i_Corrected = Temp_i + Project_Temp_i_Grad;
-        Temp_j_Corrected = Temp_j + Project_Temp_j_Grad;
+        Primitive_Flow_i[iVar] = V_i[iVar] + Project_Grad_i;
+        Primitive_Flow_j[iVar] = V_j[iVar] + Project_Grad_j;
+      }
 
-        numerics->SetPrimitive(Primitive_Flow_i, Primitive_Flow_j);
-        numerics->SetTemperature(Temp_i_Corrected, Temp_j_Corrected);
+      /* Correct the temperature variables */
+      su2double Project_Temp_i_Grad = 0.0, Project_Temp_j_Grad = 0.0;
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+        Project_Temp_i_Grad += Vector_ij[iDim]*Temp_i_Grad[0][iDim];
+        Project_Temp_j_Grad -= Vector_ij[iDim]*Temp_j_Grad[0][iDim];
       }
 
-      else {
+      numerics->SetPrimitive(Primitive_Flow_i, Primitive_Flow_j);
+      numerics->SetTemperature(Temp_i + Project_Temp_i_Grad, Temp_j + Project_Temp_j_Grad);
+    }
+    else {
 
-        numerics->SetPrimitive(V_i, V_j);
-        numerics->SetTemperature(Temp_i, Temp_j);
-      }
+      numerics->SetPrimitive(V_i, V_j);
+      numerics->SetTemperature(Temp_i, Temp_j);
+    }
 
-      numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
 
+    if (ReducerStrategy) {
+      EdgeFluxes.SetBlock(iEdge, Residual);
+      Jacobian.UpdateBlocks(iEdge, Jacobian_i, Jacobian_j);
+    }
+    else {
       LinSysRes.AddBlock(iPoint, Residual);
       LinSysRes.SubtractBlock(jPoint, Residual);
-
-      /*--- Implicit part ---*/
-
       Jacobian.UpdateBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     }
   }
+  } // end color loop
 
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
+  }
 }
 
 void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                    CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
-
-  su2double laminar_viscosity, Prandtl_Lam, Prandtl_Turb, eddy_viscosity_i, eddy_viscosity_j,
-      thermal_diffusivity_i, thermal_diffusivity_j, Temp_i, Temp_j, **Temp_i_Grad, **Temp_j_Grad;
-  unsigned long iEdge, iPoint, jPoint;
-
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
@@ -577,16 +621,28 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
 
   bool turb = ((config->GetKind_Solver() == INC_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
 
-  eddy_viscosity_i = 0.0;
-  eddy_viscosity_j = 0.0;
-  laminar_viscosity = config->GetMu_ConstantND();
-  Prandtl_Lam = config->GetPrandtl_Lam();
-  Prandtl_Turb = config->GetPrandtl_Turb();
+  const su2double laminar_viscosity = config->GetMu_ConstantND();
+  const su2double Prandtl_Lam = config->GetPrandtl_Lam();
+  const su2double Prandtl_Turb = config->GetPrandtl_Turb();
+
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Thread-local residual and Jacobians, the heat equation has a single variable. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i}, *Jacobian_j[1] = {Jac_j};
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    auto iEdge = color.indices[k];
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
 
     /*--- Points coordinates, and normal vector ---*/
 
@@ -594,17 +650,15 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
                        geometry->nodes->GetCoord(jPoint));
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
-    Temp_i_Grad = nodes->GetGradient(iPoint);
-    Temp_j_Grad = nodes->GetGradient(jPoint);
-    numerics->SetConsVarGradient(Temp_i_Grad, Temp_j_Grad);
+    numerics->SetConsVarGradient(nodes->GetGradient(iPoint), nodes->GetGradient(jPoint));
 
     /*--- Primitive variables w/o reconstruction ---*/
-    Temp_i = nodes->GetSolution(iPoint,0);
-    Temp_j = nodes->GetSolution(jPoint,0);
-    numerics->SetTemperature(Temp_i, Temp_j);
+    numerics->SetTemperature(nodes->GetSolution(iPoint,0), nodes->GetSolution(jPoint,0));
 
     /*--- Eddy viscosity to compute thermal conductivity ---*/
+    su2double thermal_diffusivity_i, thermal_diffusivity_j;
     if (flow) {
+      su2double eddy_viscosity_i = 0.0, eddy_viscosity_j = 0.0;
       if (turb) {
         eddy_viscosity_i = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
         eddy_viscosity_j = solver_container[TURB_SOL]->GetNodes()->GetmuT(jPoint);
@@ -625,11 +679,37 @@ void CHeatSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Add and subtract residual, and update Jacobians ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
+    if (ReducerStrategy) {
+      EdgeFluxes.SetBlock(iEdge, Residual, -1.0);
+      Jacobian.UpdateBlocksSub(iEdge, Jacobian_i, Jacobian_j);
+    }
+    else {
+      LinSysRes.SubtractBlock(iPoint, Residual);
+      LinSysRes.AddBlock(jPoint, Residual);
+      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    }
+  }
+  } // end color loop
+
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
+  }
+}
 
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+void CHeatSolver::SumEdgeFluxes(CGeometry* geometry) {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
+      if (iPoint == geometry->edges->GetNode(iEdge,0))
+        LinSysRes.AddBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+      else
+        LinSysRes.SubtractBlock(iPoint, EdgeFluxes.GetBlock(iEdge));
+    }
   }
+
 }
 
 void CHeatSolver::Set_Heatflux_Areas(CGeometry *geometry, CConfig *config) {
@@ -693,9 +773,7 @@ void CHeatSolver::Set_Heatflux_Areas(CGeometry *geometry, CConfig *config) {
 void CHeatSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
                                        unsigned short val_marker) {
 
-  unsigned long iPoint, iVertex, Point_Normal;
-  unsigned short iDim;
-  su2double *Normal, *Coord_i, *Coord_j, Area, dist_ij, laminar_viscosity, thermal_diffusivity, Twall, dTdn, Prandtl_Lam;
+  su2double laminar_viscosity, thermal_diffusivity, Twall, Prandtl_Lam;
   //su2double Prandtl_Turb;
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
@@ -710,54 +788,44 @@ void CHeatSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_conta
   //Prandtl_Turb = config->GetPrandtl_Turb();
   //laminar_viscosity = config->GetViscosity_FreeStreamND(); // TDE check for consistency for CHT
 
+  if(flow) {
+    thermal_diffusivity = laminar_viscosity/Prandtl_Lam;
+  }
+  else
+    thermal_diffusivity = config->GetThermalDiffusivity_Solid();
+
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-    if (geometry->nodes->GetDomain(iPoint)) {
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    const auto Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-        Area = GeometryToolbox::Norm(nDim, Normal);
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-        Coord_i = geometry->nodes->GetCoord(iPoint);
-        Coord_j = geometry->nodes->GetCoord(Point_Normal);
-        dist_ij = 0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dist_ij += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-        dist_ij = sqrt(dist_ij);
+    const su2double dist_ij = GeometryToolbox::Distance(nDim, geometry->nodes->GetCoord(Point_Normal),
+                                                        geometry->nodes->GetCoord(iPoint));
 
-        dTdn = -(nodes->GetSolution(Point_Normal,0) - Twall)/dist_ij;
+    const su2double dTdn = -(nodes->GetSolution(Point_Normal,0) - Twall)/dist_ij;
 
-        if(flow) {
-          thermal_diffusivity = laminar_viscosity/Prandtl_Lam;
-        }
-        else
-          thermal_diffusivity = config->GetThermalDiffusivity_Solid();
+    su2double Res_Visc[1] = {thermal_diffusivity*dTdn*Area};
 
-        Res_Visc[0] = thermal_diffusivity*dTdn*Area;
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-        if(implicit) {
-
-          Jacobian_i[0][0] = -thermal_diffusivity/dist_ij * Area;
-        }
-
-        LinSysRes.SubtractBlock(iPoint, Res_Visc);
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-    }
+    if (implicit) Jacobian.AddVal2Diag(iPoint, thermal_diffusivity/dist_ij * Area);
   }
 }
 
 void CHeatSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
                                                      unsigned short val_marker) {
 
-  unsigned long iVertex, iPoint;
-  su2double Wall_HeatFlux, Area, *Normal;
+  su2double Wall_HeatFlux;
 
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag);
@@ -782,34 +850,26 @@ void CHeatSolver::BC_HeatFlux_Wall(CGeometry *geometry, CSolver **solver_contain
 
   Wall_HeatFlux = Wall_HeatFlux/config->GetHeat_Flux_Ref();
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    if (geometry->nodes->GetDomain(iPoint)) {
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      Res_Visc[0] = 0.0;
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      Res_Visc[0] = Wall_HeatFlux * Area;
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Viscous contribution to the residual at the wall ---*/
+    su2double Res_Visc[1] = {Wall_HeatFlux * Area};
 
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    }
+    /*--- Viscous contribution to the residual at the wall ---*/
 
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
   }
 }
 
 void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
                             CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iDim;
-  unsigned long iVertex, iPoint, Point_Normal;
-  su2double Vel_Mag, *V_inlet, *V_domain;
-
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
@@ -819,251 +879,219 @@ void CHeatSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
 
-  su2double *Normal = new su2double[nDim];
-
-  su2double *Coord_i, *Coord_j, Area, dist_ij, laminar_viscosity, thermal_diffusivity, Twall, dTdn, Prandtl_Lam;
+  su2double laminar_viscosity, thermal_diffusivity, Twall, Prandtl_Lam;
   //su2double Prandtl_Turb;
   Prandtl_Lam = config->GetPrandtl_Lam();
 //  Prandtl_Turb = config->GetPrandtl_Turb();
   laminar_viscosity = config->GetMu_ConstantND();
   //laminar_viscosity = config->GetViscosity_FreeStreamND(); //TDE check for consistency with CHT
 
+  thermal_diffusivity = laminar_viscosity/Prandtl_Lam;
+
   Twall = config->GetTemperature_FreeStreamND();
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  /*--- Retrieve the specified velocity and temperature for the inlet. ---*/
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  const su2double Vel_Mag = config->GetInlet_Ptotal(Marker_Tag)/config->GetVelocity_Ref();
+  const auto Flow_Dir = config->GetInlet_FlowDir(Marker_Tag);
+  const su2double T_Inlet = config->GetInlet_Ttotal(Marker_Tag)/config->GetTemperature_Ref();
 
-    if (geometry->nodes->GetDomain(iPoint)) {
+  /*--- Thread-local residual and Jacobians, the heat equation has a single variable. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i}, *Jacobian_j[1] = {Jac_j};
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      if(flow) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-        /*--- Normal vector for this vertex (negate for outward convention) ---*/
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-        conv_numerics->SetNormal(Normal);
+    if(flow) {
 
-        /*--- Retrieve solution at this boundary node ---*/
+      /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-        V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
+      su2double Normal[MAXNDIM] = {0.0};
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
 
-        /*--- Retrieve the specified velocity for the inlet. ---*/
+      conv_numerics->SetNormal(Normal);
 
-        Vel_Mag  = config->GetInlet_Ptotal(Marker_Tag)/config->GetVelocity_Ref();
-        auto Flow_Dir = config->GetInlet_FlowDir(Marker_Tag);
+      /*--- Retrieve solution at this boundary node ---*/
 
-        V_inlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
+      auto V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
 
-        for (iDim = 0; iDim < nDim; iDim++)
-          V_inlet[iDim+1] = Vel_Mag*Flow_Dir[iDim];
+      auto V_inlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
 
-        conv_numerics->SetPrimitive(V_domain, V_inlet);
+      for (unsigned short iDim = 0; iDim < nDim; iDim++)
+        V_inlet[iDim+1] = Vel_Mag*Flow_Dir[iDim];
 
-        if (dynamic_grid)
-          conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
+      conv_numerics->SetPrimitive(V_domain, V_inlet);
 
-        conv_numerics->SetTemperature(nodes->GetSolution(iPoint,0), config->GetInlet_Ttotal(Marker_Tag)/config->GetTemperature_Ref());
+      if (dynamic_grid)
+        conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
-        /*--- Compute the residual using an upwind scheme ---*/
+      conv_numerics->SetTemperature(nodes->GetSolution(iPoint,0), T_Inlet);
 
-        conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+      /*--- Compute the residual using an upwind scheme ---*/
 
-        /*--- Update residual value ---*/
+      conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
 
-        LinSysRes.AddBlock(iPoint, Residual);
+      /*--- Update residual value ---*/
 
-        /*--- Jacobian contribution for implicit integration ---*/
+      LinSysRes.AddBlock(iPoint, Residual);
 
-        if (implicit)
-          Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
-      }
+      /*--- Jacobian contribution for implicit integration ---*/
 
-      /*--- Viscous contribution ---*/
+      if (implicit)
+        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+    }
 
-      if (viscous) {
+    /*--- Viscous contribution ---*/
 
-        Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    if (viscous) {
 
-        geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-        Area = GeometryToolbox::Norm(nDim, Normal);
+      const auto Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
 
-        Coord_i = geometry->nodes->GetCoord(iPoint);
-        Coord_j = geometry->nodes->GetCoord(Point_Normal);
-        dist_ij = 0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dist_ij += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-        dist_ij = sqrt(dist_ij);
+      const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-        dTdn = -(nodes->GetSolution(Point_Normal,0) - Twall)/dist_ij;
+      const su2double dist_ij = GeometryToolbox::Distance(nDim, geometry->nodes->GetCoord(Point_Normal),
+                                                          geometry->nodes->GetCoord(iPoint));
 
-        thermal_diffusivity = laminar_viscosity/Prandtl_Lam;
+      const su2double dTdn = -(nodes->GetSolution(Point_Normal,0) - Twall)/dist_ij;
 
-        Res_Visc[0] = thermal_diffusivity*dTdn*Area;
+      su2double Res_Visc[1] = {thermal_diffusivity*dTdn*Area};
 
-        if(implicit) {
+      /*--- Viscous contribution to the residual at the wall ---*/
 
-          Jacobian_i[0][0] = -thermal_diffusivity/dist_ij * Area;
-        }
-        /*--- Viscous contribution to the residual at the wall ---*/
+      LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-        LinSysRes.SubtractBlock(iPoint, Res_Visc);
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+      if (implicit) Jacobian.AddVal2Diag(iPoint, thermal_diffusivity/dist_ij * Area);
     }
   }
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
-
 }
 
 void CHeatSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
                              CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iDim;
-  unsigned long iVertex, iPoint, Point_Normal;
-  su2double *V_outlet, *V_domain;
-
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
   bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
-  su2double *Normal = new su2double[nDim];
+  if (!flow) return;
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  /*--- Thread-local residual and Jacobians, the heat equation has a single variable. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i}, *Jacobian_j[1] = {Jac_j};
 
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-    if (geometry->nodes->GetDomain(iPoint)) {
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      /*--- Normal vector for this vertex (negate for outward convention) ---*/
+    const auto Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
 
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+    /*--- Normal vector for this vertex (negate for outward convention) ---*/
 
-      if(flow) {
-          conv_numerics->SetNormal(Normal);
+    su2double Normal[MAXNDIM] = {0.0};
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      Normal[iDim] = -geometry->vertex[val_marker][iVertex]->GetNormal(iDim);
 
-          /*--- Retrieve solution at this boundary node ---*/
+    conv_numerics->SetNormal(Normal);
 
-          V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
+    /*--- Retrieve solution at this boundary node ---*/
 
-          /*--- Retrieve the specified velocity for the inlet. ---*/
+    auto V_domain = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint);
 
-          V_outlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
-          for (iDim = 0; iDim < nDim; iDim++)
-            V_outlet[iDim+1] = solver_container[FLOW_SOL]->GetNodes()->GetVelocity(Point_Normal, iDim);
+    /*--- Retrieve the specified velocity for the inlet. ---*/
 
-          conv_numerics->SetPrimitive(V_domain, V_outlet);
+    auto V_outlet = solver_container[FLOW_SOL]->GetCharacPrimVar(val_marker, iVertex);
+    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+      V_outlet[iDim+1] = solver_container[FLOW_SOL]->GetNodes()->GetVelocity(Point_Normal, iDim);
 
-          if (dynamic_grid)
-            conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
+    conv_numerics->SetPrimitive(V_domain, V_outlet);
 
-          conv_numerics->SetTemperature(nodes->GetSolution(iPoint,0), nodes->GetSolution(Point_Normal,0));
+    if (dynamic_grid)
+      conv_numerics->SetGridVel(geometry->nodes->GetGridVel(iPoint), geometry->nodes->GetGridVel(iPoint));
 
-          /*--- Compute the residual using an upwind scheme ---*/
+    conv_numerics->SetTemperature(nodes->GetSolution(iPoint,0), nodes->GetSolution(Point_Normal,0));
 
-          conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    /*--- Compute the residual using an upwind scheme ---*/
 
-          /*--- Update residual value ---*/
+    conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
 
-          LinSysRes.AddBlock(iPoint, Residual);
+    /*--- Update residual value ---*/
 
-          /*--- Jacobian contribution for implicit integration ---*/
+    LinSysRes.AddBlock(iPoint, Residual);
 
-          if (implicit)
-            Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
-      }
-    }
-  }
+    /*--- Jacobian contribution for implicit integration ---*/
 
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
+    if (implicit)
+      Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
+  }
 
 }
 
 void CHeatSolver::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned long iVertex, iPoint;
-
-  su2double thermal_diffusivity, rho_cp_solid, Temperature_Ref, T_Conjugate, Tinterface,
-      Tnormal_Conjugate, HeatFluxDensity, HeatFlux, Area;
-
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == INC_RANS)
                || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
 
-  su2double *Normal = new su2double[nDim];
-
-  Temperature_Ref       = config->GetTemperature_Ref();
-  rho_cp_solid          = config->GetDensity_Solid()*config->GetSpecific_Heat_Cp();
+  const su2double Temperature_Ref = config->GetTemperature_Ref();
+  const su2double rho_cp_solid    = config->GetDensity_Solid()*config->GetSpecific_Heat_Cp();
 
-  if (flow) {
+  const bool robin = (config->GetKind_CHT_Coupling() == DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
+                     (config->GetKind_CHT_Coupling() == AVERAGED_TEMPERATURE_ROBIN_HEATFLUX);
 
-    for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      if (geometry->nodes->GetDomain(iPoint)) {
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-        Area = GeometryToolbox::Norm(nDim, Normal);
+    if (flow) {
 
-        T_Conjugate = GetConjugateHeatVariable(val_marker, iVertex, 0)/Temperature_Ref;
+      su2double T_Conjugate = GetConjugateHeatVariable(val_marker, iVertex, 0)/Temperature_Ref;
 
-        nodes->SetSolution_Old(iPoint,&T_Conjugate);
-        LinSysRes(iPoint, 0) = 0.0;
-        nodes->SetRes_TruncErrorZero(iPoint);
+      nodes->SetSolution_Old(iPoint,&T_Conjugate);
+      LinSysRes(iPoint, 0) = 0.0;
+      nodes->SetRes_TruncErrorZero(iPoint);
 
-        if (implicit) Jacobian.DeleteValsRowi(iPoint);
-      }
+      if (implicit) Jacobian.DeleteValsRowi(iPoint);
     }
-  }
-  else {
-
-    for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-
-      iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-      if (geometry->nodes->GetDomain(iPoint)) {
-
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-        Area = GeometryToolbox::Norm(nDim, Normal);
+    else {
 
-        thermal_diffusivity = GetConjugateHeatVariable(val_marker, iVertex, 2)/rho_cp_solid;
+      const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-        if ((config->GetKind_CHT_Coupling() == DIRECT_TEMPERATURE_ROBIN_HEATFLUX) ||
-            (config->GetKind_CHT_Coupling() == AVERAGED_TEMPERATURE_ROBIN_HEATFLUX)) {
+      const su2double thermal_diffusivity = GetConjugateHeatVariable(val_marker, iVertex, 2)/rho_cp_solid;
 
-          Tinterface        = nodes->GetSolution(iPoint,0);
-          Tnormal_Conjugate = GetConjugateHeatVariable(val_marker, iVertex, 3)/Temperature_Ref;
+      su2double HeatFluxDensity;
 
-          HeatFluxDensity   = thermal_diffusivity*(Tinterface - Tnormal_Conjugate);
-          HeatFlux          = HeatFluxDensity * Area;
+      if (robin) {
 
-          if (implicit) {
+        const su2double Tinterface        = nodes->GetSolution(iPoint,0);
+        const su2double Tnormal_Conjugate = GetConjugateHeatVariable(val_marker, iVertex, 3)/Temperature_Ref;
 
-            Jacobian_i[0][0] = -thermal_diffusivity*Area;
-            Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-          }
-        }
-        else {
+        HeatFluxDensity = thermal_diffusivity*(Tinterface - Tnormal_Conjugate);
 
-          HeatFluxDensity = GetConjugateHeatVariable(val_marker, iVertex, 1)/config->GetHeat_Flux_Ref();
-          HeatFlux        = HeatFluxDensity*Area;
-        }
+        if (implicit) Jacobian.AddVal2Diag(iPoint, thermal_diffusivity*Area);
+      }
+      else {
 
-        Res_Visc[0] = -HeatFlux;
-        LinSysRes.SubtractBlock(iPoint, Res_Visc);
+        HeatFluxDensity = GetConjugateHeatVariable(val_marker, iVertex, 1)/config->GetHeat_Flux_Ref();
       }
+
+      su2double Res_Visc[1] = {-HeatFluxDensity*Area};
+      LinSysRes.SubtractBlock(iPoint, Res_Visc);
     }
   }
 }
@@ -1206,255 +1234,267 @@ void CHeatSolver::Heat_Fluxes(CGeometry *geometry, CSolver **solver_container, C
 void CHeatSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double Area, Vol, laminar_viscosity, eddy_viscosity, thermal_diffusivity, Prandtl_Lam, Prandtl_Turb, Mean_ProjVel, Mean_BetaInc2, Mean_DensityInc, Mean_SoundSpeed, Lambda;
-  su2double Global_Delta_Time = 0.0, Global_Delta_UnstTimeND = 0.0, Local_Delta_Time = 0.0, Local_Delta_Time_Inv, Local_Delta_Time_Visc, CFL_Reduction, K_v = 0.25;
-  const su2double* Normal;
-
-  bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == INC_RANS)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
-
-  bool turb = ((config->GetKind_Solver() == INC_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
-  bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
-                    (config->GetTime_Marching() == DT_STEPPING_2ND));
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
-
-  eddy_viscosity    = 0.0;
-  laminar_viscosity = config->GetMu_ConstantND();
-  Prandtl_Lam = config->GetPrandtl_Lam();
-  Prandtl_Turb = config->GetPrandtl_Turb();
-
-  thermal_diffusivity = config->GetThermalDiffusivity_Solid();
+  const bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
+                     || (config->GetKind_Solver() == INC_RANS)
+                     || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
+                     || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
+
+  const bool turb = ((config->GetKind_Solver() == INC_RANS) || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
+  const bool dual_time = ((config->GetTime_Marching() == DT_STEPPING_1ST) ||
+                          (config->GetTime_Marching() == DT_STEPPING_2ND));
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool time_stepping = (config->GetTime_Marching() == TIME_STEPPING);
+  const bool unst_cfl = dual_time && (Iteration == 0) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0);
+
+  const su2double K_v = 0.25;
+  const su2double laminar_viscosity = config->GetMu_ConstantND();
+  const su2double Prandtl_Lam = config->GetPrandtl_Lam();
+  const su2double Prandtl_Turb = config->GetPrandtl_Turb();
+  const su2double CFL_Reduction = config->GetCFLRedCoeff_Turb();
+
+  CVariable* flowNodes = flow? solver_container[FLOW_SOL]->GetNodes() : nullptr;
+  CVariable* turbNodes = turb? solver_container[TURB_SOL]->GetNodes() : nullptr;
+
+  /*--- Thermal diffusivity used for the viscous spectral radius, in the fluid
+   *    the eddy viscosity is evaluated at the first point of the edge. ---*/
+  auto thermalDiffusivity = [&](unsigned long iPoint) {
+    if (!flow) return config->GetThermalDiffusivity_Solid();
+    const su2double eddy_viscosity = turb? turbNodes->GetmuT(iPoint) : su2double(0.0);
+    return laminar_viscosity/Prandtl_Lam + eddy_viscosity/Prandtl_Turb;
+  };
+
+  /*--- Convective spectral radius of an edge or boundary face. ---*/
+  auto lambdaInv = [&](su2double ProjVel, su2double BetaInc2, su2double DensityInc, su2double Area) {
+    const su2double SoundSpeed = sqrt(ProjVel*ProjVel + (BetaInc2/DensityInc)*Area*Area);
+    return fabs(ProjVel) + SoundSpeed;
+  };
+
+  /*--- Init thread-shared variables to compute min/max values. ---*/
+
+  SU2_OMP_MASTER
+  {
+    Min_Delta_Time = 1.E30;
+    Max_Delta_Time = 0.0;
+  }
+  SU2_OMP_BARRIER
 
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  /*--- Compute spectral radius based on thermal conductivity, loop domain points. ---*/
 
-  Min_Delta_Time = 1.E30; Max_Delta_Time = 0.0;
-  CFL_Reduction = config->GetCFLRedCoeff_Turb();
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     nodes->SetMax_Lambda_Inv(iPoint,0.0);
     nodes->SetMax_Lambda_Visc(iPoint,0.0);
-  }
 
-  /*--- Loop interior edges ---*/
+    /*--- Loop over the neighbors of point i. ---*/
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    for (unsigned short iNeigh = 0; iNeigh < geometry->nodes->GetnPoint(iPoint); ++iNeigh) {
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+      const auto jPoint = geometry->nodes->GetPoint(iPoint,iNeigh);
+      const auto iEdge = geometry->nodes->GetEdge(iPoint,iNeigh);
 
-    /*--- get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, Normal);
+      /*--- Get the edge's normal vector to compute the edge's area ---*/
+      const auto Normal = geometry->edges->GetNormal(iEdge);
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
-    /*--- Inviscid contribution ---*/
-
-    if (flow) {
-      Mean_ProjVel = 0.5 * (solver_container[FLOW_SOL]->GetNodes()->GetProjVel(iPoint,Normal) + solver_container[FLOW_SOL]->GetNodes()->GetProjVel(jPoint,Normal));
-      Mean_BetaInc2 = 0.5 * (solver_container[FLOW_SOL]->GetNodes()->GetBetaInc2(iPoint) + solver_container[FLOW_SOL]->GetNodes()->GetBetaInc2(jPoint));
-      Mean_DensityInc = 0.5 * (solver_container[FLOW_SOL]->GetNodes()->GetDensity(iPoint) + solver_container[FLOW_SOL]->GetNodes()->GetDensity(jPoint));
-      Mean_SoundSpeed = sqrt(Mean_ProjVel*Mean_ProjVel + (Mean_BetaInc2/Mean_DensityInc)*Area*Area);
-
-      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Inv(iPoint, Lambda);
-      if (geometry->nodes->GetDomain(jPoint)) nodes->AddMax_Lambda_Inv(jPoint, Lambda);
-    }
+      /*--- Inviscid contribution ---*/
 
-    /*--- Viscous contribution ---*/
+      if (flow) {
+        const su2double Mean_ProjVel = 0.5 * (flowNodes->GetProjVel(iPoint,Normal) + flowNodes->GetProjVel(jPoint,Normal));
+        const su2double Mean_BetaInc2 = 0.5 * (flowNodes->GetBetaInc2(iPoint) + flowNodes->GetBetaInc2(jPoint));
+        const su2double Mean_DensityInc = 0.5 * (flowNodes->GetDensity(iPoint) + flowNodes->GetDensity(jPoint));
 
-    thermal_diffusivity = config->GetThermalDiffusivity_Solid();
-    if(flow) {
-      if(turb) {
-        eddy_viscosity = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
+        nodes->AddMax_Lambda_Inv(iPoint, lambdaInv(Mean_ProjVel, Mean_BetaInc2, Mean_DensityInc, Area));
       }
 
-      thermal_diffusivity = laminar_viscosity/Prandtl_Lam + eddy_viscosity/Prandtl_Turb;
-    }
-
-    Lambda = thermal_diffusivity*Area*Area;
-    if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->nodes->GetDomain(jPoint)) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Viscous contribution ---*/
 
+      const su2double Lambda = thermalDiffusivity(geometry->edges->GetNode(iEdge,0))*Area*Area;
+      nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+    }
   }
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+
+      if (!geometry->nodes->GetDomain(iPoint)) continue;
+
+      const auto Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      const su2double Area = GeometryToolbox::Norm(nDim, Normal);
 
       /*--- Inviscid contribution ---*/
 
       if (flow) {
-        Mean_ProjVel = solver_container[FLOW_SOL]->GetNodes()->GetProjVel(iPoint, Normal);
-        Mean_BetaInc2 = solver_container[FLOW_SOL]->GetNodes()->GetBetaInc2(iPoint);
-        Mean_DensityInc = solver_container[FLOW_SOL]->GetNodes()->GetDensity(iPoint);
-        Mean_SoundSpeed = sqrt(Mean_ProjVel*Mean_ProjVel + (Mean_BetaInc2/Mean_DensityInc)*Area*Area);
-
-        Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-        if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Inv(iPoint, Lambda);
+        nodes->AddMax_Lambda_Inv(iPoint, lambdaInv(flowNodes->GetProjVel(iPoint, Normal), flowNodes->GetBetaInc2(iPoint),
+                                                   flowNodes->GetDensity(iPoint), Area));
       }
 
       /*--- Viscous contribution ---*/
 
-      thermal_diffusivity = config->GetThermalDiffusivity_Solid();
-      if(flow) {
-        if(turb) {
-          eddy_viscosity = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-        }
-
-        thermal_diffusivity = laminar_viscosity/Prandtl_Lam + eddy_viscosity/Prandtl_Turb;
-      }
-
-      Lambda = thermal_diffusivity*Area*Area;
-      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-
+      nodes->AddMax_Lambda_Visc(iPoint, thermalDiffusivity(iPoint)*Area*Area);
     }
   }
 
   /*--- Each element uses their own speed, steady state simulation ---*/
+  {
+    /*--- Thread-local variables for min/max reduction. ---*/
+    su2double minDt = 1.E30, maxDt = 0.0;
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
 
-    if (Vol != 0.0) {
+      if (Vol != 0.0) {
 
-      if(flow) {
-        Local_Delta_Time_Inv = config->GetCFL(iMesh)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
-        Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
-      }
-      else {
-        Local_Delta_Time_Inv = config->GetMax_DeltaTime();
-        Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
-        //Local_Delta_Time_Visc = 100.0*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
-      }
+        su2double Local_Delta_Time = 0.0, Local_Delta_Time_Inv;
+        const su2double Local_Delta_Time_Visc = config->GetCFL(iMesh)*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
 
-      /*--- Time step setting method ---*/
+        if(flow) {
+          Local_Delta_Time_Inv = config->GetCFL(iMesh)*Vol / nodes->GetMax_Lambda_Inv(iPoint);
+        }
+        else {
+          Local_Delta_Time_Inv = config->GetMax_DeltaTime();
+        }
 
-      if (config->GetKind_TimeStep_Heat() == BYFLOW && flow) {
-        Local_Delta_Time = solver_container[FLOW_SOL]->GetNodes()->GetDelta_Time(iPoint);
-      }
-      else if (config->GetKind_TimeStep_Heat() == MINIMUM) {
-        Local_Delta_Time = min(Local_Delta_Time_Inv, Local_Delta_Time_Visc);
-      }
-      else if (config->GetKind_TimeStep_Heat() == CONVECTIVE) {
-        Local_Delta_Time = Local_Delta_Time_Inv;
-      }
-      else if (config->GetKind_TimeStep_Heat() == VISCOUS) {
-        Local_Delta_Time = Local_Delta_Time_Visc;
-      }
+        /*--- Time step setting method ---*/
 
-      /*--- Min-Max-Logic ---*/
+        if (config->GetKind_TimeStep_Heat() == BYFLOW && flow) {
+          Local_Delta_Time = flowNodes->GetDelta_Time(iPoint);
+        }
+        else if (config->GetKind_TimeStep_Heat() == MINIMUM) {
+          Local_Delta_Time = min(Local_Delta_Time_Inv, Local_Delta_Time_Visc);
+        }
+        else if (config->GetKind_TimeStep_Heat() == CONVECTIVE) {
+          Local_Delta_Time = Local_Delta_Time_Inv;
+        }
+        else if (config->GetKind_TimeStep_Heat() == VISCOUS) {
+          Local_Delta_Time = Local_Delta_Time_Visc;
+        }
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
+        /*--- Min-Max-Logic ---*/
 
-      nodes->SetDelta_Time(iPoint,CFL_Reduction*Local_Delta_Time);
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
+
+        if (Local_Delta_Time > config->GetMax_DeltaTime())
+          Local_Delta_Time = config->GetMax_DeltaTime();
+
+        nodes->SetDelta_Time(iPoint,CFL_Reduction*Local_Delta_Time);
+      }
+      else {
+        nodes->SetDelta_Time(iPoint,0.0);
+      }
     }
-    else {
-      nodes->SetDelta_Time(iPoint,0.0);
+    /*--- Min/max over threads. ---*/
+    SU2_OMP_CRITICAL
+    {
+      Min_Delta_Time = min(Min_Delta_Time, minDt);
+      Max_Delta_Time = max(Max_Delta_Time, maxDt);
     }
+    SU2_OMP_BARRIER
   }
 
-  /*--- Compute the max and the min dt (in parallel) ---*/
-  if (config->GetComm_Level() == COMM_FULL) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    Min_Delta_Time = rbuf_time;
-
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    Max_Delta_Time = rbuf_time;
-#endif
+  /*--- Compute the max and the min dt (in parallel, now over mpi ranks), the smallest
+   *    time step of the whole mesh is needed for exact time stepping strategies. ---*/
+
+  SU2_OMP_MASTER
+  {
+    su2double rbuf_time;
+    Global_Delta_Time = Min_Delta_Time;
+
+    if (config->GetComm_Level() == COMM_FULL) {
+      SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+      Min_Delta_Time = Global_Delta_Time = rbuf_time;
+
+      SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      Max_Delta_Time = rbuf_time;
+    }
+    else if (time_stepping || unst_cfl) {
+      SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+      Global_Delta_Time = rbuf_time;
+    }
   }
+  SU2_OMP_BARRIER
 
   /*--- For exact time solution use the minimum delta time of the whole mesh ---*/
-  if (config->GetTime_Marching() == TIME_STEPPING) {
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    Global_Delta_Time = rbuf_time;
-#endif
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+  if (time_stepping) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++)
       nodes->SetDelta_Time(iPoint,Global_Delta_Time);
   }
 
   /*--- Recompute the unsteady time step for the dual time strategy
    if the unsteady CFL is diferent from 0 ---*/
-  if ((dual_time) && (Iteration == 0) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0)) {
-    Global_Delta_UnstTimeND = config->GetUnst_CFL()*Global_Delta_Time/config->GetCFL(iMesh);
-
-#ifdef HAVE_MPI
-    su2double rbuf_time, sbuf_time;
-    sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, SU2_MPI::GetComm());
-    Global_Delta_UnstTimeND = rbuf_time;
-#endif
-    config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
+  if (unst_cfl) {
+    SU2_OMP_MASTER
+    config->SetDelta_UnstTimeND(config->GetUnst_CFL()*Global_Delta_Time/config->GetCFL(iMesh));
+    SU2_OMP_BARRIER
   }
 
   /*--- The pseudo local time (explicit integration) cannot be greater than the physical time ---*/
-  if (dual_time)
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!implicit) {
-        cout << "Using unsteady time: " << config->GetDelta_UnstTimeND() << endl;
-        Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
-        nodes->SetDelta_Time(iPoint,Local_Delta_Time);
-      }
+  if (dual_time && !implicit) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      su2double Local_Delta_Time = min((2.0/3.0)*config->GetDelta_UnstTimeND(), nodes->GetDelta_Time(iPoint));
+      nodes->SetDelta_Time(iPoint,Local_Delta_Time);
+    }
   }
 }
 
 void CHeatSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
-  unsigned short iVar;
-  unsigned long iPoint;
-
   bool adjoint = config->GetContinuous_Adjoint();
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
+
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  /*--- The heat equation has a single variable. ---*/
+  su2double resMax = 0.0, resRMS = 0.0;
+  const su2double* coordMax = nullptr;
+  unsigned long idxMax = 0;
 
   /*--- Update the solution ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    Vol = geometry->nodes->GetVolume(iPoint);
-    Delta = nodes->GetDelta_Time(iPoint) / Vol;
+  if (!adjoint) {
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
+      const su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
-    local_Residual = LinSysRes.GetBlock(iPoint);
+      const su2double Res = LinSysRes(iPoint,0) + nodes->GetResTruncError(iPoint)[0];
+      nodes->AddSolution(iPoint, 0, -Res*Delta);
 
-    if (!adjoint) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res = local_Residual[iVar] + local_Res_TruncError[iVar];
-        nodes->AddSolution(iPoint,iVar, -Res*Delta);
-        AddRes_RMS(iVar, Res*Res);
-        AddRes_Max(iVar, fabs(Res), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+      resRMS += Res*Res;
+      if (fabs(Res) > resMax) {
+        resMax = fabs(Res);
+        idxMax = iPoint;
+        coordMax = geometry->nodes->GetCoord(iPoint);
       }
     }
-
   }
+  SU2_OMP_CRITICAL
+  {
+    AddRes_RMS(0, resRMS);
+    AddRes_Max(0, resMax, geometry->nodes->GetGlobalIndex(idxMax), coordMax);
+  }
+  SU2_OMP_BARRIER
 
   /*--- MPI solution ---*/
 
@@ -1463,98 +1503,94 @@ void CHeatSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
   /*--- Compute the root mean square residual ---*/
 
+  SU2_OMP_MASTER
   SetResidual_RMS(geometry, config);
+  SU2_OMP_BARRIER
 
 }
 
 
 void CHeatSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index;
-  su2double Delta, Vol, *local_Res_TruncError;
-  bool flow = ((config->GetKind_Solver() == INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == INC_RANS)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_NAVIER_STOKES)
-               || (config->GetKind_Solver() == DISC_ADJ_INC_RANS));
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
-
-  /*--- Set maximum residual to zero ---*/
-
-  for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
+  SU2_OMP_BARRIER
+
+  /*--- The heat equation has a single variable. ---*/
+  su2double resMax = 0.0, resRMS = 0.0;
+  const su2double* coordMax = nullptr;
+  unsigned long idxMax = 0;
 
   /*--- Build implicit system ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Read the residual ---*/
 
-    local_Res_TruncError = nodes->GetResTruncError(iPoint);
-
-    /*--- Read the volume ---*/
-
-    Vol = geometry->nodes->GetVolume(iPoint);
+    su2double* local_Res_TruncError = nodes->GetResTruncError(iPoint);
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
-
-      if(flow) {
-        Delta = Vol / nodes->GetDelta_Time(iPoint);
-        Jacobian.AddVal2Diag(iPoint, Delta);
-      }
-      else {
-        Delta = Vol / nodes->GetDelta_Time(iPoint);
-        Jacobian.AddVal2Diag(iPoint, Delta);
-      }
-
-    } else {
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
+      Jacobian.AddVal2Diag(iPoint, Vol / nodes->GetDelta_Time(iPoint));
+    }
+    else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-        local_Res_TruncError[iVar] = 0.0;
-      }
+      LinSysRes(iPoint,0) = 0.0;
+      local_Res_TruncError[0] = 0.0;
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
-      LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
-      LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+    LinSysRes(iPoint,0) = - (LinSysRes(iPoint,0) + local_Res_TruncError[0]);
+    LinSysSol(iPoint,0) = 0.0;
+
+    const su2double Res = fabs(LinSysRes(iPoint,0));
+    resRMS += Res*Res;
+    if (Res > resMax) {
+      resMax = Res;
+      idxMax = iPoint;
+      coordMax = geometry->nodes->GetCoord(iPoint);
     }
   }
+  SU2_OMP_CRITICAL
+  {
+    AddRes_RMS(0, resRMS);
+    AddRes_Max(0, resMax, geometry->nodes->GetGlobalIndex(idxMax), coordMax);
+  }
+  SU2_OMP_BARRIER
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP(for schedule(static,OMP_MIN_SIZE) nowait)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
   }
 
   /*--- Solve or smooth the linear system ---*/
 
   auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
-  /*--- Store the the number of iterations of the linear solver ---*/
-  SetIterLinSolver(iter);
+  /*--- Store the the number of iterations of the linear solver, and the value of the residual. ---*/
 
-  /*--- Store the value of the residual. ---*/
-  SetResLinSolver(System.GetResidual());
+  SU2_OMP_MASTER {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint,iVar, LinSysSol[iPoint*nVar+iVar]);
-    }
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    nodes->AddSolution(iPoint, 0, LinSysSol(iPoint,0));
   }
 
   /*--- MPI solution ---*/
@@ -1564,7 +1600,9 @@ void CHeatSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
 
   /*--- Compute the root mean square residual ---*/
 
+  SU2_OMP_MASTER
   SetResidual_RMS(geometry, config);
+  SU2_OMP_BARRIER
 
 }
 
@@ -1635,67 +1673,58 @@ void CHeatSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_co
 void CHeatSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                         unsigned short iRKStep, unsigned short iMesh, unsigned short RunTime_EqSystem) {
 
-  /*--- Local variables ---*/
-
-  unsigned short iVar, jVar;
-  unsigned long iPoint;
-
-  su2double *U_time_n, *U_time_nP1, *U_time_nM1;
-  su2double Volume_nP1, TimeStep;
-
-  bool implicit       = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool first_order = (config->GetTime_Marching() == DT_STEPPING_1ST);
+  const bool second_order = (config->GetTime_Marching() == DT_STEPPING_2ND);
 
   /*--- Store the physical time step ---*/
 
-  TimeStep = config->GetDelta_UnstTimeND();
+  const su2double TimeStep = config->GetDelta_UnstTimeND();
 
   /*--- Compute the dual time-stepping source term for static meshes ---*/
 
-  if (!dynamic_grid) {
+  if (dynamic_grid) return;
 
-    /*--- Loop over all nodes (excluding halos) ---*/
+  /*--- Loop over all nodes (excluding halos) ---*/
 
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-      /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
-       we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
-       previous solutions that are stored in memory. ---*/
+    /*--- Retrieve the solution at time levels n-1, n, and n+1. Note that
+     we are currently iterating on U^n+1 and that U^n & U^n-1 are fixed,
+     previous solutions that are stored in memory. ---*/
 
-      U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
-      U_time_n   = nodes->GetSolution_time_n(iPoint);
-      U_time_nP1 = nodes->GetSolution(iPoint);
+    const su2double* U_time_nM1 = nodes->GetSolution_time_n1(iPoint);
+    const su2double* U_time_n   = nodes->GetSolution_time_n(iPoint);
+    const su2double* U_time_nP1 = nodes->GetSolution(iPoint);
 
-      /*--- CV volume at time n+1. As we are on a static mesh, the volume
-       of the CV will remained fixed for all time steps. ---*/
+    /*--- CV volume at time n+1. As we are on a static mesh, the volume
+     of the CV will remained fixed for all time steps. ---*/
 
-      Volume_nP1 = geometry->nodes->GetVolume(iPoint);
+    const su2double Volume_nP1 = geometry->nodes->GetVolume(iPoint);
 
-      /*--- Compute the dual time-stepping source term based on the chosen
-       time discretization scheme (1st- or 2nd-order).---*/
+    /*--- Compute the dual time-stepping source term based on the chosen
+     time discretization scheme (1st- or 2nd-order). The heat equation
+     has a single variable. ---*/
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        if (config->GetTime_Marching() == DT_STEPPING_1ST)
-          Residual[iVar] = (U_time_nP1[iVar] - U_time_n[iVar])*Volume_nP1 / TimeStep;
-        if (config->GetTime_Marching() == DT_STEPPING_2ND)
-          Residual[iVar] = ( 3.0*U_time_nP1[iVar] - 4.0*U_time_n[iVar]
-                            +1.0*U_time_nM1[iVar])*Volume_nP1 / (2.0*TimeStep);
-      }
+    su2double Residual[1] = {0.0};
 
-      /*--- Store the residual and compute the Jacobian contribution due
-       to the dual time source term. ---*/
+    if (first_order)
+      Residual[0] = (U_time_nP1[0] - U_time_n[0])*Volume_nP1 / TimeStep;
+    if (second_order)
+      Residual[0] = ( 3.0*U_time_nP1[0] - 4.0*U_time_n[0]
+                     +1.0*U_time_nM1[0])*Volume_nP1 / (2.0*TimeStep);
 
-      LinSysRes.AddBlock(iPoint, Residual);
-      if (implicit) {
-        for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) Jacobian_i[iVar][jVar] = 0.0;
-          if (config->GetTime_Marching() == DT_STEPPING_1ST)
-            Jacobian_i[iVar][iVar] = Volume_nP1 / TimeStep;
-          if (config->GetTime_Marching() == DT_STEPPING_2ND)
-            Jacobian_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
-        }
+    /*--- Store the residual and compute the Jacobian contribution due
+     to the dual time source term. ---*/
 
-        Jacobian.AddBlock2Diag(iPoint, Jacobian_i);
-      }
+    LinSysRes.AddBlock(iPoint, Residual);
+
+    if (implicit) {
+      if (first_order)
+        Jacobian.AddVal2Diag(iPoint, Volume_nP1 / TimeStep);
+      if (second_order)
+        Jacobian.AddVal2Diag(iPoint, (Volume_nP1*3.0)/(2.0*TimeStep));
     }
   }
 }
@@ -149,9 +149,10 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
     if (rank == MASTER_NODE)
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy, true);
+    System.SetMGCoarseSmoother(true);
 
-    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+    if ((config->GetKind_Linear_Solver_Prec() == LINELET) || (config->GetKind_Linear_Solver_Prec(iMesh) == LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
@@ -911,18 +912,44 @@ void CIncEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contai
 
 unsigned long CIncEulerSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  unsigned long nonPhysicalPoints = 0;
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The density and heat capacities are computed for batches of points (functions
+   *    of temperature only), then the primitives are set point by point. ---*/
+
+  constexpr unsigned long batchSize = 64;
+  const unsigned long nBatch = roundUpDiv(nPoint, batchSize);
+
+  CFluidModel* fluidModel = GetFluidModel();
+
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
+
+    const unsigned long begin = iBatch * batchSize;
+    const unsigned long size = min(batchSize, nPoint - begin);
+
+    su2double temperature[batchSize], density[batchSize], cp[batchSize], cv[batchSize];
 
-    /*--- Incompressible flow, primitive variables ---*/
+    for (unsigned long i = 0; i < size; ++i)
+      temperature[i] = nodes->GetSolution(begin+i, nDim+1);
 
-    auto physical = nodes->SetPrimVar(iPoint,GetFluidModel());
+    CFluidStateBatch state;
+    state.Density = density;
+    state.Cp = cp;
+    state.Cv = cv;
 
-    /* Check for non-realizable states for reporting. */
+    fluidModel->ComputeTDState_T(size, temperature, state);
 
-    if (!physical) nonPhysicalPoints++;
+    for (unsigned long i = 0; i < size; ++i) {
+
+      /*--- Incompressible flow, primitive variables ---*/
+
+      auto physical = nodes->SetPrimVar(begin+i, density[i], cp[i], cv[i], fluidModel);
+
+      /* Check for non-realizable states for reporting. */
+
+      if (!physical) nonPhysicalPoints++;
+    }
   }
 
   return nonPhysicalPoints;
@@ -305,38 +305,64 @@ void CIncNSSolver::Viscous_Residual(unsigned long iEdge, CGeometry *geometry, CS
 
 unsigned long CIncNSSolver::SetPrimitive_Variables(CSolver **solver_container, const CConfig *config) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  su2double eddy_visc = 0.0, turb_ke = 0.0, DES_LengthScale = 0.0;
-  unsigned short turb_model = config->GetKind_Turb_Model();
+  unsigned long nonPhysicalPoints = 0;
+  const unsigned short turb_model = config->GetKind_Turb_Model();
+  const bool turbulent = (turb_model != NONE) && (solver_container[TURB_SOL] != nullptr);
+  const bool hybridRANSLES = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
 
-  bool tkeNeeded = ((turb_model == SST) || (turb_model == SST_SUST));
+  /*--- As for Euler (see CIncEulerSolver::SetPrimitive_Variables) the density and heat capacities
+   *    are computed in batches, then the primitives and transport properties point by point. ---*/
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  constexpr unsigned long batchSize = 64;
+  const unsigned long nBatch = roundUpDiv(nPoint, batchSize);
 
-    /*--- Retrieve the value of the kinetic energy (if needed) ---*/
+  CFluidModel* fluidModel = GetFluidModel();
+  auto nsNodes = static_cast<CIncNSVariable*>(nodes);
 
-    if (turb_model != NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
 
-      if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES){
-        DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
-      }
-    }
+    const unsigned long begin = iBatch * batchSize;
+    const unsigned long size = min(batchSize, nPoint - begin);
+
+    su2double temperature[batchSize], density[batchSize], cp[batchSize], cv[batchSize];
+
+    for (unsigned long i = 0; i < size; ++i)
+      temperature[i] = nodes->GetSolution(begin+i, nDim+1);
+
+    CFluidStateBatch state;
+    state.Density = density;
+    state.Cp = cp;
+    state.Cv = cv;
 
-    /*--- Incompressible flow, primitive variables --- */
+    fluidModel->ComputeTDState_T(size, temperature, state);
 
-    bool physical = static_cast<CIncNSVariable*>(nodes)->SetPrimVar(iPoint,eddy_visc, turb_ke, GetFluidModel());
+    for (unsigned long i = 0; i < size; ++i) {
+      const auto iPoint = begin + i;
+      su2double eddy_visc = 0.0, DES_LengthScale = 0.0;
 
-    /* Check for non-realizable states for reporting. */
+      /*--- Retrieve the value of the eddy viscosity (if needed) ---*/
 
-    if (!physical) nonPhysicalPoints++;
+      if (turbulent) {
+        eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
 
-    /*--- Set the DES length scale ---*/
+        if (hybridRANSLES) {
+          DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
+        }
+      }
+
+      /*--- Incompressible flow, primitive variables --- */
+
+      bool physical = nsNodes->SetPrimVar(iPoint, eddy_visc, density[i], cp[i], cv[i], fluidModel);
 
-    nodes->SetDES_LengthScale(iPoint,DES_LengthScale);
+      /* Check for non-realizable states for reporting. */
 
+      if (!physical) nonPhysicalPoints++;
+
+      /*--- Set the DES length scale ---*/
+
+      nodes->SetDES_LengthScale(iPoint,DES_LengthScale);
+    }
   }
 
   return nonPhysicalPoints;
@@ -202,7 +202,7 @@ void CMeshSolver::SetMinMaxVolume(CGeometry *geometry, CConfig *config, bool upd
     int EL_KIND;
     unsigned short iNode, nNodes, iDim;
 
-    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
     CElement* fea_elem = element_container[FEA_TERM][EL_KIND + thread*MAX_FE_KINDS];
 
@@ -211,7 +211,7 @@ void CMeshSolver::SetMinMaxVolume(CGeometry *geometry, CConfig *config, bool upd
 
     for (iNode = 0; iNode < nNodes; iNode++) {
 
-      auto indexNode = geometry->elem[iElem]->GetNode(iNode);
+      auto indexNode = geometry->GetElemStore().GetNode(iElem, iNode);
 
       /*--- Compute the volume with the reference or current coordinates. ---*/
       for (iDim = 0; iDim < nDim; iDim++) {
@@ -398,13 +398,13 @@ void CMeshSolver::SetWallDistance(CGeometry *geometry, CConfig *config) {
 
     int EL_KIND;
     unsigned short nNodes = 0;
-    GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    GetElemKindAndNumNodes(geometry->GetElemStore().GetVTK_Type(iElem), EL_KIND, nNodes);
 
     /*--- Average the distance of the nodes in the element ---*/
 
     su2double ElemDist = 0.0;
     for (auto iNode = 0u; iNode < nNodes; iNode++) {
-      auto iPoint = geometry->elem[iElem]->GetNode(iNode);
+      auto iPoint = geometry->GetElemStore().GetNode(iElem, iNode);
       ElemDist += nodes->GetWallDistance(iPoint);
     }
     ElemDist = ElemDist/su2double(nNodes);
@@ -96,6 +96,9 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
   nPoint       = geometry->GetnPoint();
   nPointDomain = geometry->GetnPointDomain();
 
+  /*--- Chunk size of the (local) parallel point loops. ---*/
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+
   /*--- Set size of the conserved and primitive vectors ---*/
   //     U: [rho1, ..., rhoNs, rhou, rhov, rhow, rhoe, rhoeve]^T
   //     V: [rho1, ..., rhoNs, T, Tve, u, v, w, P, rho, h, a, rhoCvtr, rhoCvve]^T
@@ -128,14 +131,18 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   Allocate(*config);
 
+  /*--- MPI + OpenMP initialization (edge coloring), the edge loops open their own parallel regions. ---*/
+  HybridParallelInitialization(*config, *geometry);
+
   /*--- Allocate Jacobians for implicit time-stepping ---*/
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
 
     /*--- Jacobians and vector  structures for implicit computations ---*/
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, false, true);
+    System.SetMGCoarseSmoother(true);
 
-    if (config->GetKind_Linear_Solver_Prec() == LINELET) {
+    if ((config->GetKind_Linear_Solver_Prec() == LINELET) || (config->GetKind_Linear_Solver_Prec(iMesh) == LINELET)) {
       nLineLets = Jacobian.BuildLineletPreconditioner(geometry, config);
       if (rank == MASTER_NODE) cout << "Compute linelet structure. " << nLineLets << " elements in each line (average)." << endl;
     }
@@ -195,24 +202,24 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     nodes      = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                          Temperature_Inf, Temperature_ve_Inf,
                                          nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                         config, FluidModel);
+                                         config, GetFluidModel());
     node_infty = new CNEMONSVariable    (Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   } else {
     nodes      = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         nPoint, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
     node_infty = new CNEMOEulerVariable(Pressure_Inf, MassFrac_Inf, Mvec_Inf,
                                         Temperature_Inf, Temperature_ve_Inf,
                                         1, nDim, nVar, nPrimVar, nPrimVarGrad,
-                                        config, FluidModel);
+                                        config, GetFluidModel());
   }
   SetBaseClassPointerToNodes();
 
-  node_infty->SetPrimVar(0, FluidModel);
+  node_infty->SetPrimVar(0, GetFluidModel());
 
   /*--- Check that the initial solution is physical, report any non-physical nodes ---*/
 
@@ -220,20 +227,20 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
-    nonPhys = nodes->SetPrimVar(iPoint, FluidModel);
+    nonPhys = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /*--- Set mixture state ---*/
-    FluidModel->SetTDStatePTTv(Pressure_Inf, MassFrac_Inf, Temperature_Inf, Temperature_ve_Inf);
+    GetFluidModel()->SetTDStatePTTv(Pressure_Inf, MassFrac_Inf, Temperature_Inf, Temperature_ve_Inf);
 
     /*--- Compute other freestream quantities ---*/
-    Density_Inf    = FluidModel->GetDensity();
-    Soundspeed_Inf = FluidModel->GetSoundSpeed();
+    Density_Inf    = GetFluidModel()->GetDensity();
+    Soundspeed_Inf = GetFluidModel()->GetSoundSpeed();
 
     sqvel = 0.0;
     for (iDim = 0; iDim < nDim; iDim++){
       sqvel += Mvec_Inf[iDim]*Soundspeed_Inf * Mvec_Inf[iDim]*Soundspeed_Inf;
     }
-    const auto& Energies_Inf = FluidModel->ComputeMixtureEnergies();
+    const auto& Energies_Inf = GetFluidModel()->ComputeMixtureEnergies();
 
     /*--- Initialize Solution & Solution_Old vectors ---*/
     for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
@@ -280,7 +287,7 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 CNEMOEulerSolver::~CNEMOEulerSolver(void) {
 
   delete node_infty;
-  delete FluidModel;
+  for (auto& model : FluidModel) delete model;
 
 }
 
@@ -355,14 +362,18 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
-  bool nonphysical = true;
+  unsigned long nonPhysicalPoints = 0;
 
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- The NEMO solvers are not hybrid parallel, the loop opens its own parallel
+   *    region and each thread uses its own fluid model. ---*/
+  SU2_OMP_PARALLEL_(reduction(+:nonPhysicalPoints))
+  {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
     /*--- Incompressible flow, primitive variables ---*/
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool nonphysical = nodes->SetPrimVar(iPoint,GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
@@ -373,6 +384,7 @@ unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_containe
     if (!Output) LinSysRes.SetBlock_Zero(iPoint);
 
   }
+  } // end SU2_OMP_PARALLEL
 
   return nonPhysicalPoints;
 }
@@ -450,20 +462,28 @@ void CNEMOEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                          CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iVar;
-  bool err;
-
-  CNumerics* numerics = numerics_container[CONV_TERM];
 
   /*--- Set booleans based on config settings ---*/
   //bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- The NEMO solvers are not hybrid parallel, the loop opens its own parallel region. ---*/
+  SU2_OMP_PARALLEL
+  {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
+    auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    auto jPoint = geometry->edges->GetNode(iEdge, 1);
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
     numerics->SetNeighbor(geometry->nodes->GetnNeighbor(iPoint),
                           geometry->nodes->GetnNeighbor(jPoint));
@@ -487,8 +507,8 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     auto residual = numerics->ComputeResidual(config);
 
     /*--- Check for NaNs before applying the residual to the linear system ---*/
-    err = false;
-    for (iVar = 0; iVar < nVar; iVar++)
+    bool err = false;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
       if (residual[iVar] != residual[iVar])
         err = true;
     //if (implicit)
@@ -499,7 +519,11 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     //        err = true;
 
     /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    if (ReducerStrategy) {
+      if (!err) EdgeFluxes.SetBlock(iEdge, residual);
+      else EdgeFluxes.SetBlock_Zero(iEdge);
+    }
+    else if (!err) {
       LinSysRes.AddBlock(iPoint, residual);
       LinSysRes.SubtractBlock(jPoint, residual);
     //  if (implicit) {
@@ -510,6 +534,11 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
     //  }
     }
   }
+  } // end color loop
+
+  if (ReducerStrategy) SumEdgeFluxes(geometry);
+
+  } // end SU2_OMP_PARALLEL
 }
 
 void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
@@ -521,15 +550,18 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   const bool limiter          = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER);
   const bool van_albada       = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
 
+  /*--- The NEMO solvers are not hybrid parallel, the loop opens its own parallel region. ---*/
+  SU2_OMP_PARALLEL
+  {
   /*--- Non-physical counter. ---*/
   unsigned long counter_local = 0;
   SU2_OMP_MASTER
   ErrorCounter = 0;
 
   /*--- Pick one numerics object per thread. ---*/
-  CNumerics* numerics = numerics_container[CONV_TERM];
+  CNumerics* numerics = numerics_container[CONV_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  /*--- Static arrays for MUSCL reconstructed variables ---*/
+  /*--- Static arrays for MUSCL reconstructed variables (thread safety). ---*/
   su2double Primitive_i[MAXNVAR] = {0.0}, Primitive_j[MAXNVAR] = {0.0};
   su2double Conserved_i[MAXNVAR] = {0.0}, Conserved_j[MAXNVAR] = {0.0};
   su2double      dPdU_i[MAXNVAR] = {0.0},      dPdU_j[MAXNVAR] = {0.0};
@@ -539,8 +571,14 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
   su2double      Cvve_i[MAXNVAR] = {0.0},      Cvve_j[MAXNVAR] = {0.0};
   su2double Gamma_i = 0.0, Gamma_j = 0.0;
 
-  /*--- Loop over edges and calculate convective fluxes ---*/
-  for(unsigned long iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     unsigned short iDim, iVar;
 
@@ -602,13 +640,15 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
         }
 
         if (limiter) {
+          /*--- The edge limiter is local to the edge, it is not stored in the point limiters (thread safety). ---*/
+          su2double edgeLim_i = Limiter_i[iVar], edgeLim_j = Limiter_j[iVar];
           if (van_albada) {
             su2double V_ij = V_j[iVar] - V_i[iVar];
-            Limiter_i[iVar] = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
-            Limiter_j[iVar] = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
+            edgeLim_i = V_ij*( 2.0*Project_Grad_i + V_ij) / (4*pow(Project_Grad_i, 2) + pow(V_ij, 2) + EPS);
+            edgeLim_j = V_ij*(-2.0*Project_Grad_j + V_ij) / (4*pow(Project_Grad_j, 2) + pow(V_ij, 2) + EPS);
           }
-          if (lim_i > Limiter_i[iVar] && Limiter_i[iVar] != 0) lim_i = Limiter_i[iVar];
-          if (lim_j > Limiter_j[iVar] && Limiter_j[iVar] != 0) lim_j = Limiter_j[iVar];
+          if (lim_i > edgeLim_i && edgeLim_i != 0) lim_i = edgeLim_i;
+          if (lim_j > edgeLim_j && edgeLim_j != 0) lim_j = edgeLim_j;
           su2double lim_ij = min(lim_i, lim_j);
 
           Primitive_i[iVar] = V_i[iVar] + lim_ij*Project_Grad_i;
@@ -671,7 +711,11 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
     //        err = true;
 
     /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    if (ReducerStrategy) {
+      if (!err) EdgeFluxes.SetBlock(iEdge, residual);
+      else EdgeFluxes.SetBlock_Zero(iEdge);
+    }
+    else if (!err) {
       LinSysRes.AddBlock(iPoint, residual);
       LinSysRes.SubtractBlock(jPoint, residual);
       //if (implicit) {
@@ -682,6 +726,9 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
       //}
     }
   }
+  } // end color loop
+
+  if (ReducerStrategy) SumEdgeFluxes(geometry);
 
   /*--- Warning message about non-physical reconstructions. ---*/
   if ((iMesh == MESH_0) && (config->GetComm_Level() == COMM_FULL)) {
@@ -699,6 +746,8 @@ void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_con
     }
     SU2_OMP_BARRIER
   }
+
+  } // end SU2_OMP_PARALLEL
 }
 
 su2double CNEMOEulerSolver::ComputeConsistentExtrapolation(CNEMOGas *fluidmodel, unsigned short nSpecies, su2double *V,
@@ -763,8 +812,8 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
   }
 
   /*--- Set the fluidmodel and recompute energies ---*/
-  FluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
-  const auto& Energies = FluidModel->ComputeMixtureEnergies();
+  GetFluidModel()->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
+  const auto& Energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Set conservative energies ---*/
   U[nSpecies+nDim]   = V[RHO_INDEX]*(Energies[0]+0.5*sqvel);
@@ -809,20 +858,18 @@ bool CNEMOEulerSolver::CheckNonPhys(const su2double *V) const {
 
 void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned short iVar, jVar;
+  unsigned short iVar;
   unsigned long iPoint;
   unsigned long eAxi_local, eChm_local, eVib_local;
   unsigned long eAxi_global, eChm_global, eVib_global;
 
   /*--- Assign booleans ---*/
-  bool err        = false;
   bool implicit   = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool frozen     = config->GetFrozen();
   bool monoatomic = config->GetMonoatomic();
   bool viscous    = config->GetViscous();
   bool rans       = (config->GetKind_Turb_Model() != NONE);
-
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  bool split_chem = (config->GetKind_ChemistryIntegration() == POINT_IMPLICIT_CHEMISTRY);
 
   /*--- Initialize the error counter ---*/
   eAxi_local = 0;
@@ -832,108 +879,133 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   /*--- Initialize the source residual to zero ---*/
   for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
 
-  /*--- loop over interior points ---*/
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  /*--- Loop over interior points, in a local parallel region (the NEMO solvers are not hybrid
+   *    parallel). Each thread uses its own numerics, and thus its own gas model, since the
+   *    vibrational relaxation uses the production rates of the preceding chemistry call.
+   *    With operator splitting these sources are integrated after the flow update instead. ---*/
+  if (!split_chem) {
+    SU2_OMP_PARALLEL_(reduction(+:eChm_local,eVib_local))
+    {
+      CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
-    /*--- Set conserved & primitive variables  ---*/
-    numerics->SetConservative(nodes->GetSolution(iPoint),   nodes->GetSolution(iPoint));
-    numerics->SetPrimitive   (nodes->GetPrimitive(iPoint),  nodes->GetPrimitive(iPoint) );
+      SU2_OMP_FOR_DYN(omp_chunk_size)
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
-    /*--- Pass supplementary information to CNumerics ---*/
-    numerics->SetdPdU(nodes->GetdPdU(iPoint), nodes->GetdPdU(iPoint));
-    numerics->SetdTdU(nodes->GetdTdU(iPoint), nodes->GetdTdU(iPoint));
-    numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(iPoint));
-    numerics->SetEve(nodes->GetEve(iPoint), nodes->GetEve(iPoint));
-    numerics->SetCvve(nodes->GetCvve(iPoint), nodes->GetCvve(iPoint));
-
-    /*--- Set volume of the dual grid cell ---*/
-    numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
-    numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
-                       geometry->nodes->GetCoord(iPoint) );
-
-    /*--- Compute finite rate chemistry ---*/
-
-    if(!monoatomic){
-      if(!frozen){
-        /*--- Compute the non-equilibrium chemistry ---*/
-        auto residual = numerics->ComputeChemistry(config);
-
-        /*--- Check for errors before applying source to the linear system ---*/
-        err = false;
-        for (iVar = 0; iVar < nVar; iVar++)
-          if (residual[iVar] != residual[iVar]) err = true;
-        //if (implicit)
-        //  for (iVar = 0; iVar < nVar; iVar++)
-        //    for (jVar = 0; jVar < nVar; jVar++)
-        //      if (Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) err = true;
+        /*--- Set conserved & primitive variables  ---*/
+        numerics->SetConservative(nodes->GetSolution(iPoint),   nodes->GetSolution(iPoint));
+        numerics->SetPrimitive   (nodes->GetPrimitive(iPoint),  nodes->GetPrimitive(iPoint) );
 
-        /*--- Apply the chemical sources to the linear system ---*/
-        if (!err) {
-          LinSysRes.SubtractBlock(iPoint, residual);
-          //if (implicit)
-          //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-        } else
-          eChm_local++;
-      }
-    }
+        /*--- Pass supplementary information to CNumerics ---*/
+        numerics->SetdPdU(nodes->GetdPdU(iPoint), nodes->GetdPdU(iPoint));
+        numerics->SetdTdU(nodes->GetdTdU(iPoint), nodes->GetdTdU(iPoint));
+        numerics->SetdTvedU(nodes->GetdTvedU(iPoint), nodes->GetdTvedU(iPoint));
+        numerics->SetEve(nodes->GetEve(iPoint), nodes->GetEve(iPoint));
+        numerics->SetCvve(nodes->GetCvve(iPoint), nodes->GetCvve(iPoint));
+
+        /*--- Set volume of the dual grid cell ---*/
+        numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+        numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                           geometry->nodes->GetCoord(iPoint) );
+
+        /*--- Compute finite rate chemistry ---*/
+
+        if(!monoatomic){
+          if(!frozen){
+            /*--- Compute the non-equilibrium chemistry ---*/
+            auto residual = numerics->ComputeChemistry(config);
+
+            /*--- Check for errors before applying source to the linear system ---*/
+            bool err = false;
+            for (unsigned short iVar = 0; iVar < nVar; iVar++)
+              if (residual[iVar] != residual[iVar]) err = true;
+            //if (implicit)
+            //  for (iVar = 0; iVar < nVar; iVar++)
+            //    for (jVar = 0; jVar < nVar; jVar++)
+            //      if (Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) err = true;
+
+            /*--- Apply the chemical sources to the linear system ---*/
+            if (!err) {
+              LinSysRes.SubtractBlock(iPoint, residual);
+              //if (implicit)
+              //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+            } else
+              eChm_local++;
+          }
+        }
 
-    /*--- Compute vibrational energy relaxation ---*/
-    /// NOTE: Jacobians don't account for relaxation time derivatives
+        /*--- Compute vibrational energy relaxation ---*/
+        /// NOTE: Jacobians don't account for relaxation time derivatives
 
-    if (!monoatomic){
-      auto residual = numerics->ComputeVibRelaxation(config);
+        if (!monoatomic){
+          auto residual = numerics->ComputeVibRelaxation(config);
 
-      /*--- Check for errors before applying source to the linear system ---*/
-      err = false;
-      for (iVar = 0; iVar < nVar; iVar++)
-        if (residual[iVar] != residual[iVar]) err = true;
-      //if (implicit)
-      //  for (iVar = 0; iVar < nVar; iVar++)
-      //    for (jVar = 0; jVar < nVar; jVar++)
-      //      if (Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) err = true;
-
-      /*--- Apply the vibrational relaxation terms to the linear system ---*/
-      if (!err) {
-        LinSysRes.SubtractBlock(iPoint, residual);
-        //if (implicit)
-        //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      } else
-        eVib_local++;
-    }
+          /*--- Check for errors before applying source to the linear system ---*/
+          bool err = false;
+          for (unsigned short iVar = 0; iVar < nVar; iVar++)
+            if (residual[iVar] != residual[iVar]) err = true;
+          //if (implicit)
+          //  for (iVar = 0; iVar < nVar; iVar++)
+          //    for (jVar = 0; jVar < nVar; jVar++)
+          //      if (Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) err = true;
+
+          /*--- Apply the vibrational relaxation terms to the linear system ---*/
+          if (!err) {
+            LinSysRes.SubtractBlock(iPoint, residual);
+            //if (implicit)
+            //  Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+          } else
+            eVib_local++;
+        }
 
+      }
+    } // end SU2_OMP_PARALLEL
   }
-    /*--- Compute axisymmetric source terms (if needed) ---*/
-    if (config->GetAxisymmetric()) {
 
-      if (viscous) {
+  /*--- Compute axisymmetric source terms (if needed) ---*/
+  if (config->GetAxisymmetric()) {
 
-        for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    if (viscous) {
 
-          su2double yCoord          = geometry->nodes->GetCoord(iPoint, 1);
-          su2double yVelocity       = nodes->GetVelocity(iPoint,1);
-          su2double xVelocity       = nodes->GetVelocity(iPoint,0);
-          su2double Total_Viscosity = nodes->GetLaminarViscosity(iPoint) + nodes->GetEddyViscosity(iPoint);
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
 
-          if (yCoord > EPS){
-            su2double nu_v_on_y = Total_Viscosity*yVelocity/yCoord;
-            nodes->SetAuxVar(iPoint, 0, nu_v_on_y);
-            nodes->SetAuxVar(iPoint, 1, nu_v_on_y*yVelocity);
-            nodes->SetAuxVar(iPoint, 2, nu_v_on_y*xVelocity);
-          }
-        }
+        su2double yCoord          = geometry->nodes->GetCoord(iPoint, 1);
+        su2double yVelocity       = nodes->GetVelocity(iPoint,1);
+        su2double xVelocity       = nodes->GetVelocity(iPoint,0);
+        su2double Total_Viscosity = nodes->GetLaminarViscosity(iPoint) + nodes->GetEddyViscosity(iPoint);
 
-        /*--- Compute the auxiliary variable gradient with GG or WLS. ---*/
-        if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-          SetAuxVar_Gradient_GG(geometry, config);
-        }
-        if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-          SetAuxVar_Gradient_LS(geometry, config);
+        if (yCoord > EPS){
+          su2double nu_v_on_y = Total_Viscosity*yVelocity/yCoord;
+          nodes->SetAuxVar(iPoint, 0, nu_v_on_y);
+          nodes->SetAuxVar(iPoint, 1, nu_v_on_y*yVelocity);
+          nodes->SetAuxVar(iPoint, 2, nu_v_on_y*xVelocity);
         }
       }
 
-      /*--- loop over points ---*/
+      /*--- Compute the auxiliary variable gradient with GG or WLS. ---*/
+      if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+        SetAuxVar_Gradient_GG(geometry, config);
+      }
+      if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+        SetAuxVar_Gradient_LS(geometry, config);
+      }
+    }
+
+    /*--- Loop over interior points, in a local parallel region with per-thread numerics as above.
+     *    The state of each point is set here, the chemistry loop is skipped with operator splitting. ---*/
+    SU2_OMP_PARALLEL_(reduction(+:eAxi_local))
+    {
+      CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
+
       SU2_OMP_FOR_DYN(omp_chunk_size)
-      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+        /*--- Set conserved & primitive variables, energies, volume and coordinates ---*/
+        numerics->SetConservative(nodes->GetSolution(iPoint),  nodes->GetSolution(iPoint));
+        numerics->SetPrimitive   (nodes->GetPrimitive(iPoint), nodes->GetPrimitive(iPoint));
+        numerics->SetEve(nodes->GetEve(iPoint), nodes->GetEve(iPoint));
+        numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
+        numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
+                           geometry->nodes->GetCoord(iPoint) );
 
         /*--- If necessary, set variables needed for viscous computation ---*/
         if (viscous) {
@@ -968,13 +1040,13 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
         auto residual = numerics->ComputeAxisymmetric(config);
 
-        /*--- Check for errors before applying source to the linear system ---*/
-        err = false;
-        for (iVar = 0; iVar < nVar; iVar++)
+        /*--- Check for errors before applying source to the linear system (Jacobian_i is only read) ---*/
+        bool err = false;
+        for (unsigned short iVar = 0; iVar < nVar; iVar++)
           if (residual[iVar] != residual[iVar]) err = true;
         if (implicit)
-          for (iVar = 0; iVar < nVar; iVar++)
-            for (jVar = 0; jVar < nVar; jVar++)
+          for (unsigned short iVar = 0; iVar < nVar; iVar++)
+            for (unsigned short jVar = 0; jVar < nVar; jVar++)
               if (Jacobian_i[iVar][jVar] != Jacobian_i[iVar][jVar]) err = true;
 
         /*--- Apply the update to the linear system ---*/
@@ -985,7 +1057,8 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
         }else
           eAxi_local++;
       }
-    }
+    } // end SU2_OMP_PARALLEL
+  }
 
   /*--- Checking for NaN ---*/
   eAxi_global = eAxi_local;
@@ -1003,21 +1076,191 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   }
 }
 
+void CNEMOEulerSolver::IntegrateChemistry(CGeometry *geometry, CConfig *config) {
+
+  /*--- Only the solution of the finest grid is integrated, the coarse grids correct the flow. ---*/
+  if (config->GetKind_ChemistryIntegration() != POINT_IMPLICIT_CHEMISTRY ||
+      config->GetMonoatomic() || MGLevel != MESH_0) return;
+
+  const unsigned short nEq = nSpecies+1, EVE_INDEX = nSpecies+nDim+1;
+  const unsigned short maxSubsteps = config->GetChemistry_MaxSubsteps();
+
+  /*--- Maximum changes in one substep, of the species densities relative to the mixture
+   *    density, and of the temperatures relative to their values. ---*/
+  const su2double maxChangeRho = 0.2, maxChangeT = 0.1;
+
+  /*--- Points where no substep was accepted, and where the substeps ran out before the end of the step. ---*/
+  unsigned long nFailed = 0, nIncomplete = 0;
+
+  /*--- Negative species densities are clipped and the others scaled to keep the mixture density. ---*/
+  auto clipConservative = [&](vector<su2double>& rhos, su2double rho) {
+    su2double sumPositive = 0.0;
+    bool negative = false;
+    for (auto& rho_s : rhos) {
+      negative |= (rho_s < 0.0);
+      sumPositive += max(rho_s, su2double(0.0));
+    }
+    if (!negative) return;
+    for (auto& rho_s : rhos) rho_s = max(rho_s, su2double(0.0)) * rho / sumPositive;
+  };
+
+  /*--- The cost varies strongly from point to point (number of substeps), hence the dynamic schedule. ---*/
+  SU2_OMP_PARALLEL_(reduction(+:nFailed,nIncomplete))
+  {
+    CNEMOGas* fluidmodel = GetFluidModel();
+
+    vector<su2double> rhos(nSpecies), rhos_new(nSpecies), source(nEq), dU(nEq);
+    su2activematrix jacobian(nEq,nEq), lhs(nEq,nEq);
+
+    SU2_OMP_FOR_DYN(roundUpDiv(omp_chunk_size, 8))
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      su2double* U = nodes->GetSolution(iPoint);
+      const su2double dt = nodes->GetDelta_Time(iPoint);
+      if (dt <= 0.0) continue;
+
+      /*--- Chemistry only exchanges mass between species and energy between modes, the
+       *    mixture density, momentum, and total energy are constant. ---*/
+      su2double rho = 0.0, rhoEve = U[EVE_INDEX];
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+        rhos[iSpecies] = U[iSpecies];
+        rho += rhos[iSpecies];
+      }
+      if (rho <= 0.0) {
+        nFailed++;
+        continue;
+      }
+      clipConservative(rhos, rho);
+      const su2double rhoE = U[nSpecies+nDim];
+      const su2double rhoEkin = 0.5*GeometryToolbox::SquaredNorm(nDim, &U[nSpecies])/rho;
+
+      const auto& temperatures = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, rhoEkin);
+      su2double T = temperatures[0], Tve = temperatures[1];
+
+      su2double time = 0.0, h = dt;
+
+      for (unsigned short iSub = 0; iSub < maxSubsteps && time < dt; iSub++) {
+
+        /*--- Sources and Jacobian at the current state. ---*/
+        fluidmodel->SetTDStateRhosTTv(rhos, T, Tve);
+        fluidmodel->ComputeSourceJacobian(source.data(), jacobian);
+
+        /*--- Linearized implicit step, (I - h J) dU = h S, Gaussian elimination with partial pivoting. ---*/
+        for (unsigned short iEq = 0; iEq < nEq; iEq++) {
+          for (unsigned short jEq = 0; jEq < nEq; jEq++)
+            lhs(iEq,jEq) = su2double(iEq == jEq) - h*jacobian(iEq,jEq);
+          dU[iEq] = h*source[iEq];
+        }
+        for (unsigned short iEq = 0; iEq < nEq; iEq++) {
+          unsigned short iPivot = iEq;
+          for (unsigned short jEq = iEq+1; jEq < nEq; jEq++)
+            if (fabs(lhs(jEq,iEq)) > fabs(lhs(iPivot,iEq))) iPivot = jEq;
+          if (iPivot != iEq) {
+            for (unsigned short jEq = iEq; jEq < nEq; jEq++) swap(lhs(iEq,jEq), lhs(iPivot,jEq));
+            swap(dU[iEq], dU[iPivot]);
+          }
+          for (unsigned short jEq = iEq+1; jEq < nEq; jEq++) {
+            const su2double factor = lhs(jEq,iEq) / lhs(iEq,iEq);
+            for (unsigned short kEq = iEq; kEq < nEq; kEq++) lhs(jEq,kEq) -= factor*lhs(iEq,kEq);
+            dU[jEq] -= factor*dU[iEq];
+          }
+        }
+        for (int iEq = nEq-1; iEq >= 0; iEq--) {
+          for (unsigned short jEq = iEq+1; jEq < nEq; jEq++) dU[iEq] -= lhs(iEq,jEq)*dU[jEq];
+          dU[iEq] /= lhs(iEq,iEq);
+        }
+
+        /*--- Ratio of the changes to the allowed ones (>1 rejects the step), the step is
+         *    rejected if it is not finite or makes densities negative. ---*/
+        bool finite = (dU[nSpecies] == dU[nSpecies]) && (rhoEve + dU[nSpecies] > 0.0);
+        su2double ratio = 0.0;
+
+        for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+          finite &= (dU[iSpecies] == dU[iSpecies]);
+          rhos_new[iSpecies] = rhos[iSpecies] + dU[iSpecies];
+          ratio = max(ratio, su2double(fabs(dU[iSpecies]) / (maxChangeRho*rho)));
+          if (rhos_new[iSpecies] < -1e-10*rho)
+            ratio = max(ratio, su2double(2.0*fabs(dU[iSpecies])/max(rhos[iSpecies], EPS*rho)));
+        }
+        if (!finite) ratio = 10.0;
+
+        /*--- The temperatures of the new state are also the ones of the next substep. ---*/
+        su2double T_new = T, Tve_new = Tve;
+
+        if (ratio <= 1.0) {
+          clipConservative(rhos_new, rho);
+
+          const auto& temperatures_new = fluidmodel->ComputeTemperatures(rhos_new, rhoE, rhoEve+dU[nSpecies], rhoEkin);
+          T_new = temperatures_new[0];
+          Tve_new = temperatures_new[1];
+          ratio = max(su2double(fabs(T_new-T)/(maxChangeT*T)), su2double(fabs(Tve_new-Tve)/(maxChangeT*Tve)));
+        }
+
+        if (ratio > 1.0) {
+          h *= max(su2double(0.1), su2double(0.8/ratio));
+          continue;
+        }
+
+        swap(rhos, rhos_new);
+        rhoEve += dU[nSpecies];
+        T = T_new;
+        Tve = Tve_new;
+
+        /*--- The last step ends exactly at dt. ---*/
+        time = (h >= dt-time)? dt : time+h;
+        h = min(su2double(2.0*h), su2double(dt-time));
+      }
+
+      if (time == 0.0) {
+        nFailed++;
+        continue;
+      }
+
+      /*--- If the substeps run out the remaining time is dropped (the chemistry lags the flow), the
+       *    partial update is still applied. ---*/
+      if (time < dt) nIncomplete++;
+
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) U[iSpecies] = rhos[iSpecies];
+      U[EVE_INDEX] = rhoEve;
+    }
+  } // end SU2_OMP_PARALLEL
+
+  InitiateComms(geometry, config, SOLUTION);
+  CompleteComms(geometry, config, SOLUTION);
+
+  unsigned long nLocal[] = {nFailed, nIncomplete}, nGlobal[] = {0, 0};
+  SU2_MPI::Allreduce(nLocal, nGlobal, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  if (rank == MASTER_NODE) {
+    if (nGlobal[0] != 0)
+      cout << "Warning: the chemistry integration failed in " << nGlobal[0] << " points." << endl;
+    if (nGlobal[1] != 0)
+      cout << "Warning: the chemistry integration did not complete the time step in " << nGlobal[1]
+           << " points, increase CHEMISTRY_MAX_SUBSTEPS." << endl;
+  }
+}
+
 void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                             CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<RUNGE_KUTTA_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == config->GetnRKStep()-1) IntegrateChemistry(geometry, config);
 }
 
 void CNEMOEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                               CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == 3) IntegrateChemistry(geometry, config);
 }
 
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
+
+  IntegrateChemistry(geometry, config);
 }
 
 void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
@@ -1071,19 +1314,23 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   bool tkeNeeded          = ((turbulent) && (config->GetKind_Turb_Model() == SST));
   bool reynolds_init      = (config->GetKind_InitOption() == REYNOLDS);
 
-  /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
+  /*--- Instatiate the fluid model, one per thread since the models keep the state of the last point. ---*/
+  FluidModel.resize(omp_get_max_threads());
+
+  for (auto& model : FluidModel) {
+    switch (config->GetKind_FluidModel()) {
+    case MUTATIONPP:
+     #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+       model = new CMutationTCLib(config, nDim);
+     #else
+       SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+       CURRENT_FUNCTION);
+     #endif
+     break;
+    case SU2_NONEQ:
+     model = new CSU2TCLib(config, nDim, viscous);
+     break;
+    }
   }
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
@@ -1096,17 +1343,17 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   /*---                                     ---*/
 
   /*--- Set mixture state based on pressure, mass fractions and temperatures ---*/
-  FluidModel->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
+  GetFluidModel()->SetTDStatePTTv(Pressure_FreeStream, MassFrac_Inf,
                              Temperature_FreeStream, Temperature_ve_FreeStream);
 
   /*--- Compute Gas Constant ---*/
-  GasConstant_Inf = FluidModel->ComputeGasConstant();
+  GasConstant_Inf = GetFluidModel()->ComputeGasConstant();
   config->SetGas_Constant(GasConstant_Inf);
 
   /*--- Compute the freestream density, soundspeed ---*/
-  Density_FreeStream = FluidModel->GetDensity();
-  soundspeed         = FluidModel->ComputeSoundSpeed();
-  Gamma              = FluidModel->ComputeGamma();
+  Density_FreeStream = GetFluidModel()->GetDensity();
+  soundspeed         = GetFluidModel()->ComputeSoundSpeed();
+  Gamma              = GetFluidModel()->ComputeGamma();
 
   /*--- Compute the Free Stream velocity, using the Mach number ---*/
   if (nDim == 2) {
@@ -1128,7 +1375,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
   /*--- Calculate energies ---*/
-  const auto& energies = FluidModel->ComputeMixtureEnergies();
+  const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
   /*--- Viscous initialization ---*/
   if (viscous) {
@@ -1150,7 +1397,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
     if (!reynolds_init) {
 
       /*--- Thermodynamics quantities based initialization ---*/
-      Viscosity_FreeStream = FluidModel->GetViscosity();
+      Viscosity_FreeStream = GetFluidModel()->GetViscosity();
       Energy_FreeStream    = energies[0] + 0.5*sqvel;
 
     } else {
@@ -1473,7 +1720,7 @@ void CNEMOEulerSolver::BC_Sym_Plane(CGeometry *geometry, CSolver **solver_contai
   }
 
   /*--- Get species molar mass ---*/
-  auto& Ms = FluidModel->GetSpeciesMolarMass();
+  auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Loop over all the vertices on this boundary (val_marker) ---*/
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
@@ -2107,11 +2354,11 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solution_contain
         V_outlet[A_INDEX]     = SoundSpeed;
 
         /*--- Set mixture state and compute quantities ---*/
-        FluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
-        V_outlet[RHOCVTR_INDEX] = FluidModel->ComputerhoCvtr();
-        V_outlet[RHOCVVE_INDEX] = FluidModel->ComputerhoCvve();
+        GetFluidModel()->SetTDStateRhosTTv(rhos, Temperature, Tve);
+        V_outlet[RHOCVTR_INDEX] = GetFluidModel()->ComputerhoCvtr();
+        V_outlet[RHOCVVE_INDEX] = GetFluidModel()->ComputerhoCvve();
 
-        const auto& energies = FluidModel->ComputeMixtureEnergies();
+        const auto& energies = GetFluidModel()->ComputeMixtureEnergies();
 
         /*--- Conservative variables, using the derived quantities ---*/
         for (iSpecies = 0; iSpecies < nSpecies; iSpecies ++){
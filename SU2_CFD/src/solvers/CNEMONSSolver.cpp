@@ -178,13 +178,14 @@ void CNEMONSSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, const CConfig
 
 unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,CConfig *config, bool Output) {
 
-  unsigned long iPoint, nonPhysicalPoints = 0;
+  unsigned long nonPhysicalPoints = 0;
   const unsigned short turb_model = config->GetKind_Turb_Model();
   //const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
 
-  bool nonphysical = true;
-
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_PARALLEL_(reduction(+:nonPhysicalPoints))
+  {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
 
     /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
@@ -200,13 +201,14 @@ unsigned long CNEMONSSolver::SetPrimitive_Variables(CSolver **solver_container,C
 
     /*--- Incompressible flow, primitive variables ---*/
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool nonphysical = nodes->SetPrimVar(iPoint,GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
     if (nonphysical) nonPhysicalPoints++;
 
   }
+  } // end SU2_OMP_PARALLEL
 
   return nonPhysicalPoints;
 }
@@ -217,17 +219,24 @@ void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep) {
 
-  bool err;
-  unsigned short iVar;
-  unsigned long iPoint, jPoint, iEdge;
+  /*--- The NEMO solvers are not hybrid parallel, the loop opens its own parallel region. ---*/
+  SU2_OMP_PARALLEL
+  {
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for (auto k = 0ul; k < color.size; ++k) {
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    auto iEdge = color.indices[k];
 
     /*--- Points, coordinates and normal vector in edge ---*/
-    iPoint = geometry->edges->GetNode(iEdge, 0);
-    jPoint = geometry->edges->GetNode(iEdge, 1);
+    auto iPoint = geometry->edges->GetNode(iEdge, 0);
+    auto jPoint = geometry->edges->GetNode(iEdge, 1);
     numerics->SetCoord(geometry->nodes->GetCoord(iPoint),
                        geometry->nodes->GetCoord(jPoint) );
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
@@ -273,8 +282,8 @@ void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
     auto residual = numerics->ComputeResidual(config);
 
     /*--- Check for NaNs before applying the residual to the linear system ---*/
-    err = false;
-    for (iVar = 0; iVar < nVar; iVar++)
+    bool err = false;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
       if (residual[iVar] != residual[iVar]) err = true;
     //if (implicit)
     //  for (iVar = 0; iVar < nVar; iVar++)
@@ -283,8 +292,12 @@ void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
     //          (Jacobian_j[iVar][jVar] != Jacobian_j[iVar][jVar])   )
     //        err = true;
 
-    /*--- Update the residual and Jacobian ---*/
-    if (!err) {
+    /*--- Update the residual and Jacobian, the viscous flux enters with negative sign. ---*/
+    if (ReducerStrategy) {
+      EdgeFluxes.SetBlock_Zero(iEdge);
+      if (!err) EdgeFluxes.SubtractBlock(iEdge, residual);
+    }
+    else if (!err) {
       LinSysRes.SubtractBlock(iPoint, residual);
       LinSysRes.AddBlock(jPoint, residual);
       //if (implicit) {
@@ -295,6 +308,12 @@ void CNEMONSSolver::Viscous_Residual(CGeometry *geometry,
       //}
     }
   } //iEdge
+  } // end color loop
+
+  /*--- Add to the convective fluxes already in the residual. ---*/
+  if (ReducerStrategy) SumEdgeFluxes(geometry, true);
+
+  } // end SU2_OMP_PARALLEL
 }
 
 void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
@@ -364,7 +383,7 @@ void CNEMONSSolver::BC_HeatFluxNonCatalytic_Wall(CGeometry *geometry,
       // TODO: Need to determine proper way to incorporate eddy viscosity
       // This is only scaling Kve by same factor as ktr
       su2double Mass = 0.0;
-      auto&     Ms   = FluidModel->GetSpeciesMolarMass();
+      auto&     Ms   = GetFluidModel()->GetSpeciesMolarMass();
       su2double tmp1, scl, Cptr;
       su2double Ru=1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double eddy_viscosity = nodes->GetEddyViscosity(iPoint);
@@ -737,7 +756,7 @@ void CNEMONSSolver::BC_IsothermalNonCatalytic_Wall(CGeometry *geometry,
       // This is only scaling Kve by same factor as ktr
       V = nodes->GetPrimitive(iPoint);
       su2double Mass = 0.0;
-      auto&     Ms   = FluidModel->GetSpeciesMolarMass();
+      auto&     Ms   = GetFluidModel()->GetSpeciesMolarMass();
       su2double tmp1, scl, Cptr;
       su2double Ru=1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double eddy_viscosity=nodes->GetEddyViscosity(iPoint);
@@ -812,7 +831,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
   /*--- Get universal information ---*/
   RuSI     = UNIVERSAL_GAS_CONSTANT;
   Ru       = 1000.0*RuSI;
-  auto& Ms = FluidModel->GetSpeciesMolarMass();
+  auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
 
   /*--- Get the locations of the primitive variables ---*/
   RHOS_INDEX  = nodes->GetRhosIndex();
@@ -864,7 +883,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
       Vj   = nodes->GetPrimitive(jPoint);
       Di   = nodes->GetDiffusionCoeff(iPoint);
       eves = nodes->GetEve(iPoint);
-      hs   = FluidModel->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
+      hs   = GetFluidModel()->ComputeSpeciesEnthalpy(Vi[T_INDEX], Vi[TVE_INDEX], eves);
       for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
         Yj[iSpecies] = Vj[RHOS_INDEX+iSpecies]/Vj[RHO_INDEX];
       rho    = Vi[RHO_INDEX];
@@ -913,7 +932,7 @@ void CNEMONSSolver::BC_IsothermalCatalytic_Wall(CGeometry *geometry,
         }
 
         /*--- Calculate supplementary quantities ---*/
-        Cvtrs = FluidModel->GetSpeciesCvTraRot();
+        Cvtrs = GetFluidModel()->GetSpeciesCvTraRot();
         Cvve = nodes->GetCvve(iPoint);
 
         /*--- Take the primitive var. Jacobian & store in Jac. jj ---*/
@@ -1065,7 +1084,7 @@ void CNEMONSSolver::BC_Smoluchowski_Maxwell(CGeometry *geometry,
       Gamma     = nodes->GetGamma(iPoint);
 
       /*--- Incorporate turbulence effects ---*/
-      const auto& Ms = FluidModel->GetSpeciesMolarMass();
+      const auto& Ms = GetFluidModel()->GetSpeciesMolarMass();
       su2double  Ru = 1000.0*UNIVERSAL_GAS_CONSTANT;
       su2double  tmp1, scl, Cptr;
       su2double *Vi = nodes->GetPrimitive(iPoint);
@@ -36,8 +36,8 @@
 template class CFVMFlowSolverBase<CEulerVariable, COMPRESSIBLE>;
 
 
-CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) :
-           CEulerSolver(geometry, config, iMesh, true) {
+CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh, const CEulerSolver* fineSolver) :
+           CEulerSolver(geometry, config, iMesh, true, fineSolver) {
 
   /*--- This constructor only allocates/inits what is extra to CEulerSolver. ---*/
 
@@ -77,6 +77,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   const bool limiter = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER) && (InnerIter <= config->GetLimiterIter());
   const bool van_albada = (config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE);
   const bool wall_functions = config->GetWall_Functions();
+  const bool fused = config->GetFused_Gradient_Limiter() && muscl && !center && !Output;
 
   /*--- Common preprocessing steps (implemented by CEulerSolver) ---*/
 
@@ -93,20 +94,30 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     SU2_OMP_BARRIER
   }
 
+  /*--- With the fused computation the limiter goes with the reconstruction gradient. ---*/
+
   if (config->GetReconstructionGradientRequired() && muscl && !center) {
-    switch (config->GetKind_Gradient_Method_Recon()) {
-      case GREEN_GAUSS:
-        SetPrimitive_Gradient_GG(geometry, config, true); break;
-      case LEAST_SQUARES:
-      case WEIGHTED_LEAST_SQUARES:
-        SetPrimitive_Gradient_LS(geometry, config, true); break;
-      default: break;
+    if (fused) {
+      SetPrimitive_Gradient_Limiter(geometry, config, true, limiter);
+    }
+    else {
+      switch (config->GetKind_Gradient_Method_Recon()) {
+        case GREEN_GAUSS:
+          SetPrimitive_Gradient_GG(geometry, config, true); break;
+        case LEAST_SQUARES:
+        case WEIGHTED_LEAST_SQUARES:
+          SetPrimitive_Gradient_LS(geometry, config, true); break;
+        default: break;
+      }
     }
   }
 
   /*--- Compute gradient of the primitive variables ---*/
 
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+  if (fused && !config->GetReconstructionGradientRequired()) {
+    SetPrimitive_Gradient_Limiter(geometry, config, false, limiter);
+  }
+  else if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
     SetPrimitive_Gradient_GG(geometry, config);
   }
   else if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
@@ -121,7 +132,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
 
   /*--- Compute the limiters ---*/
 
-  if (muscl && !center && limiter && !van_albada && !Output) {
+  if (muscl && !center && limiter && !van_albada && !Output && !fused) {
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -143,33 +154,99 @@ unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, cons
 
   const unsigned short turb_model = config->GetKind_Turb_Model();
   const bool tkeNeeded = (turb_model == SST) || (turb_model == SST_SUST);
+  const bool turbulent = (turb_model != NONE) && (solver_container[TURB_SOL] != nullptr);
+  const bool hybridRANSLES = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES);
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- As for Euler (see CEulerSolver::SetPrimitive_Variables) the thermodynamic state is computed
+   *    in batches, then the primitives and transport properties are set point by point. ---*/
 
-    /*--- Retrieve the value of the kinetic energy (if needed). ---*/
+  constexpr unsigned long batchSize = 64;
+  const unsigned long nBatch = roundUpDiv(nPoint, batchSize);
 
-    su2double eddy_visc = 0.0, turb_ke = 0.0;
+  CFluidModel* fluidModel = GetFluidModel();
+  auto nsNodes = static_cast<CNSVariable*>(nodes);
 
-    if (turb_model != NONE && solver_container[TURB_SOL] != nullptr) {
-      eddy_visc = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
-      if (tkeNeeded) turb_ke = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, batchSize))
+  for (unsigned long iBatch = 0; iBatch < nBatch; ++iBatch) {
 
-      if (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) {
-        su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
-        nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
-      }
-    }
+    const unsigned long begin = iBatch * batchSize;
+    const unsigned long end = min(begin + batchSize, nPoint);
+
+    /*--- Within a multirate step only the time level advanced by the previous stage changed. ---*/
+
+    unsigned long index[batchSize], size = 0;
+    for (auto iPoint = begin; iPoint < end; ++iPoint)
+      if (OutdatedPoint(iPoint)) index[size++] = iPoint;
+
+    if (size == 0) continue;
 
-    /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+    su2double eddy_visc[batchSize] = {0.0}, turb_ke[batchSize] = {0.0};
+    su2double density[batchSize], staticEnergy[batchSize], pressure[batchSize], temperature[batchSize];
+    su2double soundSpeed2[batchSize], cp[batchSize], dPdrho_e[batchSize], dPde_rho[batchSize];
+    su2double dTdrho_e[batchSize], dTde_rho[batchSize];
 
-    bool physical = static_cast<CNSVariable*>(nodes)->SetPrimVar(iPoint, eddy_visc, turb_ke, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+    for (unsigned long i = 0; i < size; ++i) {
+      const auto iPoint = index[i];
 
-    /*--- Check for non-realizable states for reporting. ---*/
+      /*--- Retrieve the value of the kinetic energy (if needed). ---*/
 
-    nonPhysicalPoints += !physical;
+      if (turbulent) {
+        eddy_visc[i] = solver_container[TURB_SOL]->GetNodes()->GetmuT(iPoint);
+        if (tkeNeeded) turb_ke[i] = solver_container[TURB_SOL]->GetNodes()->GetSolution(iPoint,0);
 
+        if (hybridRANSLES) {
+          su2double DES_LengthScale = solver_container[TURB_SOL]->GetNodes()->GetDES_LengthScale(iPoint);
+          nodes->SetDES_LengthScale(iPoint, DES_LengthScale);
+        }
+      }
+
+      nodes->SetVelocity(iPoint);
+      density[i] = nodes->GetDensity(iPoint);
+      staticEnergy[i] = nodes->GetEnergy(iPoint) - 0.5*nodes->GetVelocity2(iPoint) - turb_ke[i];
+    }
+
+    CFluidStateBatch state;
+    state.Pressure = pressure;
+    state.Temperature = temperature;
+    state.SoundSpeed2 = soundSpeed2;
+    state.Cp = cp;
+    state.dPdrho_e = dPdrho_e;
+    state.dPde_rho = dPde_rho;
+    state.dTdrho_e = dTdrho_e;
+    state.dTde_rho = dTde_rho;
+
+    const auto nClamped = fluidModel->ComputeTDState_rhoe(size, density, staticEnergy, state);
+    if (nClamped) fluidModel->CountOutOfRange(nClamped);
+
+    for (unsigned long i = 0; i < size; ++i) {
+      const auto iPoint = index[i];
+
+      /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+
+      bool physical = nsNodes->SetPrimVar(iPoint, eddy_visc[i], turb_ke[i], pressure[i], soundSpeed2[i],
+                                          temperature[i], cp[i], fluidModel);
+
+      /*--- Non-physical points are recomputed by the fluid model from the old solution, otherwise the
+       *    transport derivatives are those of the last evaluation of the fluid model (this point). ---*/
+
+      if (physical) {
+        nodes->SetdPdrho_e(iPoint, dPdrho_e[i]);
+        nodes->SetdPde_rho(iPoint, dPde_rho[i]);
+        nodes->SetdTdrho_e(iPoint, dTdrho_e[i]);
+        nodes->SetdTde_rho(iPoint, dTde_rho[i]);
+        nodes->Setdmudrho_T(iPoint, fluidModel->Getdmudrho_T());
+        nodes->SetdmudT_rho(iPoint, fluidModel->GetdmudT_rho());
+        nodes->Setdktdrho_T(iPoint, fluidModel->Getdktdrho_T());
+        nodes->SetdktdT_rho(iPoint, fluidModel->GetdktdT_rho());
+      }
+      else {
+        nodes->SetSecondaryVar(iPoint, fluidModel);
+      }
+
+      /*--- Check for non-realizable states for reporting. ---*/
+
+      nonPhysicalPoints += !physical;
+    }
   }
 
   return nonPhysicalPoints;
@@ -75,7 +75,7 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
     }
 
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (P1 radiation equation)." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
 
   }
 
@@ -84,6 +84,11 @@ CRadP1Solver::CRadP1Solver(CGeometry* geometry, CConfig *config) : CRadSolver(ge
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- Initialize the flux container for the reducer strategy. ---*/
+
+  if (ReducerStrategy)
+    EdgeFluxes.Initialize(geometry->GetnEdge(), geometry->GetnEdge(), nVar, nullptr);
+
   /*--- Read farfield conditions from config ---*/
   Temperature_Inf = config->GetTemperature_FreeStreamND();
 
@@ -147,10 +152,9 @@ CRadP1Solver::~CRadP1Solver(void) {
 
 void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh, unsigned short iRKStep, unsigned short RunTime_EqSystem, bool Output) {
 
-  unsigned long iPoint;
-
   /*--- Initialize the residual vector ---*/
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
     LinSysRes.SetBlock_Zero(iPoint);
   }
 
@@ -170,23 +174,20 @@ void CRadP1Solver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
 void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iMesh) {
 
-  unsigned long iPoint;
-  su2double Energy, Temperature;
-  su2double SourceTerm, SourceTerm_Derivative;
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Retrieve the radiative energy ---*/
-    Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Energy = nodes->GetSolution(iPoint, 0);
 
     /*--- Retrieve temperature from the flow solver ---*/
-    Temperature = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint,nDim+1);
+    const su2double Temperature = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint,nDim+1);
 
     /*--- Compute the divergence of the radiative flux ---*/
-    SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
+    const su2double SourceTerm = Absorption_Coeff*(Energy - 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0));
 
     /*--- Compute the derivative of the source term with respect to the temperature ---*/
-    SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
+    const su2double SourceTerm_Derivative =  - 16.0*Absorption_Coeff*STEFAN_BOLTZMANN*pow(Temperature,3.0);
 
     /*--- Store the source term and its derivative ---*/
     nodes->SetRadiative_SourceTerm(iPoint, 0, SourceTerm);
@@ -199,16 +200,26 @@ void CRadP1Solver::Postprocessing(CGeometry *geometry, CSolver **solver_containe
 void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                     CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
 
-  CNumerics* numerics = numerics_container[VISC_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS];
 
-  unsigned long iEdge, iPoint, jPoint;
+  /*--- Thread-local residual and Jacobians, the P1 model has a single variable. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0}, Jac_j[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i}, *Jacobian_j[1] = {Jac_j};
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  /*--- Loop over edge colors. ---*/
+  for (auto color : EdgeColoring)
+  {
+  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+  for(auto k = 0ul; k < color.size; ++k) {
+
+    auto iEdge = color.indices[k];
 
     /*--- Points in edge ---*/
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    auto iPoint = geometry->edges->GetNode(iEdge,0);
+    auto jPoint = geometry->edges->GetNode(iEdge,1);
 
     /*--- Points coordinates, and normal vector ---*/
 
@@ -227,10 +238,21 @@ void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 
     /*--- Add and subtract residual, and update Jacobian ---*/
 
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    if (ReducerStrategy) {
+      EdgeFluxes.SetBlock(iEdge, Residual, -1.0);
+      Jacobian.UpdateBlocksSub(iEdge, Jacobian_i, Jacobian_j);
+    }
+    else {
+      LinSysRes.SubtractBlock(iPoint, Residual);
+      LinSysRes.AddBlock(jPoint, Residual);
+      Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    }
+  }
+  } // end color loop
 
+  if (ReducerStrategy) {
+    SumEdgeFluxes(geometry);
+    Jacobian.SetDiagonalAsColumnSum();
   }
 
 }
@@ -238,8 +260,14 @@ void CRadP1Solver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contai
 void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                   CConfig *config, unsigned short iMesh) {
 
-  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
+  /*--- Pick one numerics object per thread. ---*/
+  CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
+
+  /*--- Thread-local residual and Jacobian. ---*/
+  su2double Residual[1] = {0.0}, Jac_i[1] = {0.0};
+  su2double *Jacobian_i[1] = {Jac_i};
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Conservative variables w/o reconstruction ---*/
@@ -270,148 +298,94 @@ void CRadP1Solver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 void CRadP1Solver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config,
                                        unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
-    /*--- Retrieve the specified wall temperature ---*/
-  Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
+  /*--- Retrieve the specified wall temperature and compute the blackbody intensity at the wall ---*/
+  const su2double Twall = config->GetIsothermal_Temperature(Marker_Tag)/config->GetTemperature_Ref();
+  const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      // Weak application of the boundary condition
-
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
+    /*--- Compute dual-grid area ---*/
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Compute the Viscous contribution to the residual and apply it ---*/
+    su2double Res_Visc[1] = {Radiative_Heat_Flux*Area};
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
-    }
+    /*--- Compute the Jacobian contribution, the flux derivative is -Theta. ---*/
+    if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
   }
 
 }
 
 void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-  su2double Twall;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
-  /*--- Retrieve the specified wall temperature ---*/
-  Twall = GetTemperature_Inf();
+  /*--- Use the far-field temperature to compute the blackbody intensity ---*/
+  const su2double Twall = GetTemperature_Inf();
+  const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
-
-      Area = GeometryToolbox::Norm(nDim, Normal);
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      // Weak application of the boundary condition
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
+    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Twall,4.0);
+    /*--- Compute dual-grid area ---*/
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = 1.0*Theta*(Ib_w - Radiative_Energy);
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Compute the Viscous contribution to the residual and apply it ---*/
+    su2double Res_Visc[1] = {Radiative_Heat_Flux*Area};
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
-    }
+    /*--- Compute the Jacobian contribution, the flux derivative is -Theta. ---*/
+    if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
   }
 
 }
@@ -419,74 +393,47 @@ void CRadP1Solver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short val_marker) {
 
-  unsigned short iVar, jVar;
-  unsigned long iVertex, iPoint;
-
-  su2double Theta, Ib_w, Temperature, Radiative_Energy;
-  su2double *Normal, Area, Wall_Emissivity;
-  su2double Radiative_Heat_Flux;
-
-  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
   /*--- Identify the boundary by string name ---*/
-  string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
+  const string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
 
   /*--- Get the specified wall emissivity from config ---*/
-  Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
+  const su2double Wall_Emissivity = config->GetWall_Emissivity(Marker_Tag);
 
   /*--- Compute the constant for the wall theta ---*/
-  Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
+  const su2double Theta = Wall_Emissivity / (2.0*(2.0 - Wall_Emissivity));
 
   /*--- Loop over all of the vertices on this boundary marker ---*/
 
-  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
-
-    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
-
-    if (geometry->nodes->GetDomain(iPoint)) {
-
-      /*--- Compute dual-grid area and boundary normal ---*/
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+  SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+  for (unsigned long iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
 
-      Area = GeometryToolbox::Norm(nDim, Normal);
+    const auto iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
 
-      // Weak application of the boundary condition
-
-      /*--- Initialize the viscous residuals to zero ---*/
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Res_Visc[iVar] = 0.0;
-        if (implicit) {
-          for (jVar = 0; jVar < nVar; jVar++)
-            Jacobian_i[iVar][jVar] = 0.0;
-        }
-      }
-
-      /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
+    /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
 
-      /*--- Retrieve temperature from the flow solver ---*/
-      Temperature = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint, nDim+1);
+    if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      /*--- Compute the blackbody intensity at the wall. ---*/
-      Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
+    /*--- Compute dual-grid area ---*/
+    const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[val_marker][iVertex]->GetNormal());
 
-      /*--- Compute the radiative heat flux. ---*/
-      Radiative_Energy = nodes->GetSolution(iPoint, 0);
-      Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
+    /*--- Apply a weak boundary condition for the radiative transfer equation. ---*/
 
-      /*--- Compute the Viscous contribution to the residual ---*/
-      Res_Visc[0] = Radiative_Heat_Flux*Area;
+    /*--- Retrieve temperature from the flow solver and compute the blackbody intensity at the wall ---*/
+    const su2double Temperature = solver_container[FLOW_SOL]->GetNodes()->GetPrimitive(iPoint, nDim+1);
+    const su2double Ib_w = 4.0*STEFAN_BOLTZMANN*pow(Temperature,4.0);
 
-      /*--- Apply to the residual vector ---*/
-      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+    /*--- Compute the radiative heat flux. ---*/
+    const su2double Radiative_Energy = nodes->GetSolution(iPoint, 0);
+    const su2double Radiative_Heat_Flux = Theta*(Ib_w - Radiative_Energy);
 
-      /*--- Compute the Jacobian contribution. ---*/
-      if (implicit) {
-        Jacobian_i[0][0] = - Theta;
-        Jacobian.SubtractBlock2Diag(iPoint, Jacobian_i);
-      }
+    /*--- Compute the Viscous contribution to the residual and apply it ---*/
+    su2double Res_Visc[1] = {Radiative_Heat_Flux*Area};
+    LinSysRes.SubtractBlock(iPoint, Res_Visc);
 
-    }
+    /*--- Compute the Jacobian contribution, the flux derivative is -Theta. ---*/
+    if (implicit) Jacobian.AddVal2Diag(iPoint, Theta);
   }
 
 }
@@ -494,73 +441,81 @@ void CRadP1Solver::BC_Marshak(CGeometry *geometry, CSolver **solver_container, C
 
 void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
-  unsigned short iVar;
-  unsigned long iPoint, total_index, IterLinSol = 0;
-  su2double Vol;
-  su2double Delta;
-
-  /*--- Set maximum residual to zero ---*/
+  /*--- Set shared residual variables to 0 and declare
+   *    local ones for current thread to work on. ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  SU2_OMP_MASTER
+  for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
-  /*--- Build implicit system ---*/
+  SU2_OMP_BARRIER
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+  /*--- The P1 model has a single variable. ---*/
+  su2double resMax = 0.0, resRMS = 0.0;
+  const su2double* coordMax = nullptr;
+  unsigned long idxMax = 0;
 
-    /*--- Read the volume ---*/
+  /*--- Build implicit system ---*/
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+  SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
     /*--- Modify matrix diagonal to assure diagonal dominance ---*/
 
     if (nodes->GetDelta_Time(iPoint) != 0.0) {
-      Delta = Vol / nodes->GetDelta_Time(iPoint);
-      Jacobian.AddVal2Diag(iPoint, Delta);
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
+      Jacobian.AddVal2Diag(iPoint, Vol / nodes->GetDelta_Time(iPoint));
     }
     else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        total_index = iPoint*nVar + iVar;
-        LinSysRes[total_index] = 0.0;
-      }
+      LinSysRes(iPoint,0) = 0.0;
     }
 
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar+iVar;
-      LinSysRes[total_index] = - (LinSysRes[total_index]);
-      LinSysSol[total_index] = 0.0;
-      AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
-      AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->nodes->GetGlobalIndex(iPoint), geometry->nodes->GetCoord(iPoint));
+    LinSysRes(iPoint,0) = -LinSysRes(iPoint,0);
+    LinSysSol(iPoint,0) = 0.0;
+
+    const su2double Res = fabs(LinSysRes(iPoint,0));
+    resRMS += Res*Res;
+    if (Res > resMax) {
+      resMax = Res;
+      idxMax = iPoint;
+      coordMax = geometry->nodes->GetCoord(iPoint);
     }
   }
+  SU2_OMP_CRITICAL
+  {
+    AddRes_RMS(0, resRMS);
+    AddRes_Max(0, resMax, geometry->nodes->GetGlobalIndex(idxMax), coordMax);
+  }
+  SU2_OMP_BARRIER
 
   /*--- Initialize residual and solution at the ghost points ---*/
 
-  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = 0.0;
-      LinSysSol[total_index] = 0.0;
-    }
+  SU2_OMP(for schedule(static,OMP_MIN_SIZE) nowait)
+  for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    LinSysRes.SetBlock_Zero(iPoint);
+    LinSysSol.SetBlock_Zero(iPoint);
   }
 
   /*--- Solve or smooth the linear system ---*/
 
-  IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  auto iter = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    for (iVar = 0; iVar < nVar; iVar++) {
-      nodes->AddSolution(iPoint, iVar, LinSysSol[iPoint*nVar+iVar]);
-    }
-  }
+  /*--- Store the the number of iterations of the linear solver, and the value of the residual. ---*/
 
-  /*--- The the number of iterations of the linear solver ---*/
+  SU2_OMP_MASTER {
+    SetIterLinSolver(iter);
+    SetResLinSolver(System.GetResidual());
+  }
+  SU2_OMP_BARRIER
 
-  SetIterLinSolver(IterLinSol);
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    nodes->AddSolution(iPoint, 0, LinSysSol(iPoint,0));
+  }
 
   /*--- MPI solution ---*/
 
@@ -569,103 +524,118 @@ void CRadP1Solver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
 
   /*--- Compute the root mean square residual ---*/
 
+  SU2_OMP_MASTER
   SetResidual_RMS(geometry, config);
+  SU2_OMP_BARRIER
 
 }
 
 void CRadP1Solver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                unsigned short iMesh, unsigned long Iteration) {
 
-  unsigned short iMarker;
-  unsigned long iEdge, iVertex, iPoint = 0, jPoint = 0;
-  su2double Area, Vol, Lambda;
-  su2double Global_Delta_Time = 1E6, Local_Delta_Time = 0.0, K_v = 0.25;
-  su2double CFL = config->GetCFL_Rad();
-  su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
-  const su2double* Normal;
-
-  /*--- Compute spectral radius based on thermal conductivity ---*/
+  const su2double K_v = 0.25;
+  const su2double CFL = config->GetCFL_Rad();
+  const su2double GammaP1 = 1.0 / (3.0*(Absorption_Coeff + Scattering_Coeff));
 
-  Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
+  /*--- Init thread-shared variables to compute min/max values. ---*/
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
+  SU2_OMP_MASTER
+  {
+    Min_Delta_Time = 1.E6;
+    Max_Delta_Time = 0.0;
   }
+  SU2_OMP_BARRIER
 
-  /*--- Loop interior edges ---*/
+  /*--- Compute spectral radius based on thermal conductivity, loop domain points. ---*/
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
 
-    iPoint = geometry->edges->GetNode(iEdge,0);
-    jPoint = geometry->edges->GetNode(iEdge,1);
+    nodes->SetMax_Lambda_Visc(iPoint, 0.0);
 
-    /*--- Get the edge's normal vector to compute the edge's area ---*/
-    Normal = geometry->edges->GetNormal(iEdge);
-    Area = GeometryToolbox::Norm(nDim, Normal);
+    /*--- Loop over the neighbors of point i. ---*/
 
-    /*--- Viscous contribution ---*/
+    for (auto iEdge : geometry->nodes->GetEdges(iPoint)) {
 
-    Lambda = GammaP1*Area*Area;
-    if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
-    if (geometry->nodes->GetDomain(jPoint)) nodes->AddMax_Lambda_Visc(jPoint, Lambda);
+      /*--- Get the edge's normal vector to compute the edge's area ---*/
+      const su2double Area = GeometryToolbox::Norm(nDim, geometry->edges->GetNormal(iEdge));
 
+      /*--- Viscous contribution ---*/
+      nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area*Area);
+    }
   }
 
   /*--- Loop boundary edges ---*/
 
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+  for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
 
       /*--- Point identification, Normal vector and area ---*/
 
-      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      Area = GeometryToolbox::Norm(nDim, Normal);
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
 
-      /*--- Viscous contribution ---*/
+      if (!geometry->nodes->GetDomain(iPoint)) continue;
 
-      Lambda = GammaP1*Area*Area;
-      if (geometry->nodes->GetDomain(iPoint)) nodes->AddMax_Lambda_Visc(iPoint, Lambda);
+      const su2double Area = GeometryToolbox::Norm(nDim, geometry->vertex[iMarker][iVertex]->GetNormal());
 
+      /*--- Viscous contribution ---*/
+      nodes->AddMax_Lambda_Visc(iPoint, GammaP1*Area*Area);
     }
   }
 
   /*--- Each element uses their own speed, steady state simulation ---*/
+  {
+    /*--- Thread-local variables for min/max reduction. ---*/
+    su2double minDt = 1.E6, maxDt = 0.0;
+
+    SU2_OMP(for schedule(static,omp_chunk_size) nowait)
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      const su2double Vol = geometry->nodes->GetVolume(iPoint);
 
-    Vol = geometry->nodes->GetVolume(iPoint);
+      if (Vol != 0.0) {
 
-    if (Vol != 0.0) {
+        /*--- Time step setting method ---*/
 
-      /*--- Time step setting method ---*/
+        su2double Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
 
-       Local_Delta_Time = CFL*K_v*Vol*Vol/ nodes->GetMax_Lambda_Visc(iPoint);
+        /*--- Min-Max-Logic ---*/
 
-      /*--- Min-Max-Logic ---*/
+        minDt = min(minDt, Local_Delta_Time);
+        maxDt = max(maxDt, Local_Delta_Time);
 
-      Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
-      Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
-      Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
-      if (Local_Delta_Time > config->GetMax_DeltaTime())
-        Local_Delta_Time = config->GetMax_DeltaTime();
+        if (Local_Delta_Time > config->GetMax_DeltaTime())
+          Local_Delta_Time = config->GetMax_DeltaTime();
 
-      nodes->SetDelta_Time(iPoint, Local_Delta_Time);
+        nodes->SetDelta_Time(iPoint, Local_Delta_Time);
+      }
+      else {
+        nodes->SetDelta_Time(iPoint, 0.0);
+      }
     }
-    else {
-      nodes->SetDelta_Time(iPoint, 0.0);
+    /*--- Min/max over threads. ---*/
+    SU2_OMP_CRITICAL
+    {
+      Min_Delta_Time = min(Min_Delta_Time, minDt);
+      Max_Delta_Time = max(Max_Delta_Time, maxDt);
     }
+    SU2_OMP_BARRIER
   }
 
-  /*--- Compute the max and the min dt (in parallel) ---*/
+  /*--- Compute the max and the min dt (in parallel, now over mpi ranks) ---*/
   if (config->GetComm_Level() == COMM_FULL) {
-
-    su2double sbuf_time;
-    sbuf_time = Min_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
-
-    sbuf_time = Max_Delta_Time;
-    SU2_MPI::Allreduce(&sbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    SU2_OMP_MASTER
+    {
+      su2double rbuf_time;
+      SU2_MPI::Allreduce(&Min_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+      Min_Delta_Time = rbuf_time;
+
+      SU2_MPI::Allreduce(&Max_Delta_Time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+      Max_Delta_Time = rbuf_time;
+    }
+    SU2_OMP_BARRIER
   }
 
 }
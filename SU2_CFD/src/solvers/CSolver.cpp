@@ -1581,6 +1581,7 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       break;
     case MAX_EIGENVALUE:
     case SENSOR:
+    case DELTA_TIME:
       COUNT_PER_POINT  = 1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
@@ -1718,6 +1719,9 @@ void CSolver::InitiateComms(CGeometry *geometry,
           case SENSOR:
             bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
             break;
+          case DELTA_TIME:
+            bufDSend[buf_offset] = base_nodes->GetDelta_Time(iPoint);
+            break;
           case SOLUTION_GRADIENT:
             for (iVar = 0; iVar < nVar; iVar++) {
               for (iDim = 0; iDim < nDim; iDim++) {
@@ -1786,6 +1790,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_SCOPE("MPI::CompleteComms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -1878,6 +1884,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
           case SENSOR:
             base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
             break;
+          case DELTA_TIME:
+            base_nodes->SetDelta_Time(iPoint,bufDRecv[buf_offset]);
+            break;
           case SOLUTION_GRADIENT:
             for (iVar = 0; iVar < nVar; iVar++) {
               for (iDim = 0; iDim < nDim; iDim++) {
@@ -2015,6 +2024,16 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
     reduceCFL = linRes > 1.2*linTol;
     canIncrease = linRes < linTol;
 
+    /* The flow solver may instead decide from the stability of its last step (e.g. adaptive
+     Newton-Krylov, whose linear tolerance is not the configured one), the turbulence solver
+     can still prevent the increase. */
+    const auto signal = solver_container[MESH_0][FLOW_SOL]->GetCFLAdaptSignal();
+    if (signal != CFL_ADAPT_SIGNAL::NONE) {
+      resetCFL = linResTurb > 0.99;
+      reduceCFL = (signal == CFL_ADAPT_SIGNAL::REDUCE) || (linResTurb > 1.2*linTol);
+      canIncrease = (signal == CFL_ADAPT_SIGNAL::INCREASE) && (linResTurb < linTol);
+    }
+
     if ((iMesh == MESH_0) && (Res_Count > 0)) {
       Old_Func = New_Func;
       if (NonLinRes_Series.empty()) NonLinRes_Series.resize(Res_Count,0.0);
@@ -2174,6 +2193,67 @@ void CSolver::AdaptCFLNumber(CGeometry **geometry,
 
 }
 
+void CSolver::UpdateActiveSet(const CGeometry *geometry, const CConfig *config, CSolver* flowSolver) {
+
+  const bool flow = (flowSolver == this);
+  auto flowNodes = flowSolver->GetNodes();
+
+  const su2double factor = pow(10.0, config->GetActiveSet_Threshold());
+
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain,omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    bool converged = true;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      converged &= (fabs(LinSysRes(iPoint,iVar)) < factor * GetRes_RMS(iVar));
+
+    /*--- The flow solver sets the active set, the other solvers (turbulence) can
+     *    only reactivate the points where their own residuals are not converged. ---*/
+    if (flow) flowNodes->SetFrozen(iPoint, converged);
+    else if (!converged) flowNodes->SetFrozen(iPoint, false);
+  }
+
+  /*--- Halos are frozen, an edge is only skipped if its domain point is also frozen, in
+   *    which case the edge is computed by the rank that owns the (possibly active) halo. ---*/
+  if (flow) {
+    SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+    for (unsigned long iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+      flowNodes->SetFrozen(iPoint, true);
+  }
+
+  /*--- The frozen residuals of the flow are recomputed if points were reactivated,
+   *    its residual vector is still that of this iteration (the flow is solved first). ---*/
+  SetFrozenResidual(flowNodes);
+  if (!flow) flowSolver->SetFrozenResidual(flowNodes);
+
+}
+
+void CSolver::SetFrozenResidual(const CVariable* flowNodes) {
+
+  SU2_OMP_MASTER
+  ResFrozen_RMS.assign(nVar, 0.0);
+  SU2_OMP_BARRIER
+
+  vector<su2double> resRMS(nVar, 0.0);
+
+  /*--- The residual of the frozen points is not recomputed, the last one
+   *    contributes to the RMS residual until the next full sweep. ---*/
+  SU2_OMP_FOR_STAT(roundUpDiv(nPointDomain,omp_get_max_threads()))
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (!flowNodes->GetFrozen(iPoint)) continue;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      const su2double Res = LinSysRes(iPoint,iVar);
+      resRMS[iVar] += Res*Res;
+    }
+  }
+
+  SU2_OMP_CRITICAL
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    ResFrozen_RMS[iVar] += resRMS[iVar];
+  SU2_OMP_BARRIER
+
+}
+
 void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
   unsigned short iVar;
 
@@ -2563,11 +2643,14 @@ void CSolver::Update_Cross_Term(CConfig *config, su2passivematrix &cross_term) {
 
 void CSolver::SetGridVel_Gradient(CGeometry *geometry, const CConfig *config) {
 
-  /// TODO: No comms needed for this gradient? The Rmatrix should be allocated somewhere.
+  /// TODO: No comms needed for this gradient?
 
   const auto& gridVel = geometry->nodes->GetGridVel();
   auto& gridVelGrad = geometry->nodes->GetGridVel_Grad();
-  auto rmatrix = CVectorOfMatrix(nPoint,nDim,nDim);
+
+  /*--- Without a solver there are no periodic comms, only AD needs a local R matrix. ---*/
+  CVectorOfMatrix rmatrix;
+  if (!CGeometry::SHARED_LEAST_SQUARES) rmatrix.resize(nPoint,nDim,nDim);
 
   computeGradientsLeastSquares(nullptr, GRID_VELOCITY, PERIODIC_NONE, *geometry, *config,
                                true, gridVel, 0, nDim, gridVelGrad, rmatrix);
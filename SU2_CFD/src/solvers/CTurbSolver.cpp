@@ -121,6 +121,11 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     auto iPoint = geometry->edges->GetNode(iEdge,0);
     auto jPoint = geometry->edges->GetNode(iEdge,1);
 
+    /*--- Active set iterations, the edges between frozen (flow) points are skipped,
+     *    stale edge fluxes only contribute to frozen points (their rows are reset). ---*/
+
+    if (SkipFrozen && flowNodes->GetFrozen(iPoint) && flowNodes->GetFrozen(jPoint)) continue;
+
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     /*--- Primitive variables w/o reconstruction ---*/
@@ -517,7 +522,7 @@ void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver
 
   SU2_OMP_MASTER
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
-    SetRes_RMS(iVar, 0.0);
+    SetRes_RMS(iVar, SkipFrozen? ResFrozen_RMS[iVar] : 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
   SU2_OMP_BARRIER
@@ -546,6 +551,13 @@ void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver
       LinSysRes.SetBlock_Zero(iPoint);
     }
 
+    /*--- Points frozen by the flow solver (active set) are not updated. ---*/
+
+    if (SkipFrozen && flowNodes->GetFrozen(iPoint)) {
+      FreezePoint(iPoint);
+      continue;
+    }
+
     /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
 
     for (unsigned short iVar = 0; iVar < nVar; iVar++) {
@@ -573,6 +585,9 @@ void CTurbSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver** solver
   SU2_OMP_MASTER
   SetResidual_RMS(geometry, config);
   SU2_OMP_BARRIER
+
+  /*--- Full sweep, reactivate the points where the turbulence is not converged. ---*/
+  if (config->GetActiveSet() && !SkipFrozen) UpdateActiveSet(geometry, config, solver_container[FLOW_SOL]);
 }
 
 void CTurbSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
@@ -54,7 +54,7 @@ CAdjEulerVariable::CAdjEulerVariable(su2double psirho, const su2double *phi, su2
   }
 
   if (config->GetLeastSquaresRequired()) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   /*--- Allocate undivided laplacian (centered) and limiter (upwind)---*/
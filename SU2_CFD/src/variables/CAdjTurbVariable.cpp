@@ -44,7 +44,7 @@ CAdjTurbVariable::CAdjTurbVariable(su2double psinu_inf, unsigned long npoint, un
   Gradient.resize(nPoint,nVar,nDim,0.0);
 
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   /*--- Always allocate the slope limiter,
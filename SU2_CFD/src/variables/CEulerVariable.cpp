@@ -69,8 +69,12 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   if (config->GetKind_SlopeLimit_Flow() != NO_LIMITER &&
       config->GetKind_SlopeLimit_Flow() != VAN_ALBADA_EDGE) {
     Limiter_Primitive.resize(nPoint,nPrimVarGrad) = su2double(0.0);
-    Solution_Max.resize(nPoint,nPrimVarGrad) = su2double(0.0);
-    Solution_Min.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+
+    /*--- The fused computation of gradients and limiters does not store the min/max. ---*/
+    if (!config->GetFused_Gradient_Limiter()) {
+      Solution_Max.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+      Solution_Min.resize(nPoint,nPrimVarGrad) = su2double(0.0);
+    }
   }
 
   /*--- Solution initialization ---*/
@@ -130,7 +134,7 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   }
 
   if (config->GetLeastSquaresRequired()) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   if (config->GetMultizone_Problem())
@@ -150,12 +154,13 @@ CEulerVariable::CEulerVariable(su2double density, const su2double *velocity, su2
   Non_Physical.resize(nPoint) = false;
   Non_Physical_Counter.resize(nPoint) = 0;
 
+  /* Active set, no point is frozen until the first full sweep. */
+  if (config->GetActiveSet()) Frozen.resize(nPoint) = false;
+
 }
 
 bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
-  bool RightVol = true;
-
   SetVelocity(iPoint);   // Computes velocity and velocity^2
   su2double density      = GetDensity(iPoint);
   su2double staticEnergy = GetEnergy(iPoint)-0.5*Velocity2(iPoint);
@@ -164,10 +169,19 @@ bool CEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
   FluidModel->SetTDState_rhoe(density, staticEnergy);
 
+  return SetPrimVar(iPoint, FluidModel->GetPressure(), FluidModel->GetSoundSpeed2(),
+                    FluidModel->GetTemperature(), FluidModel);
+}
+
+bool CEulerVariable::SetPrimVar(unsigned long iPoint, su2double pressure, su2double soundSpeed2,
+                                su2double temperature, CFluidModel *FluidModel) {
+
+  bool RightVol = true;
+
   bool check_dens  = SetDensity(iPoint);
-  bool check_press = SetPressure(iPoint, FluidModel->GetPressure());
-  bool check_sos   = SetSoundSpeed(iPoint, FluidModel->GetSoundSpeed2());
-  bool check_temp  = SetTemperature(iPoint, FluidModel->GetTemperature());
+  bool check_press = SetPressure(iPoint, pressure);
+  bool check_sos   = SetSoundSpeed(iPoint, soundSpeed2);
+  bool check_temp  = SetTemperature(iPoint, temperature);
 
   /*--- Check that the solution has a physical meaning ---*/
 
@@ -69,7 +69,7 @@ CHeatVariable::CHeatVariable(su2double heat, unsigned long npoint, unsigned long
   }
   
   if (config->GetLeastSquaresRequired()) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   if (config->GetKind_ConvNumScheme_Heat() == SPACE_CENTERED)
@@ -103,7 +103,7 @@ CIncEulerVariable::CIncEulerVariable(su2double pressure, const su2double *veloci
   }
 
   if (config->GetLeastSquaresRequired()) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   if (config->GetMultizone_Problem())
@@ -133,6 +133,19 @@ CIncEulerVariable::CIncEulerVariable(su2double pressure, const su2double *veloci
 
 bool CIncEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
+  /*--- Use the fluid model to compute the new value of density.
+  Note that the thermodynamic pressure is constant and decoupled
+  from the dynamic pressure being iterated. ---*/
+
+  FluidModel->SetTDState_T(Solution(iPoint,nDim+1));
+
+  return SetPrimVar(iPoint, FluidModel->GetDensity(), FluidModel->GetCp(), FluidModel->GetCv(), FluidModel);
+
+}
+
+bool CIncEulerVariable::SetPrimVar(unsigned long iPoint, su2double density, su2double cp, su2double cv,
+                                   CFluidModel *FluidModel) {
+
   unsigned long iVar;
   bool check_dens = false, check_temp = false, physical = true;
 
@@ -145,17 +158,9 @@ bool CIncEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel
   su2double Temperature = Solution(iPoint,nDim+1);
   check_temp = SetTemperature(iPoint,Temperature);
 
-  /*--- Use the fluid model to compute the new value of density.
-  Note that the thermodynamic pressure is constant and decoupled
-  from the dynamic pressure being iterated. ---*/
-
-  /*--- Use the fluid model to compute the new value of density. ---*/
-
-  FluidModel->SetTDState_T(Temperature);
-
   /*--- Set the value of the density ---*/
 
-  check_dens = SetDensity(iPoint, FluidModel->GetDensity());
+  check_dens = SetDensity(iPoint, density);
 
   /*--- Non-physical solution found. Revert to old values. ---*/
 
@@ -172,6 +177,8 @@ bool CIncEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel
     SetTemperature(iPoint, Temperature);
     FluidModel->SetTDState_T(Temperature);
     SetDensity(iPoint, FluidModel->GetDensity());
+    cp = FluidModel->GetCp();
+    cv = FluidModel->GetCv();
 
     /*--- Flag this point as non-physical. ---*/
 
@@ -185,8 +192,8 @@ bool CIncEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel
 
   /*--- Set specific heats (only necessary for consistency with preconditioning). ---*/
 
-  SetSpecificHeatCp(iPoint, FluidModel->GetCp());
-  SetSpecificHeatCv(iPoint, FluidModel->GetCv());
+  SetSpecificHeatCp(iPoint, cp);
+  SetSpecificHeatCv(iPoint, cv);
 
   return physical;
 
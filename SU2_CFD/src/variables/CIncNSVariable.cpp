@@ -53,55 +53,26 @@ CIncNSVariable::CIncNSVariable(su2double pressure, const su2double *velocity, su
 
 bool CIncNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) {
 
-  unsigned short iVar;
-  bool check_dens = false, check_temp = false, physical = true;
-
-  /*--- Set the value of the pressure ---*/
-
-  SetPressure(iPoint);
-
-  /*--- Set the value of the temperature directly ---*/
-
-  su2double Temperature = Solution(iPoint,nDim+1);
-  check_temp = SetTemperature(iPoint,Temperature);
-
   /*--- Use the fluid model to compute the new value of density.
   Note that the thermodynamic pressure is constant and decoupled
   from the dynamic pressure being iterated. ---*/
 
-  /*--- Use the fluid model to compute the new value of density. ---*/
-
-  FluidModel->SetTDState_T(Temperature);
-
-  /*--- Set the value of the density ---*/
-
-  check_dens = SetDensity(iPoint, FluidModel->GetDensity());
+  FluidModel->SetTDState_T(Solution(iPoint,nDim+1));
 
-  /*--- Non-physical solution found. Revert to old values. ---*/
+  return SetPrimVar(iPoint, eddy_visc, FluidModel->GetDensity(), FluidModel->GetCp(), FluidModel->GetCv(), FluidModel);
 
-  if (check_dens || check_temp) {
-
-    /*--- Copy the old solution ---*/
-
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution(iPoint,iVar) = Solution_Old(iPoint,iVar);
-
-    /*--- Recompute the primitive variables ---*/
-
-    Temperature = Solution(iPoint,nDim+1);
-    SetTemperature(iPoint, Temperature);
-    FluidModel->SetTDState_T(Temperature);
-    SetDensity(iPoint, FluidModel->GetDensity());
+}
 
-    /*--- Flag this point as non-physical. ---*/
+bool CIncNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double density, su2double cp,
+                                su2double cv, CFluidModel *FluidModel) {
 
-    physical = false;
+  /*--- Thermodynamic primitive variables (reverts to the old solution if not physical). ---*/
 
-  }
+  const bool physical = CIncEulerVariable::SetPrimVar(iPoint, density, cp, cv, FluidModel);
 
-  /*--- Set the value of the velocity and velocity^2 (requires density) ---*/
+  /*--- State of the point for the transport properties ---*/
 
-  SetVelocity(iPoint);
+  FluidModel->SetTransportState(GetDensity(iPoint), GetTemperature(iPoint), GetSpecificHeatCp(iPoint));
 
   /*--- Set laminar viscosity ---*/
 
@@ -116,11 +87,6 @@ bool CIncNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2do
 
   SetThermalConductivity(iPoint, FluidModel->GetThermalConductivity());
 
-  /*--- Set specific heats ---*/
-
-  SetSpecificHeatCp(iPoint, FluidModel->GetCp());
-  SetSpecificHeatCv(iPoint, FluidModel->GetCv());
-
   return physical;
 
 }
@@ -126,7 +126,7 @@ CNEMOEulerVariable::CNEMOEulerVariable(su2double val_pressure,
   }
 
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   Velocity2.resize(nPoint) = su2double(0.0);
@@ -195,10 +195,10 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
   bool nonPhys;
   unsigned short iVar;
 
-  fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  auto fluidmodel = static_cast<CNEMOGas*>(FluidModel);
 
   /*--- Convert conserved to primitive variables ---*/
-  nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint],
+  nonPhys = Cons2PrimVar(fluidmodel, Solution[iPoint], Primitive[iPoint],
                          dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
 
   /*--- Reset solution to previous one, if nonphys ---*/
@@ -215,7 +215,7 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
   return nonPhys;
 }
 
-bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
+bool CNEMOEulerVariable::Cons2PrimVar(CNEMOGas *fluidmodel, su2double *U, su2double *V,
                                       su2double *val_dPdU, su2double *val_dTdU,
                                       su2double *val_dTvedU, su2double *val_eves,
                                       su2double *val_Cvves) {
@@ -134,8 +134,6 @@ void CNSVariable::SetRoe_Dissipation_FD(unsigned long iPoint, su2double val_wall
 
 bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, CFluidModel *FluidModel) {
 
-  bool RightVol = true;
-
   SetVelocity(iPoint); // Computes velocity and velocity^2
   su2double density      = GetDensity(iPoint);
   su2double staticEnergy = GetEnergy(iPoint)-0.5*Velocity2(iPoint) - turb_ke;
@@ -144,10 +142,19 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
 
   FluidModel->SetTDState_rhoe(density, staticEnergy);
 
+  return SetPrimVar(iPoint, eddy_visc, turb_ke, FluidModel->GetPressure(), FluidModel->GetSoundSpeed2(),
+                    FluidModel->GetTemperature(), FluidModel->GetCp(), FluidModel);
+}
+
+bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2double turb_ke, su2double pressure,
+                             su2double soundSpeed2, su2double temperature, su2double cp, CFluidModel *FluidModel) {
+
+  bool RightVol = true;
+
   bool check_dens  = SetDensity(iPoint);
-  bool check_press = SetPressure(iPoint, FluidModel->GetPressure());
-  bool check_sos   = SetSoundSpeed(iPoint, FluidModel->GetSoundSpeed2());
-  bool check_temp  = SetTemperature(iPoint, FluidModel->GetTemperature());
+  bool check_press = SetPressure(iPoint, pressure);
+  bool check_sos   = SetSoundSpeed(iPoint, soundSpeed2);
+  bool check_temp  = SetTemperature(iPoint, temperature);
 
   /*--- Check that the solution has a physical meaning ---*/
 
@@ -161,8 +168,8 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
     /*--- Recompute the primitive variables ---*/
 
     SetVelocity(iPoint); // Computes velocity and velocity^2
-    density      = GetDensity(iPoint);
-    staticEnergy = GetEnergy(iPoint)-0.5*Velocity2(iPoint) - turb_ke;
+    su2double density      = GetDensity(iPoint);
+    su2double staticEnergy = GetEnergy(iPoint)-0.5*Velocity2(iPoint) - turb_ke;
 
     /*--- Check will be moved inside fluid model plus error description strings ---*/
 
@@ -172,6 +179,7 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
     SetPressure(iPoint, FluidModel->GetPressure());
     SetSoundSpeed(iPoint, FluidModel->GetSoundSpeed2());
     SetTemperature(iPoint, FluidModel->GetTemperature());
+    cp = FluidModel->GetCp();
 
     RightVol = false;
 
@@ -181,6 +189,10 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
 
   SetEnthalpy(iPoint); // Requires pressure computation.
 
+  /*--- State of the point for the transport properties ---*/
+
+  FluidModel->SetTransportState(GetDensity(iPoint), GetTemperature(iPoint), cp);
+
   /*--- Set laminar viscosity ---*/
 
   SetLaminarViscosity(iPoint, FluidModel->GetLaminarViscosity());
@@ -195,7 +207,7 @@ bool CNSVariable::SetPrimVar(unsigned long iPoint, su2double eddy_visc, su2doubl
 
   /*--- Set specific heat ---*/
 
-  SetSpecificHeatCp(iPoint, FluidModel->GetCp());
+  SetSpecificHeatCp(iPoint, cp);
 
   return RightVol;
 }
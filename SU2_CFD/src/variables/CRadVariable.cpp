@@ -39,7 +39,7 @@ CRadVariable::CRadVariable(unsigned long npoint, unsigned long ndim, unsigned lo
   Gradient.resize(nPoint,nVar,nDim,0.0);
 
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+    AllocateRmatrix(config);
   }
 
   Max_Lambda_Visc.resize(nPoint);
@@ -28,6 +28,7 @@
 
 #include "../../include/variables/CVariable.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/geometry/CGeometry.hpp"
 
 
 CVariable::CVariable(unsigned long npoint, unsigned long nvar, CConfig *config) {
@@ -144,3 +145,9 @@ void CVariable::RegisterSolution_time_n1() {
     for(unsigned long iVar=0; iVar<nVar; ++iVar)
       AD::RegisterInput(Solution_time_n1(iPoint,iVar));
 }
+
+void CVariable::AllocateRmatrix(const CConfig *config) {
+
+  if (!CGeometry::SHARED_LEAST_SQUARES || (config->GetnMarker_Periodic() > 0))
+    Rmatrix.resize(nPoint,nDim,nDim,0.0);
+}
@@ -38,6 +38,7 @@ threads="1"
 ) pysu2
 %{
 
+#define SWIG_FILE_WITH_INIT
 #include "../../SU2_CFD/include/drivers/CDriver.hpp"
 #include "../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
 #include "../../SU2_CFD/include/drivers/CMultizoneDriver.hpp"
@@ -52,7 +53,7 @@ threads="1"
 %include "std_vector.i"
 %include "std_map.i"
 %include "typemaps.i"
-//%include "numpy.i"
+%include "numpy.i"
 #ifdef HAVE_MPI                    //Need mpi4py only for a parallel build of the wrapper.
   %include "mpi4py/mpi4py.i"
   %mpi4py_typemap(Comm, MPI_Comm)
@@ -66,6 +67,18 @@ namespace std {
    %template() map<string, string>;
 }
 
+%init %{
+  import_array();
+%}
+
+// Bulk access to the solver data through NumPy arrays, views (no copies) are returned by the
+// GetXxxView methods, see CDriver.hpp for the synchronization points.
+%apply (double** ARGOUTVIEW_ARRAY2, int* DIM1, int* DIM2) {(passivedouble** view, int* nRow, int* nCol)};
+%apply (unsigned long** ARGOUTVIEW_ARRAY1, int* DIM1) {(unsigned long** view, int* nRow)};
+%apply (double* INPLACE_ARRAY2, int DIM1, int DIM2) {(passivedouble* values, int nRow, int nCol)};
+%apply (double* IN_ARRAY2, int DIM1, int DIM2) {(const passivedouble* values, int nRow, int nCol)};
+%apply (double* IN_ARRAY1, int DIM1) {(const passivedouble* values, int nRow)};
+
 // ----------- API CLASSES ----------------
 
 //Constants definitions
@@ -85,6 +98,12 @@ const unsigned int MESH_1 = 1; /*!< \brief Definition of the finest grid level.
 const unsigned int ZONE_0 = 0; /*!< \brief Definition of the first grid domain. */
 const unsigned int ZONE_1 = 1; /*!< \brief Definition of the first grid domain. */
 
+const unsigned int FLOW_SOL = 0; /*!< \brief Position of the mean flow solution in the solver container array. */
+const unsigned int TURB_SOL = 2; /*!< \brief Position of the turbulence model solution in the solver container array. */
+const unsigned int HEAT_SOL = 5; /*!< \brief Position of the heat equation in the solution solver array. */
+const unsigned int MESH_SOL = 9; /*!< \brief Position of the mesh solver. */
+const unsigned int FEA_SOL = 0;  /*!< \brief Position of the FEA equation in the solution solver array. */
+
 // CDriver class
 %include "../../SU2_CFD/include/drivers/CDriver.hpp"
 %include "../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
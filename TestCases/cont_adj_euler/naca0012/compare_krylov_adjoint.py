@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+
+## \file compare_krylov_adjoint.py
+#  \brief Runs the fixed-point and the residual-based Krylov discrete adjoint on
+#         the same case and compares the surface sensitivities.
+#  \author agent
+#  \version 7.1.1 "Blackbird"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import csv
+import subprocess
+import sys
+from optparse import OptionParser
+
+# Options of the base case replaced (or added) for each of the two runs.
+COMMON = {"OUTPUT_FILES": "(SURFACE_CSV)",
+          "CONV_RESIDUAL_MINVAL": "-14"}
+
+RUNS = {"fixedpoint": {"DISCADJ_RESIDUAL_KRYLOV": "NO",
+                       "SURFACE_ADJ_FILENAME": "surface_adjoint_fixedpoint"},
+        "krylov":     {"DISCADJ_RESIDUAL_KRYLOV": "YES",
+                       "DISCADJ_LIN_SOLVER": "FGMRES",
+                       "DISCADJ_LIN_PREC": "ILU",
+                       "SURFACE_ADJ_FILENAME": "surface_adjoint_krylov"}}
+
+def write_config(base, name, options):
+    lines = open(base).readlines()
+    options = dict(COMMON, **options)
+    cfg = "%s_%s.cfg" % (base.split(".cfg")[0], name)
+    with open(cfg, "w") as out:
+        for line in lines:
+            if line.strip().split("=")[0].strip() not in options:
+                out.write(line)
+        for key, value in options.items():
+            out.write("%s= %s\n" % (key, value))
+    return cfg
+
+def read_sensitivity(filename):
+    with open(filename) as f:
+        reader = csv.DictReader(f, skipinitialspace=True)
+        return {int(row["PointID"]): float(row["Surface_Sensitivity"]) for row in reader}
+
+def main():
+    parser = OptionParser()
+    parser.add_option("-f", "--file", dest="filename", help="read config from FILE")
+    parser.add_option("-n", "--partitions", dest="partitions", default=2, help="number of PARTITIONS")
+    parser.add_option("-t", "--tol", dest="tol", default=1e-6, help="relative TOLerance")
+    (options, args) = parser.parse_args()
+
+    sens = {}
+    for name, runOptions in RUNS.items():
+        cfg = write_config(options.filename, name, runOptions)
+        command = "mpirun -n %d SU2_CFD_AD %s" % (int(options.partitions), cfg)
+        if subprocess.call(command, shell=True) != 0:
+            sys.exit("Failed: %s" % command)
+        sens[name] = read_sensitivity(runOptions["SURFACE_ADJ_FILENAME"] + ".csv")
+
+    # Both adjoints are converged, the sensitivities must agree up to that level.
+    scale = max(abs(v) for v in sens["fixedpoint"].values())
+    maxDiff = max(abs(sens["krylov"][i] - v) for i, v in sens["fixedpoint"].items())
+    passed = (set(sens["krylov"]) == set(sens["fixedpoint"])) and (maxDiff <= float(options.tol) * scale)
+
+    print("Max. difference of the surface sensitivities: %e (scale %e)" % (maxDiff, scale))
+    with open("krylov_adjoint_check.dat", "w") as out:
+        out.write("PASSED\n" if passed else "FAILED\n")
+
+if __name__ == "__main__":
+    main()
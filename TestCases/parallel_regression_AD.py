@@ -357,6 +357,22 @@ def main():
     pass_list.append(discadj_topol_optim.run_filediff())
     test_list.append(discadj_topol_optim)
 
+    ##############################################################
+    ### Residual-based Krylov adjoint vs fixed-point adjoint   ###
+    ##############################################################
+
+    # Inviscid NACA0012 on 2 ranks, the converged surface sensitivities must match
+    discadj_krylov_naca0012 = TestCase('discadj_krylov_naca0012')
+    discadj_krylov_naca0012.cfg_dir   = "cont_adj_euler/naca0012"
+    discadj_krylov_naca0012.cfg_file  = "inv_NACA0012_discadj.cfg"
+    discadj_krylov_naca0012.test_iter = 2000
+    discadj_krylov_naca0012.su2_exec  = "python compare_krylov_adjoint.py -n 2 -f"
+    discadj_krylov_naca0012.timeout   = 3200
+    discadj_krylov_naca0012.reference_file = "krylov_adjoint_check.dat.ref"
+    discadj_krylov_naca0012.test_file = "krylov_adjoint_check.dat"
+    pass_list.append(discadj_krylov_naca0012.run_filediff())
+    test_list.append(discadj_krylov_naca0012)
+
     ####################################################################################
     ### Unsteady Disc. adj. compressible RANS Windowed Average with restart solution ###
     ####################################################################################
@@ -43,6 +43,7 @@ import sys
 from optparse import OptionParser	# use a parser for configuration
 import pysu2			            # imports the SU2 wrapped module
 from math import *
+import numpy
 
 # -------------------------------------------------------------------
 #  Main
@@ -122,9 +123,9 @@ def main():
     SU2Driver.Preprocess(TimeIter)
     # Define the homogeneous unsteady wall temperature on the structure (user defined)
     WallTemp = 293.0 + 57.0*sin(2*pi*time)
-    # Set this temperature to all the vertices on the specified CHT marker
-    for iVertex in range(nVertex_CHTMarker):
-      SU2Driver.SetVertexTemperature(CHTMarkerID, iVertex, WallTemp)
+    # Set this temperature to all the vertices on the specified CHT marker (one call per marker)
+    if CHTMarkerID != None:
+      SU2Driver.SetMarkerTemperatures(CHTMarkerID, numpy.full(nVertex_CHTMarker, WallTemp))
     # Tell the SU2 drive to update the boundary conditions
     SU2Driver.BoundaryConditionsUpdate()
     # Run one time iteration (e.g. dual-time)
@@ -0,0 +1,81 @@
+/*!
+ * \file CWallModel_tests.cpp
+ * \brief Unit tests of the LES wall models.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <sstream>
+#include "../../Common/include/wall_model.hpp"
+#include "../../SU2_CFD/include/fluid/CIdealGas.hpp"
+
+TEST_CASE("Log-law wall model shared by threads", "[WallModel]") {
+
+  /*--- The wall model of a marker is shared by the threads of the DG task scheduler,
+   *    each thread passes its own fluid model. ---*/
+
+  std::stringstream config_options;
+  config_options << "SOLVER= NAVIER_STOKES\n"
+                    "REYNOLDS_NUMBER= 1e6\n"
+                    "MARKER_HEATFLUX= (wall, 0.0)\n"
+                    "MARKER_WALL_FUNCTIONS= (wall, LOGARITHMIC_WALL_MODEL, 0.01, 1.0, 1)\n"
+                    "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n";
+
+  CConfig config(config_options, SU2_CFD, false);
+  config.SetMu_ConstantND(1.8e-5);
+
+  const CWallModelLogLaw wallModel(&config, "wall");
+
+  /*--- Exchange states covering the viscous sublayer, buffer layer and log region. ---*/
+
+  const int n = 64;
+  vector<su2double> tauSerial(n), qSerial(n), tauThread(n), qThread(n);
+
+  auto evaluate = [&](CFluidModel& fluid, int i, su2double& tau, su2double& q) {
+    su2double mu, kOverCv;
+    wallModel.WallShearStressAndHeatFlux(290.0, 0.1 + i, 1.8e-5, 101325.0 - 100.0*i, 0.0, false,
+                                         300.0, true, &fluid, tau, q, mu, kOverCv);
+  };
+
+  CIdealGas serialFluid(1.4, 287.058);
+  serialFluid.SetLaminarViscosityModel(&config);
+  serialFluid.SetThermalConductivityModel(&config);
+  for (int i = 0; i < n; ++i) evaluate(serialFluid, i, tauSerial[i], qSerial[i]);
+
+  SU2_OMP_PARALLEL
+  {
+    CIdealGas fluid(1.4, 287.058);
+    fluid.SetLaminarViscosityModel(&config);
+    fluid.SetThermalConductivityModel(&config);
+
+    SU2_OMP_FOR_DYN(1)
+    for (int i = 0; i < n; ++i) evaluate(fluid, i, tauThread[i], qThread[i]);
+  }
+
+  for (int i = 0; i < n; ++i) {
+    CHECK(tauSerial[i] > 0.0);
+    CHECK(tauThread[i] == tauSerial[i]);
+    CHECK(qThread[i] == qSerial[i]);
+  }
+}
@@ -27,6 +27,8 @@
 
 #include "catch.hpp"
 #include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/geometry/CGeometryCache.hpp"
 
 std::unique_ptr<UnitQuadTestCase> TestCase;
 
@@ -156,3 +158,358 @@ TEST_CASE("Set bound control volume", "[Geometry]"){
   CHECK(TestCase->geometry->vertex[5][3]->GetNormal()[2] ==  0.03125);
 
 }
+
+TEST_CASE("Threaded control volume update", "[Geometry]"){
+
+  auto geometry = TestCase->geometry.get();
+  const auto nDim = geometry->GetnDim();
+
+  /*--- Rebuild the dual grid from scratch with a given number of threads. ---*/
+  auto compute = [&](int nThreads, vector<su2double>& volumes, vector<su2double>& normals) {
+    SU2_OMP_PARALLEL_ON(nThreads)
+    geometry->SetControlVolume(TestCase->config.get(), UPDATE);
+
+    volumes.clear();
+    normals.clear();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      volumes.push_back(geometry->nodes->GetVolume(iPoint));
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge)
+      for (auto iDim = 0u; iDim < nDim; ++iDim)
+        normals.push_back(geometry->edges->GetNormal(iEdge)[iDim]);
+  };
+
+  vector<su2double> volumes1, normals1, volumesN, normalsN;
+  compute(1, volumes1, normals1);
+  compute(max(4, omp_get_max_threads()), volumesN, normalsN);
+
+  /*--- The result cannot depend on the number of threads, not even in the last bit. ---*/
+  CHECK(volumes1 == volumesN);
+  CHECK(normals1 == normalsN);
+  CHECK(geometry->GetDualGridColoring().getOuterSize() > 1);
+
+}
+
+TEST_CASE("Multigrid agglomeration", "[Geometry]"){
+
+  UnitQuadTestCase test;
+  test.AddOption("MGLEVEL= 1");
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto config = test.config.get();
+  CGeometry* geometry[] = {test.geometry.get(), nullptr};
+  const auto fine = geometry[MESH_0];
+
+  cout.rdbuf(nullptr);
+  auto coarse = std::unique_ptr<CMultiGridGeometry>(new CMultiGridGeometry(geometry, config, MESH_1));
+  coarse->SetPoint_Connectivity(fine);
+  coarse->SetEdges();
+  coarse->SetVertex(fine, config);
+  SU2_OMP_PARALLEL {
+    coarse->SetControlVolume(config, fine, ALLOCATE);
+    coarse->SetBoundControlVolume(config, fine, ALLOCATE);
+  }
+  cout.rdbuf(test.orig_buf);
+
+  /*--- Each fine point belongs to exactly one coarse point. ---*/
+  vector<unsigned short> count(fine->GetnPoint(), 0);
+  for (auto iPoint = 0ul; iPoint < coarse->GetnPoint(); ++iPoint)
+    for (auto iChild = 0u; iChild < coarse->nodes->GetnChildren_CV(iPoint); ++iChild) {
+      const auto iFine = coarse->nodes->GetChildren_CV(iPoint, iChild);
+      CHECK(fine->nodes->GetParent_CV(iFine) == iPoint);
+      count[iFine]++;
+    }
+  CHECK(*min_element(count.begin(), count.end()) == 1);
+  CHECK(*max_element(count.begin(), count.end()) == 1);
+  CHECK(coarse->GetnPoint() < fine->GetnPoint());
+
+  /*--- The neighbors are symmetric and the dual grid is conservative. ---*/
+  bool symmetric = true;
+  su2double volume = 0.0;
+  for (auto iPoint = 0ul; iPoint < coarse->GetnPoint(); ++iPoint) {
+    for (auto jPoint : coarse->nodes->GetPoints(iPoint))
+      symmetric &= coarse->nodes->GetPoints().findInnerIdx(jPoint, iPoint) < coarse->nodes->GetPoints().getNumNonZeros();
+    volume += coarse->nodes->GetVolume(iPoint);
+  }
+  CHECK(symmetric);
+  CHECK(volume == Approx(1.0));
+
+  for (auto iMarker = 0u; iMarker < fine->GetnMarker(); ++iMarker) {
+    su2double fineArea[3] = {0.0}, coarseArea[3] = {0.0};
+    for (auto iVertex = 0ul; iVertex < fine->GetnVertex(iMarker); ++iVertex)
+      for (auto iDim = 0u; iDim < 3; ++iDim) fineArea[iDim] += fine->vertex[iMarker][iVertex]->GetNormal(iDim);
+    for (auto iVertex = 0ul; iVertex < coarse->GetnVertex(iMarker); ++iVertex)
+      for (auto iDim = 0u; iDim < 3; ++iDim) coarseArea[iDim] += coarse->vertex[iMarker][iVertex]->GetNormal(iDim);
+    for (auto iDim = 0u; iDim < 3; ++iDim) CHECK(coarseArea[iDim] == Approx(fineArea[iDim]));
+  }
+
+  /*--- The dual control volumes of the box are boxes, and so are the faces of the agglomerates.
+   *    Compute the aspect ratio from the coordinates: area of the children minus shared faces. ---*/
+  const su2double h = 0.25;
+  auto extent = [&](unsigned long iPoint, unsigned short iDim) {
+    const auto x = fine->nodes->GetCoord(iPoint, iDim);
+    return (x < 0.5*h || x > 1.0-0.5*h)? 0.5*h : h;
+  };
+  unsigned long maxChildren = 0;
+  su2double sumAR = 0.0, maxAR = 0.0;
+
+  for (auto iPoint = 0ul; iPoint < coarse->GetnPointDomain(); ++iPoint) {
+    const auto nChildren = coarse->nodes->GetnChildren_CV(iPoint);
+    maxChildren = max<unsigned long>(maxChildren, nChildren);
+
+    su2double volume = 0.0, area = 0.0;
+    for (auto iChild = 0u; iChild < nChildren; ++iChild) {
+      const auto iFine = coarse->nodes->GetChildren_CV(iPoint, iChild);
+      const su2double e[] = {extent(iFine,0), extent(iFine,1), extent(iFine,2)};
+      volume += e[0]*e[1]*e[2];
+      area += 2.0*(e[0]*e[1] + e[1]*e[2] + e[2]*e[0]);
+
+      /*--- Faces shared with siblings (once from each side). ---*/
+      for (auto jFine : fine->nodes->GetPoints(iFine)) {
+        if (fine->nodes->GetParent_CV(jFine) != iPoint) continue;
+        for (auto iDim = 0u; iDim < 3; ++iDim)
+          if (fine->nodes->GetCoord(iFine, iDim) != fine->nodes->GetCoord(jFine, iDim))
+            area -= e[(iDim+1)%3] * e[(iDim+2)%3];
+      }
+    }
+    const auto AR = area / (6.0*pow(volume, 2.0/3.0));
+    sumAR += AR;
+    maxAR = max(maxAR, AR);
+  }
+
+  unsigned long qualMaxChildren = 0;
+  passivedouble qualAvgAR = 0.0, qualMaxAR = 0.0;
+  coarse->ComputeAgglomerationQuality(fine, config, qualMaxChildren, qualAvgAR, qualMaxAR);
+
+  CHECK(qualMaxChildren == maxChildren);
+  CHECK(qualAvgAR == Approx(SU2_TYPE::GetValue(sumAR) / coarse->GetnPointDomain()));
+  CHECK(qualMaxAR == Approx(SU2_TYPE::GetValue(maxAR)));
+  /*--- Unions of boxes are never better than a cube. ---*/
+  CHECK(qualAvgAR >= 1.0);
+
+}
+
+namespace {
+
+/*--- Agglomerate a 25x25x25 box (several blocks of points), return the parent of each fine point,
+ *    the number of coarse points, and the average aspect ratio of the coarse control volumes. ---*/
+unsigned long AgglomerateBox(unsigned long blockSize, int nThreads, vector<unsigned long>& parents,
+                             passivedouble& avgAR) {
+  UnitQuadTestCase test;
+  test.config_options.replace(test.config_options.find("MESH_BOX_SIZE=5,5,5"), 19, "MESH_BOX_SIZE=25,25,25");
+  test.AddOption("MGLEVEL= 1");
+  test.AddOption("MG_AGGLOMERATION_BLOCK_SIZE= " + to_string(blockSize));
+  test.InitConfig();
+  test.InitGeometry();
+
+  auto config = test.config.get();
+  CGeometry* geometry[] = {test.geometry.get(), nullptr};
+  const auto fine = geometry[MESH_0];
+
+  omp_set_num_threads(nThreads);
+  cout.rdbuf(nullptr);
+  auto coarse = std::unique_ptr<CMultiGridGeometry>(new CMultiGridGeometry(geometry, config, MESH_1));
+  coarse->SetPoint_Connectivity(fine);
+  coarse->SetEdges();
+  coarse->SetVertex(fine, config);
+  SU2_OMP_PARALLEL {
+    coarse->SetControlVolume(config, fine, ALLOCATE);
+    coarse->SetBoundControlVolume(config, fine, ALLOCATE);
+  }
+  cout.rdbuf(test.orig_buf);
+
+  unsigned long maxChildren = 0;
+  passivedouble maxAR = 0.0;
+  coarse->ComputeAgglomerationQuality(fine, config, maxChildren, avgAR, maxAR);
+
+  parents.clear();
+  for (auto iPoint = 0ul; iPoint < fine->GetnPoint(); ++iPoint)
+    parents.push_back(fine->nodes->GetParent_CV(iPoint));
+  return coarse->GetnPoint();
+}
+
+}
+
+TEST_CASE("Serial multigrid agglomeration", "[Geometry]"){
+
+  vector<unsigned long> parents;
+  passivedouble avgAR = 0.0;
+  const auto nCoarse = AgglomerateBox(0, omp_get_max_threads(), parents, avgAR);
+
+  unsigned long checksum = 0;
+  for (auto iPoint = 0ul; iPoint < parents.size(); ++iPoint) checksum += (iPoint+1) * parents[iPoint];
+
+  /*--- By default the coarse grid is that of version 7.1.1 (the blocks are opt-in). ---*/
+  CHECK(nCoarse == 2479);
+  CHECK(checksum == 161852449973ul);
+
+}
+
+TEST_CASE("Threaded multigrid agglomeration", "[Geometry]"){
+
+  const auto maxThreads = omp_get_max_threads();
+  vector<unsigned long> parentsSerial, parents1, parentsN;
+  passivedouble avgARSerial = 0.0, avgAR1 = 0.0, avgARN = 0.0;
+  const auto nCoarseSerial = AgglomerateBox(0, 1, parentsSerial, avgARSerial);
+  const auto nCoarse1 = AgglomerateBox(4096, 1, parents1, avgAR1);
+  const auto nCoarseN = AgglomerateBox(4096, max(4, maxThreads), parentsN, avgARN);
+  omp_set_num_threads(maxThreads);
+
+  /*--- The coarse grid cannot depend on the number of threads. ---*/
+  CHECK(nCoarse1 == nCoarseN);
+  CHECK(parents1 == parentsN);
+  CHECK(avgAR1 == avgARN);
+
+  /*--- The blocks change the coarse grid, but the coarsening ratio and the shape of the
+   *    agglomerates must be close to those of the serial agglomeration. ---*/
+  CHECK(parents1 != parentsSerial);
+  CHECK(nCoarse1 == Approx(nCoarseSerial).epsilon(0.02));
+  CHECK(avgAR1 == Approx(avgARSerial).epsilon(0.02));
+
+}
+
+TEST_CASE("Geometry cache", "[Geometry]"){
+
+  UnitQuadTestCase test;
+  test.AddOption("GEOMETRY_CACHE= YES");
+  test.AddOption("GEOMETRY_CACHE_FILENAME= unit_test_geometry_cache");
+  test.InitConfig();
+  auto config = test.config.get();
+
+  cout.rdbuf(nullptr);
+  auto aux = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config, 0, 1));
+  {
+    CGeometryCache cache(config, aux.get());
+    remove(cache.GetFileName().c_str());
+  }
+  CGeometryCache cache(config, aux.get());
+  CHECK_FALSE(cache.LoadPartition(aux.get()));
+
+  /*--- Arbitrary colors (only one rank is used in this test). ---*/
+  for (auto iPoint = 0ul; iPoint < aux->GetnPoint(); ++iPoint) aux->nodes->SetColor(iPoint, 0);
+  cache.SavePartition(aux.get());
+
+  auto geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux.get(), config));
+  CHECK_FALSE(cache.LoadWallDistance(geometry.get()));
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+    geometry->nodes->SetWall_Distance(iPoint, 0.5*geometry->nodes->GetGlobalIndex(iPoint));
+  cache.SaveWallDistance(geometry.get());
+
+  /*--- A new run with the same mesh finds the data. ---*/
+  auto aux2 = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config, 0, 1));
+  CGeometryCache cache2(config, aux2.get());
+  for (auto iPoint = 0ul; iPoint < aux2->GetnPoint(); ++iPoint) aux2->nodes->SetColor(iPoint, 1);
+  CHECK(cache2.LoadPartition(aux2.get()));
+
+  bool sameColors = true;
+  for (auto iPoint = 0ul; iPoint < aux2->GetnPoint(); ++iPoint)
+    sameColors &= (aux2->nodes->GetColor(iPoint) == aux->nodes->GetColor(iPoint));
+  CHECK(sameColors);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) geometry->nodes->SetWall_Distance(iPoint, -1.0);
+  CHECK(cache2.LoadWallDistance(geometry.get()));
+
+  bool sameDistance = true;
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+    sameDistance &= (geometry->nodes->GetWall_Distance(iPoint) == 0.5*geometry->nodes->GetGlobalIndex(iPoint));
+  CHECK(sameDistance);
+
+  /*--- Nor does a different solver on the same mesh. ---*/
+  UnitQuadTestCase testRANS;
+  const std::string solver = "SOLVER= NAVIER_STOKES";
+  testRANS.config_options.replace(testRANS.config_options.find(solver), solver.size(), "SOLVER= RANS\nKIND_TURB_MODEL= SA");
+  testRANS.AddOption("GEOMETRY_CACHE= YES");
+  testRANS.AddOption("GEOMETRY_CACHE_FILENAME= unit_test_geometry_cache");
+  testRANS.InitConfig();
+  cout.rdbuf(nullptr);
+  auto auxRANS = std::unique_ptr<CGeometry>(new CPhysicalGeometry(testRANS.config.get(), 0, 1));
+  CGeometryCache cacheRANS(testRANS.config.get(), auxRANS.get());
+  CHECK_FALSE(cacheRANS.LoadPartition(auxRANS.get()));
+
+  /*--- A different mesh does not. ---*/
+  aux2->nodes->SetCoord(0, 0, 1e-3);
+  CGeometryCache cache3(config, aux2.get());
+  CHECK_FALSE(cache3.LoadPartition(aux2.get()));
+  CHECK_FALSE(cache3.LoadWallDistance(geometry.get()));
+  cout.rdbuf(test.orig_buf);
+
+  remove(cache.GetFileName().c_str());
+}
+
+TEST_CASE("Geometry cache of the periodic matching", "[Geometry]"){
+
+  /*--- The x faces of the box are periodic, "translation" is the distance between them. ---*/
+  auto periodicCase = [](const std::string& translation) {
+    auto test = std::unique_ptr<UnitQuadTestCase>(new UnitQuadTestCase);
+    const std::string custom = "MARKER_CUSTOM= ( x_minus, x_plus, z_plus, z_minus)";
+    test->config_options.replace(test->config_options.find(custom), custom.size(), "MARKER_CUSTOM= ( z_plus, z_minus)");
+    test->AddOption("MARKER_PERIODIC= ( x_minus, x_plus, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, " + translation + ", 0.0, 0.0 )");
+    test->AddOption("GEOMETRY_CACHE= YES");
+    test->AddOption("GEOMETRY_CACHE_FILENAME= unit_test_periodic_cache");
+    test->InitConfig();
+    test->InitGeometry();
+    return test;
+  };
+  auto test = periodicCase("1.0");
+  auto config = test->config.get();
+  auto geometry = test->geometry.get();
+
+  /*--- Donor data of the vertices of the periodic markers. ---*/
+  auto donors = [&]() {
+    vector<vector<long> > data;
+    for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+      if (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY) continue;
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        const auto vertex = geometry->vertex[iMarker][iVertex];
+        data.push_back({vertex->GetNode(), vertex->GetDonorPoint(), vertex->GetDonorGlobalIndex(),
+                        vertex->GetDonorVertex(), vertex->GetDonorMarker(), vertex->GetDonorProcessor()});
+      }
+    }
+    return data;
+  };
+
+  cout.rdbuf(nullptr);
+  auto aux = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config, 0, 1));
+  {
+    CGeometryCache cache(config, aux.get());
+    remove(cache.GetFileName().c_str());
+  }
+  CGeometryCache cache(config, aux.get());
+  for (auto iPoint = 0ul; iPoint < aux->GetnPoint(); ++iPoint) aux->nodes->SetColor(iPoint, 0);
+  cache.SavePartition(aux.get());
+  CHECK_FALSE(cache.LoadPeriodic(geometry, config));
+
+  geometry->MatchPeriodic(config, 1);
+  const auto matched = donors();
+  cache.SavePeriodic(geometry, config);
+
+  /*--- Each point is matched with the point at the same (y,z) on the other face. ---*/
+  REQUIRE(matched.size() == 50);
+  bool goodMatch = true;
+  for (const auto& donor : matched) {
+    const auto iPoint = donor[0], jPoint = donor[1];
+    goodMatch &= (fabs(geometry->nodes->GetCoord(iPoint,0) - geometry->nodes->GetCoord(jPoint,0)) == 1.0);
+    goodMatch &= (geometry->nodes->GetCoord(iPoint,1) == geometry->nodes->GetCoord(jPoint,1));
+    goodMatch &= (geometry->nodes->GetCoord(iPoint,2) == geometry->nodes->GetCoord(jPoint,2));
+  }
+  CHECK(goodMatch);
+
+  /*--- A new run finds the same donors in the cache. ---*/
+  for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker)
+    for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex)
+      geometry->vertex[iMarker][iVertex]->SetDonorPoint(-1, -1, -1, -1, -1);
+
+  CGeometryCache cache2(config, aux.get());
+  CHECK(cache2.LoadPeriodic(geometry, config));
+  CHECK(donors() == matched);
+
+  /*--- Not if the periodic transformation changes. ---*/
+  auto test2 = periodicCase("2.0");
+  cout.rdbuf(nullptr);
+  auto aux2 = std::unique_ptr<CGeometry>(new CPhysicalGeometry(test2->config.get(), 0, 1));
+  CGeometryCache cache3(test2->config.get(), aux2.get());
+  CHECK_FALSE(cache3.LoadPeriodic(test2->geometry.get(), test2->config.get()));
+  cout.rdbuf(test->orig_buf);
+
+  remove(cache.GetFileName().c_str());
+}
@@ -29,6 +29,8 @@
 #include <sstream>
 #include "../../../Common/include/geometry/primal_grid/CPrimalGrid.hpp"
 #include "../../../Common/include/geometry/primal_grid/CHexahedron.hpp"
+#include "../../../Common/include/geometry/primal_grid/CTetrahedron.hpp"
+#include "../../../Common/include/geometry/primal_grid/CPrimalGridStore.hpp"
 
 TEST_CASE("Center of gravity computation", "[Primal Grid]") {
 
@@ -64,3 +66,53 @@ TEST_CASE("Center of gravity computation", "[Primal Grid]") {
   delete [] coordinates;
   
 }
+
+TEST_CASE("Flat storage of primal grid elements", "[Primal Grid]") {
+
+  CPrimalGrid* elem[3];
+  elem[0] = new CTetrahedron(0,1,2,3);
+  elem[1] = new CHexahedron(10,11,12,13,14,15,16,17);
+  elem[2] = new CTetrahedron(4,5,6,7);
+  for (unsigned long i = 0; i < 3; ++i) elem[i]->SetGlobalIndex(100+i);
+
+  CPrimalGridStore store;
+  store.Build(elem, 3);
+
+  REQUIRE(store.GetnElem() == 3);
+  REQUIRE(store.GetElemOfType(TETRAHEDRON) == vector<unsigned long>({0,2}));
+  REQUIRE(store.GetElemOfType(HEXAHEDRON) == vector<unsigned long>({1}));
+  REQUIRE(store.GetElemOfType(PRISM).empty());
+
+  /*--- The views must be indistinguishable from the elements. ---*/
+  for (unsigned long iElem = 0; iElem < 3; ++iElem) {
+    const auto view = store[iElem];
+    REQUIRE(view.GetVTK_Type() == elem[iElem]->GetVTK_Type());
+    REQUIRE(view.GetnNodes() == elem[iElem]->GetnNodes());
+    REQUIRE(view.GetnFaces() == elem[iElem]->GetnFaces());
+    REQUIRE(store.GetGlobalIndex(iElem) == elem[iElem]->GetGlobalIndex());
+
+    for (unsigned short iNode = 0; iNode < view.GetnNodes(); ++iNode)
+      REQUIRE(view.GetNode(iNode) == elem[iElem]->GetNode(iNode));
+
+    for (unsigned short iFace = 0; iFace < view.GetnFaces(); ++iFace) {
+      REQUIRE(view.GetnNodesFace(iFace) == elem[iElem]->GetnNodesFace(iFace));
+      for (unsigned short iNode = 0; iNode < view.GetnNodesFace(iFace); ++iNode)
+        REQUIRE(view.GetFaces(iFace, iNode) == elem[iElem]->GetFaces(iFace, iNode));
+    }
+  }
+
+  /*--- The store owns the nodes, changes made through the elements are seen by it. ---*/
+  elem[0]->Change_Orientation();
+  elem[1]->SetNode(7, 42);
+  REQUIRE(store.GetNode(0, 0) == 1);
+  REQUIRE(store.GetNode(0, 1) == 0);
+  REQUIRE(store.GetNode(1, 7) == 42);
+
+  /*--- Rebuilding moves the nodes to the new storage without losing them. ---*/
+  store.Build(elem, 3);
+  REQUIRE(store.GetNode(1, 7) == 42);
+  elem[2]->SetNode(3, 8);
+  REQUIRE(store.GetNode(2, 3) == 8);
+
+  for (auto e : elem) delete e;
+}
@@ -0,0 +1,72 @@
+/*!
+ * \file CFreeFormBlending_tests.cpp
+ * \brief Unit tests comparing the tabulated FFD blending functions with the per-point evaluation.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <vector>
+#include "../../../Common/include/grid_movement/CBSplineBlending.hpp"
+#include "../../../Common/include/grid_movement/CBezierBlending.hpp"
+
+namespace {
+
+/*--- GetBasisTable must reproduce GetBasis and GetDerivative for every basis function. ---*/
+void CompareWithPerPoint(CFreeFormBlending& blending, unsigned short nBasis, unsigned short maxDer) {
+
+  const su2double params[] = {0.0, 1e-8, 0.1, 0.25, 1.0/3.0, 0.5, 0.61, 0.75, 0.9, 1.0-1e-8};
+
+  std::vector<su2double> basis(nBasis), der1(nBasis), der2(nBasis);
+
+  for (auto t : params) {
+    blending.GetBasisTable(t, nBasis, basis.data(), der1.data(), (maxDer > 1)? der2.data() : nullptr);
+
+    for (unsigned short i = 0; i < nBasis; ++i) {
+      CHECK(SU2_TYPE::GetValue(basis[i]) == Approx(SU2_TYPE::GetValue(blending.GetBasis(i, t))).margin(1e-13));
+      CHECK(SU2_TYPE::GetValue(der1[i]) == Approx(SU2_TYPE::GetValue(blending.GetDerivative(i, t, 1))).margin(1e-11));
+      if (maxDer > 1)
+        CHECK(SU2_TYPE::GetValue(der2[i]) == Approx(SU2_TYPE::GetValue(blending.GetDerivative(i, t, 2))).margin(1e-9));
+    }
+  }
+}
+
+}
+
+TEST_CASE("BSpline basis table", "[FFD]") {
+
+  for (short order = 2; order <= 5; ++order) {
+    for (short nControl = order; nControl <= order+4; ++nControl) {
+      CBSplineBlending blending(order, nControl);
+      CompareWithPerPoint(blending, nControl, (order > 2)? 2 : 1);
+    }
+  }
+}
+
+TEST_CASE("Bezier basis table", "[FFD]") {
+
+  for (short order = 3; order <= 8; ++order) {
+    CBezierBlending blending(order, order);
+    CompareWithPerPoint(blending, order, 2);
+  }
+}
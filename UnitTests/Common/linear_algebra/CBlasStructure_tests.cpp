@@ -0,0 +1,157 @@
+/*!
+ * \file CBlasStructure_tests.cpp
+ * \brief Unit tests and micro-benchmark for the small matrix product kernels
+ *        of CBlasStructure, using the matrices of the FEM standard elements.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+namespace {
+
+/*--- The standard volume elements and the range of polynomial degrees considered. ---*/
+const unsigned short elemTypes[] = {LINE, TRIANGLE, QUADRILATERAL, TETRAHEDRON,
+                                    PYRAMID, PRISM, HEXAHEDRON};
+const char* elemNames[] = {"Line", "Triangle", "Quadrilateral", "Tetrahedron",
+                           "Pyramid", "Prism", "Hexahedron"};
+const unsigned short nPolyMax = 5;
+
+/*--- Reference implementation of C = op(A)*B, row major. ---*/
+void ReferenceGemm(int M, int N, int K, const su2double *A, const su2double *B,
+                   su2double *C, bool transA) {
+  for (int i = 0; i < M; ++i) {
+    for (int j = 0; j < N; ++j) {
+      su2double c = 0.0;
+      for (int k = 0; k < K; ++k) c += (transA ? A[k*M+i] : A[i*K+k]) * B[k*N+j];
+      C[i*N+j] = c;
+    }
+  }
+}
+
+/*--- Deterministic data for the B matrices. ---*/
+void FillMatrix(vector<su2double>& B) {
+  for (size_t i = 0; i < B.size(); ++i) B[i] = sin(0.1*i + 0.3);
+}
+
+}
+
+TEST_CASE("Small GEMM kernels for the standard elements", "[BLAS]") {
+
+  CBlasStructure blas;
+
+  /*--- Number of columns, i.e. nVar, padded sizes and a size without a specialized kernel. ---*/
+  const int nCols[] = {4, 5, 8, 13, 40};
+
+  for (auto VTK_Type : elemTypes) {
+    for (unsigned short nPoly = 1; nPoly <= nPolyMax; ++nPoly) {
+
+      /*--- Specifying the order of the integration rule avoids the need of a config. ---*/
+      CFEMStandardElement elem(VTK_Type, nPoly, true, nullptr, 2*nPoly);
+
+      const int M = elem.GetNIntegration();
+      const int K = elem.GetNDOFs();
+      const su2double* A = elem.GetBasisFunctionsIntegration();
+      const su2double* AT = elem.GetBasisFunctionsIntegrationTrans();
+
+      for (int N : nCols) {
+        vector<su2double> B(K*N), C(M*N), CT(M*N), ref(M*N);
+        FillMatrix(B);
+
+        blas.gemm(M, N, K, A, B.data(), C.data(), nullptr);
+        blas.gemm(M, N, K, AT, B.data(), CT.data(), nullptr, true);
+        ReferenceGemm(M, N, K, A, B.data(), ref.data(), false);
+
+        passivedouble maxDiff = 0.0, maxDiffTrans = 0.0;
+        for (int i = 0; i < M*N; ++i) {
+          maxDiff = max(maxDiff, fabs(SU2_TYPE::GetValue(C[i] - ref[i])));
+          maxDiffTrans = max(maxDiffTrans, fabs(SU2_TYPE::GetValue(CT[i] - ref[i])));
+        }
+        CHECK(maxDiff < 1e-12);
+        CHECK(maxDiffTrans < 1e-12);
+      }
+    }
+  }
+}
+
+TEST_CASE("Small GEMM kernels micro-benchmark", "[.][benchmark][BLAS]") {
+
+  /*--- Hidden test case, run it with "test_driver [benchmark]". For every standard
+   *    element and polynomial degree the solution of nVar=5 variables of a number
+   *    of elements is interpolated to the integration points element by element,
+   *    with gemm and with the reference loops. ---*/
+
+  CBlasStructure blas;
+  using Clock = std::chrono::steady_clock;
+
+  const int N = 5, nElem = 2000, nRepeat = 5;
+
+  cout << "\n" << setw(14) << "Element" << setw(3) << "p" << setw(6) << "M" << setw(6) << "K"
+       << setw(16) << "reference [ns]" << setw(14) << "gemm [ns]" << endl;
+
+  for (unsigned short iType = 0; iType < sizeof(elemTypes)/sizeof(elemTypes[0]); ++iType) {
+    for (unsigned short nPoly = 1; nPoly <= nPolyMax; ++nPoly) {
+
+      CFEMStandardElement elem(elemTypes[iType], nPoly, true, nullptr, 2*nPoly);
+
+      const int M = elem.GetNIntegration();
+      const int K = elem.GetNDOFs();
+      const su2double* A = elem.GetBasisFunctionsIntegration();
+
+      vector<su2double> B(nElem*K*N), C(nElem*M*N);
+      FillMatrix(B);
+
+      /*--- Time per matrix product in ns, best of nRepeat. ---*/
+      auto timeIt = [&](const std::function<void()>& fun) {
+        double best = 1e30;
+        for (int r = 0; r < nRepeat; ++r) {
+          const auto start = Clock::now();
+          fun();
+          const std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+          best = min(best, elapsed.count()/nElem);
+        }
+        return best;
+      };
+
+      const double tRef = timeIt([&]() {
+        for (int l = 0; l < nElem; ++l)
+          ReferenceGemm(M, N, K, A, B.data()+l*K*N, C.data()+l*M*N, false);
+      });
+
+      const double tGemm = timeIt([&]() {
+        for (int l = 0; l < nElem; ++l)
+          blas.gemm(M, N, K, A, B.data()+l*K*N, C.data()+l*M*N, nullptr);
+      });
+
+      cout << setw(14) << elemNames[iType] << setw(3) << nPoly << setw(6) << M << setw(6) << K
+           << setw(16) << tRef << setw(14) << tGemm << endl;
+
+      CHECK(tGemm > 0.0);
+    }
+  }
+}
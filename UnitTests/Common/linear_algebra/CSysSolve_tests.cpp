@@ -0,0 +1,129 @@
+/*!
+ * \file CSysSolve_tests.cpp
+ * \brief Unit tests of the coarse multigrid level smoother of the linear solvers.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+namespace {
+
+/*--- Solves a shifted graph Laplacian, on the matrix of a flow solver (relaxed by the
+ *    coarse level smoother) or of another solver, returns the number of iterations. ---*/
+unsigned long SolveLaplacian(CGeometry* geometry, const CConfig* config, bool flow, su2double& residual) {
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+
+  CSysMatrix<su2double> matrix;
+  matrix.Initialize(nPoint, nPointDomain, 1, 1, true, geometry, config, false, flow);
+
+  const su2double diag = 1.0, offDiag = -1.0;
+  for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+    const auto iPoint = geometry->edges->GetNode(iEdge,0);
+    const auto jPoint = geometry->edges->GetNode(iEdge,1);
+    matrix.AddBlock(iPoint, iPoint, &diag);
+    matrix.AddBlock(jPoint, jPoint, &diag);
+    matrix.AddBlock(iPoint, jPoint, &offDiag);
+    matrix.AddBlock(jPoint, iPoint, &offDiag);
+  }
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) matrix.AddVal2Diag(iPoint, 0.1);
+
+  CSysVector<su2double> rhs(nPoint, nPointDomain, 1, 1.0), sol(nPoint, nPointDomain, 1, 0.0);
+
+  CSysSolve<su2double> system;
+  system.SetMGCoarseSmoother(flow);
+  const auto iters = system.Solve(matrix, rhs, sol, geometry, config);
+  residual = system.GetResidual();
+  return iters;
+}
+
+/*--- Box with one multigrid level, the geometry is used as the coarse level. ---*/
+void InitTestCase(UnitQuadTestCase& test, const string& cycle) {
+  test.config_options =
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= BOX\n"
+      "MACH_NUMBER= 0.5\n"
+      "MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus, z_minus, z_plus )\n"
+      "MESH_BOX_SIZE= 5,5,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "MGLEVEL= 1\n"
+      "MGCYCLE= " + cycle + "\n"
+      "MG_COARSE_SMOOTHER= JACOBI\n"
+      "MG_COARSE_SMOOTHER_ITER= 3\n"
+      "LINEAR_SOLVER= FGMRES\n"
+      "LINEAR_SOLVER_PREC= ILU\n"
+      "LINEAR_SOLVER_ERROR= 1E-10\n"
+      "LINEAR_SOLVER_ITER= 100\n"
+      "REF_ORIGIN_MOMENT_X= 0.0\n"
+      "REF_ORIGIN_MOMENT_Y= 0.0\n"
+      "REF_ORIGIN_MOMENT_Z= 0.0\n";
+  test.InitConfig();
+  test.InitGeometry();
+  test.geometry->SetMGLevel(MESH_1);
+}
+
+}
+
+TEST_CASE("Coarse level smoother only for the flow solvers", "[Linear Algebra]") {
+
+  UnitQuadTestCase test;
+  InitTestCase(test, "V_CYCLE");
+  const auto tol = test.config->GetLinear_Solver_Error();
+  su2double residual = 0.0;
+
+  /*--- The flow is relaxed with the sweeps of the smoother. ---*/
+
+  CHECK(SolveLaplacian(test.geometry.get(), test.config.get(), true, residual) == 3);
+  CHECK(residual > tol);
+
+  /*--- Other solvers (e.g. turbulence) are solved with the linear solver of the fine level. ---*/
+
+  SolveLaplacian(test.geometry.get(), test.config.get(), false, residual);
+  CHECK(residual <= tol);
+}
+
+TEST_CASE("Coarse level smoother with full multigrid", "[Linear Algebra]") {
+
+  UnitQuadTestCase test;
+  InitTestCase(test, "FULLMG_CYCLE");
+  const auto tol = test.config->GetLinear_Solver_Error();
+  su2double residual = 0.0;
+
+  /*--- While the coarse level is the finest one it is solved (the matrix also has the ILU storage). ---*/
+
+  REQUIRE(test.config->GetFinestMesh() == MESH_1);
+  SolveLaplacian(test.geometry.get(), test.config.get(), true, residual);
+  CHECK(residual <= tol);
+
+  /*--- Then it is a coarse level of the cycle. ---*/
+
+  test.config->SetFinestMesh(MESH_0);
+  CHECK(SolveLaplacian(test.geometry.get(), test.config.get(), true, residual) == 3);
+  CHECK(residual > tol);
+}
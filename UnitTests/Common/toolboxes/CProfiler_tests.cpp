@@ -0,0 +1,91 @@
+/*!
+ * \file CProfiler_tests.cpp
+ * \brief Unit tests for the scoped-region profiler.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+
+namespace {
+
+void Inner() {
+  SU2_PROFILE_SCOPE("ProfilerTest_Inner");
+}
+
+void Outer(int nInner) {
+  SU2_PROFILE_SCOPE("ProfilerTest_Outer");
+  for (int i = 0; i < nInner; ++i) Inner();
+}
+
+}
+
+TEST_CASE("Scoped-region profiler", "[Toolboxes]") {
+
+  /*--- Nothing is recorded while disabled. ---*/
+  Outer(1);
+
+  CProfiler::Enable(true);
+  Outer(3);
+  Outer(2);
+  CProfiler::Disable();
+
+  /*--- Nor after disabling. ---*/
+  Outer(1);
+
+  CHECK(CProfiler::RegisterRegion("ProfilerTest_Inner") == CProfiler::RegisterRegion("ProfilerTest_Inner"));
+
+  const std::string fileName = "profiler_unit_test";
+  CProfiler::WriteSummary(fileName);
+  CProfiler::WriteChromeTrace(fileName);
+
+  /*--- Check the hierarchy and the call counts. ---*/
+  std::ifstream csv(fileName + ".csv");
+  std::string line;
+  std::getline(csv, line);
+  std::getline(csv, line);
+  CHECK(line.find("\"ProfilerTest_Outer\",\"\",0,2,") == 0);
+  std::getline(csv, line);
+  CHECK(line.find("\"ProfilerTest_Inner\",\"ProfilerTest_Outer\",1,5,") == 0);
+  csv.close();
+
+  /*--- One event per call, plus the process name. ---*/
+  std::ifstream json(fileName + ".json");
+  std::stringstream trace;
+  trace << json.rdbuf();
+  json.close();
+  const auto text = trace.str();
+  int nEvents = 0;
+  for (auto pos = text.find("\"ph\":\"X\""); pos != std::string::npos; pos = text.find("\"ph\":\"X\"", pos+1)) ++nEvents;
+  CHECK(nEvents == 7);
+  CHECK(text.find('[') == 0);
+  CHECK(text.find(']') != std::string::npos);
+
+  std::remove((fileName + ".csv").c_str());
+  std::remove((fileName + ".json").c_str());
+}
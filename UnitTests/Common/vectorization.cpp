@@ -80,5 +80,13 @@ TEST_CASE("SIMD DOUBLE", "[Vectorization]") {
 
   Double t = sqrt(pow(B,2)*C + D*y + A+x);
   CHECK(t[1] == 7);
+
+  /*--- Element-wise functions, also on the generic (expression template) arrays. ---*/
+  Double u = log(exp(D) * C);
+  CHECK(u[0] == Approx(2 + log(5.0)));
+
+  simd::Array<double,1> v = 2.0;
+  v = exp(log(v) * y);
+  CHECK(v[0] == Approx(4.0));
 }
 
@@ -0,0 +1,48 @@
+/*!
+ * \file CDriver_tests.cpp
+ * \brief Unit tests for the distribution of ranks over concurrent zones.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/drivers/CDriver.hpp"
+
+TEST_CASE("Distribution of ranks over concurrent zones", "[Drivers]") {
+
+  /*--- One rank per zone, regardless of the weights. ---*/
+  auto offset = CDriver::DistributeZoneRanks({1.0, 100.0, 10.0}, 3);
+  REQUIRE(offset == vector<int>({0, 1, 2, 3}));
+
+  /*--- Proportional to the weights when they divide the ranks evenly. ---*/
+  offset = CDriver::DistributeZoneRanks({3.0, 1.0}, 8);
+  REQUIRE(offset == vector<int>({0, 6, 8}));
+
+  /*--- The cost of the slowest zone is minimized, equal weights split evenly. ---*/
+  offset = CDriver::DistributeZoneRanks({1.0, 1.0, 1.0}, 7);
+  REQUIRE(offset == vector<int>({0, 3, 5, 7}));
+
+  /*--- A tiny zone still gets one rank. ---*/
+  offset = CDriver::DistributeZoneRanks({1e6, 1.0}, 16);
+  REQUIRE(offset == vector<int>({0, 15, 16}));
+}
@@ -0,0 +1,135 @@
+/*!
+ * \file CFluidModel_tests.cpp
+ * \brief Unit tests for the batched evaluation of the fluid models.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/fluid/CIdealGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CVanDerWaalsGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CPengRobinson.hpp"
+#include "../../../SU2_CFD/include/fluid/CLookUpTableGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CConstantDensity.hpp"
+#include "../../../SU2_CFD/include/fluid/CIncIdealGas.hpp"
+
+namespace {
+
+/*--- The batch must give the same result as the point-by-point evaluation, for sizes that are not
+ *    multiples of the SIMD length (to exercise the remainder loop). ---*/
+void CheckBatch(CFluidModel& model, su2double rhoMin, su2double rhoMax, su2double eMin, su2double eMax) {
+
+  const unsigned long n = 4*simd::preferredLen<su2double>() + 3;
+  vector<su2double> rho(n), e(n), P(n), T(n), c2(n), s(n), dPdrho(n), dPde(n), dTde(n), cp(n), cv(n);
+
+  for (auto i = 0ul; i < n; ++i) {
+    rho[i] = rhoMin + (rhoMax-rhoMin) * i / (n-1);
+    e[i] = eMax - (eMax-eMin) * i / (n-1);
+  }
+
+  CFluidStateBatch state;
+  state.Pressure = P.data();
+  state.Temperature = T.data();
+  state.SoundSpeed2 = c2.data();
+  state.Entropy = s.data();
+  state.dPdrho_e = dPdrho.data();
+  state.dPde_rho = dPde.data();
+  state.dTde_rho = dTde.data();
+  state.Cp = cp.data();
+  state.Cv = cv.data();
+
+  /*--- The batch does not modify the object, set it to an unrelated state to check. ---*/
+  model.SetTDState_rhoe(rhoMax, eMin);
+  const su2double P0 = model.GetPressure();
+
+  CHECK(model.ComputeTDState_rhoe(n, rho.data(), e.data(), state) == 0);
+  CHECK(model.GetPressure() == P0);
+
+  for (auto i = 0ul; i < n; ++i) {
+    model.SetTDState_rhoe(rho[i], e[i]);
+    CHECK(P[i] == Approx(model.GetPressure()));
+    CHECK(T[i] == Approx(model.GetTemperature()));
+    CHECK(c2[i] == Approx(model.GetSoundSpeed2()));
+    CHECK(s[i] == Approx(model.GetEntropy()));
+    CHECK(dPdrho[i] == Approx(model.GetdPdrho_e()));
+    CHECK(dPde[i] == Approx(model.GetdPde_rho()));
+    CHECK(dTde[i] == Approx(model.GetdTde_rho()));
+    CHECK(cp[i] == Approx(model.GetCp()));
+    CHECK(cv[i] == Approx(model.GetCv()));
+  }
+}
+
+/*--- Same for the incompressible models, functions of temperature only. ---*/
+void CheckBatch_T(CFluidModel& model, su2double TMin, su2double TMax) {
+
+  const unsigned long n = 13;
+  vector<su2double> T(n), rho(n), cp(n), cv(n);
+
+  for (auto i = 0ul; i < n; ++i) T[i] = TMin + (TMax-TMin) * i / (n-1);
+
+  CFluidStateBatch state;
+  state.Density = rho.data();
+  state.Cp = cp.data();
+  state.Cv = cv.data();
+
+  model.SetTDState_T(TMax);
+  const su2double rho0 = model.GetDensity();
+
+  model.ComputeTDState_T(n, T.data(), state);
+  CHECK(model.GetDensity() == rho0);
+
+  for (auto i = 0ul; i < n; ++i) {
+    model.SetTDState_T(T[i]);
+    CHECK(rho[i] == Approx(model.GetDensity()));
+    CHECK(cp[i] == Approx(model.GetCp()));
+    CHECK(cv[i] == Approx(model.GetCv()));
+  }
+}
+
+}
+
+TEST_CASE("Batched fluid models", "[FluidModel]") {
+
+  CIdealGas idealGas(1.4, 287.058);
+  CheckBatch(idealGas, 0.1, 2.0, 1.5e5, 3e5);
+
+  /*--- Siloxane MDM in the dense vapor region. ---*/
+
+  CVanDerWaalsGas vanDerWaals(1.0165, 35.17, 1.415e6, 564.1);
+  CheckBatch(vanDerWaals, 1.0, 150.0, 1.25e6, 1.45e6);
+
+  CPengRobinson pengRobinson(1.0165, 35.17, 1.415e6, 564.1, 0.529);
+  CheckBatch(pengRobinson, 1.0, 150.0, 1.25e6, 1.45e6);
+
+  CLookUpTableGas lookUpTable(make_shared<CFluidTable>(pengRobinson, 1.0, 150.0, 580.0, 700.0, 20, 20));
+  CheckBatch(lookUpTable, 1.0, 150.0, 1.25e6, 1.45e6);
+}
+
+TEST_CASE("Batched incompressible fluid models", "[FluidModel]") {
+
+  CConstantDensity constantDensity(998.2, 4182.0);
+  CheckBatch_T(constantDensity, 280.0, 360.0);
+
+  CIncIdealGas incIdealGas(1004.703, 287.058, 101325.0);
+  CheckBatch_T(incIdealGas, 280.0, 360.0);
+}
@@ -0,0 +1,336 @@
+/*!
+ * \file CLookUpTableGas_tests.cpp
+ * \brief Accuracy and consistency tests (and throughput benchmark) of the look-up table fluid model.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <chrono>
+#include <cstdio>
+#include <sstream>
+#include "../../../SU2_CFD/include/fluid/CLookUpTableGas.hpp"
+#include "../../../SU2_CFD/include/fluid/CPengRobinson.hpp"
+#include "../../UnitQuadTestCase.hpp"
+
+namespace {
+
+/*--- Siloxane MDM (typical ORC working fluid), dense vapor region. ---*/
+const su2double gammaMDM = 1.0165, gasConst = 35.17, pCrit = 1.415e6, tCrit = 564.1, acentric = 0.529;
+
+const su2double rhoMin = 1.0, rhoMax = 200.0, TMin = 580.0, TMax = 700.0;
+
+su2double RelError(su2double a, su2double b) { return fabs(a-b) / fabs(b); }
+
+/*--- Quasi-random states (rho, T) inside the table, away from the temperature limits. ---*/
+template<class F>
+void ForEachState(int n, F&& f) {
+  for (int i = 0; i < n; ++i) {
+    const su2double x = fmod(0.5 + i*0.6180339887, 1.0), y = fmod(0.5 + i*0.7548776662, 1.0);
+    f(rhoMin * pow(rhoMax/rhoMin, x), TMin + 10.0 + y*(TMax - TMin - 20.0));
+  }
+}
+
+}
+
+TEST_CASE("LUT fluid model accuracy", "[FluidModel]") {
+
+  CPengRobinson model(gammaMDM, gasConst, pCrit, tCrit, acentric);
+  auto table = make_shared<CFluidTable>(model, rhoMin, rhoMax, TMin, TMax, 200, 200);
+  CLookUpTableGas lut(table);
+
+  /*--- Interpolation of the primary (rho, e) input pair. ---*/
+
+  su2double maxErrP = 0.0, maxErrT = 0.0, maxErrC = 0.0;
+
+  ForEachState(1000, [&](su2double rho, su2double T) {
+    model.SetTDState_rhoT(rho, T);
+    lut.SetTDState_rhoe(rho, model.GetStaticEnergy());
+    maxErrP = max(maxErrP, RelError(lut.GetPressure(), model.GetPressure()));
+    maxErrT = max(maxErrT, RelError(lut.GetTemperature(), model.GetTemperature()));
+    maxErrC = max(maxErrC, RelError(lut.GetSoundSpeed2(), model.GetSoundSpeed2()));
+  });
+
+  CHECK(maxErrP < 2e-4);
+  CHECK(maxErrT < 1e-5);
+  CHECK(maxErrC < 5e-4);
+}
+
+TEST_CASE("LUT fluid model inversions", "[FluidModel]") {
+
+  CPengRobinson model(gammaMDM, gasConst, pCrit, tCrit, acentric);
+  auto table = make_shared<CFluidTable>(model, rhoMin, rhoMax, TMin, TMax, 50, 50);
+  CLookUpTableGas lut(table), lut2(table);
+
+  /*--- The inverse calls must recover the (rho, e) state of the table. ---*/
+
+  su2double maxErrPT = 0.0, maxErrPrho = 0.0, maxErrrhoT = 0.0, maxErrhs = 0.0, maxErrPs = 0.0;
+
+  auto error = [&]() {
+    return max(RelError(lut2.GetDensity(), lut.GetDensity()), RelError(lut2.GetStaticEnergy(), lut.GetStaticEnergy()));
+  };
+
+  ForEachState(200, [&](su2double rho, su2double T) {
+    lut.SetTDState_rhoT(rho, T);
+    const su2double P = lut.GetPressure(), s = lut.GetEntropy();
+    const su2double h = lut.GetStaticEnergy() + P/rho;
+
+    lut2.SetTDState_PT(P, lut.GetTemperature());
+    maxErrPT = max(maxErrPT, error());
+    lut2.SetTDState_Prho(P, rho);
+    maxErrPrho = max(maxErrPrho, error());
+    lut2.SetTDState_rhoT(rho, lut.GetTemperature());
+    maxErrrhoT = max(maxErrrhoT, error());
+    lut2.SetTDState_hs(h, s);
+    maxErrhs = max(maxErrhs, error());
+    lut2.SetTDState_Ps(P, s);
+    maxErrPs = max(maxErrPs, error());
+  });
+
+  CHECK(maxErrPT < 1e-8);
+  CHECK(maxErrPrho < 1e-8);
+  CHECK(maxErrrhoT < 1e-8);
+  CHECK(maxErrhs < 1e-8);
+  CHECK(maxErrPs < 1e-8);
+
+  /*--- Derivatives for the NRBC, compare with finite differences of the table. ---*/
+
+  const su2double rho = 40.0, drho = 1e-4;
+  lut.SetTDState_rhoT(rho, 640.0);
+  const su2double P = lut.GetPressure(), dP = 1e-5*P;
+  lut.ComputeDerivativeNRBC_Prho(P, rho);
+  const su2double dhdP = lut.GetdhdP_rho(), dsdrho = lut.Getdsdrho_P();
+
+  auto enthalpy = [&](su2double p, su2double r) {
+    lut2.SetTDState_Prho(p, r);
+    return lut2.GetStaticEnergy() + p/r;
+  };
+  CHECK(RelError(dhdP, (enthalpy(P+dP, rho) - enthalpy(P-dP, rho)) / (2*dP)) < 1e-3);
+
+  lut2.SetTDState_Prho(P, rho+drho);
+  const su2double sPlus = lut2.GetEntropy();
+  lut2.SetTDState_Prho(P, rho-drho);
+  CHECK(RelError(dsdrho, (sPlus - lut2.GetEntropy()) / (2*drho)) < 1e-3);
+}
+
+TEST_CASE("LUT file and scaling", "[FluidModel]") {
+
+  CPengRobinson model(gammaMDM, gasConst, pCrit, tCrit, acentric);
+  CFluidTable table(model, rhoMin, rhoMax, TMin, TMax, 20, 30);
+
+  const std::string fileName = "unit_test_fluid_table.csv";
+  table.Write(fileName);
+  CFluidTable copy(fileName);
+  std::remove(fileName.c_str());
+
+  REQUIRE(copy.GetnDensity() == 20);
+  REQUIRE(copy.GetnEnergy() == 30);
+
+  bool same = true;
+  for (auto i = 0ul; i < 20; ++i)
+    for (auto j = 0ul; j < 30; ++j)
+      for (unsigned short iVar = 0; iVar < CFluidTable::NVAR; ++iVar)
+        same &= (copy.GetValue(i, j, iVar) == table.GetValue(i, j, iVar));
+  CHECK(same);
+
+  /*--- A scaled table gives the scaled state. ---*/
+
+  const passivedouble rhoRef = 50.0, PRef = 1e6, TRef = 500.0, eRef = PRef/rhoRef;
+  copy.Scale(rhoRef, PRef, TRef);
+
+  CLookUpTableGas lut(make_shared<const CFluidTable>(table));
+  CLookUpTableGas lutND(make_shared<const CFluidTable>(copy));
+
+  lut.SetTDState_PT(8e5, 600.0);
+  lutND.SetTDState_PT(8e5/PRef, 600.0/TRef);
+
+  CHECK(RelError(lutND.GetDensity()*rhoRef, lut.GetDensity()) < 1e-10);
+  CHECK(RelError(lutND.GetStaticEnergy()*eRef, lut.GetStaticEnergy()) < 1e-10);
+  CHECK(RelError(lutND.GetSoundSpeed2()*eRef, lut.GetSoundSpeed2()) < 1e-10);
+  CHECK(RelError(lutND.GetdPde_rho()*rhoRef, lut.GetdPde_rho()) < 1e-10);
+}
+
+TEST_CASE("LUT states outside the table", "[FluidModel]") {
+
+  CPengRobinson model(gammaMDM, gasConst, pCrit, tCrit, acentric);
+  auto table = make_shared<CFluidTable>(model, rhoMin, rhoMax, TMin, TMax, 20, 20);
+  CLookUpTableGas lut(table);
+
+  std::streambuf* orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+
+  /*--- Lookups inside the table (including its limits) are not counted. ---*/
+
+  lut.SetTDState_rhoe(rhoMin, table->GetEnergyMin());
+  lut.SetTDState_rhoe(rhoMax, table->GetEnergyMax());
+  lut.SetTDState_rhoT(40.0, 640.0);
+  CHECK(lut.GetnOutOfRange() == 0);
+  CHECK(lut.GetnNotConverged() == 0);
+
+  /*--- Outside, the state is clamped and counted. ---*/
+
+  const su2double P = lut.GetPressure();
+  lut.SetTDState_rhoe(2*rhoMax, table->GetEnergyMax());
+  CHECK(lut.GetnOutOfRange() == 1);
+  CHECK(lut.GetPressure() == Approx(table->GetValue(19, 19, CFluidTable::PRESSURE)));
+
+  su2double rho[] = {40.0, 0.5*rhoMin}, e[] = {lut.GetStaticEnergy(), table->GetEnergyMin()}, p[2];
+  CFluidStateBatch state;
+  state.Pressure = p;
+  const auto nClamped = lut.ComputeTDState_rhoe(2, rho, e, state);
+  CHECK(nClamped == 1);
+  CHECK(lut.GetnOutOfRange() == 1);
+
+  /*--- The batch only reports the clamped states, the caller counts them. ---*/
+  lut.CountOutOfRange(nClamped);
+  CHECK(lut.GetnOutOfRange() == 2);
+
+  /*--- Inversions with targets outside the table cannot converge, the last state is kept. ---*/
+
+  lut.SetTDState_PT(P, 2*TMax);
+  CHECK(lut.GetnNotConverged() == 1);
+  CHECK(lut.GetStaticEnergy() == Approx(table->GetEnergyMax()));
+
+  cout.rdbuf(orig_buf);
+}
+
+TEST_CASE("LUT tables shared by the multigrid levels", "[FluidModel]") {
+
+  UnitQuadTestCase test;
+  std::stringstream config_options;
+  config_options << "SOLVER= EULER" << std::endl;
+  config_options << "MESH_FORMAT= BOX" << std::endl;
+  config_options << "MESH_BOX_SIZE= 5,5,5" << std::endl;
+  config_options << "MESH_BOX_LENGTH= 1,1,1" << std::endl;
+  config_options << "MESH_BOX_OFFSET= 0,0,0" << std::endl;
+  config_options << "MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus, z_minus, z_plus )" << std::endl;
+  config_options << "MACH_NUMBER= 0.5" << std::endl;
+  config_options << "FREESTREAM_TEMPERATURE= 640.0" << std::endl;
+  config_options << "FREESTREAM_PRESSURE= 1E5" << std::endl;
+  config_options << "REF_DIMENSIONALIZATION= FREESTREAM_PRESS_EQ_ONE" << std::endl;
+  config_options << "FLUID_MODEL= LUT_GAS" << std::endl;
+  config_options << "CONV_NUM_METHOD_FLOW= ROE" << std::endl;
+  config_options << "LUT_BASE_MODEL= PR_GAS" << std::endl;
+  config_options << "GAMMA_VALUE= " << gammaMDM << std::endl;
+  config_options << "GAS_CONSTANT= " << gasConst << std::endl;
+  config_options << "CRITICAL_PRESSURE= " << pCrit << std::endl;
+  config_options << "CRITICAL_TEMPERATURE= " << tCrit << std::endl;
+  config_options << "ACENTRIC_FACTOR= " << acentric << std::endl;
+  config_options << "LUT_DENSITY_RANGE= (1.0, 200.0)" << std::endl;
+  config_options << "LUT_TEMPERATURE_RANGE= (580.0, 700.0)" << std::endl;
+  config_options << "LUT_SIZE= (20, 20)" << std::endl;
+  config_options << "REF_ORIGIN_MOMENT_X= 0.0" << std::endl;
+  config_options << "REF_ORIGIN_MOMENT_Y= 0.0" << std::endl;
+  config_options << "REF_ORIGIN_MOMENT_Z= 0.0" << std::endl;
+  test.config_options = config_options.str();
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto config = test.config.get();
+  auto fine = test.solver[FLOW_SOL];
+
+  /*--- A coarse level (on the same grid) uses the table of the finest one. ---*/
+
+  auto coarse = CSolverFactory::CreateSolverContainer(EULER, config, test.geometry.get(), MESH_1, fine);
+
+  weak_ptr<const CFluidTable> released;
+  {
+    const auto table = dynamic_cast<const CLookUpTableGas*>(fine->GetFluidModel())->GetTable();
+    CHECK(dynamic_cast<const CLookUpTableGas*>(coarse[FLOW_SOL]->GetFluidModel())->GetTable() == table);
+
+    /*--- In the units of the solver. ---*/
+    const auto dimensional = CLookUpTableGas::CreateTable(config);
+    CHECK(table->GetValue(3, 5, CFluidTable::PRESSURE) ==
+          Approx(dimensional->GetValue(3, 5, CFluidTable::PRESSURE) / config->GetPressure_Ref()));
+    released = table;
+  }
+
+  /*--- The table is owned by the solvers. ---*/
+
+  delete coarse[FLOW_SOL];
+  delete[] coarse;
+  CHECK_FALSE(released.expired());
+
+  delete fine;
+  test.solver[FLOW_SOL] = nullptr;
+  CHECK(released.expired());
+}
+
+TEST_CASE("LUT derivatives at non-positive densities", "[FluidModel]") {
+
+  CPengRobinson model(gammaMDM, gasConst, pCrit, tCrit, acentric);
+  CFluidTable table(model, rhoMin, rhoMax, TMin, TMax, 20, 20);
+  const su2double e = 0.5 * (table.GetEnergyMin() + table.GetEnergyMax());
+
+  /*--- The first row of the table is used, also for the derivative w.r.t. density. ---*/
+
+  su2double dPdrho_min, dPdrho, dPde;
+  const su2double P = table.Interpolate(rhoMin, e, CFluidTable::PRESSURE, dPdrho_min, dPde);
+
+  for (su2double rho : {0.0, -1.0}) {
+    CHECK(table.Interpolate(rho, e, CFluidTable::PRESSURE, dPdrho, dPde) == Approx(P));
+    CHECK(std::isfinite(SU2_TYPE::GetValue(dPdrho)));
+    CHECK(dPdrho == Approx(dPdrho_min));
+  }
+}
+
+TEST_CASE("LUT fluid model throughput", "[.][benchmark][FluidModel]") {
+
+  /*--- Not run by default, use the tag [benchmark] to run it. ---*/
+
+  using Clock = std::chrono::steady_clock;
+  CPengRobinson model(gammaMDM, gasConst, pCrit, tCrit, acentric);
+  CLookUpTableGas lut(make_shared<CFluidTable>(model, rhoMin, rhoMax, TMin, TMax, 200, 200));
+
+  const int n = 200000;
+  vector<su2double> rho, e, P, T;
+  ForEachState(n, [&](su2double r, su2double t) {
+    model.SetTDState_rhoT(r, t);
+    rho.push_back(r);
+    e.push_back(model.GetStaticEnergy());
+    P.push_back(model.GetPressure());
+    T.push_back(t);
+  });
+
+  auto time = [&](CFluidModel& fluid, int input) {
+    su2double sum = 0.0;
+    const auto start = Clock::now();
+    for (int i = 0; i < n; ++i) {
+      switch (input) {
+        case 0: fluid.SetTDState_rhoe(rho[i], e[i]); break;
+        case 1: fluid.SetTDState_rhoT(rho[i], T[i]); break;
+        default: fluid.SetTDState_PT(P[i], T[i]); break;
+      }
+      sum += fluid.GetSoundSpeed2();
+    }
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    CHECK(sum > 0.0);
+    return n / elapsed.count() / 1e6;
+  };
+
+  std::cout << "Throughput (million calls/s)  Peng-Robinson  Look-up table\n";
+  std::cout << "SetTDState_rhoe               " << time(model, 0) << "  " << time(lut, 0) << "\n";
+  std::cout << "SetTDState_rhoT               " << time(model, 1) << "  " << time(lut, 1) << "\n";
+  std::cout << "SetTDState_PT                 " << "-" << "  " << time(lut, 2) << std::endl;
+}
@@ -0,0 +1,301 @@
+/*!
+ * \file CSU2TCLib_tests.cpp
+ * \brief Consistency tests (and throughput benchmark) of the SU2TCLib finite-rate chemistry.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <chrono>
+#include <sstream>
+#include "../../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+
+namespace {
+
+/*--- 5-species air, species are N2, O2, NO, N, O. ---*/
+CConfig* Air5Config() {
+  std::stringstream config_options;
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "FLUID_MODEL= SU2_NONEQ" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+  return new CConfig(config_options, SU2_CFD, false);
+}
+
+/*--- Partially dissociated states (species-major densities) spanning the number densities of the
+ *    equilibrium constant table, and temperatures of a hypersonic shock layer. ---*/
+void MakeStates(unsigned long n, vector<su2double>& rhos, vector<su2double>& T, vector<su2double>& Tve) {
+  const su2double massFrac[] = {0.6, 0.1, 0.05, 0.15, 0.1};
+  rhos.resize(5*n);
+  T.resize(n);
+  Tve.resize(n);
+  for (auto i = 0ul; i < n; ++i) {
+    const su2double x = fmod(0.5 + i*0.6180339887, 1.0), y = fmod(0.5 + i*0.7548776662, 1.0);
+    const su2double rho = 1e-5 * pow(1e4, x);
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rhos[iSpecies*n+i] = massFrac[iSpecies] * rho;
+    T[i] = 2000.0 + 10000.0*y;
+    Tve[i] = 0.5*T[i] + 4000.0*x;
+  }
+}
+
+}
+
+TEST_CASE("SU2TCLib batched production rates", "[NEMO]") {
+
+  CConfig* config = Air5Config();
+  CSU2TCLib gas(config, 2, false);
+
+  /*--- Not a multiple of the SIMD length, to exercise the remainder loop. ---*/
+  const unsigned long n = 4*simd::preferredLen<su2double>() + 3;
+  vector<su2double> rhos, T, Tve, ws(5*n);
+  MakeStates(n, rhos, T, Tve);
+
+  gas.ComputeNetProductionRates_Batch(n, rhos.data(), T.data(), Tve.data(), ws.data());
+
+  vector<su2double> rhos_i(5);
+
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rhos_i[iSpecies] = rhos[iSpecies*n+i];
+    gas.SetTDStateRhosTTv(rhos_i, T[i], Tve[i]);
+    const auto& ws_i = gas.ComputeNetProductionRates();
+
+    /*--- Same result as point by point, and the reactions conserve mass. ---*/
+    su2double sum = 0.0, sumAbs = 0.0;
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) {
+      CHECK(ws[iSpecies*n+i] == Approx(ws_i[iSpecies]).epsilon(1e-12));
+      sum += ws[iSpecies*n+i];
+      sumAbs += fabs(ws[iSpecies*n+i]);
+    }
+    CHECK(sumAbs > 0.0);
+    CHECK(fabs(sum) < 1e-12*sumAbs);
+  }
+
+  delete config;
+}
+
+TEST_CASE("SU2TCLib source Jacobian", "[NEMO]") {
+
+  CConfig* config = Air5Config();
+  CSU2TCLib gas(config, 2, false);
+
+  const unsigned short nSpecies = 5;
+  vector<su2double> rhos, T, Tve;
+  MakeStates(20, rhos, T, Tve);
+
+  vector<su2double> rhos_i(nSpecies), source(nSpecies+1), source_p(nSpecies+1), source_m(nSpecies+1);
+  su2activematrix jacobian, dummy;
+
+  for (auto i = 0ul; i < 20; ++i) {
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies) rhos_i[iSpecies] = rhos[iSpecies*20+i];
+
+    gas.SetTDStateRhosTTv(rhos_i, T[i], Tve[i]);
+    gas.ComputeSourceJacobian(source.data(), jacobian);
+
+    /*--- Same sources as the separate calls. ---*/
+    const auto& ws = gas.ComputeNetProductionRates();
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+      CHECK(source[iSpecies] == Approx(ws[iSpecies]).epsilon(1e-12));
+    CHECK(source[nSpecies] == Approx(gas.ComputeEveSourceTerm()).epsilon(1e-12));
+
+    /*--- Reactions conserve mass, and the relaxation is stable. ---*/
+    CHECK(jacobian(nSpecies,nSpecies) < 0.0);
+
+    su2double maxErr = 0.0;
+    for (auto jSpecies = 0ul; jSpecies < nSpecies; ++jSpecies) {
+      su2double sum = 0.0, sumAbs = 0.0;
+      for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies) {
+        sum += jacobian(iSpecies,jSpecies);
+        sumAbs += fabs(jacobian(iSpecies,jSpecies));
+      }
+      CHECK(fabs(sum) <= 1e-10*sumAbs);
+
+      /*--- Production rates w.r.t. the densities (central differences at constant temperatures). ---*/
+      const su2double rho0 = rhos_i[jSpecies], delta = 1e-6*rho0;
+      rhos_i[jSpecies] = rho0 + delta;
+      gas.SetTDStateRhosTTv(rhos_i, T[i], Tve[i]);
+      gas.ComputeSourceJacobian(source_p.data(), dummy);
+      rhos_i[jSpecies] = rho0 - delta;
+      gas.SetTDStateRhosTTv(rhos_i, T[i], Tve[i]);
+      gas.ComputeSourceJacobian(source_m.data(), dummy);
+      rhos_i[jSpecies] = rho0;
+
+      for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies) {
+        const su2double fd = (source_p[iSpecies]-source_m[iSpecies]) / (2*delta);
+        maxErr = max(maxErr, fabs(fd - jacobian(iSpecies,jSpecies)) / sumAbs);
+      }
+    }
+    CHECK(maxErr < 1e-4);
+  }
+
+  delete config;
+}
+
+TEST_CASE("SU2TCLib reentrant temperatures", "[NEMO]") {
+
+  CConfig* config = Air5Config();
+  CSU2TCLib gas(config, 2, false);
+
+  const unsigned long n = 64;
+  vector<su2double> rhos, T, Tve, energies(2*n), T_kernel(n), Tve_kernel(n);
+  MakeStates(n, rhos, T, Tve);
+
+  /*--- Energies of the states, then the temperatures back point by point through the state of the object. ---*/
+  vector<su2double> rhos_i(5);
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rhos_i[iSpecies] = rhos[iSpecies*n+i];
+    gas.SetTDStateRhosTTv(rhos_i, T[i], Tve[i]);
+    const auto& e = gas.ComputeMixtureEnergies();
+    su2double rho = 0.0;
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rho += rhos_i[iSpecies];
+    energies[2*i] = rho*e[0];
+    energies[2*i+1] = rho*e[1];
+  }
+
+  /*--- All threads use the kernel of the same object concurrently. ---*/
+  SU2_OMP_PARALLEL
+  {
+    su2double rhos_k[5], eves[5];
+    SU2_OMP_FOR_STAT(1)
+    for (auto i = 0ul; i < n; ++i) {
+      for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rhos_k[iSpecies] = rhos[iSpecies*n+i];
+      gas.Temperatures(rhos_k, energies[2*i], energies[2*i+1], 0.0, eves, T_kernel[i], Tve_kernel[i]);
+    }
+  }
+
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rhos_i[iSpecies] = rhos[iSpecies*n+i];
+    const auto& temperatures = gas.ComputeTemperatures(rhos_i, energies[2*i], energies[2*i+1], 0.0);
+    CHECK(T_kernel[i] == temperatures[0]);
+    CHECK(Tve_kernel[i] == temperatures[1]);
+    CHECK(T_kernel[i] == Approx(T[i]).epsilon(1e-8));
+  }
+
+  delete config;
+}
+
+TEST_CASE("SU2TCLib equilibrium constants at the table limits", "[NEMO]") {
+
+  /*--- Below n = 1E14 1/cm^3 the constants of the first row of the table are used, the previous
+   *    implementation wrapped the (unsigned) row index and took those of the last row (1E19). ---*/
+
+  CConfig* config = Air5Config();
+  CSU2TCLib gas(config, 2, false);
+
+  const unsigned short nSpecies = 5;
+  const su2double massFrac[] = {0.6, 0.1, 0.05, 0.15, 0.1};
+  const auto& molarMass = gas.GetSpeciesMolarMass();
+
+  /*--- Number density (1/cm^3) of a unit mixture density. ---*/
+  su2double N1 = 0.0;
+  for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+    N1 += massFrac[iSpecies] / molarMass[iSpecies] * AVOGAD_CONSTANT * 1e-6;
+
+  vector<su2double> rhos(nSpecies), ws_m(nSpecies), ws_p(nSpecies);
+
+  auto rates = [&](su2double N, vector<su2double>& ws) {
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies) rhos[iSpecies] = massFrac[iSpecies] * N / N1;
+    gas.SetTDStateRhosTTv(rhos, 8000.0, 6000.0);
+    ws = gas.ComputeNetProductionRates();
+  };
+
+  /*--- The rates are continuous across both limits. ---*/
+  for (su2double N : {1e14, 1e19}) {
+    rates(N*(1-1e-10), ws_m);
+    rates(N*(1+1e-10), ws_p);
+
+    su2double scale = 0.0;
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies) scale = max(scale, fabs(ws_p[iSpecies]));
+    CHECK(scale > 0.0);
+
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; ++iSpecies)
+      CHECK(fabs(ws_p[iSpecies]-ws_m[iSpecies]) < 1e-8*scale);
+  }
+
+  delete config;
+}
+
+TEST_CASE("SU2TCLib chemistry throughput", "[.][benchmark][NEMO]") {
+
+  /*--- Not run by default, use the tag [benchmark] to run it. ---*/
+
+  using Clock = std::chrono::steady_clock;
+  CConfig* config = Air5Config();
+  CSU2TCLib gas(config, 2, false);
+
+  const unsigned long n = 200000, batchSize = 64;
+  vector<su2double> rhos, T, Tve, ws(5*n);
+  MakeStates(n, rhos, T, Tve);
+
+  auto rate = [&](Clock::time_point start) {
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+    return n / elapsed.count() / 1e6;
+  };
+
+  /*--- Point by point, through the state of the object. ---*/
+  su2double sumScalar = 0.0;
+  auto start = Clock::now();
+  vector<su2double> rhos_i(5);
+  for (auto i = 0ul; i < n; ++i) {
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies) rhos_i[iSpecies] = rhos[iSpecies*n+i];
+    gas.SetTDStateRhosTTv(rhos_i, T[i], Tve[i]);
+    sumScalar += gas.ComputeNetProductionRates()[0];
+  }
+  const double scalar = rate(start);
+
+  /*--- Batches of points gathered into species-major scratch, as in the solver. ---*/
+  su2double sumBatch = 0.0;
+  start = Clock::now();
+  su2double rhosBatch[5*batchSize], wsBatch[5*batchSize];
+  for (auto i0 = 0ul; i0 < n; i0 += batchSize) {
+    const auto m = min(batchSize, n-i0);
+    for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies)
+      for (auto i = 0ul; i < m; ++i) rhosBatch[iSpecies*m+i] = rhos[iSpecies*n+i0+i];
+    gas.ComputeNetProductionRates_Batch(m, rhosBatch, &T[i0], &Tve[i0], wsBatch);
+    for (auto i = 0ul; i < m; ++i) sumBatch += wsBatch[i];
+  }
+  const double batch = rate(start);
+
+  /*--- All threads, each with its own batches (the kernel does not modify the object). ---*/
+  start = Clock::now();
+  SU2_OMP_PARALLEL
+  {
+    su2double rhosBatch[5*batchSize];
+    SU2_OMP_FOR_STAT(1)
+    for (auto i0 = 0ul; i0 < n; i0 += batchSize) {
+      const auto m = min(batchSize, n-i0);
+      for (auto iSpecies = 0ul; iSpecies < 5; ++iSpecies)
+        for (auto i = 0ul; i < m; ++i) rhosBatch[iSpecies*m+i] = rhos[iSpecies*n+i0+i];
+      gas.ComputeNetProductionRates_Batch(m, rhosBatch, &T[i0], &Tve[i0], &ws[5*i0]);
+    }
+  }
+  const double threaded = rate(start);
+
+  CHECK(sumBatch == Approx(sumScalar));
+
+  std::cout << "AIR-5 net production rates (million points/s)\n";
+  std::cout << "Point by point  " << scalar << "\n";
+  std::cout << "Batched         " << batch << "\n";
+  std::cout << "Batched, " << omp_get_max_threads() << " threads  " << threaded << std::endl;
+
+  delete config;
+}
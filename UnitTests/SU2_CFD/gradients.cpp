@@ -31,6 +31,8 @@
 #include "../../SU2_CFD/include/solvers/CSolver.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
 #include "../../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../../SU2_CFD/include/gradients/computeGradientsAndLimiters.hpp"
+#include "../../SU2_CFD/include/limiters/computeLimiters.hpp"
 
 /*!
  * \brief Base class for gradient tests using a unit cube geometry.
@@ -163,3 +165,95 @@ TEST_CASE("LS", "[Gradients]") {
 TEST_CASE("WLS", "[Gradients]") {
   testLeastSquares<LinearFunction>(true);
 }
+
+TEST_CASE("LS matrices of the geometry", "[Gradients]") {
+  LinearFunction field;
+  auto& geometry = *field.geometry;
+  const auto nDim = geometry.GetnDim();
+  C3DDoubleMatrix R;
+  C3DDoubleMatrix gradient(geometry.GetnPoint(), field.nVar, nDim);
+
+  computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry,
+                               *field.config, true, field, 0, field.nVar, gradient, R);
+  check(field, gradient);
+
+  if (!CGeometry::SHARED_LEAST_SQUARES) return;
+
+  CHECK(geometry.GetLeastSquaresMatricesValid(true));
+  CHECK_FALSE(geometry.GetLeastSquaresMatricesValid(false));
+
+  /*--- Distort the grid, the update of the dual grid must trigger the recomputation. ---*/
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const auto coord = geometry.nodes->GetCoord(iPoint);
+    for (auto iDim = 0u; iDim < nDim; ++iDim)
+      geometry.nodes->SetCoord(iPoint, iDim, coord[iDim] + 0.02*sin(7.0*coord[(iDim+1)%nDim]));
+  }
+  geometry.SetControlVolume(field.config.get(), UPDATE);
+  CHECK_FALSE(geometry.GetLeastSquaresMatricesValid(true));
+
+  computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, geometry,
+                               *field.config, true, field, 0, field.nVar, gradient, R);
+  check(field, gradient);
+}
+
+TEST_CASE("Fused gradients and limiters", "[Gradients]") {
+  if (!CGeometry::SHARED_LEAST_SQUARES) return;
+
+  GradientTestBase base;
+  const auto& geometry = *base.geometry;
+  const auto nPoint = geometry.GetnPoint();
+  const auto nDim = geometry.GetnDim();
+  const auto nVar = 2ul;
+
+  /*--- Non-linear field, such that the limiters are active. ---*/
+
+  su2activematrix field(nPoint, nVar), fieldMin(nPoint, nVar), fieldMax(nPoint, nVar);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto coord = geometry.nodes->GetCoord(iPoint);
+    field(iPoint,0) = sin(6.0*coord[0]) * cos(4.0*coord[1]) + coord[2];
+    field(iPoint,1) = tanh(10.0*(coord[0]+coord[1]-1.0));
+  }
+
+  for (auto kindGradient : {GREEN_GAUSS, WEIGHTED_LEAST_SQUARES}) {
+    for (auto kindLimiter : {BARTH_JESPERSEN, VENKATAKRISHNAN}) {
+
+      C3DDoubleMatrix gradRef(nPoint, nVar, nDim), gradient(nPoint, nVar, nDim), R;
+      su2activematrix limRef(nPoint, nVar), limiter(nPoint, nVar);
+      su2matrix<float> limitedGradient(nPoint, nVar*nDim);
+
+      if (kindGradient == GREEN_GAUSS)
+        computeGradientsGreenGauss(nullptr, SOLUTION, PERIODIC_NONE, *base.geometry,
+                                   *base.config, field, 0, nVar, gradRef);
+      else
+        computeGradientsLeastSquares(nullptr, SOLUTION, PERIODIC_NONE, *base.geometry,
+                                     *base.config, true, field, 0, nVar, gradRef, R);
+
+      computeLimiters(kindLimiter, nullptr, SOLUTION_LIMITER, PERIODIC_NONE, PERIODIC_NONE, *base.geometry,
+                      *base.config, 0, nVar, field, gradRef, fieldMin, fieldMax, limRef);
+
+      computeGradientsAndLimiters(nullptr, SOLUTION_GRADIENT, SOLUTION_LIMITER, *base.geometry, *base.config,
+                                  kindGradient, kindLimiter, true, 0, nVar, field, gradient, limiter,
+                                  &limitedGradient);
+
+      /*--- Same results to round-off, and the single precision copy is limited. ---*/
+
+      su2double errGrad = 0.0, errLim = 0.0, errSP = 0.0, minLim = 1.0;
+      for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+        for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+          errLim = max(errLim, fabs(limiter(iPoint,iVar) - limRef(iPoint,iVar)));
+          minLim = min(minLim, limRef(iPoint,iVar));
+          for (auto iDim = 0ul; iDim < nDim; ++iDim) {
+            const su2double ref = gradRef(iPoint,iVar,iDim);
+            errGrad = max(errGrad, fabs(gradient(iPoint,iVar,iDim) - ref) / (1.0 + fabs(ref)));
+            errSP = max(errSP, fabs(limitedGradient(iPoint,iVar*nDim+iDim) - limRef(iPoint,iVar)*ref) / (1.0 + fabs(ref)));
+          }
+        }
+      }
+      CHECK(errGrad < 1e-12);
+      CHECK(errLim < 1e-12);
+      CHECK(errSP < 1e-6);
+      CHECK(minLim < 0.5);
+    }
+  }
+}
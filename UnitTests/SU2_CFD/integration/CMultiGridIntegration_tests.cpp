@@ -0,0 +1,138 @@
+/*!
+ * \file CMultiGridIntegration_tests.cpp
+ * \brief Unit tests for the multirate explicit integration of the FVM flow solvers.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include "../../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
+
+namespace {
+
+/*--- Gives access to the geometry and flow solver of the driver. ---*/
+struct CMultirateTestDriver : public CSinglezoneDriver {
+  using CSinglezoneDriver::CSinglezoneDriver;
+  CGeometry* Geometry() { return geometry_container[ZONE_0][INST_0][MESH_0]; }
+  CSolver* FlowSolver() { return solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]; }
+};
+
+/*--- Integral of the conservative variables over the domain. ---*/
+vector<su2double> TotalConservative(CGeometry* geometry, CSolver* solver) {
+  vector<su2double> total(solver->GetnVar(), 0.0);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+    for (auto iVar = 0u; iVar < solver->GetnVar(); ++iVar)
+      total[iVar] += geometry->nodes->GetVolume(iPoint) * solver->GetNodes()->GetSolution(iPoint, iVar);
+  return total;
+}
+
+}
+
+TEST_CASE("Multirate integration conserves mass and energy", "[Integration]") {
+
+  /*--- Closed box with a hot region whose smaller time step creates several levels. ---*/
+
+  const char* configName = "multirate_test.cfg";
+  {
+    std::ofstream file(configName);
+    file << "SOLVER= EULER\n"
+            "MATH_PROBLEM= DIRECT\n"
+            "MESH_FORMAT= RECTANGLE\n"
+            "MESH_BOX_SIZE= 17, 5, 0\n"
+            "MESH_BOX_LENGTH= 1, 0.25, 0\n"
+            "MESH_BOX_OFFSET= 0, 0, 0\n"
+            "MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus )\n"
+            "MACH_NUMBER= 0.3\n"
+            "CONV_NUM_METHOD_FLOW= ROE\n"
+            "MUSCL_FLOW= NO\n"
+            "TIME_DOMAIN= YES\n"
+            "TIME_MARCHING= TIME_STEPPING\n"
+            "TIME_DISCRE_FLOW= RUNGE-KUTTA_EXPLICIT\n"
+            "RK_ALPHA_COEFF= ( 0.66667, 0.66667, 1.000000 )\n"
+            "UNST_CFL_NUMBER= 0.5\n"
+            "MULTIRATE_TIME_LEVELS= 3\n"
+            "TIME_ITER= 3\n"
+            "INNER_ITER= 1\n"
+            "CONV_FILENAME= multirate_test_history\n"
+            "OUTPUT_FILES= ( RESTART_ASCII )\n"
+            "REF_ORIGIN_MOMENT_X= 0.0\n"
+            "REF_ORIGIN_MOMENT_Y= 0.0\n"
+            "REF_ORIGIN_MOMENT_Z= 0.0\n";
+  }
+
+  auto orig_buf = cout.rdbuf(nullptr);
+
+  CMultirateTestDriver driver(const_cast<char*>(configName), 1, SU2_MPI::GetComm());
+
+  auto geometry = driver.Geometry();
+  auto solver = driver.FlowSolver();
+  auto nodes = solver->GetNodes();
+  const auto nDim = geometry->GetnDim();
+
+  driver.Preprocess(0);
+
+  /*--- Nine times the internal energy (three times the speed of sound) on the left. ---*/
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    if (geometry->nodes->GetCoord(iPoint, 0) > 0.3) continue;
+    const su2double rho = nodes->GetSolution(iPoint, 0);
+    su2double kinetic = 0.0;
+    for (auto iDim = 0u; iDim < nDim; ++iDim) kinetic += 0.5 * pow(nodes->GetSolution(iPoint, iDim+1), 2) / rho;
+    const su2double rhoE = nodes->GetSolution(iPoint, nDim+1);
+    nodes->SetSolution(iPoint, nDim+1, kinetic + 9.0 * (rhoE - kinetic));
+  }
+
+  const auto initial = TotalConservative(geometry, solver);
+
+  for (unsigned long iTime = 0; iTime < 3; ++iTime) {
+    if (iTime > 0) driver.Preprocess(iTime);
+    driver.Run();
+    driver.Postprocess();
+    driver.Update();
+  }
+
+  const auto current = TotalConservative(geometry, solver);
+
+  /*--- The points were grouped in all three levels (the time step of each point is that of its level). ---*/
+
+  su2double minDt = nodes->GetDelta_Time(0), maxDt = minDt;
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    minDt = min(minDt, nodes->GetDelta_Time(iPoint));
+    maxDt = max(maxDt, nodes->GetDelta_Time(iPoint));
+  }
+
+  driver.Postprocessing();
+  cout.rdbuf(orig_buf);
+
+  std::remove(configName);
+  std::remove("multirate_test_history.csv");
+
+  CHECK(maxDt == Approx(4.0 * minDt));
+
+  /*--- The walls only contribute to the momentum. ---*/
+
+  CHECK(current[0] == Approx(initial[0]).epsilon(1e-12));
+  CHECK(current[nDim+1] == Approx(initial[nDim+1]).epsilon(1e-12));
+}
@@ -0,0 +1,135 @@
+/*!
+ * \file CNewtonIntegration_tests.cpp
+ * \brief Unit tests of the adaptive controller of the Newton-Krylov integration.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/integration/CNewtonIntegration.hpp"
+
+namespace {
+
+/*--- Default parameters {EW gamma, EW alpha, max tolerance, rebuild rate, unstable rate, max reuse}. ---*/
+CNewtonKrylovController DefaultController(su2double maxReuse = 20) {
+  CNewtonKrylovController controller;
+  controller.SetParameters({0.9, 2.0, 0.5, 1.0, 2.0, maxReuse});
+  return controller;
+}
+
+}
+
+TEST_CASE("Eisenstat-Walker forcing terms", "[Integration]") {
+
+  auto controller = DefaultController();
+  const passivedouble etaMin = 1e-8;
+
+  /*--- No previous residual, the largest tolerance is used. ---*/
+
+  CHECK(controller.ForcingTerm(1.0, etaMin) == Approx(0.5));
+
+  /*--- After a large tolerance the safeguard limits the decrease, 0.9*0.5^2. ---*/
+
+  controller.Update(true, 10, 0.5, 0.5, 1.0, 1.0, 1.0);
+  CHECK(controller.ForcingTerm(0.1, etaMin) == Approx(0.225));
+
+  /*--- Otherwise gamma*(|F_k|/|F_k-1|)^alpha, bounded by the minimum and maximum tolerances. ---*/
+
+  controller.Update(true, 10, 0.01, 0.01, 1.0, 1.0, 1.0);
+  CHECK(controller.ForcingTerm(0.1, etaMin) == Approx(0.009));
+  CHECK(controller.ForcingTerm(1e-6, etaMin) == Approx(etaMin));
+  CHECK(controller.ForcingTerm(10.0, etaMin) == Approx(0.5));
+
+  /*--- Restarted (e.g. end of the startup period). ---*/
+
+  controller.Restart();
+  CHECK(controller.ForcingTerm(0.1, etaMin) == Approx(0.5));
+  CHECK(controller.Rate(0.1) == 0.0);
+}
+
+TEST_CASE("Reuse and rebuild of the Newton-Krylov preconditioner", "[Integration]") {
+
+  auto controller = DefaultController();
+
+  /*--- Nothing to reuse initially. ---*/
+
+  CHECK(controller.RebuildNext());
+
+  /*--- Rebuild, 10 linear iterations of 0.1s, the rebuild costs 2s over a linear iteration. ---*/
+
+  controller.Update(true, 10, 1e-3, 1e-3, 1.0, 2.1, 1.0);
+  CHECK_FALSE(controller.RebuildNext());
+  CHECK(controller.GetRebuildTime() == Approx(2.0));
+  CHECK(controller.GetPrecondAge() == 0);
+
+  /*--- Reuse with 10 extra iterations (1s lost), still cheaper than rebuilding. ---*/
+
+  controller.Update(false, 20, 1e-3, 1e-3, 0.5, 0.5, 2.0);
+  CHECK_FALSE(controller.RebuildNext());
+  CHECK(controller.GetReuseTime() == Approx(1.0));
+  CHECK(controller.GetPrecondAge() == 1);
+
+  /*--- Another 1.5s lost, the accumulated 2.5s exceed the cost of the rebuild. ---*/
+
+  controller.Update(false, 25, 1e-3, 1e-3, 0.25, 0.5, 2.5);
+  CHECK(controller.RebuildNext());
+
+  /*--- The rebuild resets the costs, now measured against the explicit residual time (0.5s). ---*/
+
+  controller.Update(true, 10, 1e-3, 1e-3, 0.1, 2.5, 1.0);
+  CHECK_FALSE(controller.RebuildNext());
+  CHECK(controller.GetRebuildTime() == Approx(2.0));
+  CHECK(controller.GetReuseTime() == 0.0);
+
+  /*--- Missing the tolerance forces a rebuild. ---*/
+
+  controller.Update(false, 10, 2e-3, 1e-3, 0.05, 0.5, 1.0);
+  CHECK(controller.RebuildNext());
+
+  /*--- The residual rate that triggers an immediate rebuild. ---*/
+
+  CHECK(controller.Degraded(1.1));
+  CHECK_FALSE(controller.Degraded(0.9));
+  CHECK(controller.Rate(0.1) == Approx(2.0));
+
+  /*--- Maximum age of the preconditioner. ---*/
+
+  auto young = DefaultController(2);
+  young.Update(true, 10, 1e-3, 1e-3, 1.0, 2.1, 1.0);
+  young.Update(false, 10, 1e-3, 1e-3, 0.5, 0.5, 1.0);
+  CHECK_FALSE(young.RebuildNext());
+  young.Update(false, 10, 1e-3, 1e-3, 0.25, 0.5, 1.0);
+  CHECK(young.RebuildNext());
+}
+
+TEST_CASE("CFL signal of the Newton-Krylov controller", "[Integration]") {
+
+  const auto controller = DefaultController();
+  const passivedouble forcing = 1e-2;
+
+  CHECK(controller.CFLSignal(0.5, forcing, forcing) == CFL_ADAPT_SIGNAL::INCREASE);
+  CHECK(controller.CFLSignal(1.5, forcing, forcing) == CFL_ADAPT_SIGNAL::HOLD);
+  CHECK(controller.CFLSignal(3.0, forcing, forcing) == CFL_ADAPT_SIGNAL::REDUCE);
+  CHECK(controller.CFLSignal(0.5, 1.1*forcing, forcing) == CFL_ADAPT_SIGNAL::HOLD);
+  CHECK(controller.CFLSignal(0.5, 1.3*forcing, forcing) == CFL_ADAPT_SIGNAL::REDUCE);
+}
@@ -0,0 +1,193 @@
+/*!
+ * \file CConjugateHeatInterface_tests.cpp
+ * \brief Regression test of the conjugate heat transfer coupling between a fluid and a solid zone.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include "../../../SU2_CFD/include/drivers/CMultizoneDriver.hpp"
+
+namespace {
+
+/*--- Gives access to the containers of the driver. ---*/
+struct CCHTTestDriver : public CMultizoneDriver {
+  using CMultizoneDriver::CMultizoneDriver;
+  CConfig* Config(unsigned short iZone) { return config_container[iZone]; }
+  CGeometry* Geometry(unsigned short iZone) { return geometry_container[iZone][INST_0][MESH_0]; }
+  CSolver* Solver(unsigned short iZone, unsigned short iSol) { return solver_container[iZone][INST_0][MESH_0][iSol]; }
+};
+
+/*--- Structured quad mesh of [0,width] x [y0,y0+height] with the bottom, top, and sides markers. ---*/
+void WriteMesh(const string& fileName, unsigned long nx, unsigned long ny, su2double width, su2double y0,
+               su2double height, const string& bottom, const string& top, const string& sides) {
+  std::ofstream file(fileName);
+  auto id = [nx](unsigned long i, unsigned long j) { return j*nx+i; };
+
+  file << "NDIME= 2\nNELEM= " << (nx-1)*(ny-1) << "\n";
+  for (auto j = 0ul; j < ny-1; ++j)
+    for (auto i = 0ul; i < nx-1; ++i)
+      file << "9 " << id(i,j) << " " << id(i+1,j) << " " << id(i+1,j+1) << " " << id(i,j+1) << "\n";
+
+  file << "NPOIN= " << nx*ny << "\n" << std::setprecision(17);
+  for (auto j = 0ul; j < ny; ++j)
+    for (auto i = 0ul; i < nx; ++i)
+      file << width*i/(nx-1) << " " << y0+height*j/(ny-1) << "\n";
+
+  file << "NMARK= 3\nMARKER_TAG= " << bottom << "\nMARKER_ELEMS= " << nx-1 << "\n";
+  for (auto i = 0ul; i < nx-1; ++i) file << "3 " << id(i,0) << " " << id(i+1,0) << "\n";
+  file << "MARKER_TAG= " << top << "\nMARKER_ELEMS= " << nx-1 << "\n";
+  for (auto i = 0ul; i < nx-1; ++i) file << "3 " << id(i+1,ny-1) << " " << id(i,ny-1) << "\n";
+  file << "MARKER_TAG= " << sides << "\nMARKER_ELEMS= " << 2*(ny-1) << "\n";
+  for (auto j = 0ul; j < ny-1; ++j) file << "3 " << id(nx-1,j) << " " << id(nx-1,j+1) << "\n";
+  for (auto j = 0ul; j < ny-1; ++j) file << "3 " << id(0,j+1) << " " << id(0,j) << "\n";
+}
+
+/*--- Averages of the temperature and of the heat flux over the vertices of a marker. ---*/
+void InterfaceAverages(CCHTTestDriver& driver, unsigned short iZone, unsigned short iSol, const string& tag,
+                       su2double& temperature, su2double& heatFlux) {
+  auto config = driver.Config(iZone);
+  auto geometry = driver.Geometry(iZone);
+  auto solver = driver.Solver(iZone, iSol);
+  temperature = heatFlux = 0.0;
+
+  for (auto iMarker = 0u; iMarker < config->GetnMarker_All(); ++iMarker) {
+    if (config->GetMarker_All_TagBound(iMarker) != tag) continue;
+    const auto nVertex = geometry->GetnVertex(iMarker);
+    for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+      const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      const auto nodes = solver->GetNodes();
+      temperature += ((iSol == HEAT_SOL)? nodes->GetSolution(iPoint,0) : nodes->GetTemperature(iPoint)) / nVertex;
+      heatFlux += solver->GetHeatFlux(iMarker, iVertex) / nVertex;
+    }
+  }
+}
+
+}
+
+TEST_CASE("CHT coupling of a fluid at rest and a solid", "[Interfaces]") {
+
+  /*--- Fluid at rest in [0,0.5]x[0,1] (top at 300K), solid in [0,0.5]x[-1,0] (bottom at 400K),
+   *    adiabatic sides, the steady temperature is piecewise linear across the interface. ---*/
+
+  const su2double kFluid = 0.0257, kSolid = 0.1028, TFluid = 300.0, TSolid = 400.0;
+
+  WriteMesh("cht_test_fluid.su2", 5, 9, 0.5, 0.0, 1.0, "fluid_interface", "fluid_top", "fluid_sides");
+  WriteMesh("cht_test_solid.su2", 5, 9, 0.5, -1.0, 1.0, "solid_bottom", "solid_interface", "solid_sides");
+
+  std::ofstream("cht_test.cfg") <<
+    "SOLVER= MULTIPHYSICS\n"
+    "CONFIG_LIST= (cht_test_fluid.cfg, cht_test_solid.cfg)\n"
+    "MULTIZONE_MESH= NO\n"
+    "MARKER_ZONE_INTERFACE= (fluid_interface, solid_interface)\n"
+    "MARKER_CHT_INTERFACE= (fluid_interface, solid_interface)\n"
+    "CHT_COUPLING_METHOD= DIRECT_TEMPERATURE_ROBIN_HEATFLUX\n"
+    "TIME_DOMAIN= NO\n"
+    "OUTER_ITER= 1000\n"
+    "CONV_FIELD= BGS_TEMPERATURE[1]\n"
+    "CONV_RESIDUAL_MINVAL= -10\n"
+    "CONV_FILENAME= cht_test_history\n"
+    "OUTPUT_FILES= ( RESTART_ASCII )\n"
+    "OUTPUT_WRT_FREQ= 1000000\n";
+
+  std::ofstream("cht_test_fluid.cfg") <<
+    "SOLVER= INC_NAVIER_STOKES\n"
+    "MESH_FILENAME= cht_test_fluid.su2\n"
+    "MARKER_ISOTHERMAL= (fluid_top, 300.0)\n"
+    "MARKER_HEATFLUX= (fluid_sides, 0.0)\n"
+    "INC_DENSITY_MODEL= CONSTANT\n"
+    "INC_ENERGY_EQUATION= YES\n"
+    "INC_DENSITY_INIT= 1.0\n"
+    "INC_VELOCITY_INIT= (0.0, 0.0, 0.0)\n"
+    "INC_TEMPERATURE_INIT= 350.0\n"
+    "INC_NONDIM= DIMENSIONAL\n"
+    "SPECIFIC_HEAT_CP= 1004.703\n"
+    "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+    "MU_CONSTANT= 1.7893e-05\n"
+    "CONDUCTIVITY_MODEL= CONSTANT_CONDUCTIVITY\n"
+    "KT_CONSTANT= 0.0257\n"
+    "CONV_NUM_METHOD_FLOW= FDS\n"
+    "MUSCL_FLOW= NO\n"
+    "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+    "CFL_NUMBER= 100.0\n"
+    "LINEAR_SOLVER= FGMRES\n"
+    "LINEAR_SOLVER_PREC= ILU\n"
+    "LINEAR_SOLVER_ERROR= 1E-12\n"
+    "LINEAR_SOLVER_ITER= 20\n"
+    "INNER_ITER= 1\n"
+    "REF_ORIGIN_MOMENT_X= 0.0\n"
+    "REF_ORIGIN_MOMENT_Y= 0.0\n"
+    "REF_ORIGIN_MOMENT_Z= 0.0\n";
+
+  std::ofstream("cht_test_solid.cfg") <<
+    "SOLVER= HEAT_EQUATION\n"
+    "MESH_FILENAME= cht_test_solid.su2\n"
+    "MARKER_ISOTHERMAL= (solid_bottom, 400.0)\n"
+    "MARKER_HEATFLUX= (solid_sides, 0.0)\n"
+    "INC_NONDIM= DIMENSIONAL\n"
+    "SOLID_TEMPERATURE_INIT= 350.0\n"
+    "SOLID_DENSITY= 1.0\n"
+    "SPECIFIC_HEAT_CP= 1004.703\n"
+    "SOLID_THERMAL_CONDUCTIVITY= 0.1028\n"
+    "TIME_DISCRE_HEAT= EULER_IMPLICIT\n"
+    "CFL_NUMBER= 100.0\n"
+    "LINEAR_SOLVER= FGMRES\n"
+    "LINEAR_SOLVER_PREC= ILU\n"
+    "LINEAR_SOLVER_ERROR= 1E-12\n"
+    "LINEAR_SOLVER_ITER= 20\n"
+    "INNER_ITER= 1\n";
+
+  auto orig_buf = cout.rdbuf(nullptr);
+
+  su2double fluidT, fluidHF, solidT, solidHF;
+  {
+    CCHTTestDriver driver(const_cast<char*>("cht_test.cfg"), 2, SU2_MPI::GetComm());
+    driver.Preprocess(0);
+    driver.Run_GaussSeidel();
+
+    InterfaceAverages(driver, ZONE_0, FLOW_SOL, "fluid_interface", fluidT, fluidHF);
+    InterfaceAverages(driver, ZONE_1, HEAT_SOL, "solid_interface", solidT, solidHF);
+    driver.Postprocessing();
+  }
+  cout.rdbuf(orig_buf);
+
+  for (auto name : {"cht_test.cfg", "cht_test_fluid.cfg", "cht_test_solid.cfg", "cht_test_fluid.su2",
+                    "cht_test_solid.su2", "cht_test.csv"})
+    std::remove(name);
+
+  /*--- Reference values of the version before the hybrid parallel heat solver. ---*/
+
+  CHECK(fluidT == Approx(379.999999998361).epsilon(1e-10));
+  CHECK(solidT == Approx(379.99999999851).epsilon(1e-10));
+  CHECK(fluidHF == Approx(-2.05600000003102).epsilon(1e-10));
+  CHECK(solidHF == Approx(-2.0560000000897).epsilon(1e-10));
+
+  /*--- Steady conduction, same flux through both layers of equal thickness. ---*/
+
+  const su2double TInterface = (kSolid*TSolid + kFluid*TFluid) / (kSolid + kFluid);
+  CHECK(solidT == Approx(TInterface).epsilon(1e-8));
+  CHECK(-solidHF == Approx(kFluid*(TInterface-TFluid)).epsilon(1e-8));
+}
@@ -0,0 +1,191 @@
+/*!
+ * \file CInterface_tests.cpp
+ * \brief Unit tests (and benchmark) of the communication plan of the interface transfers.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <iomanip>
+#include "../../../Common/include/option_structure.hpp"
+#include "../../../SU2_CFD/include/interfaces/CInterface.hpp"
+
+namespace {
+
+/*--- Synthetic interface, each rank owns nLocal donor points (contiguous global indices)
+ *    and nLocal target vertices, target "g" interpolates from donors g-1, g, g+1 and a
+ *    "far" donor (g+N/2) if farDonor is true, N being the global number of points. ---*/
+struct SyntheticInterface {
+  vector<pair<unsigned long, unsigned long> > localDonor;
+  vector<unsigned long> donorStart, donorIndex;
+
+  SyntheticInterface(unsigned long nLocal, bool farDonor) {
+    const auto rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+    const auto nGlobal = nLocal * size;
+    const auto offset = nLocal * rank;
+
+    /*--- Reverse order of vertices to check the mapping. ---*/
+    for (auto i = 0ul; i < nLocal; ++i) localDonor.emplace_back(offset+i, nLocal-1-i);
+
+    donorStart.push_back(0);
+    for (auto i = 0ul; i < nLocal; ++i) {
+      const auto g = offset + i;
+      donorIndex.push_back((g + nGlobal - 1) % nGlobal);
+      donorIndex.push_back(g);
+      donorIndex.push_back((g + 1) % nGlobal);
+      if (farDonor) donorIndex.push_back((g + nGlobal/2) % nGlobal);
+      donorStart.push_back(donorIndex.size());
+    }
+  }
+
+  /*--- Value of a donor variable, known everywhere to check the transfer. ---*/
+  static su2double Value(unsigned long globalIdx, unsigned long iVar) { return 10.0*globalIdx + iVar; }
+};
+
+}
+
+TEST_CASE("Interface transfer plan", "[Interfaces]") {
+
+  const auto rank = SU2_MPI::GetRank();
+  const unsigned long nLocal = 50, nVar = 3;
+  const SyntheticInterface interface(nLocal, true);
+
+  CInterface::CTransferPlan plan;
+  plan.Build(interface.localDonor, interface.donorStart, interface.donorIndex, SU2_MPI::GetComm());
+
+  REQUIRE(plan.targetStart == interface.donorStart);
+
+  /*--- Each donor vertex is evaluated at most once. ---*/
+  auto vertices = plan.donorVertex;
+  sort(vertices.begin(), vertices.end());
+  REQUIRE(unique(vertices.begin(), vertices.end()) == vertices.end());
+
+  su2activematrix donorValues(plan.donorVertex.size(), nVar), recvValues;
+  for (auto i = 0ul; i < plan.donorVertex.size(); ++i) {
+    const auto globalIdx = nLocal*rank + nLocal-1-plan.donorVertex[i];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) donorValues(i,iVar) = SyntheticInterface::Value(globalIdx, iVar);
+  }
+
+  plan.Exchange(donorValues, recvValues);
+
+  bool allMatch = true;
+  for (auto i = 0ul; i < interface.donorIndex.size(); ++i)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar)
+      allMatch &= (recvValues(plan.targetSlot[i], iVar) == SyntheticInterface::Value(interface.donorIndex[i], iVar));
+  REQUIRE(allMatch);
+
+  plan.Free();
+}
+
+/*--- Not run by default, use e.g. "mpirun -n 16 test_driver [Benchmark]". ---*/
+TEST_CASE("Interface transfer benchmark", "[.][benchmark][Interface]") {
+
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const auto comm = SU2_MPI::GetComm();
+  const int nRepeat = 20;
+
+  if (rank == MASTER_NODE) {
+    cout << "\nInterface transfer, " << size << " ranks, average time per transfer [ms] (max over ranks).\n"
+         << setw(12) << "Points" << setw(6) << "nVar" << setw(12) << "Allgather" << setw(12) << "Plan"
+         << setw(12) << "Setup" << endl;
+  }
+
+  /*--- FSI interfaces (3 variables) and CHT interfaces (4 variables) of increasing size. ---*/
+  for (unsigned long nGlobal : {1000ul, 10000ul, 100000ul, 1000000ul}) {
+    for (unsigned long nVar : {3ul, 4ul}) {
+
+      const auto nLocal = max(1ul, nGlobal / size);
+      const SyntheticInterface interface(nLocal, false);
+
+      su2activematrix localValues(nLocal, nVar);
+      for (auto i = 0ul; i < nLocal; ++i)
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          localValues(i, iVar) = SyntheticInterface::Value(interface.localDonor[i].first, iVar);
+
+      su2double check[2] = {0.0, 0.0};
+
+      /*--- Previous strategy, gather all donors everywhere and search. ---*/
+
+      SU2_MPI::Barrier(comm);
+      passivedouble time0 = SU2_MPI::Wtime();
+
+      for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat) {
+        int nLocalDonor = nLocal;
+        vector<int> nAll(size), nAllVar(size), displ(size,0), displVar(size,0);
+        SU2_MPI::Allgather(&nLocalDonor, 1, MPI_INT, nAll.data(), 1, MPI_INT, comm);
+        for (int i = 0; i < size; ++i) {
+          if (i) displ[i] = displ[i-1] + nAll[i-1];
+          nAllVar[i] = nAll[i] * nVar;
+          displVar[i] = displ[i] * nVar;
+        }
+        vector<unsigned long> sendIdx(nLocal), donorIdx(displ.back()+nAll.back());
+        for (auto i = 0ul; i < nLocal; ++i) sendIdx[i] = interface.localDonor[i].first;
+        su2activematrix donorVar(donorIdx.size(), nVar);
+
+        SU2_MPI::Allgatherv(sendIdx.data(), nLocal, MPI_UNSIGNED_LONG, donorIdx.data(),
+                            nAll.data(), displ.data(), MPI_UNSIGNED_LONG, comm);
+        SU2_MPI::Allgatherv(localValues.data(), localValues.size(), MPI_DOUBLE, donorVar.data(),
+                            nAllVar.data(), displVar.data(), MPI_DOUBLE, comm);
+
+        /*--- The indices are already sorted here, the old code also sorted them. ---*/
+        for (const auto globalIdx : interface.donorIndex) {
+          const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), globalIdx) - donorIdx.begin();
+          check[0] += donorVar(idx, 0);
+        }
+      }
+      passivedouble time1 = SU2_MPI::Wtime();
+
+      /*--- Neighbour-only exchange. ---*/
+
+      CInterface::CTransferPlan plan;
+      plan.Build(interface.localDonor, interface.donorStart, interface.donorIndex, comm);
+
+      SU2_MPI::Barrier(comm);
+      passivedouble time2 = SU2_MPI::Wtime();
+
+      su2activematrix donorValues(plan.donorVertex.size(), nVar), recvValues;
+      for (int iRepeat = 0; iRepeat < nRepeat; ++iRepeat) {
+        for (auto i = 0ul; i < plan.donorVertex.size(); ++i)
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            donorValues(i, iVar) = localValues(nLocal-1-plan.donorVertex[i], iVar);
+
+        plan.Exchange(donorValues, recvValues);
+
+        for (const auto slot : plan.targetSlot) check[1] += recvValues(slot, 0);
+      }
+      passivedouble time3 = SU2_MPI::Wtime();
+      plan.Free();
+
+      REQUIRE(check[0] == check[1]);
+
+      passivedouble times[] = {time1-time0, time3-time2, time2-time1}, maxTimes[3];
+      SU2_MPI::Allreduce(times, maxTimes, 3, MPI_DOUBLE, MPI_MAX, comm);
+
+      if (rank == MASTER_NODE) {
+        cout << setw(12) << nLocal*size << setw(6) << nVar << fixed << setprecision(4)
+             << setw(12) << 1e3*maxTimes[0]/nRepeat << setw(12) << 1e3*maxTimes[1]/nRepeat
+             << setw(12) << 1e3*maxTimes[2] << endl;
+      }
+    }
+  }
+}
@@ -0,0 +1,153 @@
+/*!
+ * \file CEulerSolver_tests.cpp
+ * \brief Solution level tests of the options of the compressible flow solver.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include "../../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
+#include "../../../SU2_CFD/include/variables/CEulerVariable.hpp"
+
+namespace {
+
+/*--- Gives access to the geometry and flow solver of the driver. ---*/
+struct CEulerTestDriver : public CSinglezoneDriver {
+  using CSinglezoneDriver::CSinglezoneDriver;
+  CGeometry* Geometry(unsigned short iMesh = MESH_0) { return geometry_container[ZONE_0][INST_0][iMesh]; }
+  CSolver* FlowSolver(unsigned short iMesh = MESH_0) { return solver_container[ZONE_0][INST_0][iMesh][FLOW_SOL]; }
+};
+
+/*--- Shock tube like problem in a closed box (high pressure on the left), 30 multigrid iterations with
+ *    second order upwind fluxes and the Venkatakrishnan limiter, returns the conservative variables. ---*/
+su2matrix<su2double> RunShockTube(const string& options, unsigned long& nSPCoarse) {
+
+  const char* configName = "euler_solver_test.cfg";
+  {
+    std::ofstream file(configName);
+    file << "SOLVER= EULER\n"
+            "MATH_PROBLEM= DIRECT\n"
+            "MESH_FORMAT= RECTANGLE\n"
+            "MESH_BOX_SIZE= 33, 5, 0\n"
+            "MESH_BOX_LENGTH= 1, 0.125, 0\n"
+            "MESH_BOX_OFFSET= 0, 0, 0\n"
+            "MARKER_EULER= ( x_minus, x_plus, y_minus, y_plus )\n"
+            "MACH_NUMBER= 0.1\n"
+            "CONV_NUM_METHOD_FLOW= ROE\n"
+            "NUM_METHOD_GRAD_RECON= GREEN_GAUSS\n"
+            "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+            "VENKAT_LIMITER_COEFF= 0.05\n"
+            "FUSED_GRADIENT_LIMITER= YES\n"
+            "MGLEVEL= 1\n"
+            "MGCYCLE= V_CYCLE\n"
+            "TIME_DOMAIN= NO\n"
+            "TIME_DISCRE_FLOW= RUNGE-KUTTA_EXPLICIT\n"
+            "RK_ALPHA_COEFF= ( 0.66667, 0.66667, 1.000000 )\n"
+            "CFL_NUMBER= 0.5\n"
+            "ITER= 30\n"
+            "CONV_FILENAME= euler_solver_test_history\n"
+            "OUTPUT_FILES= ( RESTART_ASCII )\n"
+            "OUTPUT_WRT_FREQ= 1000000\n"
+            "REF_ORIGIN_MOMENT_X= 0.0\n"
+            "REF_ORIGIN_MOMENT_Y= 0.0\n"
+            "REF_ORIGIN_MOMENT_Z= 0.0\n" << options;
+  }
+
+  auto orig_buf = cout.rdbuf(nullptr);
+
+  su2matrix<su2double> solution;
+  {
+    CEulerTestDriver driver(const_cast<char*>(configName), 1, SU2_MPI::GetComm());
+
+    auto geometry = driver.Geometry();
+    auto nodes = driver.FlowSolver()->GetNodes();
+    const auto nDim = geometry->GetnDim();
+
+    /*--- The single precision gradients are only allocated on the fine grid. ---*/
+    nSPCoarse = static_cast<CEulerVariable*>(driver.FlowSolver(MESH_1)->GetNodes())->GetLimited_Gradient_SP().size();
+
+    driver.Preprocess(0);
+
+    /*--- Ten times the pressure on the left. ---*/
+
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      if (geometry->nodes->GetCoord(iPoint, 0) > 0.5) continue;
+      const su2double rho = nodes->GetSolution(iPoint, 0);
+      su2double kinetic = 0.0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) kinetic += 0.5 * pow(nodes->GetSolution(iPoint, iDim+1), 2) / rho;
+      const su2double rhoE = nodes->GetSolution(iPoint, nDim+1);
+      nodes->SetSolution(iPoint, nDim+1, kinetic + 10.0 * (rhoE - kinetic));
+    }
+
+    driver.Run();
+
+    solution = nodes->GetSolution();
+    driver.Postprocessing();
+  }
+  cout.rdbuf(orig_buf);
+
+  std::remove(configName);
+  std::remove("euler_solver_test_history.csv");
+
+  return solution;
+}
+
+/*--- Largest difference between two solutions, relative to the range of each variable of the first. ---*/
+su2double MaxRelativeDifference(const su2matrix<su2double>& a, const su2matrix<su2double>& b) {
+  su2double maxDiff = 0.0;
+  for (auto iVar = 0ul; iVar < a.cols(); ++iVar) {
+    su2double minVal = a(0,iVar), maxVal = minVal, diff = 0.0;
+    for (auto iPoint = 0ul; iPoint < a.rows(); ++iPoint) {
+      minVal = min(minVal, a(iPoint,iVar));
+      maxVal = max(maxVal, a(iPoint,iVar));
+      diff = max(diff, fabs(a(iPoint,iVar) - b(iPoint,iVar)));
+    }
+    maxDiff = max(maxDiff, diff / (maxVal - minVal));
+  }
+  return maxDiff;
+}
+
+}
+
+TEST_CASE("Single precision MUSCL gradients", "[Solvers]") {
+
+  unsigned long nSPCoarse = 0;
+
+  const auto reference = RunShockTube("MUSCL_FLOW= YES\nMUSCL_SINGLE_PRECISION= NO\n", nSPCoarse);
+  const auto singlePrec = RunShockTube("MUSCL_FLOW= YES\nMUSCL_SINGLE_PRECISION= YES\n", nSPCoarse);
+  CHECK(nSPCoarse == 0);
+
+  const auto firstOrder = RunShockTube("MUSCL_FLOW= NO\nMUSCL_SINGLE_PRECISION= NO\n", nSPCoarse);
+
+  /*--- The single precision gradients only add round-off to the solution, which is orders of
+   *    magnitude below the effect of the reconstruction itself. ---*/
+
+  const su2double errSP = MaxRelativeDifference(reference, singlePrec);
+  const su2double err1stOrder = MaxRelativeDifference(reference, firstOrder);
+
+  CHECK(errSP > 0.0);
+  CHECK(errSP < 1e-6);
+  CHECK(errSP < 1e-5 * err1stOrder);
+}
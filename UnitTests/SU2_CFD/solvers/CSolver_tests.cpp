@@ -0,0 +1,114 @@
+/*!
+ * \file CSolver_tests.cpp
+ * \brief Unit tests of the active set (frozen points) shared by the flow and turbulence solvers.
+ * \author agent
+ * \version 7.1.1 "Blackbird"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2020, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../UnitQuadTestCase.hpp"
+
+TEST_CASE("Active set of the flow and turbulence solvers", "[Solvers]") {
+
+  UnitQuadTestCase test;
+  test.config_options =
+      "SOLVER= RANS\n"
+      "KIND_TURB_MODEL= SA\n"
+      "MESH_FORMAT= BOX\n"
+      "MACH_NUMBER= 0.5\n"
+      "REYNOLDS_NUMBER= 1E6\n"
+      "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n"
+      "MARKER_CUSTOM= ( x_minus, x_plus, z_plus, z_minus)\n"
+      "MESH_BOX_SIZE= 5,5,5\n"
+      "MESH_BOX_LENGTH= 1,1,1\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+      "TIME_DISCRE_TURB= EULER_IMPLICIT\n"
+      "ACTIVE_SET= YES\n"
+      "ACTIVE_SET_THRESHOLD= -2.0\n"
+      "ACTIVE_SET_FREQUENCY= 10\n"
+      "REF_ORIGIN_MOMENT_X= 0.0\n"
+      "REF_ORIGIN_MOMENT_Y= 0.0\n"
+      "REF_ORIGIN_MOMENT_Z= 0.0\n";
+  test.InitConfig();
+  test.InitGeometry();
+  test.InitSolver();
+
+  auto config = test.config.get();
+  auto geometry = test.geometry.get();
+  auto flow = test.solver[FLOW_SOL];
+  auto turb = test.solver[TURB_SOL];
+  const auto nPoint = geometry->GetnPointDomain();
+
+  /*--- Converged everywhere except the flow at point 0 and the turbulence at point 1. ---*/
+
+  const su2double small = 1e-8;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    flow->GetNodes()->SetDelta_Time(iPoint, 1.0);
+    flow->GetNodes()->SetLocalCFL(iPoint, 1.0);
+    turb->GetNodes()->SetLocalCFL(iPoint, 1.0);
+    for (auto iVar = 0u; iVar < flow->GetnVar(); ++iVar)
+      flow->LinSysRes(iPoint,iVar) = (iPoint == 0)? 1.0 : small;
+    for (auto iVar = 0u; iVar < turb->GetnVar(); ++iVar)
+      turb->LinSysRes(iPoint,iVar) = (iPoint == 1)? 1.0 : small;
+  }
+
+  /*--- Full sweep, the turbulence solver runs after the flow solver. ---*/
+
+  config->SetInnerIter(0);
+  flow->SetSkipFrozen(config);
+  turb->SetSkipFrozen(config);
+  flow->PrepareImplicitIteration(geometry, test.solver, config);
+  turb->PrepareImplicitIteration(geometry, test.solver, config);
+
+  CHECK_FALSE(flow->GetNodes()->GetFrozen(0));
+  CHECK_FALSE(flow->GetNodes()->GetFrozen(1));
+  unsigned long nFrozen = 0;
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) nFrozen += flow->GetNodes()->GetFrozen(iPoint);
+  CHECK(nFrozen == nPoint-2);
+
+  /*--- Partial sweep without residuals in the active points, the RMS residuals are
+   *    those stored for the frozen points, point 1 no longer contributes to the flow. ---*/
+
+  config->SetInnerIter(1);
+  flow->SetSkipFrozen(config);
+  turb->SetSkipFrozen(config);
+  flow->LinSysRes.SetValZero();
+  turb->LinSysRes.SetValZero();
+  flow->PrepareImplicitIteration(geometry, test.solver, config);
+  turb->PrepareImplicitIteration(geometry, test.solver, config);
+
+  const su2double expected = small * sqrt(su2double(nPoint-2) / nPoint);
+  for (auto iVar = 0u; iVar < flow->GetnVar(); ++iVar)
+    CHECK(flow->GetRes_RMS(iVar) == Approx(expected).epsilon(1e-10));
+  for (auto iVar = 0u; iVar < turb->GetnVar(); ++iVar)
+    CHECK(turb->GetRes_RMS(iVar) == Approx(expected).epsilon(1e-10));
+
+  /*--- The active set is only updated by full sweeps. ---*/
+
+  CHECK_FALSE(flow->GetNodes()->GetFrozen(1));
+  CHECK(flow->GetNodes()->GetFrozen(2));
+
+  delete turb;
+  test.solver[TURB_SOL] = nullptr;
+}